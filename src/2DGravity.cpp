@@ -19,7 +19,19 @@
 #include <vector>
 #include <ctime>
 #include <random>
+#include <string>
+#include <thread>
 #include "vector2d.h"
+#include "SimRandom.h"
+#include "SimReplay.h"
+#include "ScenePlacement.h"
+#include "SimSnapshot.h"
+#include "CircleRenderer.h"
+#include "TextRenderer.h"
+#include "SoftRenderer.h"
+#include "GLRenderer.h"
+#include "RenderCommands.h"
+#include "Camera.h"
 
 using namespace std;
 
@@ -47,15 +59,22 @@ int circleSections = 30;
 
 const int winWidth = 800;
 const int winHeight = 600;
-const double ratio = (float)winHeight / (float)winWidth;
+const double aspectRatio = (float)winHeight / (float)winWidth;
 const double WorldWidth = 100.0; // 50 meter wide
-const double WorldHeight = WorldWidth * ratio; // 
+const double WorldHeight = WorldWidth * aspectRatio; // 
 int width = 0, height = 0;
 
 
 static double clocktime = 0.f;
 int framerate = 30;
 
+SimRandom gRandom;	// every random number of the scene is drawn from here
+bool gRecordReplay = false;	// record the next run into gReplayFile
+bool gPlayReplay = false;	// play the next run back from gReplayFile
+const char *gReplayFile = "2DGravity.rpl";
+const char *gCheckpointFile = "2DGravity.snp";
+const int checkpointSteps = 30;	// about once a second while checkpointing is on
+
 struct Circle2D
 {
 	Vector2d<double> pos, vel, acc;
@@ -76,114 +95,46 @@ struct Circle2D
 		red = g;
 		blue = b;
 	}
-
-
-	// draws a hollow circle centered at (cx, cy) and with radius r, using num_segments triangle segments.
-	// It rotates the circle by iAngle as well.
-	void DrawCircle(double angle, int num_segments)
-	{
-		double theta = 2. * PI / double(num_segments);
-		double c = cos(theta);//precalculate the sine and cosine
-		double s = sin(theta);
-
-		double x = radius;//we start at angle = 0 
-		double y = 0.;
-		double t = x;
-		x = cos(angle) * x - sin(angle) * y;
-		y = sin(angle) * t + cos(angle) * y;
-
-		glLineWidth(2);
-		glBegin(GL_LINE_LOOP);
-		glColor3ub(red, green, blue);
-		for (int i = 0; i < num_segments; i++)
-		{
-			glVertex2d(x + pos.x, y + pos.y);
-
-			//apply the rotation matrix
-			t = x;
-			x = c * x - s * y;
-			y = s * t + c * y;
-		}
-		glEnd();
-	}
-
-	// draws a solid circle centered at (cx, cy) and with radius r, using num_segments triangle segments.
-	// It rotates the circle by iAngle as well.
-	void DrawSolidCircle(double angle, int num_segments)
-	{
-		double theta = 2. * PI / double(num_segments);
-		double c = cos(theta);//precalculate the sine and cosine
-		double s = sin(theta);
-
-		double x = radius;//we start at angle = 0 
-		double y = 0;
-		double t = x;
-		double sx = cos(angle) * x - sin(angle) * y;
-		double sy = sin(angle) * t + cos(angle) * y;
-		x = sx; y = sy;
-
-		glLineWidth(2);
-		glBegin(GL_TRIANGLE_FAN);
-		glColor3ub(red, green, blue);
-		glVertex2d(pos.x, pos.y);
-		for (int i = 0; i < num_segments; i++)
-		{
-			glVertex2d(x + pos.x, y + pos.y);//output vertex 
-
-			//apply the rotation matrix
-			t = x;
-			x = c * x - s * y;
-			y = s * t + c * y;
-		}
-
-		glVertex2d(sx + pos.x, sy + pos.y);
-		glEnd();
-	}
 };
 
 vector< Circle2D> simBalls;
-bool isInside(double x, double y)
-{
-	Vector2d<double> test(x, y);
-	for (auto &ball : simBalls)
-	{
-		if ((test - ball.pos).LengthSq() <= (2.0*ball.radius)*(2.0*ball.radius))
-			return true;
-	}
-	return false;
-}
+CircleRenderer gCircles(circleSections);	// every ball in one draw call
+TextRenderer gText(YsFont8x12, 8, 12);	// all menu text in one draw call
+GLRenderer gDevice;
+CommandBuffer gFrame(winWidth, winHeight);	// the frame renderScene() records and replays
 //////////////////////////////////////////////////////////////
-double gausianRandomMass(double average, double dev)
+double clampMass(double average, double dev, double rawRand)
 {
-	std::random_device rd;
-	std::mt19937 e2(rd());
-	std::normal_distribution<double> dist(average, dev);
-	double rawRand = round(dist(e2));
-	return min(average + dev, rawRand);
+	return min(average + dev, round(rawRand));
 }
 ///////////////////////////////////////////////////////////////
 void initPhysics(double rad, double speed, double angle)
 {
 	simBalls.clear();
 	simBalls.reserve(gBallCount);
-	srand(time(0));
-	for (int i = 0; i < gBallCount; i++)
+	gRandom.setSeed(gRandom.getSeed()); // restart the sequence so a replay sees the same scene
+
+	// non-overlapping positions from the placement grid, then the per-ball
+	// speeds and masses in two batches
+	vector<double> xs, ys;
+	int count = placeRandom(gRandom, WorldWidth, WorldHeight, 2.0 * rad, gBallCount, xs, ys);
+	if (count < gBallCount)
+		printf("initPhysics: room for %d of %d balls only\n", count, gBallCount);
+	vector<double> speeds(count), masses(count);
+	gRandom.fillNormal(speeds.data(), count, speed, speed / 20.);
+	gRandom.fillNormal(masses.data(), count, gAverageMass, gAverageMass / 15.);
+
+	for (int i = 0; i < count; i++)
 	{
-		double x = rand() % (int)WorldWidth;
-		double y = rand() % (int)WorldHeight;
-		if (isInside(x, y))
-		{
-			i--;
-			continue;
-		}
-		double vx = rand() % (int)speed - speed;
-		double vy = rand() % (int)speed - speed;
+		double vx = gRandom.uniform(-speed, 0.0);
+		double vy = gRandom.uniform(-speed, 0.0);
 		Vector2d<double> vel(vx, vy);
 		double pSpeed = vel.Length();
-		double speedDist = gausianRandomMass(speed, speed / 20.);
-		vel = vel *(speedDist / pSpeed);
-		double mass = gausianRandomMass(gAverageMass, gAverageMass/15.);
-		simBalls.push_back(std::move(Circle2D(x, y, rad, mass, vel, 128 + i, 2 * i, 20 * i)));
+		double speedDist = clampMass(speed, speed / 20., speeds[i]);
+		if (pSpeed > 0.0)
+			vel = vel *(speedDist / pSpeed);
+		double mass = clampMass(gAverageMass, gAverageMass / 15., masses[i]);
+		simBalls.push_back(std::move(Circle2D(xs[i], ys[i], rad, mass, vel, 128 + i, 2 * i, 20 * i)));
 	}
 	clocktime = 0.f;
 	//	printf("initPhysics: ball(%f, %f)\n", simBall1.cx, simBall1.cy);
@@ -218,6 +169,13 @@ int Menu(void)
 		case FSKEY_RIGHT:
 			radius = min(5.0, radius + 0.2);
 			break;
+		case FSKEY_R:
+			gRecordReplay = !gRecordReplay;
+			break;
+		case FSKEY_P:
+			gPlayReplay = true;
+			r = eStart;
+			break;
 		}
 
 		if (r == eStop)
@@ -233,23 +191,25 @@ int Menu(void)
 
 		glClearColor(0.0,0.0,0.0,0.0);
 		glClear(GL_COLOR_BUFFER_BIT);
-		glColor3ub(127,127,127);
 
 		char sSpeed[128];
 		sprintf_s(sSpeed, "Current planet speed is %f m/s. Use Up/Down keys to change it!\n", iSpeed);
 		char sAngle[128];
 		sprintf_s(sAngle, "Current planet radius is %f meter. Use Left/Right keys to change it!\n", radius);
-		glColor3ub(255,255,255);
-		glRasterPos2i(32,32);
-		glCallLists(strlen(sSpeed),GL_UNSIGNED_BYTE,sSpeed);
-		glRasterPos2i(32,64);
-		glCallLists(strlen(sAngle),GL_UNSIGNED_BYTE,sAngle);
+		gText.clear();
+		gText.add(32, 32, sSpeed, 255, 255, 255);
+		gText.add(32, 64, sAngle, 255, 255, 255);
 		const char *msg1="S.....Start Simulation";
 		const char *msg2="ESC...Exit";
-		glRasterPos2i(32,96);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
-		glRasterPos2i(32,128);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		const char *msg3=(gRecordReplay ? "R.....Record the run (ON)" : "R.....Record the run (OFF)");
+		const char *msg4="P.....Play back the recorded run";
+		const char *msg5="C/L...In the run: checkpoints on/off, load the last one";
+		gText.add(32, 96, msg1, 255, 255, 255);
+		gText.add(32, 128, msg3, 255, 255, 255);
+		gText.add(32, 160, msg4, 255, 255, 255);
+		gText.add(32, 192, msg5, 255, 255, 255);
+		gText.add(32, 224, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -259,12 +219,18 @@ int Menu(void)
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-void renderScene()
+// world units to clip space, for the balls in the window and in -render
+Matrix4 worldProjection()
 {
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity();
-	gluOrtho2D(0., WorldWidth, 0., (GLdouble)WorldHeight);
+	return orthoMatrix(0.f, float(WorldWidth), 0.f, float(WorldHeight), -1.f, 1.f);
+}
+
+// records one frame without the balls, for the window and for -render alike;
+// the balls are one batch that each path draws its own way (see below)
+void recordScene(CommandBuffer &frame)
+{
+	const RenderColor black = { 0, 0, 0, 0 };
+	frame.clear(CLEAR_COLOR | CLEAR_DEPTH, black);
 
 	////////////////////////// Drawing The Coordinate Plane Starts Here.
 	// We Will Draw Horizontal And Vertical Lines With A Space Of 1 Meter Between Them.
@@ -286,20 +252,47 @@ void renderScene()
 	}
 	glEnd(); */
 	/////////////////////////// Drawing The Coordinate Plane Ends Here.
+}
 
-	/////////////////////////draw the hallow 2d disc /////////////
+// every ball into gCircles, for either path
+void addBalls()
+{
+	gCircles.clear();
 	for (auto &w : simBalls)
-	{
-		w.DrawSolidCircle(0, circleSections);
-	}
+		gCircles.addSolid(float(w.pos.x), float(w.pos.y), float(w.radius), w.red, w.green, w.blue);
+}
+
+// a whole -render frame: the balls go into the buffer as triangles, which
+// is what a SoftRenderer needs anyway
+void recordFrame(CommandBuffer &frame)
+{
+	recordScene(frame);
+	addBalls();
+	gCircles.draw(frame, worldProjection());
+}
+
+void renderScene()
+{
+	gFrame.reset();
+	recordScene(gFrame);
+	gFrame.replay(gDevice);
+
+	// the balls skip the buffer: expanded into triangles there they would cost
+	// segments * 3 vertices each, where the instanced path sends one instance
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadMatrixf(worldProjection().get());
+	addBalls();
+	gCircles.draw();
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
 
 	///////////// draw the overlay HUD /////////////////////
-	glColor3ub(127, 127, 127);
 	char str[256];
-//	sprintf(str, "# of Balls=%d, frame rate=%d", gBallCount, framerate);
-//	glRasterPos2i(64, 64);
-//	glCallLists(strlen(str), GL_UNSIGNED_BYTE, str);
-	printf("# of Balls=%d, frame rate=%d\n", gBallCount, framerate);
+	sprintf(str, "# of Balls=%d, frame rate=%d", gBallCount, framerate);
+	gText.clear();
+	gText.add(64, 64, str, 127, 127, 127);
+	gText.draw();
 
 	FsSwapBuffers();
 }
@@ -313,9 +306,10 @@ void updateNumPhysics(double timeInc)
 	for (auto &ball : simBalls)
 		ball.acc.set(0.0, 0.0);
 
-	for (int i = 0; i < gBallCount; i++)
+	int count = (int)simBalls.size(); // placement may have found room for fewer than gBallCount
+	for (int i = 0; i < count; i++)
 	{
-		for (int j = i + 1; j < gBallCount; j++)
+		for (int j = i + 1; j < count; j++)
 		{
 			Circle2D &balli = simBalls[i];
 			Circle2D &ballj = simBalls[j];
@@ -370,6 +364,198 @@ void updateNumPhysics(double timeInc)
 
 }
 
+///////////////////////////////////////////////////////////////////
+// the scene parameters are stored at the head of a replay log
+void beginReplay(ReplayRecorder &recorder)
+{
+	double params[3] = { iSpeed, radius, (double)gBallCount };
+	recorder.begin(gReplayFile, gRandom.getSeed(), params, 3);
+}
+
+bool loadReplay(ReplayPlayer &player, const char *fileName)
+{
+	if (!player.open(fileName) || player.getParamCount() < 3)
+		return false;
+	gRandom.setSeed(player.getSeed());
+	iSpeed = player.getParam(0);
+	radius = player.getParam(1);
+	gBallCount = (int)player.getParam(2);
+	return true;
+}
+
+// FNV-1a hash of the ball states, used to check that two runs match bit for bit
+unsigned int stateChecksum()
+{
+	unsigned int hash = 2166136261u;
+	for (auto &ball : simBalls)
+	{
+		const unsigned char *bytes[2] = { (const unsigned char *)&ball.pos, (const unsigned char *)&ball.vel };
+		for (int k = 0; k < 2; k++)
+			for (size_t i = 0; i < sizeof(Vector2d<double>); i++)
+				hash = (hash ^ bytes[k][i]) * 16777619u;
+	}
+	return hash;
+}
+
+// checkpoints hold everything the step loop reads: balls, clock and RNG
+const unsigned int tagBalls = SNAPSHOT_TAG('B', 'A', 'L', 'L');
+const unsigned int tagClock = SNAPSHOT_TAG('C', 'L', 'O', 'K');
+const unsigned int tagRandom = SNAPSHOT_TAG('R', 'A', 'N', 'D');
+
+void captureState(SnapshotState &state)
+{
+	state.addArray(tagBalls, simBalls.data(), simBalls.size());
+	state.addValue(tagClock, clocktime);
+	state.addValue(tagRandom, gRandom.getState());
+}
+
+bool restoreState(const char *fileName)
+{
+	SnapshotState state;
+	vector<Circle2D> balls;
+	double clock;
+	SimRandom::State rng;
+	if (!loadSnapshot(fileName, state) || !state.getArray(tagBalls, balls) ||
+		!state.getValue(tagClock, clock) || !state.getValue(tagRandom, rng))
+		return false;
+	simBalls.swap(balls);
+	clocktime = clock;
+	gRandom.setState(rng);
+	return true;
+}
+
+// re-simulates a recorded run without a window, as fast as possible
+int ReplayHeadless(const char *fileName)
+{
+	ReplayPlayer player;
+	if (!loadReplay(player, fileName))
+		return 1;
+	initPhysics(radius, iSpeed, iAngle);
+
+	unsigned int stepMs;
+	int key, steps = 0;
+	clock_t start = clock();
+	while (player.next(stepMs, key) && key != FSKEY_ESC)
+	{
+		double timeInc = (double)stepMs * 0.001;
+		clocktime += timeInc;
+		updateNumPhysics(timeInc);
+		steps++;
+	}
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("Replayed %d steps of %d balls in %f s, state checksum %08x\n", steps, (int)simBalls.size(), seconds, stateChecksum());
+	return 0;
+}
+
+struct RenderSteps
+{
+	ReplayPlayer *player;
+	int every;
+};
+
+// the simulation side of -render: steps the replay and records every nth step
+static void recordReplaySteps(FrameQueue &queue, const RenderSteps &run)
+{
+	unsigned int stepMs;
+	int key, steps = 0;
+	while (run.player->next(stepMs, key) && key != FSKEY_ESC)
+	{
+		double timeInc = (double)stepMs * 0.001;
+		clocktime += timeInc;
+		updateNumPhysics(timeInc);
+		if (steps++ % run.every != 0)
+			continue;
+		recordFrame(queue.record());
+		queue.publish();
+	}
+	queue.close();
+}
+
+// replays a recorded run without a window and renders every nth step on the CPU:
+//   -render file.rpl [out=prefix] [every=n] [width=n] [height=n] [threads=n] [commands=file.txt]
+// writes prefix00000.png, ... (prefix.ppm names give PPM) and prints a checksum per frame;
+// the steps run on a thread of their own, recording frame N+1 while frame N is rendered,
+// and commands= dumps the command buffer of every frame as text
+int RenderReplay(const char *fileName, int argc, char *argv[])
+{
+	const char *prefix = "frame";
+	const char *extension = ".png";
+	const char *commandFile = NULL;
+	int every = 1, wid = 800, hei = 600, threads = 0;
+	for (int i = 0; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		if (strncmp(arg, "out=", 4) == 0)
+			prefix = arg + 4;
+		else if (strncmp(arg, "every=", 6) == 0)
+			every = atoi(arg + 6);
+		else if (strncmp(arg, "width=", 6) == 0)
+			wid = atoi(arg + 6);
+		else if (strncmp(arg, "height=", 7) == 0)
+			hei = atoi(arg + 7);
+		else if (strncmp(arg, "threads=", 8) == 0)
+			threads = atoi(arg + 8);
+		else if (strncmp(arg, "commands=", 9) == 0)
+			commandFile = arg + 9;
+		else
+			printf("render: unknown argument %s\n", arg);
+	}
+	string base(prefix);
+	if (base.size() > 4 && (base.compare(base.size() - 4, 4, ".ppm") == 0 || base.compare(base.size() - 4, 4, ".png") == 0))
+	{
+		extension = base.compare(base.size() - 4, 4, ".ppm") == 0 ? ".ppm" : ".png";
+		base.resize(base.size() - 4);
+	}
+	if (every <= 0 || wid <= 0 || hei <= 0)
+	{
+		printf("render: nothing to render\n");
+		return 1;
+	}
+
+	ReplayPlayer player;
+	if (!loadReplay(player, fileName))
+		return 1;
+	initPhysics(radius, iSpeed, iAngle);
+
+	FILE *commands = NULL;
+	if (commandFile != NULL && (commands = fopen(commandFile, "w")) == NULL)
+		printf("render: cannot write %s\n", commandFile);
+
+	SoftRenderer target(wid, hei, threads);
+	FrameQueue queue(&target);
+	RenderSteps run = { &player, every };
+	std::thread producer(recordReplaySteps, std::ref(queue), std::cref(run));
+	int frames = 0, draws = 0;
+	double renderSeconds = 0.0;
+	while (const CommandBuffer *frame = queue.acquire())
+	{
+		clock_t start = clock();
+		frame->replay(target);
+		renderSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+		draws += frame->getStats().draws;
+		if (commands)
+		{
+			fprintf(commands, "frame %d\n", frames);
+			frame->write(commands);
+		}
+		queue.release();
+
+		char name[1024];
+		sprintf(name, "%s%05d%s", base.c_str(), frames, extension);
+		if (!target.saveImage(name))
+			printf("render: cannot write %s\n", name);
+		printf("%s step %d checksum %08x\n", name, frames * every, target.checksum());
+		frames++;
+	}
+	producer.join();
+	if (commands)
+		fclose(commands);
+	printf("Rendered %d frames of %d balls at %dx%d on %d threads, %.2f ms and %.1f draws per frame\n", frames,
+		(int)simBalls.size(), wid, hei, target.getThreadCount(), frames ? 1000.0 * renderSeconds / frames : 0.0,
+		frames ? (double)draws / frames : 0.0);
+	return 0;
+}
+
 ///////////////////////////////////////////////////////////////////
 int Game(void)
 {
@@ -379,6 +565,20 @@ int Game(void)
 	//////////// initial setting up the scene ////////////////////////////////////////
 	int timeSpan = 33; // milliseconds
 	double timeInc = (double)timeSpan * 0.001; // time increment in seconds
+
+	ReplayRecorder recorder;
+	ReplayPlayer player;
+	SnapshotWriter checkpoints;
+	bool checkpointing = false;
+	int steps = 0;
+	bool playing = gPlayReplay && loadReplay(player, gReplayFile);
+	gPlayReplay = false;
+	if (!playing)
+	{
+		gRandom.setSeed(SimRandom::makeSeed());
+		if (gRecordReplay)
+			beginReplay(recorder);
+	}
 	
 	initPhysics(radius, iSpeed, iAngle);
 
@@ -395,10 +595,41 @@ int Game(void)
 		int key=FsInkey();
 		if(key == FSKEY_ESC)
 			break;
-		timeInc = (double)(passedTime) * 0.001;
+		unsigned int stepMs = passedTime;
+		if (playing)
+		{
+			// inputs and time steps come from the log instead of the user and the clock
+			if (!player.next(stepMs, key) || key == FSKEY_ESC)
+				break;
+		}
+		else
+			recorder.record(stepMs, key);
+		if (key == FSKEY_C)
+		{
+			// C toggles periodic checkpoints, each one a delta of the last
+			checkpointing = !checkpointing;
+			if (checkpointing)
+				checkpoints.begin(gCheckpointFile);
+		}
+		if (key == FSKEY_L)
+		{
+			checkpoints.flush();
+			if (restoreState(gCheckpointFile) && recorder.isRecording())
+			{
+				printf("Restored a checkpoint, replay recording stopped\n");
+				recorder.close();
+			}
+		}
+		timeInc = (double)(stepMs) * 0.001;
 		clocktime += timeInc;
 		/////////// update physics /////////////////
 		updateNumPhysics(timeInc);
+		if (checkpointing && ++steps % checkpointSteps == 0)
+		{
+			SnapshotState state;
+			captureState(state);
+			checkpoints.submit(state);
+		}
 		/////////////////////////////////////////
 		renderScene();
 
@@ -417,6 +648,8 @@ int Game(void)
 		framerate = 1000 / passedTime;
 		passedTime=FsPassedTime(true); // Making it up to 50fps
 	}
+	recorder.close();
+	printf("Run ended at %f s, state checksum %08x\n", clocktime, stateChecksum());
 	return 0;
 }
 
@@ -448,14 +681,13 @@ void GameOver(int score)
 
 		const char *msg1="Game Over";
 		char msg2[256];
-		glColor3ub(255,255,255);
-		glRasterPos2i(32,32);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
+		gText.clear();
+		gText.add(32, 32, msg1, 255, 255, 255);
 
 		sprintf_s(msg2,"Your score is %d",score);
 
-		glRasterPos2i(32,48);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		gText.add(32, 48, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -463,15 +695,17 @@ void GameOver(int score)
 }
 
 //////////////////////////////////////////////////////////////////////////////////////
-int main(void)
+int main(int argc, char *argv[])
 {
+	if (argc > 2 && strcmp(argv[1], "-replay") == 0)
+		return ReplayHeadless(argv[2]);
+	if (argc > 2 && strcmp(argv[1], "-render") == 0)
+		return RenderReplay(argv[2], argc - 3, argv + 3);
+
 	int menu;
 	FsOpenWindow(32, 32, winWidth, winHeight, 1); // 800x600 pixels, useDoubleBuffer=1
 
-	int listBase;
-	listBase=glGenLists(256);
-	YsGlUseFontBitmap8x12(listBase);
-	glListBase(listBase);
+	gText.init();
 
 	glDisable(GL_DEPTH_TEST);
 	glDisable(GL_LIGHTING);
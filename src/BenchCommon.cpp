@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// BenchCommon.cpp
+// ===============
+// Arguments and output of the bench commands. See BenchCommon.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <stdlib.h>
+#include "BenchCommon.h"
+
+BenchArgs::BenchArgs(const char *command, int argc, char *argv[]) : command(command)
+{
+	for (int i = 0; i < argc; i++)
+		args.push_back(argv[i]);
+	used.assign(args.size(), false);
+}
+
+const char *BenchArgs::find(const char *key)
+{
+	// the last one wins, so a default can be overridden by appending to it
+	const size_t len = strlen(key);
+	const char *value = NULL;
+	for (size_t i = 0; i < args.size(); i++)
+		if (strncmp(args[i], key, len) == 0 && args[i][len] == '=')
+		{
+			value = args[i] + len + 1;
+			used[i] = true;
+		}
+	return value;
+}
+
+const char *BenchArgs::text(const char *key, const char *fallback)
+{
+	const char *value = find(key);
+	return value != NULL ? value : fallback;
+}
+
+int BenchArgs::integer(const char *key, int fallback)
+{
+	const char *value = find(key);
+	return value != NULL ? atoi(value) : fallback;
+}
+
+unsigned int BenchArgs::unsignedInteger(const char *key, unsigned int fallback)
+{
+	const char *value = find(key);
+	return value != NULL ? (unsigned int)strtoul(value, NULL, 10) : fallback;
+}
+
+double BenchArgs::number(const char *key, double fallback)
+{
+	const char *value = find(key);
+	return value != NULL ? atof(value) : fallback;
+}
+
+int BenchArgs::reportUnknown() const
+{
+	int unknown = 0;
+	for (size_t i = 0; i < args.size(); i++)
+		if (!used[i])
+		{
+			printf("%s: unknown argument %s\n", command, args[i]);
+			unknown++;
+		}
+	return unknown;
+}
+
+FILE *openCsv(const char *command, const char *fileName, const char *header)
+{
+	FILE *fp = fopen(fileName, "w");
+	if (fp == NULL)
+	{
+		printf("%s: cannot write %s\n", command, fileName);
+		return NULL;
+	}
+	fprintf(fp, "%s\n", header);
+	return fp;
+}
+
+bool closeCsv(const char *command, FILE *fp, const char *fileName)
+{
+	const bool ok = ferror(fp) == 0;
+	if (fclose(fp) != 0 || !ok)
+	{
+		printf("%s: cannot write %s\n", command, fileName);
+		return false;
+	}
+	printf("wrote %s\n", fileName);
+	return true;
+}
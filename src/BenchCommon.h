@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// BenchCommon.h
+// =============
+// What the bench and check commands have in common: their key=value
+// arguments, the timing loop and the CSV file they write.
+//
+//   BenchArgs       the arguments of one command. Each value is looked up
+//                   by key with the default to use when it is not given;
+//                   reportUnknown() then names the arguments nobody asked for
+//   elapsedNs       the time one call of run() takes
+//   bestNs          the best of a few calls, for a single form
+//   bestNsInTurns   the best of a few rounds for each of several forms that
+//                   are compared: within a round the forms take turns, so a
+//                   change in the machine's speed during the bench hits them
+//                   all alike instead of favouring the one that ran first
+//   openCsv         opens the output and writes the header line; closeCsv
+//                   closes it and says where it went
+//
+// A command prints its messages as "<command>: ..." and returns what its
+// main() should return: 0, or 1 when there was nothing to run, the output
+// could not be written, or a check failed. benchCheck.cpp gathers the
+// commands into one console program.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+class BenchArgs
+{
+public:
+	BenchArgs(const char *command, int argc, char *argv[]);
+
+	const char *getCommand() const              { return command; }
+
+	// the value of key=, or fallback when the argument is not there
+	const char *text(const char *key, const char *fallback);
+	int integer(const char *key, int fallback);
+	unsigned int unsignedInteger(const char *key, unsigned int fallback);
+	double number(const char *key, double fallback);
+
+	// prints "<command>: unknown argument ..." for every argument none of the
+	// calls above asked for, and returns their number
+	int reportUnknown() const;
+
+private:
+	const char *find(const char *key);
+
+	const char *command;
+	std::vector<const char *> args;
+	std::vector<bool> used;
+};
+
+template<class Run>
+double elapsedNs(Run run)
+{
+	auto t0 = std::chrono::steady_clock::now();
+	run();
+	auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count();
+}
+
+template<class Run>
+double bestNs(Run run, int rounds = 3)
+{
+	double best = 0.0;
+	for (int r = 0; r < rounds; r++)
+	{
+		const double ns = elapsedNs(run);
+		best = r == 0 || ns < best ? ns : best;
+	}
+	return best;
+}
+
+// run(form) runs form 0 .. forms - 1 once; best receives forms values
+template<class Run>
+void bestNsInTurns(int forms, Run run, double *best, int rounds = 9)
+{
+	for (int r = 0; r < rounds; r++)
+		for (int f = 0; f < forms; f++)
+		{
+			const double ns = elapsedNs([&] { run(f); });
+			best[f] = r == 0 || ns < best[f] ? ns : best[f];
+		}
+}
+
+// NULL, after saying so, when the file cannot be written
+FILE *openCsv(const char *command, const char *fileName, const char *header);
+
+// false, after saying so, when the data did not make it to the file
+bool closeCsv(const char *command, FILE *fp, const char *fileName);
+
+#endif
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+// Camera.cpp
+// ==========
+// Matrix stack, camera and per-frame model-view batch. See Camera.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "MatrixBatch.h"
+#include "Camera.h"
+
+namespace
+{
+const float DEG2RAD = 3.141593f / 180;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// builders
+///////////////////////////////////////////////////////////////////////////////
+Matrix4 lookAtMatrix(const Vector3& eye, const Vector3& target, const Vector3& up)
+{
+    // rows of the rotation are side, up and -forward; the translation moves
+    // the eye to the origin
+    Vector3 f = target - eye;
+    f.normalize();
+    Vector3 s = f.cross(up);
+    s.normalize();
+    Vector3 u = s.cross(f);
+    return Matrix4(s.x, u.x, -f.x, 0,                   // 1st column
+                   s.y, u.y, -f.y, 0,                   // 2nd column
+                   s.z, u.z, -f.z, 0,                   // 3rd column
+                   -s.dot(eye), -u.dot(eye), f.dot(eye), 1);
+}
+
+Matrix4 perspectiveMatrix(float fovY, float aspect, float zNear, float zFar)
+{
+    float f = 1.0f / tanf(0.5f * fovY * DEG2RAD);
+    float depth = zNear - zFar;
+    return Matrix4(f / aspect, 0, 0, 0,
+                   0, f, 0, 0,
+                   0, 0, (zFar + zNear) / depth, -1,
+                   0, 0, 2 * zFar * zNear / depth, 0);
+}
+
+Matrix4 frustumMatrix(float l, float r, float b, float t, float n, float f)
+{
+    return Matrix4(2 * n / (r - l), 0, 0, 0,
+                   0, 2 * n / (t - b), 0, 0,
+                   (r + l) / (r - l), (t + b) / (t - b), -(f + n) / (f - n), -1,
+                   0, 0, -2 * f * n / (f - n), 0);
+}
+
+Matrix4 orthoMatrix(float l, float r, float b, float t, float n, float f)
+{
+    return Matrix4(2 / (r - l), 0, 0, 0,
+                   0, 2 / (t - b), 0, 0,
+                   0, 0, -2 / (f - n), 0,
+                   -(r + l) / (r - l), -(t + b) / (t - b), -(f + n) / (f - n), 1);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Camera
+///////////////////////////////////////////////////////////////////////////////
+void Camera::setPerspective(float fovY, float aspect, float zNear, float zFar)
+{
+    projection = perspectiveMatrix(fovY, aspect, zNear, zFar);
+    dirty = true;
+}
+
+void Camera::setOrtho(float left, float right, float bottom, float top, float zNear, float zFar)
+{
+    projection = orthoMatrix(left, right, bottom, top, zNear, zFar);
+    dirty = true;
+}
+
+void Camera::lookAt(const Vector3& eye, const Vector3& target, const Vector3& up)
+{
+    view = lookAtMatrix(eye, target, up);
+    position = eye;
+    dirty = true;
+}
+
+void Camera::setView(const Matrix4& m)
+{
+    view = m;
+    Matrix4 inverse = m;
+    inverse.invertAffine();
+    const float* a = inverse.get();
+    position = Vector3(a[12], a[13], a[14]);
+    dirty = true;
+}
+
+const Matrix4& Camera::getViewProjection() const
+{
+    if(dirty)
+    {
+        viewProjection = projection * view;
+        dirty = false;
+    }
+    return viewProjection;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// ModelViewBatch
+///////////////////////////////////////////////////////////////////////////////
+int ModelViewBatch::add(const Matrix4& model)
+{
+    models.push_back(model);
+    return (int)models.size() - 1;
+}
+
+void ModelViewBatch::resolve(const Matrix4& view)
+{
+    modelViews.resize(models.size());
+    if(!models.empty())
+        multiplyMatrices(view, &models[0], &modelViews[0], models.size());
+}
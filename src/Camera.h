@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// Camera.h
+// ========
+// CPU-side replacements for the fixed-function GL matrix calls
+//
+// lookAtMatrix(), perspectiveMatrix(), frustumMatrix() and orthoMatrix()
+// build the same matrices as gluLookAt, gluPerspective, glFrustum and
+// glOrtho. MatrixStack does glPushMatrix/glPopMatrix and friends on Matrix4;
+// its translate/rotate/scale multiply on the right like the GL calls do.
+// Camera keeps a view and a projection and caches their product.
+//
+// ModelViewBatch collects the model matrix of every object drawn in a frame
+// and multiplies them all by the view matrix in one pass (MatrixBatch), so
+// the draw code loads a finished model-view matrix per object instead of
+// letting the driver multiply a push/mult/pop sequence. None of this calls
+// GL; the results can be checked without a window.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_CAMERA_H
+#define MATH_CAMERA_H
+
+#include <cstddef>
+#include <vector>
+#include "Matrices.h"
+
+// view and projection builders; angles in degree
+Matrix4 lookAtMatrix(const Vector3& eye, const Vector3& target, const Vector3& up);
+Matrix4 perspectiveMatrix(float fovY, float aspect, float zNear, float zFar);
+Matrix4 frustumMatrix(float left, float right, float bottom, float top, float zNear, float zFar);
+Matrix4 orthoMatrix(float left, float right, float bottom, float top, float zNear, float zFar);
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// matrix stack, starts with one identity matrix
+///////////////////////////////////////////////////////////////////////////////
+class MatrixStack
+{
+public:
+    MatrixStack() : stack(1)                            {}
+
+    void        push()                                  { stack.push_back(stack.back()); }
+    void        pop()                                   { if(stack.size() > 1) stack.pop_back(); } // the last matrix stays
+    size_t      depth() const                           { return stack.size(); }
+    const Matrix4& top() const                          { return stack.back(); }
+
+    MatrixStack& load(const Matrix4& m)                 { stack.back() = m; return *this; }
+    MatrixStack& loadIdentity()                         { stack.back().identity(); return *this; }
+    MatrixStack& multiply(const Matrix4& m)             { stack.back() = stack.back() * m; return *this; } // top = top * m
+    MatrixStack& translate(float x, float y, float z)   { return multiply(Matrix4().translate(x, y, z)); }
+    MatrixStack& translate(const Vector3& v)            { return multiply(Matrix4().translate(v)); }
+    MatrixStack& rotate(float angle, const Vector3& axis) { return multiply(Matrix4().rotate(angle, axis)); }
+    MatrixStack& scale(float s)                         { return multiply(Matrix4().scale(s)); }
+    MatrixStack& scale(float sx, float sy, float sz)    { return multiply(Matrix4().scale(sx, sy, sz)); }
+
+private:
+    std::vector<Matrix4> stack;
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// camera: view * projection with the product cached
+///////////////////////////////////////////////////////////////////////////////
+class Camera
+{
+public:
+    Camera() : dirty(true)                              {}
+
+    void        setPerspective(float fovY, float aspect, float zNear, float zFar);
+    void        setOrtho(float left, float right, float bottom, float top, float zNear, float zFar);
+    void        setProjection(const Matrix4& m)         { projection = m; dirty = true; }
+    void        lookAt(const Vector3& eye, const Vector3& target, const Vector3& up = Vector3(0, 1, 0));
+    void        setView(const Matrix4& m);
+
+    const Matrix4& getProjection() const                { return projection; }
+    const Matrix4& getView() const                      { return view; }
+    const Matrix4& getViewProjection() const;           // projection * view, rebuilt after a change
+    Vector3     getPosition() const                     { return position; } // eye in world space
+
+private:
+    Matrix4     projection;
+    Matrix4     view;
+    Vector3     position;
+    mutable Matrix4 viewProjection;
+    mutable bool dirty;
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// model matrices of one frame, multiplied by the view in one batch
+///////////////////////////////////////////////////////////////////////////////
+class ModelViewBatch
+{
+public:
+    void        clear()                                 { models.clear(); modelViews.clear(); }
+    int         add(const Matrix4& model);              // returns the slot of this object
+    void        resolve(const Matrix4& view);           // modelView[i] = view * model[i]
+    void        resolve(const Camera& camera)           { resolve(camera.getView()); }
+    size_t      size() const                            { return models.size(); }
+    const Matrix4& getModel(int slot) const             { return models[slot]; }
+    const Matrix4& getModelView(int slot) const         { return modelViews[slot]; } // valid after resolve()
+
+private:
+    std::vector<Matrix4> models;
+    std::vector<Matrix4> modelViews;
+};
+
+#endif
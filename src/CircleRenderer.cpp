@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////////////////
+// CircleRenderer.cpp
+// ==================
+// Instanced and sprite circle drawing. See CircleRenderer.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#ifndef WIN32
+#include <GL/glx.h>
+#endif
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "CircleRenderer.h"
+#include "GLLoader.h"
+#include "Renderer.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// the few GL 1.5 - 3.3 names the instanced path needs; gl.h stops at 1.1
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_STATIC_DRAW 0x88E4
+#define GL_STREAM_DRAW 0x88E0
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_VERTEX_SHADER 0x8B31
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_LINK_STATUS 0x8B82
+#endif
+
+namespace
+{
+	typedef GLuint (APIENTRY *CreateShaderProc)(GLenum type);
+	typedef void (APIENTRY *ShaderSourceProc)(GLuint shader, GLsizei count, const char *const *source, const GLint *length);
+	typedef void (APIENTRY *ShaderProc)(GLuint shader);
+	typedef void (APIENTRY *GetivProc)(GLuint object, GLenum name, GLint *value);
+	typedef GLuint (APIENTRY *CreateProgramProc)(void);
+	typedef void (APIENTRY *AttachShaderProc)(GLuint program, GLuint shader);
+	typedef void (APIENTRY *BindAttribLocationProc)(GLuint program, GLuint index, const char *name);
+	typedef void (APIENTRY *GenBuffersProc)(GLsizei n, GLuint *buffers);
+	typedef void (APIENTRY *DeleteBuffersProc)(GLsizei n, const GLuint *buffers);
+	typedef void (APIENTRY *BindBufferProc)(GLenum target, GLuint buffer);
+	typedef void (APIENTRY *BufferDataProc)(GLenum target, ptrdiff_t size, const void *data, GLenum usage);
+	typedef void (APIENTRY *BufferSubDataProc)(GLenum target, ptrdiff_t offset, ptrdiff_t size, const void *data);
+	typedef void (APIENTRY *VertexAttribPointerProc)(GLuint index, GLint size, GLenum type, GLboolean normalized,
+		GLsizei stride, const void *pointer);
+	typedef void (APIENTRY *AttribArrayProc)(GLuint index);
+	typedef void (APIENTRY *VertexAttribDivisorProc)(GLuint index, GLuint divisor);
+	typedef void (APIENTRY *DrawArraysInstancedProc)(GLenum mode, GLint first, GLsizei count, GLsizei instances);
+
+	struct InstancingFunctions
+	{
+		CreateShaderProc createShader;
+		ShaderSourceProc shaderSource;
+		ShaderProc compileShader, deleteShader, linkProgram, deleteProgram, useProgram;
+		GetivProc getShaderiv, getProgramiv;
+		CreateProgramProc createProgram;
+		AttachShaderProc attachShader;
+		BindAttribLocationProc bindAttribLocation;
+		GenBuffersProc genBuffers;
+		DeleteBuffersProc deleteBuffers;
+		BindBufferProc bindBuffer;
+		BufferDataProc bufferData;
+		BufferSubDataProc bufferSubData;
+		VertexAttribPointerProc vertexAttribPointer;
+		AttribArrayProc enableVertexAttribArray, disableVertexAttribArray;
+		VertexAttribDivisorProc vertexAttribDivisor;
+		DrawArraysInstancedProc drawArraysInstanced;
+	};
+	InstancingFunctions gl;
+
+	bool loadInstancingFunctions()
+	{
+		// shaders and buffers are GL 2.0; glDrawArraysInstanced is GL 3.1 or
+		// ARB_draw_instanced, glVertexAttribDivisor GL 3.3 or ARB_instanced_arrays
+		const char *instanced = hasGLVersion(3, 1) ? "" : (hasGLExtension("GL_ARB_draw_instanced") ? "ARB" : NULL);
+		const char *divisor = hasGLVersion(3, 3) ? "" : (hasGLExtension("GL_ARB_instanced_arrays") ? "ARB" : NULL);
+		if (!hasGLVersion(2, 0) || instanced == NULL || divisor == NULL)
+			return false;
+		return loadGLFunction(gl.createShader, "glCreateShader") && loadGLFunction(gl.shaderSource, "glShaderSource") &&
+			loadGLFunction(gl.compileShader, "glCompileShader") && loadGLFunction(gl.deleteShader, "glDeleteShader") &&
+			loadGLFunction(gl.linkProgram, "glLinkProgram") && loadGLFunction(gl.deleteProgram, "glDeleteProgram") &&
+			loadGLFunction(gl.useProgram, "glUseProgram") && loadGLFunction(gl.getShaderiv, "glGetShaderiv") &&
+			loadGLFunction(gl.getProgramiv, "glGetProgramiv") && loadGLFunction(gl.createProgram, "glCreateProgram") &&
+			loadGLFunction(gl.attachShader, "glAttachShader") &&
+			loadGLFunction(gl.bindAttribLocation, "glBindAttribLocation") &&
+			loadGLFunction(gl.genBuffers, "glGenBuffers") && loadGLFunction(gl.deleteBuffers, "glDeleteBuffers") &&
+			loadGLFunction(gl.bindBuffer, "glBindBuffer") && loadGLFunction(gl.bufferData, "glBufferData") &&
+			loadGLFunction(gl.bufferSubData, "glBufferSubData") &&
+			loadGLFunction(gl.vertexAttribPointer, "glVertexAttribPointer") &&
+			loadGLFunction(gl.enableVertexAttribArray, "glEnableVertexAttribArray") &&
+			loadGLFunction(gl.disableVertexAttribArray, "glDisableVertexAttribArray") &&
+			loadGLFunction(gl.vertexAttribDivisor, "glVertexAttribDivisor", divisor) &&
+			loadGLFunction(gl.drawArraysInstanced, "glDrawArraysInstanced", instanced);
+	}
+
+	// attribute 0: mesh vertex (cos, sin, 1 on the outer ring / 0 on the inner)
+	// attribute 1: instance (x, y, radius, inner), attribute 2: instance color
+	const char *vertexShader =
+		"#version 120\n"
+		"attribute vec3 corner;\n"
+		"attribute vec4 circle;\n"
+		"attribute vec4 color;\n"
+		"varying vec4 fragmentColor;\n"
+		"void main()\n"
+		"{\n"
+		"	float r = mix(circle.w, circle.z, corner.z);\n"
+		"	gl_Position = gl_ModelViewProjectionMatrix * vec4(circle.xy + corner.xy * r, 0.0, 1.0);\n"
+		"	fragmentColor = color;\n"
+		"}\n";
+
+	const char *fragmentShader =
+		"#version 120\n"
+		"varying vec4 fragmentColor;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_FragColor = fragmentColor;\n"
+		"}\n";
+
+	GLuint compileShader(GLenum type, const char *source)
+	{
+		GLuint shader = gl.createShader(type);
+		gl.shaderSource(shader, 1, &source, NULL);
+		gl.compileShader(shader);
+		GLint ok = 0;
+		gl.getShaderiv(shader, GL_COMPILE_STATUS, &ok);
+		if (!ok)
+		{
+			gl.deleteShader(shader);
+			return 0;
+		}
+		return shader;
+	}
+
+	GLuint buildProgram()
+	{
+		GLuint vs = compileShader(GL_VERTEX_SHADER, vertexShader);
+		GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentShader);
+		GLuint program = 0;
+		if (vs != 0 && fs != 0)
+		{
+			program = gl.createProgram();
+			gl.attachShader(program, vs);
+			gl.attachShader(program, fs);
+			gl.bindAttribLocation(program, 0, "corner");
+			gl.bindAttribLocation(program, 1, "circle");
+			gl.bindAttribLocation(program, 2, "color");
+			gl.linkProgram(program);
+			GLint ok = 0;
+			gl.getProgramiv(program, GL_LINK_STATUS, &ok);
+			if (!ok)
+			{
+				gl.deleteProgram(program);
+				program = 0;
+			}
+		}
+		if (vs != 0)
+			gl.deleteShader(vs);
+		if (fs != 0)
+			gl.deleteShader(fs);
+		return program;
+	}
+
+	const int discSize = 64;        // sprite texture, the disc has radius discSize / 2 - 1 texels
+}
+
+CircleRenderer::CircleRenderer(int segments)
+	: segments(segments < 3 ? 3 : segments), path(PATH_SPRITES), initialized(false),
+	program(0), meshBuffer(0), instanceBuffer(0), instanceCapacity(0), discTexture(0)
+{
+}
+
+void CircleRenderer::makeRingDirections()
+{
+	if ((int)ringDirections.size() == 2 * segments)
+		return;
+	ringDirections.resize(2 * segments);
+	for (int i = 0; i < segments; i++)
+	{
+		double a = 2.0 * 3.14159265358979 * i / segments;
+		ringDirections[2 * i] = (float)cos(a);
+		ringDirections[2 * i + 1] = (float)sin(a);
+	}
+}
+
+bool CircleRenderer::init(Path requested)
+{
+	if (initialized)
+		release();
+	initialized = true;
+
+	makeRingDirections();
+
+	if (requested != PATH_SPRITES && loadInstancingFunctions() && (program = buildProgram()) != 0)
+	{
+		// strip from the outer to the inner ring, closed by repeating segment 0
+		std::vector<float> mesh;
+		for (int i = 0; i <= segments; i++)
+		{
+			int k = i % segments;
+			const float outer[3] = { ringDirections[2 * k], ringDirections[2 * k + 1], 1.0f };
+			const float inner[3] = { ringDirections[2 * k], ringDirections[2 * k + 1], 0.0f };
+			mesh.insert(mesh.end(), outer, outer + 3);
+			mesh.insert(mesh.end(), inner, inner + 3);
+		}
+		GLuint buffers[2];
+		gl.genBuffers(2, buffers);
+		meshBuffer = buffers[0];
+		instanceBuffer = buffers[1];
+		gl.bindBuffer(GL_ARRAY_BUFFER, meshBuffer);
+		gl.bufferData(GL_ARRAY_BUFFER, mesh.size() * sizeof(float), &mesh[0], GL_STATIC_DRAW);
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+		path = PATH_INSTANCED;
+		return true;
+	}
+
+	// antialiased disc in the alpha channel
+	std::vector<unsigned char> texels(discSize * discSize);
+	const float c = discSize * 0.5f, r = c - 1.0f;
+	for (int y = 0; y < discSize; y++)
+	{
+		for (int x = 0; x < discSize; x++)
+		{
+			float dx = x + 0.5f - c, dy = y + 0.5f - c;
+			float a = r - sqrtf(dx * dx + dy * dy) + 0.5f;
+			texels[y * discSize + x] = (unsigned char)(255.0f * (a < 0.0f ? 0.0f : (a > 1.0f ? 1.0f : a)));
+		}
+	}
+	glGenTextures(1, &discTexture);
+	glBindTexture(GL_TEXTURE_2D, discTexture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, discSize, discSize, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &texels[0]);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	path = PATH_SPRITES;
+	return requested != PATH_INSTANCED;
+}
+
+void CircleRenderer::release()
+{
+	if (!initialized)
+		return;
+	if (path == PATH_INSTANCED)
+	{
+		GLuint buffers[2] = { meshBuffer, instanceBuffer };
+		gl.deleteBuffers(2, buffers);
+		gl.deleteProgram(program);
+	}
+	else
+		glDeleteTextures(1, &discTexture);
+	program = meshBuffer = instanceBuffer = discTexture = 0;
+	instanceCapacity = 0;
+	initialized = false;
+}
+
+void CircleRenderer::draw()
+{
+	if (!initialized)
+		init();
+	if (instances.empty())
+		return;
+
+	glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	if (path == PATH_INSTANCED)
+		drawInstanced();
+	else
+		drawSprites();
+	glPopAttrib();
+}
+
+void CircleRenderer::draw(Renderer &target, const Matrix4 &transform)
+{
+	if (instances.empty())
+		return;
+	makeRingDirections();
+
+	// the instanced mesh as triangles: 2 per segment, 1 for a filled circle
+	std::vector<RenderVertex> vertices;
+	vertices.reserve(instances.size() * segments * 3);
+	for (auto &c : instances)
+	{
+		RenderVertex v = { 0, 0, 0, 0, 0, c.red, c.green, c.blue, c.alpha };
+		for (int i = 0; i < segments; i++)
+		{
+			const float *d0 = &ringDirections[2 * i];
+			const float *d1 = &ringDirections[2 * ((i + 1) % segments)];
+			const float corner[4][2] = {
+				{ c.x + d0[0] * c.radius, c.y + d0[1] * c.radius }, { c.x + d1[0] * c.radius, c.y + d1[1] * c.radius },
+				{ c.x + d0[0] * c.inner, c.y + d0[1] * c.inner }, { c.x + d1[0] * c.inner, c.y + d1[1] * c.inner } };
+			const int triangles = c.inner > 0.0f ? 2 : 1;
+			const int index[2][3] = { { 2, 0, 1 }, { 2, 1, 3 } };
+			for (int t = 0; t < triangles; t++)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					v.x = corner[index[t][k]][0];
+					v.y = corner[index[t][k]][1];
+					vertices.push_back(v);
+				}
+			}
+		}
+	}
+	RenderState state;
+	state.transform = transform;
+	state.blend = BLEND_ALPHA;
+	target.draw(PRIMITIVE_TRIANGLES, &vertices[0], vertices.size(), state);
+}
+
+void CircleRenderer::drawInstanced()
+{
+	// orphan the last frame's instances and stream this frame's in
+	const size_t bytes = instances.size() * sizeof(CircleInstance);
+	gl.bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	if (bytes > instanceCapacity)
+		instanceCapacity = bytes + bytes / 2;
+	gl.bufferData(GL_ARRAY_BUFFER, instanceCapacity, NULL, GL_STREAM_DRAW);
+	gl.bufferSubData(GL_ARRAY_BUFFER, 0, bytes, &instances[0]);
+	gl.vertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(CircleInstance), (const void *)0);
+	gl.vertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CircleInstance),
+		(const void *)offsetof(CircleInstance, red));
+	gl.vertexAttribDivisor(1, 1);
+	gl.vertexAttribDivisor(2, 1);
+
+	gl.bindBuffer(GL_ARRAY_BUFFER, meshBuffer);
+	gl.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (const void *)0);
+	for (GLuint i = 0; i < 3; i++)
+		gl.enableVertexAttribArray(i);
+
+	gl.useProgram(program);
+	gl.drawArraysInstanced(GL_TRIANGLE_STRIP, 0, 2 * (segments + 1), (GLsizei)instances.size());
+	gl.useProgram(0);
+
+	for (GLuint i = 0; i < 3; i++)
+		gl.disableVertexAttribArray(i);
+	gl.vertexAttribDivisor(1, 0);
+	gl.vertexAttribDivisor(2, 0);
+	gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void CircleRenderer::drawSprites()
+{
+	// a filled circle is one quad (2 triangles), a ring 2 triangles per segment
+	size_t vertexCount = 0;
+	for (auto &c : instances)
+		vertexCount += c.inner > 0.0f ? 6 * segments : 6;
+	spriteVertices.resize(4 * vertexCount);
+	spriteColors.resize(4 * vertexCount);
+
+	float *v = &spriteVertices[0];
+	unsigned char *color = &spriteColors[0];
+	const float quadScale = (discSize * 0.5f) / (discSize * 0.5f - 1.0f);      // disc edge at the radius
+	for (auto &c : instances)
+	{
+		int n;
+		if (c.inner <= 0.0f)
+		{
+			const float h = c.radius * quadScale;
+			const float quad[6][4] = {
+				{ c.x - h, c.y - h, 0, 0 }, { c.x + h, c.y - h, 1, 0 }, { c.x + h, c.y + h, 1, 1 },
+				{ c.x - h, c.y - h, 0, 0 }, { c.x + h, c.y + h, 1, 1 }, { c.x - h, c.y + h, 0, 1 } };
+			memcpy(v, quad, sizeof(quad));
+			v += 24;
+			n = 6;
+		}
+		else
+		{
+			// texture coordinates at the middle of the disc, where it is opaque
+			for (int i = 0; i < segments; i++)
+			{
+				const float *d0 = &ringDirections[2 * i];
+				const float *d1 = &ringDirections[2 * ((i + 1) % segments)];
+				const float ring[6][4] = {
+					{ c.x + d0[0] * c.radius, c.y + d0[1] * c.radius, 0.5f, 0.5f },
+					{ c.x + d0[0] * c.inner, c.y + d0[1] * c.inner, 0.5f, 0.5f },
+					{ c.x + d1[0] * c.radius, c.y + d1[1] * c.radius, 0.5f, 0.5f },
+					{ c.x + d1[0] * c.radius, c.y + d1[1] * c.radius, 0.5f, 0.5f },
+					{ c.x + d0[0] * c.inner, c.y + d0[1] * c.inner, 0.5f, 0.5f },
+					{ c.x + d1[0] * c.inner, c.y + d1[1] * c.inner, 0.5f, 0.5f } };
+				memcpy(v, ring, sizeof(ring));
+				v += 24;
+			}
+			n = 6 * segments;
+		}
+		for (int i = 0; i < n; i++, color += 4)
+		{
+			color[0] = c.red;
+			color[1] = c.green;
+			color[2] = c.blue;
+			color[3] = c.alpha;
+		}
+	}
+
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, discTexture);
+	glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(2, GL_FLOAT, 4 * sizeof(float), &spriteVertices[0]);
+	glTexCoordPointer(2, GL_FLOAT, 4 * sizeof(float), &spriteVertices[2]);
+	glColorPointer(4, GL_UNSIGNED_BYTE, 0, &spriteColors[0]);
+	glDrawArrays(GL_TRIANGLES, 0, (GLsizei)vertexCount);
+	glPopClientAttrib();
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// CircleRenderer.h
+// ================
+// Draws many filled circles and rings in a single draw call.
+//
+// A demo adds its balls every frame (position, radius, color; a ring also
+// has a line width) and calls draw() once. The circles go through the
+// current modelview and projection, like the glBegin(GL_TRIANGLE_FAN)
+// circles they replace, in whatever units the demo draws in.
+//
+// Two paths:
+//   instanced  one unit-circle mesh (a triangle strip between an inner and
+//              an outer ring of segments vertices) in a static buffer, and
+//              one buffer of instances streamed once per frame. A small
+//              GLSL 1.20 shader scales the mesh by each instance, so a
+//              filled circle is the strip with an inner radius of 0. Needs
+//              GL 2.0 plus glDrawArraysInstanced and glVertexAttribDivisor
+//              (GL 3.3, or ARB_draw_instanced and ARB_instanced_arrays),
+//              loaded through GLLoader once GL_VERSION or the extension
+//              string says the driver has them.
+//   sprites    the fallback for older drivers and macOS: each
+//              filled circle becomes a quad textured with an antialiased
+//              disc, each ring a strip of triangles, all expanded on the
+//              CPU into one client-side vertex array and drawn with one
+//              glDrawArrays. GL 1.1 only.
+//
+// init() needs a current GL context; draw() calls it if it has not been.
+// draw(Renderer &, transform) draws the same circles as plain triangles
+// through a Renderer backend (a SoftRenderer for headless frames) instead.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CIRCLE_RENDERER_H
+#define CIRCLE_RENDERER_H
+
+#include <stddef.h>
+#include <vector>
+
+class Renderer;
+class Matrix4;
+
+// one circle: a filled one has inner = 0, a ring inner = radius - line width
+struct CircleInstance
+{
+	float x, y;
+	float radius;
+	float inner;
+	unsigned char red, green, blue, alpha;
+};
+
+class CircleRenderer
+{
+public:
+	enum Path
+	{
+		PATH_AUTO,          // instanced if the driver can, else sprites
+		PATH_INSTANCED,
+		PATH_SPRITES
+	};
+
+	explicit CircleRenderer(int segments = 32);
+
+	// returns false when PATH_INSTANCED was asked for and is not available;
+	// the renderer then uses sprites
+	bool init(Path path = PATH_AUTO);
+	void release();                 // deletes the GL objects, while the context is still current
+	Path getPath() const { return path; }
+
+	void clear() { instances.clear(); }
+	size_t size() const { return instances.size(); }
+	void reserve(size_t count) { instances.reserve(count); }
+	void addSolid(float x, float y, float radius,
+		unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255);
+	void addRing(float x, float y, float radius, float lineWidth,
+		unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255);
+
+	// draws every circle added since the last clear(), in one draw call
+	void draw();
+	void draw(Renderer &target, const Matrix4 &transform);     // no GL needed, no init()
+
+private:
+	void makeRingDirections();
+	void drawInstanced();
+	void drawSprites();
+
+	int segments;
+	Path path;
+	bool initialized;
+	std::vector<CircleInstance> instances;
+
+	// instanced path
+	unsigned int program, meshBuffer, instanceBuffer;
+	size_t instanceCapacity;        // bytes allocated in instanceBuffer
+
+	// sprite path
+	unsigned int discTexture;
+	std::vector<float> ringDirections;          // cos, sin per segment
+	std::vector<float> spriteVertices;          // x, y, u, v per vertex
+	std::vector<unsigned char> spriteColors;    // rgba per vertex
+
+	CircleRenderer(const CircleRenderer &);
+	CircleRenderer &operator=(const CircleRenderer &);
+};
+
+inline void CircleRenderer::addSolid(float x, float y, float radius,
+	unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha)
+{
+	CircleInstance c = { x, y, radius, 0.0f, red, green, blue, alpha };
+	instances.push_back(c);
+}
+
+inline void CircleRenderer::addRing(float x, float y, float radius, float lineWidth,
+	unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha)
+{
+	float inner = radius - lineWidth;
+	CircleInstance c = { x, y, radius, inner > 0.0f ? inner : 0.0f, red, green, blue, alpha };
+	instances.push_back(c);
+}
+
+#endif
@@ -0,0 +1,353 @@
+///////////////////////////////////////////////////////////////////////////////
+// FastMath.cpp
+// ============
+// Fast float transcendental kernels. See FastMath.h.
+//
+// sin/cos: Cody-Waite reduction by pi/2 and Cephes polynomials on
+// [-pi/4, pi/4]; exp: reduction by ln 2 and a polynomial for e^r; atan2:
+// Cephes atanf with the pi/8 split (precise) or the Abramowitz & Stegun
+// 4.4.47 polynomial on [0, 1] (fast); rsqrt: the hardware estimate with a
+// Newton step (precise) or without (fast).
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include "FastMath.h"
+
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FASTMATH_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	///////////////////////////////////////////////////////////////////////////
+	// 4 lanes of float (F4) and int32 (I4); masks are F4 with all bits set
+	///////////////////////////////////////////////////////////////////////////
+#if defined(FASTMATH_SSE2)
+	typedef __m128 F4;
+	typedef __m128i I4;
+
+	inline F4 load(const float *p) { return _mm_loadu_ps(p); }
+	inline void store(float *p, F4 a) { _mm_storeu_ps(p, a); }
+	inline F4 set1(float s) { return _mm_set1_ps(s); }
+	inline I4 set1i(int s) { return _mm_set1_epi32(s); }
+	inline F4 add(F4 a, F4 b) { return _mm_add_ps(a, b); }
+	inline F4 sub(F4 a, F4 b) { return _mm_sub_ps(a, b); }
+	inline F4 mul(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+	inline F4 div(F4 a, F4 b) { return _mm_div_ps(a, b); }
+	inline F4 vmin(F4 a, F4 b) { return _mm_min_ps(a, b); }
+	inline F4 vmax(F4 a, F4 b) { return _mm_max_ps(a, b); }
+	inline F4 vand(F4 a, F4 b) { return _mm_and_ps(a, b); }
+	inline F4 vxor(F4 a, F4 b) { return _mm_xor_ps(a, b); }
+	inline F4 less(F4 a, F4 b) { return _mm_cmplt_ps(a, b); }
+	inline F4 select(F4 mask, F4 a, F4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+	inline I4 roundToInt(F4 a) { return _mm_cvtps_epi32(a); }
+	inline F4 toFloat(I4 a) { return _mm_cvtepi32_ps(a); }
+	inline I4 iadd(I4 a, I4 b) { return _mm_add_epi32(a, b); }
+	inline I4 iand(I4 a, I4 b) { return _mm_and_si128(a, b); }
+	inline I4 ieq(I4 a, I4 b) { return _mm_cmpeq_epi32(a, b); }
+	template <int n> inline I4 shiftLeft(I4 a) { return _mm_slli_epi32(a, n); }
+	inline F4 asFloat(I4 a) { return _mm_castsi128_ps(a); }
+	inline I4 asInt(F4 a) { return _mm_castps_si128(a); }
+	inline F4 rsqrtEstimate(F4 a) { return _mm_rsqrt_ps(a); }
+#else
+	struct F4 { float v[4]; };
+	struct I4 { int32_t v[4]; };
+
+	inline F4 load(const float *p) { F4 r; memcpy(r.v, p, sizeof(r.v)); return r; }
+	inline void store(float *p, F4 a) { memcpy(p, a.v, sizeof(a.v)); }
+	inline F4 set1(float s) { F4 r; for (int i = 0; i < 4; i++) r.v[i] = s; return r; }
+	inline I4 set1i(int s) { I4 r; for (int i = 0; i < 4; i++) r.v[i] = s; return r; }
+	inline F4 add(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+	inline F4 sub(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+	inline F4 mul(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+	inline F4 div(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] /= b.v[i]; return a; }
+	inline F4 vmin(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+	inline F4 vmax(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+	inline I4 asInt(F4 a) { I4 r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+	inline F4 asFloat(I4 a) { F4 r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+	inline I4 iadd(I4 a, I4 b) { for (int i = 0; i < 4; i++) a.v[i] = (int32_t)((uint32_t)a.v[i] + (uint32_t)b.v[i]); return a; }
+	inline I4 iand(I4 a, I4 b) { for (int i = 0; i < 4; i++) a.v[i] &= b.v[i]; return a; }
+	inline I4 ieq(I4 a, I4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] == b.v[i] ? -1 : 0; return a; }
+	template <int n> inline I4 shiftLeft(I4 a) { for (int i = 0; i < 4; i++) a.v[i] = (int32_t)((uint32_t)a.v[i] << n); return a; }
+	inline F4 vand(F4 a, F4 b) { return asFloat(iand(asInt(a), asInt(b))); }
+	inline F4 vxor(F4 a, F4 b) { I4 x = asInt(a), y = asInt(b); for (int i = 0; i < 4; i++) x.v[i] ^= y.v[i]; return asFloat(x); }
+	inline F4 less(F4 a, F4 b) { I4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] < b.v[i] ? -1 : 0; return asFloat(r); }
+	inline F4 select(F4 mask, F4 a, F4 b) { I4 m = asInt(mask), x = asInt(a), y = asInt(b); for (int i = 0; i < 4; i++) x.v[i] = (x.v[i] & m.v[i]) | (y.v[i] & ~m.v[i]); return asFloat(x); }
+	inline I4 roundToInt(F4 a) { I4 r; for (int i = 0; i < 4; i++) r.v[i] = (int32_t)floorf(a.v[i] + 0.5f); return r; }
+	inline F4 toFloat(I4 a) { F4 r; for (int i = 0; i < 4; i++) r.v[i] = (float)a.v[i]; return r; }
+	inline F4 rsqrtEstimate(F4 a) { for (int i = 0; i < 4; i++) a.v[i] = 1.0f / sqrtf(a.v[i]); return a; }
+#endif
+
+	inline F4 signBit() { return asFloat(set1i((int)0x80000000)); }
+	inline F4 madd(F4 a, F4 b, float c) { return add(mul(a, b), set1(c)); }   // a*b + c
+	inline F4 vabs(F4 a) { return vand(a, asFloat(set1i(0x7fffffff))); }
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// kernels
+	///////////////////////////////////////////////////////////////////////////
+	template <MathTier tier>
+	inline void sinCos4(F4 x, F4 &s, F4 &c)
+	{
+		// x = k*pi/2 + r, |r| <= pi/4; pi/2 split in 3 (precise) or 2 parts
+		I4 k = roundToInt(mul(x, set1(0.636619772367581f)));
+		F4 kf = toFloat(k);
+		F4 r = sub(x, mul(kf, set1(1.5703125f)));
+		if (tier == MATH_PRECISE)
+			r = sub(sub(r, mul(kf, set1(4.837512969970703125e-4f))), mul(kf, set1(7.54978995489188216e-8f)));
+		else
+			r = sub(r, mul(kf, set1(4.8382679e-4f)));
+		F4 z = mul(r, r);
+
+		F4 sr, cr;
+		if (tier == MATH_PRECISE)
+		{
+			// r + r^3*p(r^2), 1 - r^2/2 + r^4*q(r^2)
+			F4 p = madd(madd(set1(-1.9515295891e-4f), z, 8.3321608736e-3f), z, -1.6666654611e-1f);
+			F4 q = madd(madd(set1(2.443315711809948e-5f), z, -1.388731625493765e-3f), z, 4.166664568298827e-2f);
+			sr = add(mul(mul(p, z), r), r);
+			cr = add(sub(mul(mul(q, z), z), mul(set1(0.5f), z)), set1(1.0f));
+		}
+		else
+		{
+			// Taylor series to r^5 and r^6
+			F4 p = madd(set1(8.3333333e-3f), z, -1.6666667e-1f);
+			sr = add(mul(mul(p, z), r), r);
+			cr = madd(madd(madd(set1(-1.3888889e-3f), z, 4.1666667e-2f), z, -0.5f), z, 1.0f);
+		}
+
+		// odd k swaps sin and cos; bit 1 of k (sin) or k+1 (cos) flips the sign
+		const I4 one = set1i(1), two = set1i(2);
+		F4 swap = asFloat(ieq(iand(k, one), one));
+		F4 sinSign = asFloat(shiftLeft<30>(iand(k, two)));
+		F4 cosSign = asFloat(shiftLeft<30>(iand(iadd(k, one), two)));
+		s = vxor(select(swap, cr, sr), sinSign);
+		c = vxor(select(swap, sr, cr), cosSign);
+	}
+
+	template <MathTier tier>
+	inline F4 rsqrt4(F4 x)
+	{
+		F4 y = rsqrtEstimate(x);
+#if defined(FASTMATH_SSE2)
+		if (tier == MATH_PRECISE)   // one Newton step: y * (1.5 - 0.5*x*y*y)
+			y = mul(y, sub(set1(1.5f), mul(mul(mul(set1(0.5f), x), y), y)));
+#endif
+		return y;
+	}
+
+	template <MathTier tier>
+	inline F4 exp4(F4 x)
+	{
+		x = vmax(vmin(x, set1(88.3762626647949f)), set1(-87.3365447505531f));
+
+		// x = n*ln2 + r, |r| <= ln2/2; e^x = 2^n * e^r
+		I4 n = roundToInt(mul(x, set1(1.44269504088896341f)));
+		F4 nf = toFloat(n);
+		F4 r = sub(sub(x, mul(nf, set1(0.693359375f))), mul(nf, set1(-2.12194440e-4f)));
+
+		F4 y;
+		if (tier == MATH_PRECISE)
+		{
+			F4 p = madd(set1(1.9875691500e-4f), r, 1.3981999507e-3f);
+			p = madd(p, r, 8.3334519073e-3f);
+			p = madd(p, r, 4.1665795894e-2f);
+			p = madd(p, r, 1.6666665459e-1f);
+			p = madd(p, r, 5.0000001201e-1f);
+			y = add(add(mul(mul(p, r), r), r), set1(1.0f));
+		}
+		else
+			y = madd(madd(madd(madd(set1(4.1666667e-2f), r, 1.6666667e-1f), r, 0.5f), r, 1.0f), r, 1.0f);
+
+		return mul(y, asFloat(shiftLeft<23>(iadd(n, set1i(127)))));
+	}
+
+	template <MathTier tier>
+	inline F4 atan2_4(F4 y, F4 x)
+	{
+		const F4 sign = signBit();
+		F4 ax = vabs(x), ay = vabs(y);
+		F4 t = div(vmin(ax, ay), vmax(vmax(ax, ay), set1(1e-37f)));   // in [0, 1]; 0 for x = y = 0
+
+		F4 a;
+		if (tier == MATH_PRECISE)
+		{
+			// above tan(pi/8) use atan(t) = pi/4 + atan((t-1)/(t+1))
+			F4 big = less(set1(0.414213562373095f), t);
+			F4 tr = select(big, div(sub(t, set1(1.0f)), add(t, set1(1.0f))), t);
+			F4 z = mul(tr, tr);
+			F4 p = madd(madd(madd(set1(8.05374449538e-2f), z, -1.38776856032e-1f), z, 1.99777106478e-1f), z, -3.33329491539e-1f);
+			a = add(add(mul(mul(p, z), tr), tr), vand(big, set1(0.785398163397448f)));
+		}
+		else
+		{
+			F4 z = mul(t, t);
+			F4 p = madd(madd(madd(madd(set1(0.0208351f), z, -0.0851330f), z, 0.1801410f), z, -0.3302995f), z, 0.9998660f);
+			a = mul(p, t);
+		}
+
+		// |y| > |x| mirrors to pi/2 - a, x < 0 (also -0) to pi - a; the
+		// result takes the sign of y
+		a = select(less(ax, ay), sub(set1(1.57079632679490f), a), a);
+		F4 negativeX = asFloat(ieq(iand(asInt(x), asInt(sign)), asInt(sign)));
+		a = select(negativeX, sub(set1(3.14159265358979f), a), a);
+		return vxor(a, vand(y, sign));
+	}
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	// array drivers: 4 at a time, the remainder through a padded block
+	///////////////////////////////////////////////////////////////////////////
+	template <class Kernel>
+	void runUnary(const float *in, float *out, size_t count, Kernel kernel)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			store(out + i, kernel(load(in + i)));
+		if (i < count)
+		{
+			float a[4] = { 1.0f, 1.0f, 1.0f, 1.0f }, b[4];
+			memcpy(a, in + i, (count - i) * sizeof(float));
+			store(b, kernel(load(a)));
+			memcpy(out + i, b, (count - i) * sizeof(float));
+		}
+	}
+
+	template <MathTier tier> struct Rsqrt { F4 operator()(F4 x) const { return rsqrt4<tier>(x); } };
+	template <MathTier tier> struct Exp { F4 operator()(F4 x) const { return exp4<tier>(x); } };
+
+	template <MathTier tier>
+	void sinCosArray(const float *x, float *s, float *c, size_t count)
+	{
+		float sb[4], cb[4];
+		for (size_t i = 0; i < count; i += 4)
+		{
+			size_t n = count - i < 4 ? count - i : 4;
+			F4 vs, vc;
+			if (n == 4)
+				sinCos4<tier>(load(x + i), vs, vc);
+			else
+			{
+				float a[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				memcpy(a, x + i, n * sizeof(float));
+				sinCos4<tier>(load(a), vs, vc);
+			}
+			store(sb, vs);
+			store(cb, vc);
+			if (s != NULL)
+				memcpy(s + i, sb, n * sizeof(float));
+			if (c != NULL)
+				memcpy(c + i, cb, n * sizeof(float));
+		}
+	}
+
+	template <MathTier tier>
+	void atan2Array(const float *y, const float *x, float *out, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			store(out + i, atan2_4<tier>(load(y + i), load(x + i)));
+		if (i < count)
+		{
+			float a[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, b[4] = { 1.0f, 1.0f, 1.0f, 1.0f }, r[4];
+			memcpy(a, y + i, (count - i) * sizeof(float));
+			memcpy(b, x + i, (count - i) * sizeof(float));
+			store(r, atan2_4<tier>(load(a), load(b)));
+			memcpy(out + i, r, (count - i) * sizeof(float));
+		}
+	}
+
+	inline float lane0(F4 a)
+	{
+		float r[4];
+		store(r, a);
+		return r[0];
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// single values
+///////////////////////////////////////////////////////////////////////////////
+void fastSinCos(float x, float &s, float &c, MathTier tier)
+{
+	F4 vs, vc;
+	if (tier == MATH_PRECISE)
+		sinCos4<MATH_PRECISE>(set1(x), vs, vc);
+	else
+		sinCos4<MATH_FAST>(set1(x), vs, vc);
+	s = lane0(vs);
+	c = lane0(vc);
+}
+
+float fastSin(float x, MathTier tier)
+{
+	float s, c;
+	fastSinCos(x, s, c, tier);
+	return s;
+}
+
+float fastCos(float x, MathTier tier)
+{
+	float s, c;
+	fastSinCos(x, s, c, tier);
+	return c;
+}
+
+float fastRsqrt(float x, MathTier tier)
+{
+	return lane0(tier == MATH_PRECISE ? rsqrt4<MATH_PRECISE>(set1(x)) : rsqrt4<MATH_FAST>(set1(x)));
+}
+
+float fastExp(float x, MathTier tier)
+{
+	return lane0(tier == MATH_PRECISE ? exp4<MATH_PRECISE>(set1(x)) : exp4<MATH_FAST>(set1(x)));
+}
+
+float fastAtan2(float y, float x, MathTier tier)
+{
+	return lane0(tier == MATH_PRECISE ? atan2_4<MATH_PRECISE>(set1(y), set1(x)) : atan2_4<MATH_FAST>(set1(y), set1(x)));
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// arrays
+///////////////////////////////////////////////////////////////////////////////
+void fastSinCos(const float *x, float *s, float *c, size_t count, MathTier tier)
+{
+	if (tier == MATH_PRECISE)
+		sinCosArray<MATH_PRECISE>(x, s, c, count);
+	else
+		sinCosArray<MATH_FAST>(x, s, c, count);
+}
+
+void fastRsqrt(const float *x, float *out, size_t count, MathTier tier)
+{
+	if (tier == MATH_PRECISE)
+		runUnary(x, out, count, Rsqrt<MATH_PRECISE>());
+	else
+		runUnary(x, out, count, Rsqrt<MATH_FAST>());
+}
+
+void fastExp(const float *x, float *out, size_t count, MathTier tier)
+{
+	if (tier == MATH_PRECISE)
+		runUnary(x, out, count, Exp<MATH_PRECISE>());
+	else
+		runUnary(x, out, count, Exp<MATH_FAST>());
+}
+
+void fastAtan2(const float *y, const float *x, float *out, size_t count, MathTier tier)
+{
+	if (tier == MATH_PRECISE)
+		atan2Array<MATH_PRECISE>(y, x, out, count);
+	else
+		atan2Array<MATH_FAST>(y, x, out, count);
+}
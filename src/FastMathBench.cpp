@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////////
+// FastMathBench.cpp
+// =================
+// FastMath accuracy and throughput report. See FastMathBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "BenchCommon.h"
+#include "FastMath.h"
+#include "FastMathBench.h"
+
+namespace
+{
+	struct Inputs
+	{
+		std::vector<float> x, y;
+	};
+
+	// one function under test over the whole array; called through a
+	// pointer so the timing loop is the same for every entry
+	typedef void (*Kernel)(const Inputs &in, float *out, float *out2, MathTier tier);
+
+	void sinCosLibm(const Inputs &in, float *s, float *c, MathTier)
+	{
+		for (size_t i = 0; i < in.x.size(); i++)
+		{
+			s[i] = sinf(in.x[i]);
+			c[i] = cosf(in.x[i]);
+		}
+	}
+
+	void sinCosFast(const Inputs &in, float *s, float *c, MathTier tier)
+	{
+		fastSinCos(&in.x[0], s, c, in.x.size(), tier);
+	}
+
+	void rsqrtLibm(const Inputs &in, float *out, float *, MathTier)
+	{
+		for (size_t i = 0; i < in.x.size(); i++)
+			out[i] = 1.0f / sqrtf(in.x[i]);
+	}
+
+	void rsqrtFast(const Inputs &in, float *out, float *, MathTier tier)
+	{
+		fastRsqrt(&in.x[0], out, in.x.size(), tier);
+	}
+
+	void expLibm(const Inputs &in, float *out, float *, MathTier)
+	{
+		for (size_t i = 0; i < in.x.size(); i++)
+			out[i] = expf(in.x[i]);
+	}
+
+	void expFast(const Inputs &in, float *out, float *, MathTier tier)
+	{
+		fastExp(&in.x[0], out, in.x.size(), tier);
+	}
+
+	void atan2Libm(const Inputs &in, float *out, float *, MathTier)
+	{
+		for (size_t i = 0; i < in.x.size(); i++)
+			out[i] = atan2f(in.y[i], in.x[i]);
+	}
+
+	void atan2Fast(const Inputs &in, float *out, float *, MathTier tier)
+	{
+		fastAtan2(&in.y[0], &in.x[0], out, in.x.size(), tier);
+	}
+
+	// the maximum errors documented in FastMath.h, keep the two in step;
+	// 0 is not checked
+	struct Bound
+	{
+		const char *function;
+		MathTier tier;
+		double ulp, abs, rel;
+	};
+
+	const Bound bounds[] =
+	{
+		{ "sincos", MATH_PRECISE, 1.5, 7.4e-8, 0.0 },
+		{ "sincos", MATH_FAST,    0.0, 3.7e-5, 0.0 },
+		{ "rsqrt",  MATH_PRECISE, 3.6, 0.0,    0.0 },
+		{ "rsqrt",  MATH_FAST,    0.0, 0.0,    3.3e-4 },
+		{ "exp",    MATH_PRECISE, 1.0, 0.0,    0.0 },
+		{ "exp",    MATH_FAST,    0.0, 0.0,    5.6e-5 },
+		{ "atan2",  MATH_PRECISE, 2.9, 2.7e-7, 0.0 },
+		{ "atan2",  MATH_FAST,    0.0, 1.2e-5, 0.0 },
+	};
+
+	bool withinBounds(const MathBenchRow &row, MathTier tier)
+	{
+		for (const Bound &b : bounds)
+		{
+			if (strcmp(b.function, row.function) != 0 || b.tier != tier)
+				continue;
+			return (b.ulp == 0.0 || row.maxUlp <= b.ulp) && (b.abs == 0.0 || row.maxAbs <= b.abs) &&
+				(b.rel == 0.0 || row.maxRel <= b.rel);
+		}
+		return false;
+	}
+
+	// reference results in double
+	double sinRef(float x, float) { return sin((double)x); }
+	double cosRef(float x, float) { return cos((double)x); }
+	double rsqrtRef(float x, float) { return 1.0 / sqrt((double)x); }
+	double expRef(float x, float) { return exp((double)x); }
+	double atan2Ref(float x, float y) { return atan2((double)y, (double)x); }
+
+	// size of one unit in the last place of a float of magnitude |v|
+	double ulpOf(double v)
+	{
+		int e;
+		frexp(fabs(v) < 1.1754943508e-38 ? 1.1754943508e-38 : v, &e);
+		return ldexp(1.0, e - 24);
+	}
+
+	void measure(const Inputs &in, const float *out, double (*ref)(float, float), MathBenchRow &row)
+	{
+		for (size_t i = 0; i < in.x.size(); i++)
+		{
+			double r = ref(in.x[i], in.y.empty() ? 0.0f : in.y[i]);
+			double d = fabs(out[i] - r);
+			double ulp = d / ulpOf(r);
+			if (ulp > row.maxUlp)
+				row.maxUlp = ulp;
+			if (d > row.maxAbs)
+				row.maxAbs = d;
+			if (r != 0.0 && d / fabs(r) > row.maxRel)
+				row.maxRel = d / fabs(r);
+		}
+	}
+
+	void compare(const char *function, const Inputs &in, Kernel libm, Kernel fast,
+		double (*ref)(float, float), double (*ref2)(float, float), int repeats, std::vector<MathBenchRow> &rows)
+	{
+		const char *tierName[] = { "libm", "precise", "fast" };
+		const Kernel kernels[] = { libm, fast, fast };
+		const MathTier tiers[] = { MATH_PRECISE, MATH_PRECISE, MATH_FAST };
+		std::vector<float> out(in.x.size()), out2(in.x.size());
+		for (int t = 0; t < 3; t++)
+		{
+			MathBenchRow row;
+			row.function = function;
+			row.tier = tierName[t];
+			row.count = (int)in.x.size();
+			row.maxUlp = row.maxAbs = row.maxRel = 0.0;
+			kernels[t](in, &out[0], &out2[0], tiers[t]);
+			measure(in, &out[0], ref, row);
+			if (ref2)
+				measure(in, &out2[0], ref2, row);
+			row.withinBounds = t == 0 || withinBounds(row, tiers[t]);
+			rows.push_back(row);
+		}
+
+		// ns per value, the three taking turns
+		double ns[3];
+		bestNsInTurns(3, [&](int t)
+		{
+			for (int r = 0; r < repeats; r++)
+				kernels[t](in, &out[0], &out2[0], tiers[t]);
+		}, ns);
+		for (int t = 0; t < 3; t++)
+			rows[rows.size() - 3 + t].nsPerElement = ns[t] / ((double)repeats * in.x.size());
+	}
+}
+
+void runMathBench(int count, int repeats, std::vector<MathBenchRow> &rows)
+{
+	rows.clear();
+
+	// evenly spread over the domain plus a scramble so neighbours differ
+	Inputs angles, positive, exponents, points;
+	for (int i = 0; i < count; i++)
+	{
+		double u = (i + 0.5) / count;
+		double v = fmod(u * 7919.0, 1.0);
+		angles.x.push_back((float)(-8192.0 + 16384.0 * u));
+		positive.x.push_back((float)ldexp(1.0 + v, (int)(u * 60.0) - 30));
+		exponents.x.push_back((float)(-87.0 + 175.0 * u));
+		points.x.push_back((float)(cos(u * 6.283185307) * (0.001 + 100.0 * v)));
+		points.y.push_back((float)(sin(u * 6.283185307) * (0.001 + 100.0 * v)));
+	}
+
+	compare("sincos", angles, sinCosLibm, sinCosFast, sinRef, cosRef, repeats, rows);
+	compare("rsqrt", positive, rsqrtLibm, rsqrtFast, rsqrtRef, NULL, repeats, rows);
+	compare("exp", exponents, expLibm, expFast, expRef, NULL, repeats, rows);
+	compare("atan2", points, atan2Libm, atan2Fast, atan2Ref, NULL, repeats, rows);
+}
+
+int runMathBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("mathbench", argc, argv);
+	const char *outFile = args.text("out", "fast_math.csv");
+	const int count = args.integer("values", 1 << 16), repeats = args.integer("repeats", 200);
+	args.reportUnknown();
+	if (count <= 0 || repeats <= 0)
+	{
+		printf("mathbench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<MathBenchRow> rows;
+	runMathBench(count, repeats, rows);
+	int failed = 0;
+	for (auto &row : rows)
+	{
+		printf("%-7s %-8s max %8.2f ulp  abs %.2e  rel %.2e  %6.3f ns%s\n", row.function, row.tier,
+			row.maxUlp, row.maxAbs, row.maxRel, row.nsPerElement, row.withinBounds ? "" : "  FAIL");
+		if (!row.withinBounds)
+			failed++;
+	}
+
+	FILE *fp = openCsv("mathbench", outFile, "function,tier,values,max_ulp,max_abs,max_rel,ns_per_element,within_bounds");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%s,%d,%.3f,%.3e,%.3e,%.4f,%d\n", row.function, row.tier, row.count,
+			row.maxUlp, row.maxAbs, row.maxRel, row.nsPerElement, row.withinBounds ? 1 : 0);
+	if (!closeCsv("mathbench", fp, outFile))
+		return 1;
+	if (failed)
+	{
+		printf("mathbench: %d row(s) over the bounds in FastMath.h\n", failed);
+		return 1;
+	}
+	return 0;
+}
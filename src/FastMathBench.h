@@ -0,0 +1,37 @@
+///////////////////////////////////////////////////////////////////////////////
+// FastMathBench.h
+// ===============
+// Accuracy and speed of the FastMath kernels against the C library.
+//
+// Every function runs over an array of inputs spread across its domain, in
+// each tier and once through libm (sinf, 1/sqrtf, expf, atan2f). Errors are
+// measured against the double precision result; the timings are ns per
+// value over the same arrays. The precise and fast rows are held to the
+// error bounds in FastMath.h's table; the command exits with 1 when one of
+// them is over.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef FAST_MATH_BENCH_H
+#define FAST_MATH_BENCH_H
+
+#include <vector>
+
+struct MathBenchRow
+{
+	const char *function;       // sincos, rsqrt, exp, atan2
+	const char *tier;           // libm, precise, fast
+	int count;                  // values
+	double maxUlp;              // units in the last place of the float result
+	double maxAbs;              // absolute error
+	double maxRel;              // relative error
+	double nsPerElement;
+	bool withinBounds;          // libm rows always are
+};
+
+void runMathBench(int count, int repeats, std::vector<MathBenchRow> &rows);
+
+// benchCheck's command line front end, returns 1 on an error over its bound:
+//   -mathbench [out=file.csv] [values=n] [repeats=n]
+int runMathBenchCommand(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// GLLoader.cpp
+// ============
+// GL version, extension and function lookup. See GLLoader.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#ifndef WIN32
+#include <GL/glx.h>
+#endif
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "GLLoader.h"
+
+bool hasGLVersion(int major, int minor)
+{
+	// "major.minor[.release] [vendor text]", after "OpenGL ES " on ES
+	const char *version = (const char *)glGetString(GL_VERSION);
+	if (version == NULL)
+		return false;               // no current context
+	while (*version != 0 && (*version < '0' || *version > '9'))
+		version++;
+	int hasMajor, hasMinor;
+	if (sscanf(version, "%d.%d", &hasMajor, &hasMinor) != 2)
+		return false;
+	return hasMajor > major || (hasMajor == major && hasMinor >= minor);
+}
+
+bool hasGLExtension(const char *name)
+{
+	// the demos' contexts are compatibility ones, which still list the
+	// extensions in one string; a core context returns NULL here
+	const char *list = (const char *)glGetString(GL_EXTENSIONS);
+	const size_t length = strlen(name);
+	for (const char *p = list; p != NULL && (p = strstr(p, name)) != NULL; p += length)
+	{
+		// not the start of a longer name
+		if ((p == list || p[-1] == ' ') && (p[length] == ' ' || p[length] == 0))
+			return true;
+	}
+	return false;
+}
+
+void *getGLProc(const char *name, const char *suffix)
+{
+	char full[64];
+	const int n = snprintf(full, sizeof(full), "%s%s", name, suffix);
+	if (n < 0 || n >= (int)sizeof(full))
+		return NULL;
+#if defined(WIN32)
+	void *p = (void *)wglGetProcAddress(full);
+	if ((size_t)p <= 3 || p == (void *)-1)     // some drivers fail with 1, 2, 3 or -1
+		return NULL;
+	return p;
+#elif !defined(MACOSX)
+	return (void *)glXGetProcAddressARB((const GLubyte *)full);
+#else
+	return NULL;
+#endif
+}
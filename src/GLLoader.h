@@ -0,0 +1,37 @@
+///////////////////////////////////////////////////////////////////////////////
+// GLLoader.h
+// ==========
+// Run-time lookup of the GL functions past gl.h's 1.1, for the modules that
+// take a newer path when the driver has one (CircleRenderer, TraceStream,
+// ShadowMap). All of it needs a current GL context.
+//
+// An address alone does not say the driver has a function:
+// glXGetProcAddressARB returns one for any name, even a made-up one. So a
+// module first checks the GL version or the extension that brings the
+// functions it wants, and loads them only after that:
+//
+//   hasGLVersion     GL_VERSION is at least major.minor
+//   hasGLExtension   the name is in GL_EXTENSIONS, as a whole word
+//   getGLProc        the address of name followed by suffix, NULL where the
+//                    platform has none (macOS has no lookup here)
+//   loadGLFunction   getGLProc into a typed pointer; the suffix is "" for
+//                    the core function, "ARB" or "EXT" for an extension's
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef GL_LOADER_H
+#define GL_LOADER_H
+
+#include <stddef.h>
+
+bool hasGLVersion(int major, int minor);
+bool hasGLExtension(const char *name);
+void *getGLProc(const char *name, const char *suffix = "");
+
+template <class T>
+bool loadGLFunction(T &function, const char *name, const char *suffix = "")
+{
+	function = (T)getGLProc(name, suffix);
+	return function != NULL;
+}
+
+#endif
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+// GLRenderer.cpp
+// ==============
+// Renderer on OpenGL 1.1. See GLRenderer.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "GLRenderer.h"
+
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F         // GL 1.2, the Windows headers stop at 1.1
+#endif
+
+namespace
+{
+	GLenum compareGL(CompareFunc func)
+	{
+		static const GLenum map[] = { GL_NEVER, GL_LESS, GL_EQUAL, GL_LEQUAL, GL_GREATER, GL_NOTEQUAL, GL_GEQUAL, GL_ALWAYS };
+		return map[func];
+	}
+
+	GLenum stencilOpGL(StencilOp op)
+	{
+		static const GLenum map[] = { GL_KEEP, GL_ZERO, GL_REPLACE, GL_INCR, GL_DECR, GL_INVERT };
+		return map[op];
+	}
+
+	void enable(GLenum cap, bool on)
+	{
+		if (on)
+			glEnable(cap);
+		else
+			glDisable(cap);
+	}
+}
+
+int GLRenderer::getWidth() const
+{
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	return viewport[2];
+}
+
+int GLRenderer::getHeight() const
+{
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	return viewport[3];
+}
+
+int GLRenderer::createTexture(int width, int height, const unsigned char *rgba)
+{
+	GLuint name;
+	glGenTextures(1, &name);
+	glBindTexture(GL_TEXTURE_2D, name);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return (int)name;
+}
+
+void GLRenderer::deleteTexture(int texture)
+{
+	GLuint name = (GLuint)texture;
+	glDeleteTextures(1, &name);
+}
+
+void GLRenderer::clear(unsigned int flags, const RenderColor &color, float depth, unsigned char stencil)
+{
+	glPushAttrib(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	GLbitfield mask = 0;
+	if (flags & CLEAR_COLOR)
+	{
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		glClearColor(color.red / 255.0f, color.green / 255.0f, color.blue / 255.0f, color.alpha / 255.0f);
+		mask |= GL_COLOR_BUFFER_BIT;
+	}
+	if (flags & CLEAR_DEPTH)
+	{
+		glDepthMask(GL_TRUE);
+		glClearDepth(depth);
+		mask |= GL_DEPTH_BUFFER_BIT;
+	}
+	if (flags & CLEAR_STENCIL)
+	{
+		glStencilMask(0xff);
+		glClearStencil(stencil);
+		mask |= GL_STENCIL_BUFFER_BIT;
+	}
+	glClear(mask);
+	glPopAttrib();
+}
+
+void GLRenderer::draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state)
+{
+	if (count == 0)
+		return;
+	glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT |
+		GL_POLYGON_BIT | GL_LINE_BIT | GL_POINT_BIT | GL_TEXTURE_BIT);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadMatrixf(state.transform.get());
+
+	glDisable(GL_LIGHTING);
+	glDisable(GL_FOG);
+	glDisable(GL_ALPHA_TEST);
+	glDisable(GL_SCISSOR_TEST);
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+	enable(GL_DEPTH_TEST, state.depthTest);
+	glDepthFunc(compareGL(state.depthFunc));
+	glDepthMask(state.depthWrite ? GL_TRUE : GL_FALSE);
+
+	enable(GL_STENCIL_TEST, state.stencilTest);
+	glStencilFunc(compareGL(state.stencilFunc), state.stencilRef, state.stencilMask);
+	glStencilOp(stencilOpGL(state.stencilFail), stencilOpGL(state.depthFail), stencilOpGL(state.depthPass));
+	glStencilMask(0xff);
+
+	enable(GL_BLEND, state.blend != BLEND_NONE);
+	if (state.blend == BLEND_ALPHA)
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	else if (state.blend == BLEND_ADD)
+		glBlendFunc(GL_ONE, GL_ONE);
+
+	enable(GL_CULL_FACE, state.cull != CULL_NONE);
+	glFrontFace(GL_CCW);
+	glCullFace(state.cull == CULL_FRONT ? GL_FRONT : GL_BACK);
+	GLboolean c = state.colorWrite ? GL_TRUE : GL_FALSE;
+	glColorMask(c, c, c, c);
+
+	enable(GL_TEXTURE_2D, state.texture != 0);
+	if (state.texture != 0)
+	{
+		GLint filter = state.filter == FILTER_LINEAR ? GL_LINEAR : GL_NEAREST;
+		GLint wrap = state.repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+		glBindTexture(GL_TEXTURE_2D, (GLuint)state.texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+		glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+	}
+	glLineWidth(state.lineWidth);
+	glPointSize(state.pointSize);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(RenderVertex), &vertices[0].x);
+	glTexCoordPointer(2, GL_FLOAT, sizeof(RenderVertex), &vertices[0].u);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(RenderVertex), &vertices[0].red);
+	static const GLenum mode[] = { GL_TRIANGLES, GL_LINES, GL_POINTS };
+	glDrawArrays(mode[type], 0, (GLsizei)count);
+
+	glPopMatrix();
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopClientAttrib();
+	glPopAttrib();
+}
+
+void GLRenderer::finish()
+{
+	glFinish();
+}
@@ -0,0 +1,29 @@
+///////////////////////////////////////////////////////////////////////////////
+// GLRenderer.h
+// ============
+// OpenGL 1.1 backend of the Renderer interface, drawing into the current
+// context with client-side vertex arrays. The target size is the viewport.
+// Each draw saves and restores the GL matrices and the state it touches,
+// so it can be mixed with a demo's own GL calls.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef GL_RENDERER_H
+#define GL_RENDERER_H
+
+#include "Renderer.h"
+
+class GLRenderer : public Renderer
+{
+public:
+	int getWidth() const;
+	int getHeight() const;
+
+	int createTexture(int width, int height, const unsigned char *rgba);    // the GL texture name
+	void deleteTexture(int texture);
+
+	void clear(unsigned int flags, const RenderColor &color, float depth = 1.0f, unsigned char stencil = 0);
+	void draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state);
+	void finish();
+};
+
+#endif
@@ -0,0 +1,343 @@
+///////////////////////////////////////////////////////////////////////////////
+// Geometry.cpp
+// ============
+// Intersection tests, single and batched. See Geometry.h.
+//
+// The batches run the single-test formulas on 4 elements per SSE register,
+// with the branches turned into masks; the elements after the last full
+// group of 4 go through the single tests.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cfloat>
+#include "Geometry.h"
+
+namespace
+{
+const float TRIANGLE_EPSILON = 1e-12f;                  // |det| below this: ray parallel to the triangle
+
+#if defined(MATH_SSE)
+typedef __m128 F4;
+inline F4 load4(const float* p)         { return _mm_loadu_ps(p); }
+inline void store4(float* p, F4 v)      { _mm_storeu_ps(p, v); }
+inline F4 set4(float s)                 { return _mm_set1_ps(s); }
+inline F4 add4(F4 a, F4 b)              { return _mm_add_ps(a, b); }
+inline F4 sub4(F4 a, F4 b)              { return _mm_sub_ps(a, b); }
+inline F4 mul4(F4 a, F4 b)              { return _mm_mul_ps(a, b); }
+inline F4 and4(F4 a, F4 b)              { return _mm_and_ps(a, b); }
+inline F4 less4(F4 a, F4 b)             { return _mm_cmplt_ps(a, b); }
+inline F4 lessEqual4(F4 a, F4 b)        { return _mm_cmple_ps(a, b); }
+inline F4 select4(F4 m, F4 a, F4 b)     { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+inline F4 abs4(F4 a)                    { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+// mask lanes to 0/1 flags; returns the number of set lanes
+inline size_t storeFlags(unsigned char* p, F4 mask)
+{
+    int bits = _mm_movemask_ps(mask);
+    p[0] = (unsigned char)(bits & 1);
+    p[1] = (unsigned char)((bits >> 1) & 1);
+    p[2] = (unsigned char)((bits >> 2) & 1);
+    p[3] = (unsigned char)((bits >> 3) & 1);
+    return p[0] + p[1] + p[2] + p[3];
+}
+#endif
+
+// v . (x, y, z) in the order every test below uses
+inline float dot3(float ax, float ay, float az, float bx, float by, float bz)
+{
+    return ax*bx + ay*by + az*bz;
+}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// shapes
+///////////////////////////////////////////////////////////////////////////////
+Plane Plane::fromPoints(const Vector3& v0, const Vector3& v1, const Vector3& v2)
+{
+    Vector3 n = (v1 - v0).cross(v2 - v0);
+    n.normalize();
+    return Plane(n, -n.dot(v0));
+}
+
+Frustum Frustum::fromMatrix(const Matrix4& viewProjection)
+{
+    // clip space -w <= x, y, z <= w: each plane is row 3 +- row 0, 1 or 2
+    const float* m = viewProjection.get();
+    const float sign[6] = { 1, -1, 1, -1, 1, -1 };
+    Frustum f;
+    for(int i = 0; i < 6; ++i)
+    {
+        int row = i / 2;
+        Vector3 n(m[3] + sign[i]*m[row], m[7] + sign[i]*m[4 + row], m[11] + sign[i]*m[8 + row]);
+        float d = m[15] + sign[i]*m[12 + row];
+        float invLength = 1.0f / n.length();
+        f.planes[i] = Plane(n * invLength, d * invLength);
+    }
+    return f;
+}
+
+Matrix4 shadowMatrix(const Plane& plane, const Vector4& light)
+{
+    // dot(plane, light) * I - light * plane^T
+    const float p[4] = { plane.normal.x, plane.normal.y, plane.normal.z, plane.d };
+    const float l[4] = { light.x, light.y, light.z, light.w };
+    float dot = p[0]*l[0] + p[1]*l[1] + p[2]*l[2] + p[3]*l[3];
+    float m[16];
+    for(int c = 0; c < 4; ++c)
+        for(int r = 0; r < 4; ++r)
+            m[c*4 + r] = (r == c ? dot : 0.0f) - l[r] * p[c];
+    return Matrix4(m);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// single tests
+///////////////////////////////////////////////////////////////////////////////
+bool intersectRaySphere(const Ray& ray, const Sphere& sphere, float& t)
+{
+    // |o + t*d - c|^2 = r^2  ->  a*t^2 + 2*b*t + cc = 0
+    const Vector3& d = ray.direction;
+    float invA = 1.0f / dot3(d.x, d.y, d.z, d.x, d.y, d.z);
+    float ox = ray.origin.x - sphere.center.x;
+    float oy = ray.origin.y - sphere.center.y;
+    float oz = ray.origin.z - sphere.center.z;
+    float b = dot3(ox, oy, oz, d.x, d.y, d.z);
+    float cc = dot3(ox, oy, oz, ox, oy, oz) - sphere.radius * sphere.radius;
+    float disc = b*b - cc * (1.0f / invA);
+    t = FLT_MAX;
+    if(!(disc >= 0))
+        return false;
+    float s = sqrtf(disc);
+    float t0 = (-b - s) * invA;                         // near side, or
+    float t1 = (-b + s) * invA;                         // far side when the origin is inside
+    float tt = t0 >= 0 ? t0 : t1;
+    if(!(tt >= 0))
+        return false;
+    t = tt;
+    return true;
+}
+
+bool intersectRayTriangle(const Ray& ray, const Vector3& v0, const Vector3& v1, const Vector3& v2,
+                          float& t, float& u, float& v)
+{
+    // Moller-Trumbore, both sides of the triangle
+    const Vector3& d = ray.direction;
+    float e1x = v1.x - v0.x, e1y = v1.y - v0.y, e1z = v1.z - v0.z;
+    float e2x = v2.x - v0.x, e2y = v2.y - v0.y, e2z = v2.z - v0.z;
+    float px = d.y*e2z - d.z*e2y, py = d.z*e2x - d.x*e2z, pz = d.x*e2y - d.y*e2x;    // d x e2
+    float det = dot3(e1x, e1y, e1z, px, py, pz);
+    float invDet = 1.0f / det;
+    float sx = ray.origin.x - v0.x, sy = ray.origin.y - v0.y, sz = ray.origin.z - v0.z;
+    float qx = sy*e1z - sz*e1y, qy = sz*e1x - sx*e1z, qz = sx*e1y - sy*e1x;         // s x e1
+    u = dot3(sx, sy, sz, px, py, pz) * invDet;
+    v = dot3(d.x, d.y, d.z, qx, qy, qz) * invDet;
+    float tt = dot3(e2x, e2y, e2z, qx, qy, qz) * invDet;
+    t = FLT_MAX;
+    if(!(fabsf(det) > TRIANGLE_EPSILON && u >= 0 && v >= 0 && u + v <= 1 && tt >= 0))
+        return false;
+    t = tt;
+    return true;
+}
+
+bool intersectSpherePlane(const Sphere& sphere, const Plane& plane, float& distance)
+{
+    const Vector3& n = plane.normal;
+    distance = dot3(n.x, n.y, n.z, sphere.center.x, sphere.center.y, sphere.center.z) + plane.d;
+    return fabsf(distance) <= sphere.radius;
+}
+
+bool overlapAABB(const AABB& a, const AABB& b)
+{
+    return a.min.x <= b.max.x && b.min.x <= a.max.x &&
+           a.min.y <= b.max.y && b.min.y <= a.max.y &&
+           a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+bool intersectFrustumAABB(const Frustum& frustum, const AABB& box)
+{
+    // the box is outside if its corner furthest along a plane normal is behind it
+    for(int i = 0; i < 6; ++i)
+    {
+        const Vector3& n = frustum.planes[i].normal;
+        float x = n.x >= 0 ? box.max.x : box.min.x;
+        float y = n.y >= 0 ? box.max.y : box.min.y;
+        float z = n.z >= 0 ? box.max.z : box.min.z;
+        if(!(dot3(n.x, n.y, n.z, x, y, z) + frustum.planes[i].d >= 0))
+            return false;
+    }
+    return true;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// batched tests
+///////////////////////////////////////////////////////////////////////////////
+size_t intersectRaySpheres(const Ray& ray, const SpheresSoA& s, size_t count, unsigned char* hit, float* t)
+{
+    size_t hits = 0, i = 0;
+#if defined(MATH_SSE)
+    const Vector3& d = ray.direction;
+    const float invA = 1.0f / dot3(d.x, d.y, d.z, d.x, d.y, d.z);
+    const F4 dx = set4(d.x), dy = set4(d.y), dz = set4(d.z);
+    const F4 vInvA = set4(invA), vA = set4(1.0f / invA), zero = set4(0.0f);
+    for(; i + 4 <= count; i += 4)
+    {
+        F4 ox = sub4(set4(ray.origin.x), load4(s.x + i));
+        F4 oy = sub4(set4(ray.origin.y), load4(s.y + i));
+        F4 oz = sub4(set4(ray.origin.z), load4(s.z + i));
+        F4 r = load4(s.radius + i);
+        F4 b = add4(add4(mul4(ox, dx), mul4(oy, dy)), mul4(oz, dz));
+        F4 cc = sub4(add4(add4(mul4(ox, ox), mul4(oy, oy)), mul4(oz, oz)), mul4(r, r));
+        F4 disc = sub4(mul4(b, b), mul4(cc, vA));
+        F4 sq = _mm_sqrt_ps(_mm_max_ps(disc, zero));    // no NaN in the lanes that miss
+        F4 nb = _mm_xor_ps(set4(-0.0f), b);
+        F4 t0 = mul4(sub4(nb, sq), vInvA);
+        F4 t1 = mul4(add4(nb, sq), vInvA);
+        F4 tt = select4(lessEqual4(zero, t0), t0, t1);
+        F4 mask = and4(lessEqual4(zero, disc), lessEqual4(zero, tt));
+        hits += storeFlags(hit + i, mask);
+        if(t)
+            store4(t + i, select4(mask, tt, set4(FLT_MAX)));
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        float ti;
+        hit[i] = intersectRaySphere(ray, Sphere(Vector3(s.x[i], s.y[i], s.z[i]), s.radius[i]), ti) ? 1 : 0;
+        hits += hit[i];
+        if(t)
+            t[i] = ti;
+    }
+    return hits;
+}
+
+size_t intersectRayTriangles(const Ray& ray, const TrianglesSoA& tri, size_t count, unsigned char* hit, float* t)
+{
+    size_t hits = 0, i = 0;
+#if defined(MATH_SSE)
+    const F4 dx = set4(ray.direction.x), dy = set4(ray.direction.y), dz = set4(ray.direction.z);
+    const F4 zero = set4(0.0f), one = set4(1.0f), eps = set4(TRIANGLE_EPSILON);
+    for(; i + 4 <= count; i += 4)
+    {
+        F4 x0 = load4(tri.x0 + i), y0 = load4(tri.y0 + i), z0 = load4(tri.z0 + i);
+        F4 e1x = sub4(load4(tri.x1 + i), x0), e1y = sub4(load4(tri.y1 + i), y0), e1z = sub4(load4(tri.z1 + i), z0);
+        F4 e2x = sub4(load4(tri.x2 + i), x0), e2y = sub4(load4(tri.y2 + i), y0), e2z = sub4(load4(tri.z2 + i), z0);
+        F4 px = sub4(mul4(dy, e2z), mul4(dz, e2y));
+        F4 py = sub4(mul4(dz, e2x), mul4(dx, e2z));
+        F4 pz = sub4(mul4(dx, e2y), mul4(dy, e2x));
+        F4 det = add4(add4(mul4(e1x, px), mul4(e1y, py)), mul4(e1z, pz));
+        F4 invDet = _mm_div_ps(one, det);
+        F4 sx = sub4(set4(ray.origin.x), x0), sy = sub4(set4(ray.origin.y), y0), sz = sub4(set4(ray.origin.z), z0);
+        F4 qx = sub4(mul4(sy, e1z), mul4(sz, e1y));
+        F4 qy = sub4(mul4(sz, e1x), mul4(sx, e1z));
+        F4 qz = sub4(mul4(sx, e1y), mul4(sy, e1x));
+        F4 u = mul4(add4(add4(mul4(sx, px), mul4(sy, py)), mul4(sz, pz)), invDet);
+        F4 v = mul4(add4(add4(mul4(dx, qx), mul4(dy, qy)), mul4(dz, qz)), invDet);
+        F4 tt = mul4(add4(add4(mul4(e2x, qx), mul4(e2y, qy)), mul4(e2z, qz)), invDet);
+        F4 mask = and4(less4(eps, abs4(det)), lessEqual4(zero, u));
+        mask = and4(mask, lessEqual4(zero, v));
+        mask = and4(mask, lessEqual4(add4(u, v), one));
+        mask = and4(mask, lessEqual4(zero, tt));
+        hits += storeFlags(hit + i, mask);
+        if(t)
+            store4(t + i, select4(mask, tt, set4(FLT_MAX)));
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        float ti, u, v;
+        hit[i] = intersectRayTriangle(ray, Vector3(tri.x0[i], tri.y0[i], tri.z0[i]), Vector3(tri.x1[i], tri.y1[i], tri.z1[i]),
+                                      Vector3(tri.x2[i], tri.y2[i], tri.z2[i]), ti, u, v) ? 1 : 0;
+        hits += hit[i];
+        if(t)
+            t[i] = ti;
+    }
+    return hits;
+}
+
+size_t intersectSpheresPlane(const SpheresSoA& s, size_t count, const Plane& plane, unsigned char* hit, float* distance)
+{
+    size_t hits = 0, i = 0;
+#if defined(MATH_SSE)
+    const F4 nx = set4(plane.normal.x), ny = set4(plane.normal.y), nz = set4(plane.normal.z), pd = set4(plane.d);
+    for(; i + 4 <= count; i += 4)
+    {
+        F4 dist = add4(add4(add4(mul4(nx, load4(s.x + i)), mul4(ny, load4(s.y + i))), mul4(nz, load4(s.z + i))), pd);
+        hits += storeFlags(hit + i, lessEqual4(abs4(dist), load4(s.radius + i)));
+        if(distance)
+            store4(distance + i, dist);
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        float dist;
+        hit[i] = intersectSpherePlane(Sphere(Vector3(s.x[i], s.y[i], s.z[i]), s.radius[i]), plane, dist) ? 1 : 0;
+        hits += hit[i];
+        if(distance)
+            distance[i] = dist;
+    }
+    return hits;
+}
+
+size_t overlapAABBs(const AABB& box, const BoxesSoA& b, size_t count, unsigned char* hit)
+{
+    size_t hits = 0, i = 0;
+#if defined(MATH_SSE)
+    const F4 minX = set4(box.min.x), minY = set4(box.min.y), minZ = set4(box.min.z);
+    const F4 maxX = set4(box.max.x), maxY = set4(box.max.y), maxZ = set4(box.max.z);
+    for(; i + 4 <= count; i += 4)
+    {
+        F4 mask = and4(lessEqual4(minX, load4(b.maxX + i)), lessEqual4(load4(b.minX + i), maxX));
+        mask = and4(mask, and4(lessEqual4(minY, load4(b.maxY + i)), lessEqual4(load4(b.minY + i), maxY)));
+        mask = and4(mask, and4(lessEqual4(minZ, load4(b.maxZ + i)), lessEqual4(load4(b.minZ + i), maxZ)));
+        hits += storeFlags(hit + i, mask);
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        hit[i] = overlapAABB(box, AABB(Vector3(b.minX[i], b.minY[i], b.minZ[i]), Vector3(b.maxX[i], b.maxY[i], b.maxZ[i]))) ? 1 : 0;
+        hits += hit[i];
+    }
+    return hits;
+}
+
+size_t intersectFrustumAABBs(const Frustum& frustum, const BoxesSoA& b, size_t count, unsigned char* visible)
+{
+    size_t hits = 0, i = 0;
+#if defined(MATH_SSE)
+    // the furthest corner along each plane normal picks min or max per axis,
+    // the same choice for every box
+    const float* corner[6][3];
+    F4 nx[6], ny[6], nz[6], pd[6];
+    for(int p = 0; p < 6; ++p)
+    {
+        const Plane& plane = frustum.planes[p];
+        corner[p][0] = plane.normal.x >= 0 ? b.maxX : b.minX;
+        corner[p][1] = plane.normal.y >= 0 ? b.maxY : b.minY;
+        corner[p][2] = plane.normal.z >= 0 ? b.maxZ : b.minZ;
+        nx[p] = set4(plane.normal.x); ny[p] = set4(plane.normal.y); nz[p] = set4(plane.normal.z); pd[p] = set4(plane.d);
+    }
+    const F4 zero = set4(0.0f);
+    for(; i + 4 <= count; i += 4)
+    {
+        F4 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for(int p = 0; p < 6; ++p)
+        {
+            F4 dist = add4(add4(mul4(nx[p], load4(corner[p][0] + i)), mul4(ny[p], load4(corner[p][1] + i))),
+                           mul4(nz[p], load4(corner[p][2] + i)));
+            mask = and4(mask, lessEqual4(zero, add4(dist, pd[p])));
+        }
+        hits += storeFlags(visible + i, mask);
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        visible[i] = intersectFrustumAABB(frustum, AABB(Vector3(b.minX[i], b.minY[i], b.minZ[i]), Vector3(b.maxX[i], b.maxY[i], b.maxZ[i]))) ? 1 : 0;
+        hits += visible[i];
+    }
+    return hits;
+}
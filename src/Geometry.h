@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+// Geometry.h
+// ==========
+// Rays, spheres, planes, boxes and frustums, and batched intersection tests
+//
+// Each test comes as a function on single objects and as a batch that runs
+// one query object (a ray, a plane, a box, a frustum) against arrays of the
+// other kind in SoA form, 4 at a time with SSE on x86/x64 (elsewhere one at
+// a time; define MATH_NO_SIMD for that on x86 too). A batch gives exactly
+// the results of the single test on every element: both do the same float
+// operations in the same order. Batches write one flag per element (1 =
+// hit) and return the number of hits; the optional arrays may be NULL.
+//
+// Tests that touch only at the boundary count as hits. Rays hit from
+// t = 0 on, so a ray starting inside a sphere hits its far side.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_GEOMETRY_H
+#define MATH_GEOMETRY_H
+
+#include <cstddef>
+#include "Matrices.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// shapes
+///////////////////////////////////////////////////////////////////////////////
+struct Ray
+{
+    Vector3 origin;
+    Vector3 direction;                                  // need not be unit length; t is in its units
+
+    Ray() {}
+    Ray(const Vector3& origin, const Vector3& direction) : origin(origin), direction(direction) {}
+    Vector3 at(float t) const                           { return origin + direction * t; }
+};
+
+struct Sphere
+{
+    Vector3 center;
+    float   radius;
+
+    Sphere() : radius(0) {}
+    Sphere(const Vector3& center, float radius) : center(center), radius(radius) {}
+};
+
+// points p with normal . p + d = 0; normal is unit length, it points to the
+// positive side
+struct Plane
+{
+    Vector3 normal;
+    float   d;
+
+    Plane() : normal(0, 1, 0), d(0) {}
+    Plane(const Vector3& normal, float d) : normal(normal), d(d) {}
+    static Plane fromPoints(const Vector3& v0, const Vector3& v1, const Vector3& v2); // normal (v1-v0) x (v2-v0)
+    float   distance(const Vector3& p) const            { return normal.dot(p) + d; } // signed
+};
+
+struct AABB
+{
+    Vector3 min;
+    Vector3 max;
+
+    AABB() {}
+    AABB(const Vector3& lo, const Vector3& hi)          { min = lo; max = hi; } // not min(lo): windows.h min/max macros
+};
+
+// the 6 planes of a view volume, normals pointing inwards
+struct Frustum
+{
+    enum { LEFT, RIGHT, BOTTOM, TOP, NEAR_PLANE, FAR_PLANE };
+    Plane   planes[6];
+
+    static Frustum fromMatrix(const Matrix4& viewProjection); // world space planes of projection * view
+};
+
+// flattens geometry onto the plane as seen from the light (w = 0 for a
+// directional light), for planar projected shadows
+Matrix4 shadowMatrix(const Plane& plane, const Vector4& light);
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// single tests
+///////////////////////////////////////////////////////////////////////////////
+bool intersectRaySphere(const Ray& ray, const Sphere& sphere, float& t);
+bool intersectRayTriangle(const Ray& ray, const Vector3& v0, const Vector3& v1, const Vector3& v2,
+                          float& t, float& u, float& v);   // u, v: barycentric weights of v1 and v2
+bool intersectSpherePlane(const Sphere& sphere, const Plane& plane, float& distance); // |distance| <= radius
+bool overlapAABB(const AABB& a, const AABB& b);
+bool intersectFrustumAABB(const Frustum& frustum, const AABB& box); // false only if the box is surely outside
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// SoA arrays and batched tests
+///////////////////////////////////////////////////////////////////////////////
+struct SpheresSoA   { const float *x, *y, *z, *radius; };
+struct TrianglesSoA { const float *x0, *y0, *z0, *x1, *y1, *z1, *x2, *y2, *z2; };
+struct BoxesSoA     { const float *minX, *minY, *minZ, *maxX, *maxY, *maxZ; };
+
+// t of each hit (FLT_MAX for a miss)
+size_t intersectRaySpheres(const Ray& ray, const SpheresSoA& spheres, size_t count,
+                           unsigned char* hit, float* t = NULL);
+size_t intersectRayTriangles(const Ray& ray, const TrianglesSoA& triangles, size_t count,
+                             unsigned char* hit, float* t = NULL);
+// signed distance of each center
+size_t intersectSpheresPlane(const SpheresSoA& spheres, size_t count, const Plane& plane,
+                             unsigned char* hit, float* distance = NULL);
+size_t overlapAABBs(const AABB& box, const BoxesSoA& boxes, size_t count, unsigned char* hit);
+size_t intersectFrustumAABBs(const Frustum& frustum, const BoxesSoA& boxes, size_t count, unsigned char* visible);
+
+#endif
@@ -0,0 +1,579 @@
+///////////////////////////////////////////////////////////////////////////////
+// GeometryBench.cpp
+// =================
+// Geometry test check and microbenchmark. See GeometryBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "BenchCommon.h"
+#include "SimRandom.h"
+#include "Camera.h"
+#include "Geometry.h"
+#include "GeometryBench.h"
+
+namespace
+{
+	struct Data
+	{
+		Ray ray;
+		Plane plane;
+		AABB box;
+		Frustum frustum;
+
+		// the same objects as AoS for the single tests and SoA for the batches
+		std::vector<Sphere> spheres;
+		std::vector<float> sphereX, sphereY, sphereZ, sphereR;
+		std::vector<Vector3> triangles;                     // 3 vertices each
+		std::vector<float> triangle[9];                     // x0 y0 z0 x1 ... z2
+		std::vector<AABB> boxes;
+		std::vector<float> boxMin[3], boxMax[3];
+
+		// results of the run under test
+		std::vector<unsigned char> hit;
+		std::vector<float> value;
+
+		SpheresSoA spheresSoA() const
+		{
+			SpheresSoA s = { &sphereX[0], &sphereY[0], &sphereZ[0], &sphereR[0] };
+			return s;
+		}
+
+		TrianglesSoA trianglesSoA() const
+		{
+			TrianglesSoA t = { &triangle[0][0], &triangle[1][0], &triangle[2][0], &triangle[3][0], &triangle[4][0],
+				&triangle[5][0], &triangle[6][0], &triangle[7][0], &triangle[8][0] };
+			return t;
+		}
+
+		BoxesSoA boxesSoA() const
+		{
+			BoxesSoA b = { &boxMin[0][0], &boxMin[1][0], &boxMin[2][0], &boxMax[0][0], &boxMax[1][0], &boxMax[2][0] };
+			return b;
+		}
+
+		void clearSpheres()
+		{
+			spheres.clear();
+			sphereX.clear();
+			sphereY.clear();
+			sphereZ.clear();
+			sphereR.clear();
+		}
+
+		void clearBoxes()
+		{
+			boxes.clear();
+			for (int k = 0; k < 3; k++)
+			{
+				boxMin[k].clear();
+				boxMax[k].clear();
+			}
+		}
+
+		void addSphere(const Sphere &s)
+		{
+			spheres.push_back(s);
+			sphereX.push_back(s.center.x);
+			sphereY.push_back(s.center.y);
+			sphereZ.push_back(s.center.z);
+			sphereR.push_back(s.radius);
+		}
+
+		void addTriangle(const Vector3 &v0, const Vector3 &v1, const Vector3 &v2)
+		{
+			const Vector3 v[3] = { v0, v1, v2 };
+			for (int k = 0; k < 3; k++)
+			{
+				triangles.push_back(v[k]);
+				triangle[3 * k].push_back(v[k].x);
+				triangle[3 * k + 1].push_back(v[k].y);
+				triangle[3 * k + 2].push_back(v[k].z);
+			}
+		}
+
+		void addBox(const AABB &b)
+		{
+			boxes.push_back(b);
+			for (int k = 0; k < 3; k++)
+			{
+				boxMin[k].push_back(b.min[k]);
+				boxMax[k].push_back(b.max[k]);
+			}
+		}
+	};
+
+	// every form is called through a pointer so none is inlined into the timing loop
+	typedef size_t (*Run)(Data &d);
+
+	size_t raySpheresSingle(Data &d)
+	{
+		size_t hits = 0;
+		for (size_t i = 0; i < d.spheres.size(); i++)
+		{
+			d.hit[i] = intersectRaySphere(d.ray, d.spheres[i], d.value[i]) ? 1 : 0;
+			hits += d.hit[i];
+		}
+		return hits;
+	}
+
+	size_t raySpheresBatch(Data &d)
+	{
+		return intersectRaySpheres(d.ray, d.spheresSoA(), d.spheres.size(), &d.hit[0], &d.value[0]);
+	}
+
+	size_t rayTrianglesSingle(Data &d)
+	{
+		size_t hits = 0;
+		const size_t n = d.triangles.size() / 3;
+		for (size_t i = 0; i < n; i++)
+		{
+			float u, v;
+			d.hit[i] = intersectRayTriangle(d.ray, d.triangles[3 * i], d.triangles[3 * i + 1], d.triangles[3 * i + 2],
+				d.value[i], u, v) ? 1 : 0;
+			hits += d.hit[i];
+		}
+		return hits;
+	}
+
+	size_t rayTrianglesBatch(Data &d)
+	{
+		return intersectRayTriangles(d.ray, d.trianglesSoA(), d.triangles.size() / 3, &d.hit[0], &d.value[0]);
+	}
+
+	size_t spheresPlaneSingle(Data &d)
+	{
+		size_t hits = 0;
+		for (size_t i = 0; i < d.spheres.size(); i++)
+		{
+			d.hit[i] = intersectSpherePlane(d.spheres[i], d.plane, d.value[i]) ? 1 : 0;
+			hits += d.hit[i];
+		}
+		return hits;
+	}
+
+	size_t spheresPlaneBatch(Data &d)
+	{
+		return intersectSpheresPlane(d.spheresSoA(), d.spheres.size(), d.plane, &d.hit[0], &d.value[0]);
+	}
+
+	size_t boxesSingle(Data &d)
+	{
+		size_t hits = 0;
+		for (size_t i = 0; i < d.boxes.size(); i++)
+		{
+			d.hit[i] = overlapAABB(d.box, d.boxes[i]) ? 1 : 0;
+			hits += d.hit[i];
+		}
+		return hits;
+	}
+
+	size_t boxesBatch(Data &d)
+	{
+		return overlapAABBs(d.box, d.boxesSoA(), d.boxes.size(), &d.hit[0]);
+	}
+
+	size_t frustumSingle(Data &d)
+	{
+		size_t hits = 0;
+		for (size_t i = 0; i < d.boxes.size(); i++)
+		{
+			d.hit[i] = intersectFrustumAABB(d.frustum, d.boxes[i]) ? 1 : 0;
+			hits += d.hit[i];
+		}
+		return hits;
+	}
+
+	size_t frustumBatch(Data &d)
+	{
+		return intersectFrustumAABBs(d.frustum, d.boxesSoA(), d.boxes.size(), &d.hit[0]);
+	}
+
+	// The double precision answer for element i: the flag, the t or distance
+	// of a hit with the error allowed in the float one, and whether the
+	// element lies so close to the boundary of the test that float rounding
+	// may decide it either way; those are left out of the check.
+	struct Reference
+	{
+		bool hit;
+		double value;
+		double tolerance;
+		bool close;
+	};
+
+	typedef Reference (*ReferenceTest)(const Data &d, size_t i);
+
+	const double CLOSE = 1e-5;                          // relative distance to the boundary
+	const double VALUE_TOLERANCE = 1e-4;                // relative error of t and distance, well conditioned
+
+	double dot(double ax, double ay, double az, double bx, double by, double bz)
+	{
+		return ax * bx + ay * by + az * bz;
+	}
+
+	Reference raySphereReference(const Data &d, size_t i)
+	{
+		const Vector3 &dir = d.ray.direction;
+		const Sphere &s = d.spheres[i];
+		const double ox = (double)d.ray.origin.x - s.center.x;
+		const double oy = (double)d.ray.origin.y - s.center.y;
+		const double oz = (double)d.ray.origin.z - s.center.z;
+		const double a = dot(dir.x, dir.y, dir.z, dir.x, dir.y, dir.z);
+		const double b = dot(ox, oy, oz, dir.x, dir.y, dir.z);
+		const double c = dot(ox, oy, oz, ox, oy, oz) - (double)s.radius * s.radius;
+		const double disc = b * b - a * c;
+		Reference ref = { false, 0.0, 0.0, fabs(disc) <= CLOSE * (b * b + fabs(a * c)) };
+		if (disc < 0.0)
+			return ref;
+		const double root = sqrt(disc), t0 = (-b - root) / a, t1 = (-b + root) / a;
+		const double scale = (fabs(b) + root) / a + 1.0;
+		ref.close = ref.close || fabs(t0) <= CLOSE * scale || fabs(t1) <= CLOSE * scale;
+		ref.value = t0 >= 0.0 ? t0 : t1;
+		ref.tolerance = VALUE_TOLERANCE * fmax(1.0, fabs(ref.value));
+		ref.hit = ref.value >= 0.0;
+		return ref;
+	}
+
+	Reference rayTriangleReference(const Data &d, size_t i)
+	{
+		const Vector3 &dir = d.ray.direction, &o = d.ray.origin;
+		const Vector3 &v0 = d.triangles[3 * i], &v1 = d.triangles[3 * i + 1], &v2 = d.triangles[3 * i + 2];
+		const double e1x = (double)v1.x - v0.x, e1y = (double)v1.y - v0.y, e1z = (double)v1.z - v0.z;
+		const double e2x = (double)v2.x - v0.x, e2y = (double)v2.y - v0.y, e2z = (double)v2.z - v0.z;
+		const double px = dir.y * e2z - dir.z * e2y, py = dir.z * e2x - dir.x * e2z, pz = dir.x * e2y - dir.y * e2x;
+		const double det = dot(e1x, e1y, e1z, px, py, pz);
+		const double sx = (double)o.x - v0.x, sy = (double)o.y - v0.y, sz = (double)o.z - v0.z;
+		const double qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+		const double u = dot(sx, sy, sz, px, py, pz) / det;
+		const double v = dot(dir.x, dir.y, dir.z, qx, qy, qz) / det;
+		const double t = dot(e2x, e2y, e2z, qx, qy, qz) / det;
+
+		// the float test takes |det| <= 1e-12 as parallel; t loses accuracy as
+		// the ray turns parallel to the triangle, by size / |det|
+		const double size = sqrt(dot(e1x, e1y, e1z, e1x, e1y, e1z) * dot(e2x, e2y, e2z, e2x, e2y, e2z) *
+			dot(dir.x, dir.y, dir.z, dir.x, dir.y, dir.z));
+		const double scale = sqrt(dot(sx, sy, sz, sx, sy, sz)) + 1.0;
+		Reference ref = { fabs(det) > 1e-12 && u >= 0.0 && v >= 0.0 && u + v <= 1.0 && t >= 0.0, t,
+			VALUE_TOLERANCE * fmax(1.0, fabs(t)) * size / fabs(det), fabs(det) <= CLOSE * size || fabs(u) <= CLOSE || fabs(v) <= CLOSE || fabs(1.0 - u - v) <= CLOSE ||
+			fabs(t) <= CLOSE * scale };
+		return ref;
+	}
+
+	Reference spherePlaneReference(const Data &d, size_t i)
+	{
+		const Vector3 &n = d.plane.normal;
+		const Sphere &s = d.spheres[i];
+		const double along = dot(n.x, n.y, n.z, s.center.x, s.center.y, s.center.z);
+		const double distance = along + d.plane.d;
+		Reference ref = { fabs(distance) <= s.radius, distance, VALUE_TOLERANCE * fmax(1.0, fabs(distance)),
+			fabs(fabs(distance) - s.radius) <= CLOSE * (fabs(along) + fabs(d.plane.d) + s.radius) };
+		return ref;
+	}
+
+	// the float test only compares, so it is exact
+	Reference boxReference(const Data &d, size_t i)
+	{
+		const AABB &a = d.box, &b = d.boxes[i];
+		bool hit = true;
+		for (int k = 0; k < 3; k++)
+			hit = hit && (double)a.min[k] <= b.max[k] && (double)b.min[k] <= a.max[k];
+		Reference ref = { hit, 0.0, 0.0, false };
+		return ref;
+	}
+
+	// the same corner test as intersectFrustumAABB(), in double
+	Reference frustumReference(const Data &d, size_t i)
+	{
+		const AABB &box = d.boxes[i];
+		Reference ref = { true, 0.0, 0.0, false };
+		for (int p = 0; p < 6; p++)
+		{
+			const Vector3 &n = d.frustum.planes[p].normal;
+			const double x = n.x >= 0 ? box.max.x : box.min.x;
+			const double y = n.y >= 0 ? box.max.y : box.min.y;
+			const double z = n.z >= 0 ? box.max.z : box.min.z;
+			const double along = dot(n.x, n.y, n.z, x, y, z);
+			const double distance = along + d.frustum.planes[p].d;
+			ref.hit = ref.hit && distance >= 0.0;
+			ref.close = ref.close || fabs(distance) <= CLOSE * (fabs(along) + fabs(d.frustum.planes[p].d));
+		}
+		return ref;
+	}
+
+	// runs the single test and the batch over count elements, the first of
+	// which are the edge cases with the expected flags; the single test is
+	// checked against the reference, the batch against the single test.
+	// Tests without a value pass withValue false.
+	int compare(std::vector<GeometryBenchRow> &rows, const char *test, Run single, Run batch, ReferenceTest reference,
+		bool withValue, Data &d, size_t count, const std::vector<unsigned char> &expected, int repeats)
+	{
+		d.hit.assign(count, 2);
+		d.value.assign(count, 0.0f);
+		size_t singleHits = single(d);
+		const std::vector<unsigned char> singleHit = d.hit;
+		const std::vector<float> singleValue = d.value;
+
+		d.hit.assign(count, 2);
+		d.value.assign(count, 0.0f);
+		size_t batchHits = batch(d);
+		int singleMismatches = 0, batchMismatches = batchHits != singleHits ? 1 : 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			if (i < expected.size() && singleHit[i] != expected[i])
+			{
+				printf("geombench: %s edge case %d: expected %d\n", test, (int)i, expected[i]);
+				singleMismatches++;
+			}
+			const Reference ref = reference(d, i);
+			if (!ref.close && (singleHit[i] != (ref.hit ? 1 : 0) || (withValue && ref.hit &&
+				fabs(singleValue[i] - ref.value) > ref.tolerance)))
+			{
+				if (singleMismatches < 10)
+					printf("geombench: %s element %d: %d %g, double precision %d %g\n", test, (int)i, singleHit[i],
+						singleValue[i], ref.hit ? 1 : 0, ref.value);
+				singleMismatches++;
+			}
+			if (d.hit[i] != singleHit[i] || d.value[i] != singleValue[i])
+				batchMismatches++;
+		}
+
+		const char *forms[] = { "single", "batch" };
+		const Run runs[] = { single, batch };
+		const int mismatches[] = { singleMismatches, batchMismatches };
+		double ns[2];
+		bestNsInTurns(2, [&](int k) { for (int r = 0; r < repeats; r++) runs[k](d); }, ns);
+		for (int k = 0; k < 2; k++)
+		{
+			GeometryBenchRow row;
+			row.test = test;
+			row.form = forms[k];
+			row.count = (int)count;
+			row.nsPerElement = ns[k] / ((double)repeats * count);
+			row.hits = (int)singleHits;
+			row.mismatches = mismatches[k];
+			rows.push_back(row);
+		}
+		return singleMismatches + batchMismatches;
+	}
+
+	Vector3 randomVector(SimRandom &random, double lo, double hi)
+	{
+		return Vector3((float)random.uniform(lo, hi), (float)random.uniform(lo, hi), (float)random.uniform(lo, hi));
+	}
+}
+
+int runGeometryBench(int count, double hitFraction, int repeats, std::vector<GeometryBenchRow> &rows)
+{
+	rows.clear();
+	Data d;
+	SimRandom random(5489u);
+	std::vector<unsigned char> expected;
+	int mismatches = 0;
+
+	// queries: a ray down -z from the origin, the plane y = 0, a box around
+	// the origin and the view volume of a camera at (0, 0, 10) looking at it
+	d.ray = Ray(Vector3(0, 0, 0), Vector3(0, 0, -1));
+	d.plane = Plane(Vector3(0, 1, 0), 0);
+	d.box = AABB(Vector3(-1, -1, -1), Vector3(1, 1, 1));
+	d.frustum = Frustum::fromMatrix(perspectiveMatrix(45.f, 4.f / 3.f, 0.1f, 50.f) *
+		lookAtMatrix(Vector3(0, 0, 10), Vector3(0, 0, 0), Vector3(0, 1, 0)));
+
+	// spheres; the ray tests use the ray, the plane tests the plane. Each test
+	// gets its own random spheres after the edge cases, a hitFraction of
+	// them placed to hit and the rest to miss, clear of the boundary.
+	const Sphere edgeSpheres[] =
+	{
+		Sphere(Vector3(0, 0, -5), 1),                   // ray: straight hit     plane: through
+		Sphere(Vector3(1, 0, -5), 1),                   // ray: grazing          plane: through
+		Sphere(Vector3(0, 0, 0), 1),                    // ray: inside           plane: through
+		Sphere(Vector3(0, 0, 5), 1),                    // ray: behind           plane: through
+		Sphere(Vector3(0, 2, -5), 1),                   // ray: passes by        plane: above
+		Sphere(Vector3(0, 1, -5), 1),                   // ray: grazing          plane: touching
+		Sphere(Vector3(3, -1, 0), 1),                   // ray: passes by        plane: touching
+		Sphere(Vector3(0, -1.5f, 0), 1),                // ray: passes by        plane: below
+	};
+	const unsigned char sphereRay[] = { 1, 1, 1, 0, 0, 1, 0, 0 };
+	const unsigned char spherePlane[] = { 1, 1, 1, 1, 0, 1, 1, 0 };
+
+	for (const Sphere &s : edgeSpheres)
+		d.addSphere(s);
+	for (int i = 0; i < count; i++)
+	{
+		// around a point of the ray's line, off it by under 0.9 radii for a
+		// hit, over 1.1 for a miss; a fifth of the misses are behind the origin
+		const bool hit = random.uniform01() < hitFraction;
+		const double r = random.uniform(0.5, 3.0), angle = random.uniform(0.0, 6.283185307);
+		double z = -random.uniform(2.0, 40.0), off = random.uniform(0.0, 0.9) * r;
+		if (!hit && random.uniform01() < 0.2)
+			z = random.uniform(1.1 * r, 40.0);
+		else if (!hit)
+			off = random.uniform(1.1, 3.0) * r;
+		d.addSphere(Sphere(Vector3((float)(off * cos(angle)), (float)(off * sin(angle)), (float)z), (float)r));
+	}
+	expected.assign(sphereRay, sphereRay + 8);
+	mismatches += compare(rows, "ray-sphere", raySpheresSingle, raySpheresBatch, raySphereReference, true, d,
+		d.spheres.size(), expected, repeats);
+
+	d.clearSpheres();
+	for (const Sphere &s : edgeSpheres)
+		d.addSphere(s);
+	for (int i = 0; i < count; i++)
+	{
+		// the center under 0.9 radii from the plane for a hit, over 1.1 for a miss
+		const bool hit = random.uniform01() < hitFraction;
+		const double r = random.uniform(0.5, 3.0);
+		const double y = (hit ? random.uniform(0.0, 0.9) : random.uniform(1.1, 3.0)) * r;
+		d.addSphere(Sphere(Vector3((float)random.uniform(-20.0, 20.0), (float)(random.uniform01() < 0.5 ? -y : y),
+			(float)random.uniform(-20.0, 20.0)), (float)r));
+	}
+	expected.assign(spherePlane, spherePlane + 8);
+	mismatches += compare(rows, "sphere-plane", spheresPlaneSingle, spheresPlaneBatch, spherePlaneReference, true, d,
+		d.spheres.size(), expected, repeats);
+
+	// triangles
+	d.addTriangle(Vector3(-1, -1, -2), Vector3(1, -1, -2), Vector3(0, 1, -2));  // hit
+	d.addTriangle(Vector3(-1, -1, -2), Vector3(0, 1, -2), Vector3(1, -1, -2));  // hit, back side
+	d.addTriangle(Vector3(0, 0, -2), Vector3(1, 0, -2), Vector3(0, 1, -2));     // hit at v0
+	d.addTriangle(Vector3(-1, 0, -2), Vector3(1, 0, -2), Vector3(0, 1, -2));    // hit on the edge v0-v1
+	d.addTriangle(Vector3(-1, -1, 2), Vector3(1, -1, 2), Vector3(0, 1, 2));     // behind
+	d.addTriangle(Vector3(1, 1, -2), Vector3(2, 1, -2), Vector3(1, 2, -2));     // passes by
+	d.addTriangle(Vector3(0, -1, -1), Vector3(0, 1, -1), Vector3(0, 0, -3));    // parallel, contains the ray
+	d.addTriangle(Vector3(-1, -1, -2), Vector3(0, 0, -2), Vector3(1, 1, -2));   // degenerate
+	const unsigned char triangleRay[] = { 1, 1, 1, 1, 0, 0, 0, 0 };
+	for (int i = 0; i < count; i++)
+	{
+		// random edges, moved so that the ray's line meets the plane of the
+		// triangle at barycentric (u, v): inside with a margin of 0.05 for a
+		// hit, outside by as much for a miss, or inside but behind the origin
+		const bool hit = random.uniform01() < hitFraction;
+		const Vector3 e1 = randomVector(random, -3.0, 3.0), e2 = randomVector(random, -3.0, 3.0);
+		double z = -random.uniform(1.0, 40.0), u = random.uniform(0.05, 0.9), v = random.uniform(0.05, 0.95 - u);
+		if (!hit)
+		{
+			const double a = random.uniform01();
+			switch (random.nextInt(4))
+			{
+			case 0: z = -z; break;
+			case 1: u = -random.uniform(0.05, 1.0); v = a; break;
+			case 2: v = -random.uniform(0.05, 1.0); u = a; break;
+			default: u = random.uniform(1.05, 2.0) * a; v = random.uniform(1.05, 2.0) * (1.0 - a) + 0.05; break;
+			}
+		}
+		const Vector3 v0 = Vector3(0, 0, (float)z) - e1 * (float)u - e2 * (float)v;
+		d.addTriangle(v0, v0 + e1, v0 + e2);
+	}
+	expected.assign(triangleRay, triangleRay + 8);
+	mismatches += compare(rows, "ray-triangle", rayTrianglesSingle, rayTrianglesBatch, rayTriangleReference, true, d,
+		d.triangles.size() / 3, expected, repeats);
+
+	// boxes; the overlap tests use the box, the frustum tests the frustum
+	const AABB edgeBoxes[] =
+	{
+		AABB(Vector3(-0.5f, -0.5f, -0.5f), Vector3(0.5f, 0.5f, 0.5f)),         // box: inside           frustum: inside
+		AABB(Vector3(1, -1, -1), Vector3(2, 1, 1)),                             // box: touching face    frustum: inside
+		AABB(Vector3(1, 1, 1), Vector3(2, 2, 2)),                               // box: touching corner  frustum: inside
+		AABB(Vector3(1.5f, -1, -1), Vector3(2, 1, 1)),                          // box: gap on x         frustum: inside
+		AABB(Vector3(-1, -1, 11), Vector3(1, 1, 13)),                           // box: gap on z         frustum: behind the camera
+		AABB(Vector3(-1, -1, -45), Vector3(1, 1, -41)),                         // box: gap on z         frustum: beyond far
+		AABB(Vector3(-1, -1, -41), Vector3(1, 1, -39)),                         // box: gap on z         frustum: across far
+		AABB(Vector3(20, -1, -1), Vector3(22, 1, 1)),                           // box: gap on x         frustum: right of it
+	};
+	const unsigned char boxBox[] = { 1, 1, 1, 0, 0, 0, 0, 0 };
+	const unsigned char boxFrustum[] = { 1, 1, 1, 1, 0, 0, 1, 0 };
+
+	for (const AABB &b : edgeBoxes)
+		d.addBox(b);
+	for (int i = 0; i < count; i++)
+	{
+		// overlapping the query box by at least 0.01 on every axis for a hit;
+		// for a miss apart by 0.01 or more on one axis
+		const bool hit = random.uniform01() < hitFraction;
+		const int apart = hit ? -1 : random.nextInt(3);
+		Vector3 lo, size = randomVector(random, 0.1, 4.0);
+		for (int k = 0; k < 3; k++)
+		{
+			if (k != apart)
+				lo[k] = (float)random.uniform(-0.99 - size[k], 0.99);
+			else if (random.uniform01() < 0.5)
+				lo[k] = (float)(1.01 + random.uniform(0.0, 20.0));
+			else
+				lo[k] = (float)(-1.01 - size[k] - random.uniform(0.0, 20.0));
+		}
+		d.addBox(AABB(lo, lo + size));
+	}
+	expected.assign(boxBox, boxBox + 8);
+	mismatches += compare(rows, "aabb-aabb", boxesSingle, boxesBatch, boxReference, false, d, d.boxes.size(),
+		expected, repeats);
+
+	d.clearBoxes();
+	for (const AABB &b : edgeBoxes)
+		d.addBox(b);
+	for (int i = 0; i < count; i++)
+	{
+		// a cube of half size h around a point at the given depth in front
+		// of the camera: within 0.9 of the half width and height of the view
+		// for a hit; for a miss beyond far, behind the camera, or to a side
+		// by 2h and more, which takes every corner out past that plane
+		const bool hit = random.uniform01() < hitFraction;
+		const double h = random.uniform(0.05, 0.5);
+		double depth = random.uniform(1.0, 45.0);
+		const double halfHeight = tan(22.5 * 3.14159265358979 / 180.0) * depth, halfWidth = halfHeight * 4.0 / 3.0;
+		double x = random.uniform(-0.9, 0.9) * halfWidth, y = random.uniform(-0.9, 0.9) * halfHeight;
+		if (!hit)
+		{
+			const double beyond = random.uniform(0.5, 20.0), sign = random.uniform01() < 0.5 ? -1.0 : 1.0;
+			switch (random.nextInt(4))
+			{
+			case 0: depth = 50.0 + h + beyond; break;
+			case 1: depth = -h - beyond; break;
+			case 2: x = sign * (halfWidth + 2.0 * h + beyond); break;
+			default: y = sign * (halfHeight + 2.0 * h + beyond); break;
+			}
+		}
+		const Vector3 center((float)x, (float)y, (float)(10.0 - depth));
+		d.addBox(AABB(center - Vector3((float)h, (float)h, (float)h), center + Vector3((float)h, (float)h, (float)h)));
+	}
+	expected.assign(boxFrustum, boxFrustum + 8);
+	mismatches += compare(rows, "frustum-aabb", frustumSingle, frustumBatch, frustumReference, false, d,
+		d.boxes.size(), expected, repeats);
+	return mismatches;
+}
+
+int runGeometryBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("geombench", argc, argv);
+	const char *outFile = args.text("out", "geometry_bench.csv");
+	const int count = args.integer("count", 4095);      // + 8 edge cases: 4103, not a multiple of 4
+	const int repeats = args.integer("repeats", 500);
+	const double hitFraction = args.number("hits", 0.5);
+	args.reportUnknown();
+	if (count < 0 || repeats <= 0 || hitFraction < 0.0 || hitFraction > 1.0)
+	{
+		printf("geombench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<GeometryBenchRow> rows;
+	int mismatches = runGeometryBench(count, hitFraction, repeats, rows);
+	double base = 0.0;
+	for (auto &row : rows)
+	{
+		if (strcmp(row.form, "single") == 0)
+			base = row.nsPerElement;
+		printf("%-13s %-7s %6.2f ns  x%.2f  %5d hits  %d mismatches\n", row.test, row.form, row.nsPerElement,
+			base / row.nsPerElement, row.hits, row.mismatches);
+	}
+
+	FILE *fp = openCsv("geombench", outFile, "test,form,count,ns_per_element,hits,mismatches");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%s,%d,%.4f,%d,%d\n", row.test, row.form, row.count, row.nsPerElement, row.hits, row.mismatches);
+	if (!closeCsv("geombench", fp, outFile))
+		return 1;
+	if (mismatches)
+		printf("geombench: %d mismatches\n", mismatches);
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,43 @@
+///////////////////////////////////////////////////////////////////////////////
+// GeometryBench.h
+// ===============
+// Correctness check and throughput of the batched geometry tests (Geometry.h).
+//
+// Each test runs over a set of edge cases with known answers (grazing rays,
+// touching spheres and boxes, rays starting inside a sphere, parallel and
+// degenerate triangles) followed by random objects, of which a chosen
+// fraction is placed to hit the query and the rest to miss it, clear of the
+// boundary either way.
+//
+// The check compares the single test against the same test worked out in
+// double on every element, flags and t/distance (elements within 1e-5 of
+// the boundary are skipped: float rounding may put them on either side),
+// the edge cases against their expected flags, and the batch against the
+// single test, exactly. The timing gives ns per element for a loop over the
+// single test (AoS objects) and for the batch (SoA arrays).
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOMETRY_BENCH_H
+#define GEOMETRY_BENCH_H
+
+#include <vector>
+
+struct GeometryBenchRow
+{
+	const char *test;           // ray-sphere, ray-triangle, ...
+	const char *form;           // single, batch
+	int count;
+	double nsPerElement;
+	int hits;
+	int mismatches;             // single: against double precision and the edge cases; batch: against single
+};
+
+// count random objects per test, hitFraction of them hits (0 to 1);
+// returns the total number of mismatches
+int runGeometryBench(int count, double hitFraction, int repeats, std::vector<GeometryBenchRow> &rows);
+
+// benchCheck's command line front end, exits with 1 on any mismatch:
+//   -geombench [out=file.csv] [count=n] [hits=fraction] [repeats=n]
+int runGeometryBenchCommand(int argc, char *argv[]);
+
+#endif
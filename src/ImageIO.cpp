@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+// ImageIO.cpp
+// ===========
+// PPM and uncompressed PNG writers. See ImageIO.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "ImageIO.h"
+
+namespace
+{
+	const unsigned char *row(const unsigned char *rgba, int width, int height, int y, bool bottomUp)
+	{
+		return rgba + (size_t)(bottomUp ? height - 1 - y : y) * width * 4;
+	}
+
+	unsigned int crcTable[256];
+
+	unsigned int crc32(unsigned int crc, const unsigned char *p, size_t size)
+	{
+		if (crcTable[1] == 0)
+		{
+			for (unsigned int n = 0; n < 256; n++)
+			{
+				unsigned int c = n;
+				for (int k = 0; k < 8; k++)
+					c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+				crcTable[n] = c;
+			}
+		}
+		crc = ~crc;
+		for (size_t i = 0; i < size; i++)
+			crc = crcTable[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+		return ~crc;
+	}
+
+	void putU32BigEndian(std::vector<unsigned char> &buf, unsigned int v)
+	{
+		buf.push_back((unsigned char)(v >> 24));
+		buf.push_back((unsigned char)(v >> 16));
+		buf.push_back((unsigned char)(v >> 8));
+		buf.push_back((unsigned char)v);
+	}
+
+	// length | type | data | crc of type and data
+	bool writeChunk(FILE *fp, const char *type, const std::vector<unsigned char> &data)
+	{
+		std::vector<unsigned char> chunk;
+		putU32BigEndian(chunk, (unsigned int)data.size());
+		chunk.insert(chunk.end(), type, type + 4);
+		chunk.insert(chunk.end(), data.begin(), data.end());
+		putU32BigEndian(chunk, crc32(0, &chunk[4], chunk.size() - 4));
+		return fwrite(&chunk[0], 1, chunk.size(), fp) == chunk.size();
+	}
+}
+
+bool writePPM(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp)
+{
+	FILE *fp;
+	if ((fp = fopen(fileName, "wb")) == NULL)
+		return false;
+	fprintf(fp, "P6\n%d %d\n255\n", width, height);
+	std::vector<unsigned char> rgb(width * 3);
+	bool ok = true;
+	for (int y = 0; y < height && ok; y++)
+	{
+		const unsigned char *p = row(rgba, width, height, y, bottomUp);
+		for (int x = 0; x < width; x++)
+			memcpy(&rgb[x * 3], p + x * 4, 3);
+		ok = fwrite(&rgb[0], 1, rgb.size(), fp) == rgb.size();
+	}
+	return fclose(fp) == 0 && ok;
+}
+
+bool writePNG(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp)
+{
+	// the zlib stream: each row is filter byte 0 and the pixels, cut into
+	// stored deflate blocks of at most 65535 bytes
+	std::vector<unsigned char> raw;
+	raw.reserve((size_t)height * (width * 4 + 1));
+	for (int y = 0; y < height; y++)
+	{
+		const unsigned char *p = row(rgba, width, height, y, bottomUp);
+		raw.push_back(0);
+		raw.insert(raw.end(), p, p + width * 4);
+	}
+	std::vector<unsigned char> z;
+	z.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+	z.push_back(0x78);
+	z.push_back(0x01);
+	unsigned int a = 1, b = 0;
+	size_t done = 0;
+	do
+	{
+		size_t n = raw.size() - done < 65535 ? raw.size() - done : 65535;
+		z.push_back(done + n == raw.size() ? 1 : 0);
+		z.push_back((unsigned char)n);
+		z.push_back((unsigned char)(n >> 8));
+		z.push_back((unsigned char)~n);
+		z.push_back((unsigned char)(~n >> 8));
+		z.insert(z.end(), raw.begin() + done, raw.begin() + done + n);
+		for (size_t i = done; i < done + n; i++)
+		{
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		done += n;
+	} while (done < raw.size());
+	putU32BigEndian(z, (b << 16) | a);
+
+	std::vector<unsigned char> header;
+	putU32BigEndian(header, width);
+	putU32BigEndian(header, height);
+	const unsigned char format[5] = { 8, 6, 0, 0, 0 };    // 8 bit RGBA, deflate, no interlace
+	header.insert(header.end(), format, format + 5);
+
+	FILE *fp;
+	if ((fp = fopen(fileName, "wb")) == NULL)
+		return false;
+	const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	bool ok = fwrite(signature, 1, 8, fp) == 8 && writeChunk(fp, "IHDR", header) && writeChunk(fp, "IDAT", z) &&
+		writeChunk(fp, "IEND", std::vector<unsigned char>());
+	return fclose(fp) == 0 && ok;
+}
+
+bool writeImage(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp)
+{
+	size_t n = strlen(fileName);
+	if (n >= 4 && (strcmp(fileName + n - 4, ".png") == 0 || strcmp(fileName + n - 4, ".PNG") == 0))
+		return writePNG(fileName, rgba, width, height, bottomUp);
+	return writePPM(fileName, rgba, width, height, bottomUp);
+}
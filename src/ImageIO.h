@@ -0,0 +1,21 @@
+///////////////////////////////////////////////////////////////////////////////
+// ImageIO.h
+// =========
+// Writes RGBA8 images as binary PPM (P6, alpha dropped) or PNG.
+//
+// The PNG writer needs no zlib: it stores the rows in uncompressed deflate
+// blocks, so the files are about as big as the PPM ones but keep alpha
+// and open everywhere. Rows are top first unless bottomUp is set, which
+// is the order of glReadPixels and SoftRenderer.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef IMAGE_IO_H
+#define IMAGE_IO_H
+
+bool writePPM(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp = false);
+bool writePNG(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp = false);
+
+// picks the format from the extension (.png, anything else PPM)
+bool writeImage(const char *fileName, const unsigned char *rgba, int width, int height, bool bottomUp = false);
+
+#endif
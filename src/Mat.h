@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+// Mat.h
+// =====
+// Mat<N,T>: NxN column-major matrix of T, the matrix partner of Vec<N,T>
+//
+// Mat<2,float>, Mat<3,float> and Mat<4,float> are Matrix2, Matrix3 and
+// Matrix4 from Matrices.h, with their full API and the SSE/NEON paths of
+// Matrix4. Every other size and precision is MatN<N,T> below, which has the
+// part of that API a simulation needs: identity, element access, rows and
+// columns as Vec, transpose, and matrix * matrix / matrix * vector.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_MAT_H
+#define MATH_MAT_H
+
+#include <iostream>
+#include "Matrices.h"
+
+template<int N, typename T>
+class MatN
+{
+public:
+    // constructors
+    MatN()                                              { identity(); }   // init with identity
+    MatN(const T src[N*N])                              { set(src); }
+    template<typename U>
+    explicit MatN(const MatN<N, U>& rhs)                { for(int i = 0; i < N*N; ++i) m[i] = T(rhs[i]); }
+
+    void        set(const T src[N*N])                   { for(int i = 0; i < N*N; ++i) m[i] = src[i]; }
+    template<int M>
+    void        setRow(int index, const Vec<M, T>& v);  // first M columns of the row, M <= N
+    template<int M>
+    void        setColumn(int index, const Vec<M, T>& v); // first M rows of the column, M <= N
+    Vec<N, T>   getRow(int index) const;
+    Vec<N, T>   getColumn(int index) const;
+
+    const T*    get() const                             { return m; }
+    MatN&       identity();
+    MatN&       transpose();                            // transpose itself and return reference
+
+    // operators
+    MatN        operator+(const MatN& rhs) const;       // add rhs
+    MatN        operator-(const MatN& rhs) const;       // subtract rhs
+    MatN&       operator+=(const MatN& rhs)             { return *this = *this + rhs; }
+    MatN&       operator-=(const MatN& rhs)             { return *this = *this - rhs; }
+    Vec<N, T>   operator*(const Vec<N, T>& rhs) const;  // multiplication: v' = M * v
+    MatN        operator*(const MatN& rhs) const;       // multiplication: M3 = M1 * M2
+    MatN&       operator*=(const MatN& rhs)             { return *this = *this * rhs; }
+    bool        operator==(const MatN& rhs) const;      // exact compare, no epsilon
+    bool        operator!=(const MatN& rhs) const       { return !(*this == rhs); }
+    T           operator[](int index) const             { return m[index]; } // subscript operator v[0], v[1]
+    T&          operator[](int index)                   { return m[index]; } // subscript operator v[0], v[1]
+
+    friend std::ostream& operator<<(std::ostream& os, const MatN& m)
+    {
+        for(int r = 0; r < N; ++r)
+        {
+            os << "[";
+            for(int c = 0; c < N; ++c)
+                os << (c ? " " : "") << m[c*N + r];
+            os << "]\n";
+        }
+        return os;
+    }
+
+protected:
+    T m[N*N];
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Mat<N,T>: the float 2x2, 3x3 and 4x4 go to Matrices.h
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T> struct MatSelect        { typedef MatN<N, T> type; };
+template<> struct MatSelect<2, float>               { typedef Matrix2 type; };
+template<> struct MatSelect<3, float>               { typedef Matrix3 type; };
+template<> struct MatSelect<4, float>               { typedef Matrix4 type; };
+
+template<int N, typename T> using Mat = typename MatSelect<N, T>::type;
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// inline functions for MatN
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T>
+template<int M>
+inline void MatN<N, T>::setRow(int index, const Vec<M, T>& v)
+{
+    static_assert(M <= N, "row vector longer than the matrix");
+    for(int c = 0; c < M; ++c)
+        m[c*N + index] = v[c];
+}
+
+template<int N, typename T>
+template<int M>
+inline void MatN<N, T>::setColumn(int index, const Vec<M, T>& v)
+{
+    static_assert(M <= N, "column vector longer than the matrix");
+    for(int r = 0; r < M; ++r)
+        m[index*N + r] = v[r];
+}
+
+template<int N, typename T>
+inline Vec<N, T> MatN<N, T>::getRow(int index) const
+{
+    Vec<N, T> v;
+    for(int c = 0; c < N; ++c)
+        v[c] = m[c*N + index];
+    return v;
+}
+
+template<int N, typename T>
+inline Vec<N, T> MatN<N, T>::getColumn(int index) const
+{
+    Vec<N, T> v;
+    for(int r = 0; r < N; ++r)
+        v[r] = m[index*N + r];
+    return v;
+}
+
+template<int N, typename T>
+inline MatN<N, T>& MatN<N, T>::identity()
+{
+    for(int i = 0; i < N*N; ++i)
+        m[i] = (i % (N + 1) == 0) ? T(1) : T(0);
+    return *this;
+}
+
+template<int N, typename T>
+inline MatN<N, T>& MatN<N, T>::transpose()
+{
+    for(int c = 0; c < N; ++c)
+        for(int r = c + 1; r < N; ++r)
+        {
+            T t = m[c*N + r];
+            m[c*N + r] = m[r*N + c];
+            m[r*N + c] = t;
+        }
+    return *this;
+}
+
+template<int N, typename T>
+inline MatN<N, T> MatN<N, T>::operator+(const MatN& rhs) const
+{
+    MatN r;
+    for(int i = 0; i < N*N; ++i)
+        r.m[i] = m[i] + rhs.m[i];
+    return r;
+}
+
+template<int N, typename T>
+inline MatN<N, T> MatN<N, T>::operator-(const MatN& rhs) const
+{
+    MatN r;
+    for(int i = 0; i < N*N; ++i)
+        r.m[i] = m[i] - rhs.m[i];
+    return r;
+}
+
+template<int N, typename T>
+inline Vec<N, T> MatN<N, T>::operator*(const Vec<N, T>& rhs) const
+{
+    // sum of the columns weighted by the vector, in the order Matrix4 uses
+    Vec<N, T> v;
+    for(int r = 0; r < N; ++r)
+    {
+        T s = m[r] * rhs[0];
+        for(int c = 1; c < N; ++c)
+            s += m[c*N + r] * rhs[c];
+        v[r] = s;
+    }
+    return v;
+}
+
+template<int N, typename T>
+inline MatN<N, T> MatN<N, T>::operator*(const MatN& rhs) const
+{
+    MatN r;
+    for(int c = 0; c < N; ++c)
+    {
+        Vec<N, T> col = *this * rhs.getColumn(c);
+        for(int i = 0; i < N; ++i)
+            r.m[c*N + i] = col[i];
+    }
+    return r;
+}
+
+template<int N, typename T>
+inline bool MatN<N, T>::operator==(const MatN& rhs) const
+{
+    for(int i = 0; i < N*N; ++i)
+        if(m[i] != rhs.m[i])
+            return false;
+    return true;
+}
+
+#endif
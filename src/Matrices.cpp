@@ -143,6 +143,32 @@ Matrix3& Matrix3::invert()
 // transpose 4x4 matrix
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::transpose()
+{
+#if defined(MATH_SSE)
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(m, c0);
+    _mm_storeu_ps(m + 4, c1);
+    _mm_storeu_ps(m + 8, c2);
+    _mm_storeu_ps(m + 12, c3);
+    return *this;
+#elif defined(MATH_NEON)
+    // the de-interleaving load reads the matrix already transposed
+    float32x4x4_t t = vld4q_f32(m);
+    vst1q_f32(m, t.val[0]);
+    vst1q_f32(m + 4, t.val[1]);
+    vst1q_f32(m + 8, t.val[2]);
+    vst1q_f32(m + 12, t.val[3]);
+    return *this;
+#else
+    return transposeScalar(*this);
+#endif
+}
+
+Matrix4& transposeScalar(Matrix4& m)
 {
     std::swap(m[1],  m[4]);
     std::swap(m[2],  m[8]);
@@ -151,7 +177,7 @@ Matrix4& Matrix4::transpose()
     std::swap(m[7],  m[13]);
     std::swap(m[11], m[14]);
 
-    return *this;
+    return m;
 }
 
 
@@ -248,6 +274,55 @@ Matrix4& Matrix4::invertEuclidean()
 //  [ 0 | 1 ]     [  0   +     1     ]
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::invertAffine()
+{
+#if defined(MATH_SSE)
+    // The rows of R^-1 are the cross products of the columns of R divided by
+    // det(R). The products and sums are ordered like Matrix3::invert() so
+    // the result matches the scalar path bit for bit.
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    #define YZX(v) _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1))
+    #define ZXY(v) _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2))
+    __m128 r0 = _mm_sub_ps(_mm_mul_ps(YZX(c1), ZXY(c2)), _mm_mul_ps(ZXY(c1), YZX(c2)));   // c1 x c2
+    __m128 r1 = _mm_sub_ps(_mm_mul_ps(ZXY(c0), YZX(c2)), _mm_mul_ps(YZX(c0), ZXY(c2)));   // c2 x c0
+    __m128 r2 = _mm_sub_ps(_mm_mul_ps(YZX(c0), ZXY(c1)), _mm_mul_ps(ZXY(c0), YZX(c1)));   // c0 x c1
+    #undef YZX
+    #undef ZXY
+
+    // det = c0 . (c1 x c2)
+    __m128 d = _mm_mul_ps(c0, r0);
+    __m128 det = _mm_add_ss(_mm_add_ss(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 1, 1, 1))),
+                            _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 2, 2, 2)));
+    if(fabs(_mm_cvtss_f32(det)) > EPSILON)
+    {
+        __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(det, det, 0));
+        r0 = _mm_mul_ps(invDet, r0);
+        r1 = _mm_mul_ps(invDet, r1);
+        r2 = _mm_mul_ps(invDet, r2);
+
+        // rows to columns; column 3 becomes -R^-1 * T below
+        __m128 t = _mm_loadu_ps(m + 12);
+        __m128 r3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        __m128 p = _mm_mul_ps(r0, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+        p = _mm_add_ps(p, _mm_mul_ps(r1, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))));
+        p = _mm_add_ps(p, _mm_mul_ps(r2, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2))));
+        float w[4] = { m[3], m[7], m[11], m[15] };
+        _mm_storeu_ps(m, r0);
+        _mm_storeu_ps(m + 4, r1);
+        _mm_storeu_ps(m + 8, r2);
+        _mm_storeu_ps(m + 12, _mm_xor_ps(p, _mm_set1_ps(-0.0f)));   // -p, signed zeros as in the scalar code
+        // last row should be unchanged (0,0,0,1)
+        m[3] = w[0];  m[7] = w[1];  m[11] = w[2];  m[15] = w[3];
+        return *this;
+    }
+    // singular R: the scalar code resets R to identity
+#endif
+    return invertAffineScalar(*this);
+}
+
+Matrix4& invertAffineScalar(Matrix4& m)
 {
     // R^-1
     Matrix3 r(m[0],m[1],m[2], m[4],m[5],m[6], m[8],m[9],m[10]);
@@ -268,7 +343,7 @@ Matrix4& Matrix4::invertAffine()
     //m[3] = m[7] = m[11] = 0.0f;
     //m[15] = 1.0f;
 
-    return * this;
+    return m;
 }
 
 
@@ -9,6 +9,19 @@
 //            | 2 5 8 |    |  2  6 10 14 |
 //                         |  3  7 11 15 |
 //
+// Matrix4 keeps its 16 floats 16-byte aligned. transpose() and
+// invertAffine() use SSE on x86/x64 and NEON on ARM; define MATH_NO_SIMD to
+// build the scalar code instead. The SIMD paths do the same multiplies and
+// adds in the same order as the scalar ones, so both give bit-identical
+// results; the scalar code is also built with SIMD on, as the *Scalar
+// functions after Matrix4, and benchCheck -matrixbench checks the two
+// against each other. Loads and stores are unaligned so heap blocks with
+// 8-byte alignment (32-bit new) are fine.
+//
+// Matrix4 x Matrix4 and Matrix4 x Vector4 are the scalar multiplyScalar()
+// on every target: the bench had hand-written SSE forms of them 10-25%
+// slower than what the compiler makes of the scalar code.
+//
 //  AUTHOR: Song Ho Ahn (song.ahn@gmail.com)
 // CREATED: 2005-06-24
 // UPDATED: 2013-09-30
@@ -21,7 +34,7 @@
 
 #include <iostream>
 #include <iomanip>
-#include "Vectors.h"
+#include "Vectors.h"                     // also sets MATH_SSE / MATH_NEON (Vec.h)
 
 ///////////////////////////////////////////////////////////////////////////
 // 2x2 matrix
@@ -157,8 +170,18 @@ public:
     void        setColumn(int index, const Vector4& v);
     void        setColumn(int index, const Vector3& v);
 
+    // the transposed elements; they convert to const float* for glLoadMatrixf()
+    // and the like, a pointer that lives as long as the returned object (to
+    // the end of the statement when it is a temporary)
+    struct Transposed
+    {
+        float m[16];
+        operator const float*() const { return m; }
+    };
+
     const float* get() const;
-    const float* getTranspose();                        // return transposed matrix
+    Transposed  getTranspose() const;                   // return transposed matrix
+    Matrix4     getTransposed() const;                  // return transposed copy
     float        getDeterminant();
 
     Matrix4&    identity();
@@ -207,11 +230,19 @@ private:
                             float m3, float m4, float m5,
                             float m6, float m7, float m8);
 
-    float m[16];
-    float tm[16];                                       // transpose m
+    alignas(16) float m[16];
 
 };
 
+// the scalar products, which operator* uses everywhere
+Vector4         multiplyScalar(const Matrix4& m, const Vector4& v);    // m * v
+Matrix4         multiplyScalar(const Matrix4& m, const Matrix4& n);    // m * n
+
+// the scalar code of Matrix4's SIMD paths: what MATH_NO_SIMD builds, and in
+// SIMD builds the reference for checking them
+Matrix4&        transposeScalar(Matrix4& m);
+Matrix4&        invertAffineScalar(Matrix4& m);
+
 
 
 ///////////////////////////////////////////////////////////////////////////
@@ -734,13 +765,21 @@ inline const float* Matrix4::get() const
 
 
 
-inline const float* Matrix4::getTranspose()
+inline Matrix4::Transposed Matrix4::getTranspose() const
+{
+    Transposed t;
+    t.m[0] = m[0];   t.m[1] = m[4];   t.m[2] = m[8];   t.m[3] = m[12];
+    t.m[4] = m[1];   t.m[5] = m[5];   t.m[6] = m[9];   t.m[7] = m[13];
+    t.m[8] = m[2];   t.m[9] = m[6];   t.m[10]= m[10];  t.m[11]= m[14];
+    t.m[12]= m[3];   t.m[13]= m[7];   t.m[14]= m[11];  t.m[15]= m[15];
+    return t;
+}
+
+
+
+inline Matrix4 Matrix4::getTransposed() const
 {
-    tm[0] = m[0];   tm[1] = m[4];   tm[2] = m[8];   tm[3] = m[12];
-    tm[4] = m[1];   tm[5] = m[5];   tm[6] = m[9];   tm[7] = m[13];
-    tm[8] = m[2];   tm[9] = m[6];   tm[10]= m[10];  tm[11]= m[14];
-    tm[12]= m[3];   tm[13]= m[7];   tm[14]= m[11];  tm[15]= m[15];
-    return tm;
+    return Matrix4(*this).transpose();
 }
 
 
@@ -798,10 +837,7 @@ inline Matrix4& Matrix4::operator-=(const Matrix4& rhs)
 
 inline Vector4 Matrix4::operator*(const Vector4& rhs) const
 {
-    return Vector4(m[0]*rhs.x + m[4]*rhs.y + m[8]*rhs.z  + m[12]*rhs.w,
-                   m[1]*rhs.x + m[5]*rhs.y + m[9]*rhs.z  + m[13]*rhs.w,
-                   m[2]*rhs.x + m[6]*rhs.y + m[10]*rhs.z + m[14]*rhs.w,
-                   m[3]*rhs.x + m[7]*rhs.y + m[11]*rhs.z + m[15]*rhs.w);
+    return multiplyScalar(*this, rhs);
 }
 
 
@@ -816,6 +852,23 @@ inline Vector3 Matrix4::operator*(const Vector3& rhs) const
 
 
 inline Matrix4 Matrix4::operator*(const Matrix4& n) const
+{
+    return multiplyScalar(*this, n);
+}
+
+
+
+inline Vector4 multiplyScalar(const Matrix4& m, const Vector4& v)
+{
+    return Vector4(m[0]*v.x + m[4]*v.y + m[8]*v.z  + m[12]*v.w,
+                   m[1]*v.x + m[5]*v.y + m[9]*v.z  + m[13]*v.w,
+                   m[2]*v.x + m[6]*v.y + m[10]*v.z + m[14]*v.w,
+                   m[3]*v.x + m[7]*v.y + m[11]*v.z + m[15]*v.w);
+}
+
+
+
+inline Matrix4 multiplyScalar(const Matrix4& m, const Matrix4& n)
 {
     return Matrix4(m[0]*n[0]  + m[4]*n[1]  + m[8]*n[2]  + m[12]*n[3],   m[1]*n[0]  + m[5]*n[1]  + m[9]*n[2]  + m[13]*n[3],   m[2]*n[0]  + m[6]*n[1]  + m[10]*n[2]  + m[14]*n[3],   m[3]*n[0]  + m[7]*n[1]  + m[11]*n[2]  + m[15]*n[3],
                    m[0]*n[4]  + m[4]*n[5]  + m[8]*n[6]  + m[12]*n[7],   m[1]*n[4]  + m[5]*n[5]  + m[9]*n[6]  + m[13]*n[7],   m[2]*n[4]  + m[6]*n[5]  + m[10]*n[6]  + m[14]*n[7],   m[3]*n[4]  + m[7]*n[5]  + m[11]*n[6]  + m[15]*n[7],
@@ -0,0 +1,352 @@
+///////////////////////////////////////////////////////////////////////////////
+// MatrixBatch.cpp
+// ===============
+// Transforms arrays of points, normals and axis-aligned boxes by one Matrix4
+//
+// Each transform is written once as a kernel on 4 elements in SoA form.
+// SoA inputs feed it directly; strided inputs are gathered into 4-wide
+// blocks first. The remainder of an array goes through a zero-padded block.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "MatrixBatch.h"
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// 4 floats: one SSE/NEON register, or a plain array in the scalar build
+///////////////////////////////////////////////////////////////////////////////
+#if defined(MATH_SSE)
+typedef __m128 F4;
+inline F4 load4(const float* p)         { return _mm_loadu_ps(p); }
+inline void store4(float* p, F4 v)      { _mm_storeu_ps(p, v); }
+inline F4 set4(float s)                 { return _mm_set1_ps(s); }
+inline F4 add4(F4 a, F4 b)              { return _mm_add_ps(a, b); }
+inline F4 sub4(F4 a, F4 b)              { return _mm_sub_ps(a, b); }
+inline F4 mul4(F4 a, F4 b)              { return _mm_mul_ps(a, b); }
+inline F4 div4(F4 a, F4 b)              { return _mm_div_ps(a, b); }
+inline F4 sqrt4(F4 a)                   { return _mm_sqrt_ps(a); }
+#elif defined(MATH_NEON)
+typedef float32x4_t F4;
+inline F4 load4(const float* p)         { return vld1q_f32(p); }
+inline void store4(float* p, F4 v)      { vst1q_f32(p, v); }
+inline F4 set4(float s)                 { return vdupq_n_f32(s); }
+inline F4 add4(F4 a, F4 b)              { return vaddq_f32(a, b); }
+inline F4 sub4(F4 a, F4 b)              { return vsubq_f32(a, b); }
+inline F4 mul4(F4 a, F4 b)              { return vmulq_f32(a, b); }
+#if defined(__aarch64__) || defined(_M_ARM64)
+inline F4 div4(F4 a, F4 b)              { return vdivq_f32(a, b); }
+inline F4 sqrt4(F4 a)                   { return vsqrtq_f32(a); }
+#else
+// ARMv7 NEON has no divide or square root
+inline F4 div4(F4 a, F4 b)
+{
+    float x[4], y[4];
+    vst1q_f32(x, a);  vst1q_f32(y, b);
+    for(int i = 0; i < 4; ++i) x[i] /= y[i];
+    return vld1q_f32(x);
+}
+inline F4 sqrt4(F4 a)
+{
+    float x[4];
+    vst1q_f32(x, a);
+    for(int i = 0; i < 4; ++i) x[i] = sqrtf(x[i]);
+    return vld1q_f32(x);
+}
+#endif
+#else
+struct F4 { float v[4]; };
+inline F4 load4(const float* p)         { F4 r; for(int i = 0; i < 4; ++i) r.v[i] = p[i]; return r; }
+inline void store4(float* p, F4 a)      { for(int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+inline F4 set4(float s)                 { F4 r; for(int i = 0; i < 4; ++i) r.v[i] = s; return r; }
+inline F4 add4(F4 a, F4 b)              { for(int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+inline F4 sub4(F4 a, F4 b)              { for(int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+inline F4 mul4(F4 a, F4 b)              { for(int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+inline F4 div4(F4 a, F4 b)              { for(int i = 0; i < 4; ++i) a.v[i] /= b.v[i]; return a; }
+inline F4 sqrt4(F4 a)                   { for(int i = 0; i < 4; ++i) a.v[i] = sqrtf(a.v[i]); return a; }
+#endif
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// 3x3 matrix plus translation, splatted once per call
+///////////////////////////////////////////////////////////////////////////////
+struct Splat
+{
+    F4 c[12];   // column-major 3x3 in c[0..8], translation in c[9..11]
+
+    Splat(const float r[9], const float t[3])
+    {
+        for(int i = 0; i < 9; ++i) c[i] = set4(r[i]);
+        for(int i = 0; i < 3; ++i) c[9 + i] = set4(t[i]);
+    }
+
+    // out = R * in (+ T)
+    void apply(F4 x, F4 y, F4 z, F4& ox, F4& oy, F4& oz, bool translate) const
+    {
+        ox = add4(add4(mul4(c[0], x), mul4(c[3], y)), mul4(c[6], z));
+        oy = add4(add4(mul4(c[1], x), mul4(c[4], y)), mul4(c[7], z));
+        oz = add4(add4(mul4(c[2], x), mul4(c[5], y)), mul4(c[8], z));
+        if(translate)
+        {
+            ox = add4(ox, c[9]);
+            oy = add4(oy, c[10]);
+            oz = add4(oz, c[11]);
+        }
+    }
+};
+
+void upperLeft(const Matrix4& m, float r[9], float t[3])
+{
+    const float* a = m.get();
+    r[0] = a[0];  r[1] = a[1];  r[2] = a[2];
+    r[3] = a[4];  r[4] = a[5];  r[5] = a[6];
+    r[6] = a[8];  r[7] = a[9];  r[8] = a[10];
+    t[0] = a[12]; t[1] = a[13]; t[2] = a[14];
+}
+
+// (R^-1)^T: its columns are the cross products of the columns of R over det(R);
+// a singular R leaves the normals untouched
+void normalMatrix(const Matrix4& m, float n[9])
+{
+    float r[9], t[3];
+    upperLeft(m, r, t);
+    n[0] = r[4] * r[8] - r[5] * r[7];  n[1] = r[5] * r[6] - r[3] * r[8];  n[2] = r[3] * r[7] - r[4] * r[6];
+    n[3] = r[7] * r[2] - r[8] * r[1];  n[4] = r[8] * r[0] - r[6] * r[2];  n[5] = r[6] * r[1] - r[7] * r[0];
+    n[6] = r[1] * r[5] - r[2] * r[4];  n[7] = r[2] * r[3] - r[0] * r[5];  n[8] = r[0] * r[4] - r[1] * r[3];
+    float det = r[0] * n[0] + r[1] * n[1] + r[2] * n[2];
+    if(std::fabs(det) <= 0.00001f)
+    {
+        for(int i = 0; i < 9; ++i) n[i] = (i % 4 == 0) ? 1.0f : 0.0f;
+        return;
+    }
+    float invDet = 1.0f / det;
+    for(int i = 0; i < 9; ++i) n[i] *= invDet;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// kernels: 4 elements in, 4 out
+///////////////////////////////////////////////////////////////////////////////
+struct PointKernel
+{
+    Splat s;
+    PointKernel(const float r[9], const float t[3]) : s(r, t) {}
+    void operator()(const F4* in, F4* out) const { s.apply(in[0], in[1], in[2], out[0], out[1], out[2], true); }
+};
+
+struct NormalKernel
+{
+    Splat s;
+    bool normalize;
+    NormalKernel(const float n[9], const float t[3], bool norm) : s(n, t), normalize(norm) {}
+    void operator()(const F4* in, F4* out) const
+    {
+        s.apply(in[0], in[1], in[2], out[0], out[1], out[2], false);
+        if(normalize)
+        {
+            F4 lengthSq = add4(add4(mul4(out[0], out[0]), mul4(out[1], out[1])), mul4(out[2], out[2]));
+            F4 inv = div4(set4(1.0f), sqrt4(lengthSq));
+            out[0] = mul4(out[0], inv);
+            out[1] = mul4(out[1], inv);
+            out[2] = mul4(out[2], inv);
+        }
+    }
+};
+
+// in/out: minX, minY, minZ, maxX, maxY, maxZ
+struct BoxKernel
+{
+    Splat s, abs;
+    BoxKernel(const float r[9], const float t[3], const float a[9]) : s(r, t), abs(a, t) {}
+    void operator()(const F4* in, F4* out) const
+    {
+        const F4 half = set4(0.5f);
+        F4 cx = mul4(add4(in[0], in[3]), half), ex = mul4(sub4(in[3], in[0]), half);
+        F4 cy = mul4(add4(in[1], in[4]), half), ey = mul4(sub4(in[4], in[1]), half);
+        F4 cz = mul4(add4(in[2], in[5]), half), ez = mul4(sub4(in[5], in[2]), half);
+        F4 ox, oy, oz, rx, ry, rz;
+        s.apply(cx, cy, cz, ox, oy, oz, true);
+        abs.apply(ex, ey, ez, rx, ry, rz, false);
+        out[0] = sub4(ox, rx);  out[1] = sub4(oy, ry);  out[2] = sub4(oz, rz);
+        out[3] = add4(ox, rx);  out[4] = add4(oy, ry);  out[5] = add4(oz, rz);
+    }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// drivers: N streams of SoA floats, or strided triples gathered into blocks
+///////////////////////////////////////////////////////////////////////////////
+template <class Kernel, int N>
+void runSoA(const Kernel& kernel, const float* const in[N], float* const out[N], size_t count)
+{
+    F4 a[N], b[N];
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        for(int k = 0; k < N; ++k) a[k] = load4(in[k] + i);
+        kernel(a, b);
+        for(int k = 0; k < N; ++k) store4(out[k] + i, b[k]);
+    }
+    if(i < count)
+    {
+        float tmp[N][4] = {};
+        size_t rest = count - i;
+        for(int k = 0; k < N; ++k)
+            for(size_t j = 0; j < rest; ++j) tmp[k][j] = in[k][i + j];
+        for(int k = 0; k < N; ++k) a[k] = load4(tmp[k]);
+        kernel(a, b);
+        for(int k = 0; k < N; ++k)
+        {
+            store4(tmp[k], b[k]);
+            for(size_t j = 0; j < rest; ++j) out[k][i + j] = tmp[k][j];
+        }
+    }
+}
+
+// N / 3 strided arrays of xyz triples
+template <class Kernel, int N>
+void runStrided(const Kernel& kernel, const float* const in[N / 3], size_t inStride,
+                float* const out[N / 3], size_t outStride, size_t count)
+{
+    const int arrays = N / 3;
+    F4 a[N], b[N];
+    for(size_t i = 0; i < count; i += 4)
+    {
+        size_t n = count - i < 4 ? count - i : 4;
+        float tmp[N][4] = {};
+        for(int k = 0; k < arrays; ++k)
+            for(size_t j = 0; j < n; ++j)
+            {
+                const float* p = (const float*)((const char*)in[k] + (i + j) * inStride);
+                tmp[3 * k][j] = p[0];  tmp[3 * k + 1][j] = p[1];  tmp[3 * k + 2][j] = p[2];
+            }
+        for(int k = 0; k < N; ++k) a[k] = load4(tmp[k]);
+        kernel(a, b);
+        for(int k = 0; k < N; ++k) store4(tmp[k], b[k]);
+        for(int k = 0; k < arrays; ++k)
+            for(size_t j = 0; j < n; ++j)
+            {
+                float* p = (float*)((char*)out[k] + (i + j) * outStride);
+                p[0] = tmp[3 * k][j];  p[1] = tmp[3 * k + 1][j];  p[2] = tmp[3 * k + 2][j];
+            }
+    }
+}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// points
+///////////////////////////////////////////////////////////////////////////////
+void transformPoints(const Matrix4& m, const float* in, size_t inStride, float* out, size_t outStride, size_t count)
+{
+    float r[9], t[3];
+    upperLeft(m, r, t);
+    const float* ins[1] = { in };
+    float* outs[1] = { out };
+    runStrided<PointKernel, 3>(PointKernel(r, t), ins, inStride, outs, outStride, count);
+}
+
+void transformPoints(const Matrix4& m, const Vector3* in, Vector3* out, size_t count)
+{
+    transformPoints(m, &in->x, sizeof(Vector3), &out->x, sizeof(Vector3), count);
+}
+
+void transformPoints(const Matrix4& m, const float* inX, const float* inY, const float* inZ,
+                     float* outX, float* outY, float* outZ, size_t count)
+{
+    float r[9], t[3];
+    upperLeft(m, r, t);
+    const float* ins[3] = { inX, inY, inZ };
+    float* outs[3] = { outX, outY, outZ };
+    runSoA<PointKernel, 3>(PointKernel(r, t), ins, outs, count);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// normals
+///////////////////////////////////////////////////////////////////////////////
+void transformNormals(const Matrix4& m, const float* in, size_t inStride, float* out, size_t outStride,
+                      size_t count, bool normalize)
+{
+    float n[9], t[3] = { 0, 0, 0 };
+    normalMatrix(m, n);
+    const float* ins[1] = { in };
+    float* outs[1] = { out };
+    runStrided<NormalKernel, 3>(NormalKernel(n, t, normalize), ins, inStride, outs, outStride, count);
+}
+
+void transformNormals(const Matrix4& m, const Vector3* in, Vector3* out, size_t count, bool normalize)
+{
+    transformNormals(m, &in->x, sizeof(Vector3), &out->x, sizeof(Vector3), count, normalize);
+}
+
+void transformNormals(const Matrix4& m, const float* inX, const float* inY, const float* inZ,
+                      float* outX, float* outY, float* outZ, size_t count, bool normalize)
+{
+    float n[9], t[3] = { 0, 0, 0 };
+    normalMatrix(m, n);
+    const float* ins[3] = { inX, inY, inZ };
+    float* outs[3] = { outX, outY, outZ };
+    runSoA<NormalKernel, 3>(NormalKernel(n, t, normalize), ins, outs, count);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// axis-aligned boxes
+///////////////////////////////////////////////////////////////////////////////
+void transformAABBs(const Matrix4& m, const Vector3* inMin, const Vector3* inMax,
+                    Vector3* outMin, Vector3* outMax, size_t count)
+{
+    float r[9], t[3], a[9];
+    upperLeft(m, r, t);
+    for(int i = 0; i < 9; ++i) a[i] = std::fabs(r[i]);
+    const float* ins[2] = { &inMin->x, &inMax->x };
+    float* outs[2] = { &outMin->x, &outMax->x };
+    runStrided<BoxKernel, 6>(BoxKernel(r, t, a), ins, sizeof(Vector3), outs, sizeof(Vector3), count);
+}
+
+void transformAABBs(const Matrix4& m, const float* minX, const float* minY, const float* minZ,
+                    const float* maxX, const float* maxY, const float* maxZ,
+                    float* outMinX, float* outMinY, float* outMinZ,
+                    float* outMaxX, float* outMaxY, float* outMaxZ, size_t count)
+{
+    float r[9], t[3], a[9];
+    upperLeft(m, r, t);
+    for(int i = 0; i < 9; ++i) a[i] = std::fabs(r[i]);
+    const float* ins[6] = { minX, minY, minZ, maxX, maxY, maxZ };
+    float* outs[6] = { outMinX, outMinY, outMinZ, outMaxX, outMaxY, outMaxZ };
+    runSoA<BoxKernel, 6>(BoxKernel(r, t, a), ins, outs, count);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// matrices
+///////////////////////////////////////////////////////////////////////////////
+void multiplyMatrices(const Matrix4& m, const Matrix4* in, Matrix4* out, size_t count)
+{
+    // the columns of m stay in registers; column j of each product is m times
+    // column j of in[i], added up in the order of Matrix4::operator*
+    const float* a = m.get();
+    const F4 c0 = load4(a), c1 = load4(a + 4), c2 = load4(a + 8), c3 = load4(a + 12);
+    for(size_t i = 0; i < count; ++i)
+    {
+        const float* b = in[i].get();
+        float r[16];
+        for(int j = 0; j < 16; j += 4)
+        {
+            F4 col = mul4(c0, set4(b[j]));
+            col = add4(col, mul4(c1, set4(b[j + 1])));
+            col = add4(col, mul4(c2, set4(b[j + 2])));
+            col = add4(col, mul4(c3, set4(b[j + 3])));
+            store4(r + j, col);
+        }
+        out[i].set(r);
+    }
+}
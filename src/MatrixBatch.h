@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+// MatrixBatch.h
+// =============
+// Transforms arrays of points, normals, axis-aligned boxes and matrices by
+// one Matrix4
+//
+// Every function comes in two layouts:
+//  - strided (array of structures): x, y, z are 3 consecutive floats and the
+//    next element starts stride bytes later, so Vector3 arrays and position
+//    fields inside larger vertex/trace structs can be passed as they are.
+//  - SoA: separate x[], y[] and z[] arrays; 4 elements per SIMD instruction.
+// The matrix is read once per call, not once per element. Input and output
+// may be the same arrays.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_MATRIX_BATCH_H
+#define MATH_MATRIX_BATCH_H
+
+#include <cstddef>
+#include "Matrices.h"
+
+// p' = M * (x, y, z, 1); the w row is ignored (affine transform)
+void transformPoints(const Matrix4& m, const float* in, size_t inStride, float* out, size_t outStride, size_t count);
+void transformPoints(const Matrix4& m, const Vector3* in, Vector3* out, size_t count);
+void transformPoints(const Matrix4& m, const float* inX, const float* inY, const float* inZ,
+                     float* outX, float* outY, float* outZ, size_t count);
+
+// n' = (M^-1)^T * n using the upper 3x3 of M, optionally renormalized;
+// the inverse-transpose keeps normals perpendicular under non-uniform scale
+void transformNormals(const Matrix4& m, const float* in, size_t inStride, float* out, size_t outStride,
+                      size_t count, bool normalize = true);
+void transformNormals(const Matrix4& m, const Vector3* in, Vector3* out, size_t count, bool normalize = true);
+void transformNormals(const Matrix4& m, const float* inX, const float* inY, const float* inZ,
+                      float* outX, float* outY, float* outZ, size_t count, bool normalize = true);
+
+// the axis-aligned box that bounds each transformed box (Arvo's method:
+// transform the center, add up the absolute matrix times the half extents)
+void transformAABBs(const Matrix4& m, const Vector3* inMin, const Vector3* inMax,
+                    Vector3* outMin, Vector3* outMax, size_t count);
+void transformAABBs(const Matrix4& m, const float* minX, const float* minY, const float* minZ,
+                    const float* maxX, const float* maxY, const float* maxZ,
+                    float* outMinX, float* outMinY, float* outMinZ,
+                    float* outMaxX, float* outMaxY, float* outMaxZ, size_t count);
+
+// out[i] = m * in[i], e.g. the view matrix times every model matrix of a
+// frame; same result as Matrix4::operator*
+void multiplyMatrices(const Matrix4& m, const Matrix4* in, Matrix4* out, size_t count);
+
+#endif
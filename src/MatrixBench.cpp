@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+// MatrixBench.cpp
+// ===============
+// SIMD against scalar Matrix4 check. See MatrixBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "BenchCommon.h"
+#include "SimRandom.h"
+#include "Matrices.h"
+#include "MatrixBench.h"
+
+namespace
+{
+	struct Data
+	{
+		std::vector<Matrix4> general, affine, out;
+	};
+
+	// every form is called through a pointer so none is inlined into the timing loop
+	typedef void (*Run)(Data &d);
+
+	void transposeSimd(Data &d)
+	{
+		for (size_t i = 0; i < d.general.size(); i++)
+			d.out[i] = Matrix4(d.general[i]).transpose();
+	}
+
+	void transposeReference(Data &d)
+	{
+		for (size_t i = 0; i < d.general.size(); i++)
+		{
+			Matrix4 m(d.general[i]);
+			d.out[i] = transposeScalar(m);
+		}
+	}
+
+	void invertAffineSimd(Data &d)
+	{
+		for (size_t i = 0; i < d.affine.size(); i++)
+			d.out[i] = Matrix4(d.affine[i]).invertAffine();
+	}
+
+	void invertAffineReference(Data &d)
+	{
+		for (size_t i = 0; i < d.affine.size(); i++)
+		{
+			Matrix4 m(d.affine[i]);
+			d.out[i] = invertAffineScalar(m);
+		}
+	}
+
+	// distance in units in the last place; floats of either sign map to one
+	// ordered integer line, so -0 and +0 are 1 apart
+	unsigned int ulps(float a, float b)
+	{
+		int ia, ib;
+		memcpy(&ia, &a, sizeof(float));
+		memcpy(&ib, &b, sizeof(float));
+		const long long oa = ia < 0 ? -(long long)(ia & 0x7fffffff) - 1 : ia;
+		const long long ob = ib < 0 ? -(long long)(ib & 0x7fffffff) - 1 : ib;
+		const long long d = oa > ob ? oa - ob : ob - oa;
+		return d > 0xffffffffll ? 0xffffffffu : (unsigned int)d;
+	}
+
+	// one result of n floats: its distance to the reference, counted as a
+	// mismatch if over the tolerance
+	void compare(const float *a, const float *b, int n, unsigned int tolerance, MatrixBenchRow &row)
+	{
+		unsigned int worst = 0;
+		for (int k = 0; k < n; k++)
+		{
+			const unsigned int d = ulps(a[k], b[k]);
+			worst = d > worst ? d : worst;
+		}
+		row.maxUlps = worst > row.maxUlps ? worst : row.maxUlps;
+		row.mismatches += worst > tolerance ? 1 : 0;
+	}
+
+	int check(std::vector<MatrixBenchRow> &rows, const char *operation, Run simd, Run reference,
+		Data &d, int repeats, unsigned int tolerance)
+	{
+		MatrixBenchRow row;
+		row.operation = operation;
+		row.count = (int)d.general.size();
+		row.maxUlps = 0;
+		row.mismatches = 0;
+
+		simd(d);
+		const std::vector<Matrix4> out = d.out;
+		reference(d);
+		for (size_t i = 0; i < d.general.size(); i++)
+		{
+			const int before = row.mismatches;
+			compare(out[i].get(), d.out[i].get(), 16, tolerance, row);
+			if (row.mismatches > before && row.mismatches <= 5)
+				printf("matrixbench: %s: result %d is more than %u ulps off\n", operation, (int)i, tolerance);
+		}
+
+		// ns per operation, the two forms taking turns
+		const Run forms[] = { simd, reference };
+		double ns[2];
+		bestNsInTurns(2, [&](int f) { for (int k = 0; k < repeats; k++) forms[f](d); }, ns);
+		row.simdNs = ns[0] / ((double)repeats * d.general.size());
+		row.scalarNs = ns[1] / ((double)repeats * d.general.size());
+		rows.push_back(row);
+		return row.mismatches;
+	}
+}
+
+int runMatrixBench(int count, int repeats, unsigned int ulps, std::vector<MatrixBenchRow> &rows)
+{
+	rows.clear();
+	Data d;
+	SimRandom random(5489u);
+	for (int i = 0; i < count; i++)
+	{
+		Matrix4 m;
+		for (int k = 0; k < 16; k++)
+			m[k] = (float)random.uniform(-10.0, 10.0);
+		d.general.push_back(m);
+
+		// rotation, scale and shear, and a translation; every 16th has a
+		// singular R (a zero or a repeated column)
+		Matrix4 a;
+		for (int k = 0; k < 12; k++)
+			if (k % 4 != 3)
+				a[k] = (float)random.uniform(-2.0, 2.0);
+		a.translate((float)random.uniform(-50.0, 50.0), (float)random.uniform(-50.0, 50.0), (float)random.uniform(-50.0, 50.0));
+		if (i % 16 == 15)
+		{
+			for (int k = 0; k < 3; k++)
+				a[4 + k] = (i & 16) ? 0.0f : a[k];
+		}
+		d.affine.push_back(a);
+	}
+	d.out.resize(count);
+
+	int mismatches = 0;
+	mismatches += check(rows, "transpose", transposeSimd, transposeReference, d, repeats, ulps);
+	mismatches += check(rows, "invert-affine", invertAffineSimd, invertAffineReference, d, repeats, ulps);
+	return mismatches;
+}
+
+int runMatrixBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("matrixbench", argc, argv);
+	const char *outFile = args.text("out", "matrix_bench.csv");
+	const int count = args.integer("count", 4096), repeats = args.integer("repeats", 200);
+	const int tolerance = args.integer("ulps", 0);
+	args.reportUnknown();
+	if (count <= 0 || repeats <= 0 || tolerance < 0)
+	{
+		printf("matrixbench: nothing to run\n");
+		return 1;
+	}
+
+#if defined(MATH_SSE)
+	const char *simd = "SSE";
+#elif defined(MATH_NEON)
+	const char *simd = "NEON";
+#else
+	const char *simd = "none (MATH_NO_SIMD)";
+#endif
+	printf("SIMD: %s, tolerance %d ulps\n", simd, tolerance);
+
+	std::vector<MatrixBenchRow> rows;
+	int mismatches = runMatrixBench(count, repeats, (unsigned int)tolerance, rows);
+	for (auto &row : rows)
+	{
+		printf("%-16s %6d  simd %6.2f ns  scalar %6.2f ns  x%.2f  max %u ulps  %d mismatches\n", row.operation,
+			row.count, row.simdNs, row.scalarNs, row.scalarNs / row.simdNs, row.maxUlps, row.mismatches);
+	}
+
+	FILE *fp = openCsv("matrixbench", outFile, "operation,count,simd_ns,scalar_ns,max_ulps,mismatches");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%d,%.4f,%.4f,%u,%d\n", row.operation, row.count, row.simdNs, row.scalarNs, row.maxUlps, row.mismatches);
+	if (!closeCsv("matrixbench", fp, outFile))
+		return 1;
+	if (mismatches)
+		printf("matrixbench: %d mismatches\n", mismatches);
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+// MatrixBench.h
+// =============
+// Matrix4's SIMD paths against its scalar code (Matrices.h).
+//
+// transpose() and invertAffine() run over arrays of random matrices, once
+// through the Matrix4 members (SSE or NEON unless MATH_NO_SIMD is defined)
+// and once through the *Scalar functions, which are the code a MATH_NO_SIMD
+// build uses; a SIMD form stays in Matrices.h only while it is the faster
+// of the two. Every result
+// float is compared bit for bit: a mismatch is one further apart than the
+// tolerance, in units in the last place (0 by default, since the SIMD paths
+// keep the scalar order of operations). The affine inputs include singular
+// ones, which take invertAffine()'s scalar fallback.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATRIX_BENCH_H
+#define MATRIX_BENCH_H
+
+#include <vector>
+
+struct MatrixBenchRow
+{
+	const char *operation;      // transpose, invert-affine
+	int count;
+	double simdNs;              // per operation, Matrix4 member
+	double scalarNs;            // per operation, scalar function
+	unsigned int maxUlps;       // largest distance between the two results
+	int mismatches;             // results further apart than the tolerance
+};
+
+// returns the total number of mismatches
+int runMatrixBench(int count, int repeats, unsigned int ulps, std::vector<MatrixBenchRow> &rows);
+
+// benchCheck's command line front end, exits with 1 on any mismatch:
+//   -matrixbench [out=file.csv] [count=n] [repeats=n] [ulps=n]
+int runMatrixBenchCommand(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,343 @@
+///////////////////////////////////////////////////////////////////////////////
+// NBody.cpp
+// =========
+// Direct-sum gravity kernels. See NBody.h.
+//
+// The float pair term uses the SSE reciprocal square root estimate with one
+// Newton step (about 2 ulp). Lanes with |d|^2 + e^2 == 0 (a body and itself
+// without softening) are masked to zero instead of producing NaN.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+#include "NBody.h"
+
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NBODY_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	const int pairwiseBlock = 64;   // pairs summed in float before going to double
+
+	// float copy of the bodies relative to their centre, padded to a
+	// multiple of 4 with massless bodies
+	struct FloatBodies
+	{
+		std::vector<float> x, y, gm;
+		double cx, cy;
+		int count, padded;
+
+		void load(const NBodySystem &s)
+		{
+			count = s.size();
+			padded = (count + 3) & ~3;
+			double minX = 0.0, maxX = 0.0, minY = 0.0, maxY = 0.0;
+			for (int i = 0; i < count; i++)
+			{
+				if (i == 0 || s.x[i] < minX) minX = s.x[i];
+				if (i == 0 || s.x[i] > maxX) maxX = s.x[i];
+				if (i == 0 || s.y[i] < minY) minY = s.y[i];
+				if (i == 0 || s.y[i] > maxY) maxY = s.y[i];
+			}
+			cx = 0.5 * (minX + maxX);
+			cy = 0.5 * (minY + maxY);
+			x.assign(padded + 4, 0.0f);   // +4: room to align the start
+			y.assign(padded + 4, 0.0f);
+			gm.assign(padded + 4, 0.0f);
+			for (int i = 0; i < count; i++)
+			{
+				x[i] = (float)(s.x[i] - cx);
+				y[i] = (float)(s.y[i] - cy);
+				gm[i] = (float)s.gm[i];
+			}
+		}
+	};
+
+	// Kahan: add v to the sum s with the running compensation c
+	inline void kahanAdd(double &s, double &c, double v)
+	{
+		double y = v - c;
+		double t = s + y;
+		c = (t - s) - y;
+		s = t;
+	}
+
+#if defined(NBODY_SSE2)
+	inline void kahanAdd(__m128d &s, __m128d &c, __m128d v)
+	{
+		__m128d y = _mm_sub_pd(v, c);
+		__m128d t = _mm_add_pd(s, y);
+		c = _mm_sub_pd(_mm_sub_pd(t, s), y);
+		s = t;
+	}
+
+	inline double sum2(__m128d a)
+	{
+		double r[2];
+		_mm_storeu_pd(r, a);
+		return r[0] + r[1];
+	}
+
+	inline float sum4(__m128 a)
+	{
+		float r[4];
+		_mm_storeu_ps(r, a);
+		return (r[0] + r[1]) + (r[2] + r[3]);
+	}
+
+	// pull of bodies j..j+3 on (xi, yi)
+	inline void pairs4(__m128 xi, __m128 yi, __m128 e2, const FloatBodies &b, int j, __m128 &fx, __m128 &fy)
+	{
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(&b.x[j]), xi);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(&b.y[j]), yi);
+		__m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), e2);
+		__m128 inv = _mm_rsqrt_ps(r2);
+		inv = _mm_mul_ps(inv, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r2), inv), inv)));
+		__m128 f = _mm_mul_ps(_mm_loadu_ps(&b.gm[j]), _mm_mul_ps(inv, _mm_mul_ps(inv, inv)));
+		f = _mm_and_ps(f, _mm_cmpgt_ps(r2, _mm_setzero_ps()));
+		fx = _mm_mul_ps(f, dx);
+		fy = _mm_mul_ps(f, dy);
+	}
+
+	void accelerationsDouble(const NBodySystem &s, double *ax, double *ay)
+	{
+		const int n = s.size();
+		const __m128d e2 = _mm_set1_pd(s.softening * s.softening);
+		for (int i = 0; i < n; i++)
+		{
+			const __m128d xi = _mm_set1_pd(s.x[i]), yi = _mm_set1_pd(s.y[i]);
+			__m128d sx = _mm_setzero_pd(), sy = _mm_setzero_pd();
+			int j = 0;
+			for (; j + 2 <= n; j += 2)
+			{
+				__m128d dx = _mm_sub_pd(_mm_loadu_pd(&s.x[j]), xi);
+				__m128d dy = _mm_sub_pd(_mm_loadu_pd(&s.y[j]), yi);
+				__m128d r2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), e2);
+				__m128d inv = _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(r2));
+				__m128d f = _mm_mul_pd(_mm_loadu_pd(&s.gm[j]), _mm_mul_pd(inv, _mm_mul_pd(inv, inv)));
+				f = _mm_and_pd(f, _mm_cmpgt_pd(r2, _mm_setzero_pd()));
+				sx = _mm_add_pd(sx, _mm_mul_pd(f, dx));
+				sy = _mm_add_pd(sy, _mm_mul_pd(f, dy));
+			}
+			double tx = sum2(sx), ty = sum2(sy);
+			for (; j < n; j++)
+			{
+				double dx = s.x[j] - s.x[i], dy = s.y[j] - s.y[i];
+				double r2 = dx * dx + dy * dy + s.softening * s.softening;
+				if (r2 > 0.0)
+				{
+					double inv = 1.0 / sqrt(r2);
+					double f = s.gm[j] * inv * inv * inv;
+					tx += f * dx;
+					ty += f * dy;
+				}
+			}
+			ax[i] = tx;
+			ay[i] = ty;
+		}
+	}
+
+	void accelerationsFloat(const NBodySystem &s, NBodyPrecision precision, double *ax, double *ay)
+	{
+		FloatBodies b;
+		b.load(s);
+		const __m128 e2 = _mm_set1_ps((float)(s.softening * s.softening));
+		for (int i = 0; i < b.count; i++)
+		{
+			const __m128 xi = _mm_set1_ps(b.x[i]), yi = _mm_set1_ps(b.y[i]);
+			__m128 fx, fy;
+			if (precision == NBODY_FLOAT)
+			{
+				__m128 sx = _mm_setzero_ps(), sy = _mm_setzero_ps();
+				for (int j = 0; j < b.padded; j += 4)
+				{
+					pairs4(xi, yi, e2, b, j, fx, fy);
+					sx = _mm_add_ps(sx, fx);
+					sy = _mm_add_ps(sy, fy);
+				}
+				ax[i] = sum4(sx);
+				ay[i] = sum4(sy);
+			}
+			else if (precision == NBODY_MIXED_KAHAN)
+			{
+				__m128d sx0 = _mm_setzero_pd(), sx1 = sx0, sy0 = sx0, sy1 = sx0;
+				__m128d cx0 = sx0, cx1 = sx0, cy0 = sx0, cy1 = sx0;
+				for (int j = 0; j < b.padded; j += 4)
+				{
+					pairs4(xi, yi, e2, b, j, fx, fy);
+					kahanAdd(sx0, cx0, _mm_cvtps_pd(fx));
+					kahanAdd(sx1, cx1, _mm_cvtps_pd(_mm_movehl_ps(fx, fx)));
+					kahanAdd(sy0, cy0, _mm_cvtps_pd(fy));
+					kahanAdd(sy1, cy1, _mm_cvtps_pd(_mm_movehl_ps(fy, fy)));
+				}
+				// the four lane sums minus their outstanding compensations
+				ax[i] = (sum2(sx0) + sum2(sx1)) - (sum2(cx0) + sum2(cx1));
+				ay[i] = (sum2(sy0) + sum2(sy1)) - (sum2(cy0) + sum2(cy1));
+			}
+			else
+			{
+				__m128d sx = _mm_setzero_pd(), sy = _mm_setzero_pd();
+				for (int block = 0; block < b.padded; block += pairwiseBlock)
+				{
+					const int end = block + pairwiseBlock < b.padded ? block + pairwiseBlock : b.padded;
+					__m128 bx = _mm_setzero_ps(), by = _mm_setzero_ps();
+					for (int j = block; j < end; j += 4)
+					{
+						pairs4(xi, yi, e2, b, j, fx, fy);
+						bx = _mm_add_ps(bx, fx);
+						by = _mm_add_ps(by, fy);
+					}
+					sx = _mm_add_pd(sx, _mm_add_pd(_mm_cvtps_pd(bx), _mm_cvtps_pd(_mm_movehl_ps(bx, bx))));
+					sy = _mm_add_pd(sy, _mm_add_pd(_mm_cvtps_pd(by), _mm_cvtps_pd(_mm_movehl_ps(by, by))));
+				}
+				ax[i] = sum2(sx);
+				ay[i] = sum2(sy);
+			}
+		}
+	}
+#else
+	void accelerationsDouble(const NBodySystem &s, double *ax, double *ay)
+	{
+		const int n = s.size();
+		const double e2 = s.softening * s.softening;
+		for (int i = 0; i < n; i++)
+		{
+			double tx = 0.0, ty = 0.0;
+			for (int j = 0; j < n; j++)
+			{
+				double dx = s.x[j] - s.x[i], dy = s.y[j] - s.y[i];
+				double r2 = dx * dx + dy * dy + e2;
+				if (r2 > 0.0)
+				{
+					double inv = 1.0 / sqrt(r2);
+					double f = s.gm[j] * inv * inv * inv;
+					tx += f * dx;
+					ty += f * dy;
+				}
+			}
+			ax[i] = tx;
+			ay[i] = ty;
+		}
+	}
+
+	void accelerationsFloat(const NBodySystem &s, NBodyPrecision precision, double *ax, double *ay)
+	{
+		FloatBodies b;
+		b.load(s);
+		const float e2 = (float)(s.softening * s.softening);
+		for (int i = 0; i < b.count; i++)
+		{
+			float fsx = 0.0f, fsy = 0.0f, bx = 0.0f, by = 0.0f;
+			double sx = 0.0, sy = 0.0, cx = 0.0, cy = 0.0;
+			for (int j = 0; j < b.padded; j++)
+			{
+				float dx = b.x[j] - b.x[i], dy = b.y[j] - b.y[i];
+				float r2 = dx * dx + dy * dy + e2;
+				float f = r2 > 0.0f ? b.gm[j] / (r2 * sqrtf(r2)) : 0.0f;
+				if (precision == NBODY_FLOAT)
+				{
+					fsx += f * dx;
+					fsy += f * dy;
+				}
+				else if (precision == NBODY_MIXED_KAHAN)
+				{
+					kahanAdd(sx, cx, f * dx);
+					kahanAdd(sy, cy, f * dy);
+				}
+				else
+				{
+					bx += f * dx;
+					by += f * dy;
+					if ((j + 1) % pairwiseBlock == 0 || j + 1 == b.padded)
+					{
+						sx += bx;
+						sy += by;
+						bx = by = 0.0f;
+					}
+				}
+			}
+			ax[i] = precision == NBODY_FLOAT ? fsx : sx;
+			ay[i] = precision == NBODY_FLOAT ? fsy : sy;
+		}
+	}
+#endif
+}
+
+
+
+const char *nbodyPrecisionName(NBodyPrecision precision)
+{
+	switch (precision)
+	{
+	case NBODY_DOUBLE: return "double";
+	case NBODY_FLOAT: return "float";
+	case NBODY_MIXED_KAHAN: return "mixed-kahan";
+	case NBODY_MIXED_PAIRWISE: return "mixed-pairwise";
+	}
+	return "unknown";
+}
+
+void NBodySystem::add(double px, double py, double pvx, double pvy, double pgm)
+{
+	x.push_back(px);
+	y.push_back(py);
+	vx.push_back(pvx);
+	vy.push_back(pvy);
+	gm.push_back(pgm);
+}
+
+void computeAccelerations(const NBodySystem &s, NBodyPrecision precision, double *ax, double *ay)
+{
+	if (s.size() == 0)
+		return;
+	if (precision == NBODY_DOUBLE)
+		accelerationsDouble(s, ax, ay);
+	else
+		accelerationsFloat(s, precision, ax, ay);
+}
+
+void stepLeapfrog(NBodySystem &s, double dt, NBodyPrecision precision, std::vector<double> &ax, std::vector<double> &ay)
+{
+	const int n = s.size();
+	if ((int)ax.size() != n || (int)ay.size() != n)
+	{
+		ax.resize(n);
+		ay.resize(n);
+		computeAccelerations(s, precision, ax.data(), ay.data());
+	}
+	const double half = 0.5 * dt;
+	for (int i = 0; i < n; i++)
+	{
+		s.vx[i] += ax[i] * half;
+		s.vy[i] += ay[i] * half;
+		s.x[i] += s.vx[i] * dt;
+		s.y[i] += s.vy[i] * dt;
+	}
+	computeAccelerations(s, precision, ax.data(), ay.data());
+	for (int i = 0; i < n; i++)
+	{
+		s.vx[i] += ax[i] * half;
+		s.vy[i] += ay[i] * half;
+	}
+}
+
+double totalEnergy(const NBodySystem &s)
+{
+	const int n = s.size();
+	const double e2 = s.softening * s.softening;
+	double kinetic = 0.0, potential = 0.0;
+	for (int i = 0; i < n; i++)
+	{
+		kinetic += 0.5 * s.gm[i] * (s.vx[i] * s.vx[i] + s.vy[i] * s.vy[i]);
+		for (int j = i + 1; j < n; j++)
+		{
+			double dx = s.x[j] - s.x[i], dy = s.y[j] - s.y[i];
+			double r2 = dx * dx + dy * dy + e2;
+			if (r2 > 0.0)
+				potential -= s.gm[i] * s.gm[j] / sqrt(r2);
+		}
+	}
+	return kinetic + potential;
+}
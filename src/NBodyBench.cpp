@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+// NBodyBench.cpp
+// ==============
+// Mixed-precision N-body report. See NBodyBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <math.h>
+#include "BenchCommon.h"
+#include "SimRandom.h"
+#include "NBodyBench.h"
+
+namespace
+{
+	const double dt = 1.0 / 300.0;  // small enough that the double run itself conserves energy
+
+	void makeScene(int bodies, unsigned int seed, NBodySystem &s)
+	{
+		SimRandom random(seed);
+		s = NBodySystem();
+		s.softening = 0.6;          // the 2DGravity planet radius
+		for (int i = 0; i < bodies; i++)
+		{
+			double x = random.uniform(0.0, 100.0), y = random.uniform(0.0, 75.0);
+			double vx = random.uniform(-1.0, 1.0), vy = random.uniform(-1.0, 1.0);
+			s.add(x, y, vx, vy, 6.674E-11 * random.normal(1.5E11, 1.0E10));
+		}
+	}
+}
+
+void runNBodyBench(int bodies, int steps, unsigned int seed, std::vector<NBodyBenchRow> &rows)
+{
+	rows.clear();
+	NBodySystem start;
+	makeScene(bodies, seed, start);
+	const double startEnergy = totalEnergy(start);
+
+	std::vector<double> refX(bodies), refY(bodies), ax(bodies), ay(bodies);
+	computeAccelerations(start, NBODY_DOUBLE, refX.data(), refY.data());
+	double meanForce = 0.0;
+	for (int i = 0; i < bodies; i++)
+		meanForce += sqrt(refX[i] * refX[i] + refY[i] * refY[i]) / bodies;
+
+	NBodySystem reference;
+	const NBodyPrecision modes[] = { NBODY_DOUBLE, NBODY_FLOAT, NBODY_MIXED_KAHAN, NBODY_MIXED_PAIRWISE };
+	for (NBodyPrecision precision : modes)
+	{
+		NBodyBenchRow row;
+		row.precision = precision;
+		row.bodies = bodies;
+		row.steps = steps;
+
+		computeAccelerations(start, precision, ax.data(), ay.data());
+		row.forceError = 0.0;
+		for (int i = 0; i < bodies; i++)
+		{
+			double e = sqrt((ax[i] - refX[i]) * (ax[i] - refX[i]) + (ay[i] - refY[i]) * (ay[i] - refY[i]));
+			if (e / meanForce > row.forceError)
+				row.forceError = e / meanForce;
+		}
+
+		NBodySystem s = start;
+		std::vector<double> sx, sy;
+		for (int step = 0; step < steps; step++)
+			stepLeapfrog(s, dt, precision, sx, sy);
+		if (precision == NBODY_DOUBLE)
+			reference = s;
+		row.positionError = 0.0;
+		for (int i = 0; i < bodies; i++)
+		{
+			double e = sqrt((s.x[i] - reference.x[i]) * (s.x[i] - reference.x[i]) + (s.y[i] - reference.y[i]) * (s.y[i] - reference.y[i]));
+			if (e > row.positionError)
+				row.positionError = e;
+		}
+		row.energyDrift = fabs(totalEnergy(s) - startEnergy) / fabs(startEnergy);
+		rows.push_back(row);
+	}
+
+	// ns per pair, best of three with the precisions taking turns
+	const double pairs = (double)bodies * bodies;
+	const int repeats = (int)(2.0E7 / pairs) + 1;
+	double ns[4];
+	bestNsInTurns(4, [&](int m)
+	{
+		for (int r = 0; r < repeats; r++)
+			computeAccelerations(start, modes[m], ax.data(), ay.data());
+	}, ns, 3);
+	for (int m = 0; m < 4; m++)
+	{
+		rows[m].nsPerPair = ns[m] / (repeats * pairs);
+		rows[m].speedup = rows[0].nsPerPair / rows[m].nsPerPair;
+	}
+}
+
+int runNBodyBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("nbodybench", argc, argv);
+	const char *outFile = args.text("out", "nbody_bench.csv");
+	const int bodies = args.integer("bodies", 1024), steps = args.integer("steps", 300);
+	const unsigned int seed = args.unsignedInteger("seed", 5489u);
+	args.reportUnknown();
+	if (bodies <= 1 || steps < 0)
+	{
+		printf("nbodybench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<NBodyBenchRow> rows;
+	runNBodyBench(bodies, steps, seed, rows);
+	printf("%d bodies, %d steps of %.4f s\n", bodies, steps, dt);
+	for (auto &row : rows)
+		printf("%-15s %6.3f ns/pair  x%.2f  force err %.2e  position err %.2e m  energy drift %.2e\n",
+			nbodyPrecisionName(row.precision), row.nsPerPair, row.speedup, row.forceError, row.positionError, row.energyDrift);
+
+	FILE *fp = openCsv("nbodybench", outFile, "precision,bodies,steps,ns_per_pair,speedup,force_error,position_error,energy_drift");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%d,%d,%.4f,%.3f,%.3e,%.3e,%.3e\n", nbodyPrecisionName(row.precision), row.bodies, row.steps,
+			row.nsPerPair, row.speedup, row.forceError, row.positionError, row.energyDrift);
+	return closeCsv("nbodybench", fp, outFile) ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////
+// NBodyBench.h
+// ============
+// Error against speed of the NBody precisions.
+//
+// A random 2DGravity-like scene (planets of G*m ~ 10 in a 100 x 75 m box)
+// is integrated with each precision from the same start. For every mode the
+// report gives the time per pair, the force error of the first step against
+// NBODY_DOUBLE, and after the run the largest position difference from the
+// double run and the relative energy drift. The force error says what a
+// mode costs per step; the energy drift says whether the orbits survive.
+// Position differences grow in any chaotic run, so compare them between
+// modes rather than to zero.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NBODY_BENCH_H
+#define NBODY_BENCH_H
+
+#include <vector>
+#include "NBody.h"
+
+struct NBodyBenchRow
+{
+	NBodyPrecision precision;
+	int bodies;
+	int steps;
+	double nsPerPair;           // one force evaluation / bodies^2
+	double speedup;             // against NBODY_DOUBLE
+	double forceError;          // max |a - a_double| / mean |a_double|, first step
+	double positionError;       // max |p - p_double| after the run, meters
+	double energyDrift;         // |E_end - E_start| / |E_start|
+};
+
+void runNBodyBench(int bodies, int steps, unsigned int seed, std::vector<NBodyBenchRow> &rows);
+
+// benchCheck's command line front end:
+//   -nbodybench [out=file.csv] [bodies=n] [steps=n] [seed=n]
+int runNBodyBenchCommand(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// ProceduralTexture.cpp
+// =====================
+// Generated textures with a memory and a disk cache. See ProceduralTexture.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "ProceduralTexture.h"
+
+namespace
+{
+	// the parameters of a checker texture, in the order of the cache file header
+	struct CheckerKey
+	{
+		unsigned int width, height, cell, even, odd;
+
+		bool operator<(const CheckerKey &other) const
+		{
+			return memcmp(this, &other, sizeof(CheckerKey)) < 0;
+		}
+	};
+
+	const char fileMagic[4] = { 'P', 'T', 'E', 'X' };
+	const unsigned int fileVersion = 1;
+
+	std::map<CheckerKey, ProceduralTexture> textures;
+	std::string directory;
+
+	std::string cacheFileName(const CheckerKey &key)
+	{
+		char name[96];
+		sprintf(name, "checker_%ux%u_%u_%u_%u.tex", key.width, key.height, key.cell, key.even, key.odd);
+		return directory + "/" + name;
+	}
+
+	// false if the file is missing, or was written for other parameters or cut short
+	bool readCacheFile(const CheckerKey &key, ProceduralTexture &texture)
+	{
+		FILE *fp;
+		if ((fp = fopen(cacheFileName(key).c_str(), "rb")) == NULL)
+			return false;
+		char magic[4];
+		unsigned int version;
+		CheckerKey stored;
+		bool ok = fread(magic, 1, 4, fp) == 4 && memcmp(magic, fileMagic, 4) == 0 &&
+			fread(&version, sizeof(version), 1, fp) == 1 && version == fileVersion &&
+			fread(&stored, sizeof(stored), 1, fp) == 1 && memcmp(&stored, &key, sizeof(key)) == 0 &&
+			fread(&texture.texels[0], 1, texture.texels.size(), fp) == texture.texels.size();
+		fclose(fp);
+		return ok;
+	}
+
+	void writeCacheFile(const CheckerKey &key, const ProceduralTexture &texture)
+	{
+		FILE *fp;
+		if ((fp = fopen(cacheFileName(key).c_str(), "wb")) == NULL)
+			return;                 // the cache is only a shortcut
+		fwrite(fileMagic, 1, 4, fp);
+		fwrite(&fileVersion, sizeof(fileVersion), 1, fp);
+		fwrite(&key, sizeof(key), 1, fp);
+		fwrite(&texture.texels[0], 1, texture.texels.size(), fp);
+		fclose(fp);
+	}
+}
+
+void makeCheckerTexels(unsigned char *texels, int width, int height, int cell, unsigned char even, unsigned char odd)
+{
+	if (width <= 0 || height <= 0)
+		return;
+	if (cell < 1)
+		cell = 1;
+
+	// the first two bands of rows start with the two row patterns; every
+	// other row is a copy of one of them, which the library's memcpy makes
+	// with the widest stores the machine has
+	unsigned char *first = texels, *second = height > cell ? texels + (size_t)cell * width : NULL;
+	for (int x = 0; x < width; x++)
+	{
+		const bool oddColumn = (x / cell) & 1;
+		first[x] = oddColumn ? odd : even;
+		if (second != NULL)
+			second[x] = oddColumn ? even : odd;
+	}
+	for (int y = 1; y < height; y++)
+	{
+		if (y == cell)
+			continue;
+		memcpy(texels + (size_t)y * width, (y / cell) & 1 ? second : first, width);
+	}
+}
+
+const ProceduralTexture &getCheckerTexture(int width, int height, int cell, unsigned char even, unsigned char odd)
+{
+	const CheckerKey key = { (unsigned int)(width > 0 ? width : 0), (unsigned int)(height > 0 ? height : 0),
+		(unsigned int)(cell > 1 ? cell : 1), even, odd };
+	std::map<CheckerKey, ProceduralTexture>::iterator found = textures.find(key);
+	if (found != textures.end())
+		return found->second;
+
+	ProceduralTexture &texture = textures[key];
+	texture.width = (int)key.width;
+	texture.height = (int)key.height;
+	texture.texels.resize((size_t)key.width * key.height);
+	if (texture.texels.empty())
+		return texture;
+	if (!directory.empty() && readCacheFile(key, texture))
+		return texture;
+	makeCheckerTexels(&texture.texels[0], texture.width, texture.height, (int)key.cell, even, odd);
+	if (!directory.empty())
+		writeCacheFile(key, texture);
+	return texture;
+}
+
+void setProceduralTextureDirectory(const char *directory)
+{
+	::directory = directory != NULL ? directory : "";
+}
+
+void uploadProceduralTexture(const ProceduralTexture &texture)
+{
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE8, texture.width, texture.height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE,
+		texture.texels.empty() ? NULL : &texture.texels[0]);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+// ProceduralTexture.h
+// ===================
+// The demos' generated textures, made once and kept.
+//
+// A texture is one byte per texel (luminance), bottom row first like
+// glTexImage2D takes it: a quarter of the floats the demos used to make,
+// and uploaded as GL_LUMINANCE8 from GL_UNSIGNED_BYTE, so the driver
+// converts nothing. Only two rows are worked out texel by texel; the rest
+// are copies of them.
+//
+// getCheckerTexture() looks the texture up by its parameters, first in
+// memory, then in the disk cache if setProceduralTextureDirectory() named
+// one, and only then generates it (and writes it there). The returned
+// texture lives until the program ends. Not thread safe; the demos make
+// their textures on the main thread.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROCEDURAL_TEXTURE_H
+#define PROCEDURAL_TEXTURE_H
+
+#include <vector>
+
+struct ProceduralTexture
+{
+	int width, height;
+	std::vector<unsigned char> texels;
+};
+
+// squares of cell x cell texels starting at texel (0, 0); even where
+// s / cell + t / cell is even, odd elsewhere
+void makeCheckerTexels(unsigned char *texels, int width, int height, int cell, unsigned char even, unsigned char odd);
+const ProceduralTexture &getCheckerTexture(int width, int height, int cell, unsigned char even, unsigned char odd);
+
+// NULL (the default) turns the disk cache off; the directory must exist
+void setProceduralTextureDirectory(const char *directory);
+
+// into the bound GL_TEXTURE_2D, level 0; the parameters are the caller's
+void uploadProceduralTexture(const ProceduralTexture &texture);
+
+#endif
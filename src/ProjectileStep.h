@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+// ProjectileStep.h
+// ================
+// One integration step of a projectile under constant gravity and linear air
+// resistance, a = g - k*v. simpleProjectile advances its balls with these and
+// TrajectoryBench times and checks the same functions, so the bench measures
+// the code the demo runs.
+//
+// gy is the gravity along y with its sign, since the demo and the bench do not
+// agree on which way is up; k = 0 is gravity alone. A step only moves the
+// body: walls, bounces and landing stay with the caller.
+//
+// eulerStep         explicit Euler, position from the old velocity
+// semiImplicitStep  symplectic Euler, position from the new velocity
+// verletStep        velocity Verlet
+// rk4Step           classic fourth order Runge-Kutta
+// ClosedFormStep    the exact solution over dt from the current state; its
+//                   factors depend on dt only, so they are worked out once
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECTILE_STEP_H
+#define PROJECTILE_STEP_H
+
+#include <math.h>
+
+struct ProjectileModel
+{
+	double gy;                  // m/s*s, signed
+	double k;                   // linear air resistance, 1/s
+};
+
+inline void eulerStep(const ProjectileModel &m, double dt, double &x, double &y, double &vx, double &vy)
+{
+	const double vx0 = vx, vy0 = vy;
+	x += vx0 * dt;
+	y += vy0 * dt;
+	vx = vx0 - m.k * vx0 * dt;
+	vy = vy0 + (m.gy - m.k * vy0) * dt;
+}
+
+inline void semiImplicitStep(const ProjectileModel &m, double dt, double &x, double &y, double &vx, double &vy)
+{
+	vx = vx - m.k * vx * dt;
+	vy = vy + (m.gy - m.k * vy) * dt;
+	x += vx * dt;
+	y += vy * dt;
+}
+
+// the drag depends on the velocity, so the end-of-step acceleration is taken
+// at a predicted velocity
+inline void verletStep(const ProjectileModel &m, double dt, double &x, double &y, double &vx, double &vy)
+{
+	const double vx0 = vx, vy0 = vy;
+	const double ax0 = -m.k * vx0, ay0 = m.gy - m.k * vy0;
+	x += (vx0 + 0.5 * ax0 * dt) * dt;
+	y += (vy0 + 0.5 * ay0 * dt) * dt;
+	const double px = vx0 + ax0 * dt, py = vy0 + ay0 * dt;
+	const double ax1 = -m.k * px, ay1 = m.gy - m.k * py;
+	vx = vx0 + 0.5 * (ax0 + ax1) * dt;
+	vy = vy0 + 0.5 * (ay0 + ay1) * dt;
+}
+
+inline void rk4Step(const ProjectileModel &m, double dt, double &x, double &y, double &vx, double &vy)
+{
+	// the acceleration only depends on the velocity
+	const double h = 0.5 * dt;
+	const double v1x = vx, v1y = vy;
+	const double a1x = -m.k * v1x, a1y = m.gy - m.k * v1y;
+	const double v2x = v1x + a1x * h, v2y = v1y + a1y * h;
+	const double a2x = -m.k * v2x, a2y = m.gy - m.k * v2y;
+	const double v3x = v1x + a2x * h, v3y = v1y + a2y * h;
+	const double a3x = -m.k * v3x, a3y = m.gy - m.k * v3y;
+	const double v4x = v1x + a3x * dt, v4y = v1y + a3y * dt;
+	const double a4x = -m.k * v4x, a4y = m.gy - m.k * v4y;
+	x += (v1x + 2.0 * (v2x + v3x) + v4x) * (dt / 6.0);
+	y += (v1y + 2.0 * (v2y + v3y) + v4y) * (dt / 6.0);
+	vx += (a1x + 2.0 * (a2x + a3x) + a4x) * (dt / 6.0);
+	vy += (a1y + 2.0 * (a2y + a3y) + a4y) * (dt / 6.0);
+}
+
+class ClosedFormStep
+{
+public:
+	ClosedFormStep(const ProjectileModel &m, double dt) : dt(dt), gy(m.gy), drag(m.k != 0.0)
+	{
+		drop = 0.5 * m.gy * dt * dt;
+		decay = drag ? exp(-m.k * dt) : 1.0;
+		reach = drag ? (1.0 - decay) / m.k : dt;
+		terminal = drag ? -m.gy / m.k : 0.0;     // terminal falling speed
+	}
+
+	void operator()(double &x, double &y, double &vx, double &vy) const
+	{
+		if (!drag)
+		{
+			x += vx * dt;
+			y += vy * dt + drop;
+			vy += gy * dt;
+			return;
+		}
+		const double v = vy + terminal;
+		x += vx * reach;
+		y += v * reach - terminal * dt;
+		vx *= decay;
+		vy = v * decay - terminal;
+	}
+
+private:
+	double dt, gy;
+	bool drag;
+	double drop, decay, reach, terminal;
+};
+
+#endif
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+// ProjectileSweep.cpp
+// ===================
+// Packed trajectory integration for parameter sweeps. See ProjectileSweep.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <math.h>
+#include <atomic>
+#include <thread>
+#include "BenchCommon.h"
+#include "ProjectileSweep.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define SWEEP_SSE2
+#include <emmintrin.h>
+#endif
+
+static const double degree = 3.14159265358979323846 / 180.0;
+
+// fills the parameter columns of result[index] from the grid position
+static void gridPoint(const SweepParams &params, int index, TrajectoryResult &result)
+{
+	int i = index % params.speed.count;
+	index /= params.speed.count;
+	int j = index % params.angle.count;
+	index /= params.angle.count;
+	int k = index % params.airResistance.count;
+	index /= params.airResistance.count;
+	result.speed = params.speed.at(i);
+	result.angle = params.angle.at(j);
+	result.airResistance = params.airResistance.at(k);
+	result.friction = params.friction.at(index);
+}
+
+static void finish(const SweepParams &params, TrajectoryResult &result, double landVx)
+{
+	result.slide = (result.friction > 0.0 && result.flightTime >= 0.0) ?
+		landVx * landVx / (2.0 * result.friction * params.gravity) : 0.0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// one trajectory; the reference for the packed version below
+///////////////////////////////////////////////////////////////////////////////
+static void integrateOne(const SweepParams &params, TrajectoryResult &r)
+{
+	const double dt = params.timeStep;
+	const double g = -params.gravity;
+	double x = 0.0, y = 0.0, t = 0.0, apex = 0.0;
+	double vx = r.speed * cos(r.angle);
+	double vy = r.speed * sin(r.angle);
+	double kdt = r.airResistance * dt;
+	r.range = 0.0;
+	r.flightTime = -1.0;
+	double landVx = 0.0;
+	while (t < params.maxTime)
+	{
+		double nx = x + vx * dt;
+		double ny = y + vy * dt;
+		double nvx = vx - kdt * vx;
+		double nvy = vy + (g * dt - kdt * vy);
+		apex = apex > ny ? apex : ny;
+		if (ny < 0.0)
+		{
+			// linear interpolation to the ground crossing
+			double frac = y / (y - ny);
+			r.range = x + (nx - x) * frac;
+			r.flightTime = t + dt * frac;
+			landVx = vx;
+			break;
+		}
+		x = nx; y = ny; vx = nvx; vy = nvy;
+		t += dt;
+	}
+	if (r.flightTime < 0.0)
+		r.range = x;
+	r.apex = apex;
+	finish(params, r, landVx);
+}
+
+#ifdef SWEEP_SSE2
+///////////////////////////////////////////////////////////////////////////////
+// two trajectories per register; a lane that lands keeps integrating but its
+// results are frozen by the landed mask
+///////////////////////////////////////////////////////////////////////////////
+static void integrateTwo(const SweepParams &params, TrajectoryResult &r0, TrajectoryResult &r1)
+{
+	const __m128d dt = _mm_set1_pd(params.timeStep);
+	const __m128d gdt = _mm_set1_pd(-params.gravity * params.timeStep);
+	const __m128d zero = _mm_setzero_pd();
+	__m128d x = zero, y = zero, t = zero, apex = zero;
+	__m128d vx = _mm_set_pd(r1.speed * cos(r1.angle), r0.speed * cos(r0.angle));
+	__m128d vy = _mm_set_pd(r1.speed * sin(r1.angle), r0.speed * sin(r0.angle));
+	__m128d kdt = _mm_mul_pd(_mm_set_pd(r1.airResistance, r0.airResistance), dt);
+	__m128d range = zero, flight = _mm_set1_pd(-1.0), landVx = zero;
+	__m128d flying = _mm_cmpeq_pd(zero, zero);     // all bits set
+
+	const __m128d maxTime = _mm_set1_pd(params.maxTime);
+	while (_mm_movemask_pd(_mm_and_pd(flying, _mm_cmplt_pd(t, maxTime))) != 0)
+	{
+		__m128d nx = _mm_add_pd(x, _mm_mul_pd(vx, dt));
+		__m128d ny = _mm_add_pd(y, _mm_mul_pd(vy, dt));
+		__m128d nvx = _mm_sub_pd(vx, _mm_mul_pd(kdt, vx));
+		__m128d nvy = _mm_add_pd(vy, _mm_sub_pd(gdt, _mm_mul_pd(kdt, vy)));
+		apex = _mm_or_pd(_mm_and_pd(flying, _mm_max_pd(ny, apex)), _mm_andnot_pd(flying, apex));
+
+		__m128d landing = _mm_and_pd(flying, _mm_cmplt_pd(ny, zero));
+		if (_mm_movemask_pd(landing) != 0)
+		{
+			__m128d frac = _mm_div_pd(y, _mm_sub_pd(y, ny));
+			__m128d r = _mm_add_pd(x, _mm_mul_pd(_mm_sub_pd(nx, x), frac));
+			__m128d f = _mm_add_pd(t, _mm_mul_pd(dt, frac));
+			range = _mm_or_pd(_mm_and_pd(landing, r), _mm_andnot_pd(landing, range));
+			flight = _mm_or_pd(_mm_and_pd(landing, f), _mm_andnot_pd(landing, flight));
+			landVx = _mm_or_pd(_mm_and_pd(landing, vx), _mm_andnot_pd(landing, landVx));
+			flying = _mm_andnot_pd(landing, flying);
+		}
+		x = nx; y = ny; vx = nvx; vy = nvy;
+		t = _mm_add_pd(t, dt);
+	}
+	// lanes cut off at maxTime report where they got to
+	range = _mm_or_pd(_mm_and_pd(flying, x), _mm_andnot_pd(flying, range));
+
+	double out[2];
+	TrajectoryResult *res[2] = { &r0, &r1 };
+	double lv[2];
+	_mm_storeu_pd(lv, landVx);
+	for (int lane = 0; lane < 2; lane++)
+	{
+		_mm_storeu_pd(out, range);
+		res[lane]->range = out[lane];
+		_mm_storeu_pd(out, apex);
+		res[lane]->apex = out[lane];
+		_mm_storeu_pd(out, flight);
+		res[lane]->flightTime = out[lane];
+		finish(params, *res[lane], lv[lane]);
+	}
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// runSweep: workers take blocks of the grid from a shared counter
+///////////////////////////////////////////////////////////////////////////////
+void runSweep(const SweepParams &params, std::vector<TrajectoryResult> &results, int threadCount)
+{
+	const int count = params.getCount();
+	results.resize(count);
+	for (int i = 0; i < count; i++)
+		gridPoint(params, i, results[i]);
+
+	const int blockSize = 64;   // trajectories per work item, even
+	std::atomic<int> nextBlock(0);
+	auto worker = [&]()
+	{
+		for (;;)
+		{
+			int begin = blockSize * nextBlock.fetch_add(1);
+			if (begin >= count)
+				return;
+			int end = begin + blockSize < count ? begin + blockSize : count;
+			int i = begin;
+#ifdef SWEEP_SSE2
+			for (; i + 1 < end; i += 2)
+				integrateTwo(params, results[i], results[i + 1]);
+#endif
+			for (; i < end; i++)
+				integrateOne(params, results[i]);
+		}
+	};
+
+	if (threadCount <= 0)
+		threadCount = (int)std::thread::hardware_concurrency();
+	int blocks = (count + blockSize - 1) / blockSize;
+	threadCount = threadCount < blocks ? threadCount : blocks;
+	std::vector<std::thread> threads;
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(worker));
+	worker();
+	for (auto &thread : threads)
+		thread.join();
+}
+
+bool writeSweepCsv(const char *fileName, const std::vector<TrajectoryResult> &results)
+{
+	FILE *fp = openCsv("writeSweepCsv", fileName, "speed,angle_deg,air_resistance,friction,range,apex,time_of_flight,slide");
+	if (fp == NULL)
+		return false;
+	for (auto &r : results)
+		fprintf(fp, "%g,%g,%g,%g,%.6f,%.6f,%.6f,%.6f\n", r.speed, r.angle / degree, r.airResistance, r.friction,
+			r.range, r.apex, r.flightTime, r.slide);
+	return closeCsv("writeSweepCsv", fp, fileName);
+}
+
+// name=lo:hi:n or name=value, if given
+static void parseAxis(BenchArgs &args, const char *name, SweepAxis &axis, double scale)
+{
+	const char *value = args.text(name, NULL);
+	if (value == NULL)
+		return;
+	double lo, hi;
+	int n;
+	if (sscanf(value, "%lf:%lf:%d", &lo, &hi, &n) == 3 && n > 0)
+		axis = SweepAxis(lo * scale, hi * scale, n);
+	else if (sscanf(value, "%lf", &lo) == 1)
+		axis = SweepAxis(lo * scale, lo * scale, 1);
+	else
+		printf("sweep: bad value in %s=%s\n", name, value);
+}
+
+int runSweepCommand(int argc, char *argv[], const SweepParams &defaults)
+{
+	BenchArgs args("sweep", argc, argv);
+	SweepParams params = defaults;
+	parseAxis(args, "speed", params.speed, 1.0);
+	parseAxis(args, "angle", params.angle, degree);
+	parseAxis(args, "air", params.airResistance, 1.0);
+	parseAxis(args, "friction", params.friction, 1.0);
+	params.timeStep = args.number("dt", params.timeStep);
+	const char *outFile = args.text("out", "sweep.csv");
+	const int threadCount = args.integer("threads", 0);
+	args.reportUnknown();
+	if (params.timeStep <= 0.0 || params.getCount() <= 0)
+	{
+		printf("sweep: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<TrajectoryResult> results;
+	const double seconds = elapsedNs([&] { runSweep(params, results, threadCount); }) * 1e-9;
+	printf("sweep: %d trajectories, dt=%g s, %f s (%.0f trajectories/s)\n", (int)results.size(), params.timeStep,
+		seconds, results.size() / seconds);
+	return writeSweepCsv(outFile, results) ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////
+// ProjectileSweep.h
+// =================
+// Batch runner for the projectile demos: simulates every combination of a
+// grid of launch speeds, angles, air resistances and friction coefficients
+// and tabulates range, apex and time of flight as CSV.
+//
+// A trajectory is integrated the way project2 does it (explicit Euler with
+// linear air resistance, v' = g - k*v) from the ground until it comes back
+// down. Trajectories are packed two to an SSE2 register and the grid is
+// split across worker threads; the packed and the scalar code do the same
+// operations in the same order, so their results are identical.
+//
+// Friction does not act in the air; it gives the distance the ball slides
+// on flat ground after landing, vx^2 / (2 * friction * g).
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECTILE_SWEEP_H
+#define PROJECTILE_SWEEP_H
+
+#include <vector>
+
+// count values spread evenly over [lo, hi]
+struct SweepAxis
+{
+	double lo, hi;
+	int count;
+
+	SweepAxis() : lo(0.0), hi(0.0), count(1) {}
+	SweepAxis(double l, double h, int n) : lo(l), hi(h), count(n) {}
+	double at(int i) const { return count > 1 ? lo + (hi - lo) * i / (count - 1) : lo; }
+};
+
+struct SweepParams
+{
+	SweepAxis speed;            // m/s
+	SweepAxis angle;            // radian above the horizon
+	SweepAxis airResistance;    // 1/s
+	SweepAxis friction;         // sliding friction coefficient on landing
+	double gravity;             // m/s*s, positive
+	double timeStep;            // s
+	double maxTime;             // trajectories still flying after this are cut off
+
+	SweepParams() : gravity(9.81), timeStep(0.001), maxTime(60.0) {}
+	int getCount() const { return speed.count * angle.count * airResistance.count * friction.count; }
+};
+
+struct TrajectoryResult
+{
+	double speed, angle, airResistance, friction;
+	double range;               // x where the ball comes back to the ground
+	double apex;                // highest y
+	double flightTime;          // -1 if the ball was still flying at maxTime
+	double slide;               // distance slid after landing, 0 without friction
+};
+
+// runs the whole grid; threadCount 0 uses every hardware thread
+void runSweep(const SweepParams &params, std::vector<TrajectoryResult> &results, int threadCount = 0);
+
+bool writeSweepCsv(const char *fileName, const std::vector<TrajectoryResult> &results);
+
+// command line front end shared by the demos:
+//   -sweep [out=file.csv] [speed=lo:hi:n] [angle=lo:hi:n] [air=lo:hi:n]
+//          [friction=lo:hi:n] [dt=s] [threads=n]
+// angles are given in degrees. defaults fill in the parameters not given.
+int runSweepCommand(int argc, char *argv[], const SweepParams &defaults);
+
+#endif
@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////
+// Quaternion.cpp
+// ==============
+// Unit quaternions and dual quaternions. See Quaternion.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "Quaternion.h"
+
+namespace
+{
+const float DEG2RAD = 3.141593f / 180;
+const float RAD2DEG = 180 / 3.141593f;
+
+// rotation matrix m0..m8 (column major) to a unit quaternion, Shepperd's
+// method: divide by the largest of the 4 possible denominators
+Quaternion quaternionFrom3x3(float m0, float m1, float m2,
+                             float m3, float m4, float m5,
+                             float m6, float m7, float m8)
+{
+    float trace = m0 + m4 + m8;
+    if(trace > 0)
+    {
+        float s = 0.5f / sqrtf(trace + 1.0f);
+        return Quaternion((m5 - m7) * s, (m6 - m2) * s, (m1 - m3) * s, 0.25f / s);
+    }
+    else if(m0 > m4 && m0 > m8)
+    {
+        float s = 2.0f * sqrtf(1.0f + m0 - m4 - m8);
+        return Quaternion(0.25f * s, (m3 + m1) / s, (m6 + m2) / s, (m5 - m7) / s);
+    }
+    else if(m4 > m8)
+    {
+        float s = 2.0f * sqrtf(1.0f + m4 - m0 - m8);
+        return Quaternion((m3 + m1) / s, 0.25f * s, (m7 + m5) / s, (m6 - m2) / s);
+    }
+    else
+    {
+        float s = 2.0f * sqrtf(1.0f + m8 - m0 - m4);
+        return Quaternion((m6 + m2) / s, (m7 + m5) / s, 0.25f * s, (m1 - m3) / s);
+    }
+}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Quaternion
+///////////////////////////////////////////////////////////////////////////////
+Quaternion::Quaternion(const Vector3& axis, float angle)
+{
+    float halfAngle = 0.5f * angle * DEG2RAD;
+    float s = sinf(halfAngle) / axis.length();
+    x = axis.x * s;
+    y = axis.y * s;
+    z = axis.z * s;
+    w = cosf(halfAngle);
+}
+
+
+
+Quaternion Quaternion::fromMatrix(const Matrix3& m)
+{
+    const float* a = m.get();
+    return quaternionFrom3x3(a[0], a[1], a[2],  a[3], a[4], a[5],  a[6], a[7], a[8]);
+}
+
+Quaternion Quaternion::fromMatrix(const Matrix4& m)
+{
+    const float* a = m.get();
+    return quaternionFrom3x3(a[0], a[1], a[2],  a[4], a[5], a[6],  a[8], a[9], a[10]);
+}
+
+
+
+Matrix3 Quaternion::getMatrix3() const
+{
+    float xx = x*x, yy = y*y, zz = z*z;
+    float xy = x*y, xz = x*z, yz = y*z;
+    float xw = x*w, yw = y*w, zw = z*w;
+    return Matrix3(1 - 2*(yy + zz),     2*(xy + zw),     2*(xz - yw),   // 1st column
+                       2*(xy - zw), 1 - 2*(xx + zz),     2*(yz + xw),   // 2nd column
+                       2*(xz + yw),     2*(yz - xw), 1 - 2*(xx + yy));  // 3rd column
+}
+
+Matrix4 Quaternion::getMatrix4() const
+{
+    float xx = x*x, yy = y*y, zz = z*z;
+    float xy = x*y, xz = x*z, yz = y*z;
+    float xw = x*w, yw = y*w, zw = z*w;
+    return Matrix4(1 - 2*(yy + zz),     2*(xy + zw),     2*(xz - yw), 0,   // 1st column
+                       2*(xy - zw), 1 - 2*(xx + zz),     2*(yz + xw), 0,   // 2nd column
+                       2*(xz + yw),     2*(yz - xw), 1 - 2*(xx + yy), 0,   // 3rd column
+                   0, 0, 0, 1);                                            // 4th column
+}
+
+
+
+float Quaternion::getAngle() const
+{
+    float c = w / length();
+    c = c > 1.0f ? 1.0f : (c < -1.0f ? -1.0f : c);
+    return 2.0f * acosf(c) * RAD2DEG;
+}
+
+Vector3 Quaternion::getAxis() const
+{
+    float s = sqrtf(x*x + y*y + z*z);
+    if(s < 0.000001f)
+        return Vector3(1, 0, 0);
+    return Vector3(x / s, y / s, z / s);
+}
+
+
+
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float t)
+{
+    float c = a.dot(b);
+    Quaternion bb = b;
+    if(c < 0)                                           // take the shorter arc
+    {
+        c = -c;
+        bb = -b;
+    }
+    if(c > 0.9995f)                                     // nearly parallel: sin(angle) ~ 0
+        return nlerp(a, bb, t);
+
+    float angle = acosf(c);
+    float invSin = 1.0f / sinf(angle);
+    float sa = sinf((1 - t) * angle) * invSin;
+    float sb = sinf(t * angle) * invSin;
+    return a * sa + bb * sb;
+}
+
+
+
+void multiplyQuaternions(const Quaternion* a, const Quaternion* b, Quaternion* out, size_t count)
+{
+    for(size_t i = 0; i < count; ++i)
+        out[i] = a[i] * b[i];
+}
+
+void nlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count)
+{
+    for(size_t i = 0; i < count; ++i)
+        out[i] = nlerp(a[i], b[i], t);
+}
+
+
+
+std::ostream& operator<<(std::ostream& os, const Quaternion& q)
+{
+    os << "(" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ")";
+    return os;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// DualQuaternion
+///////////////////////////////////////////////////////////////////////////////
+DualQuaternion DualQuaternion::fromMatrix(const Matrix4& m)
+{
+    const float* a = m.get();
+    return DualQuaternion(Quaternion::fromMatrix(m), Vector3(a[12], a[13], a[14]));
+}
+
+
+
+Matrix4 DualQuaternion::getMatrix() const
+{
+    Matrix4 m = real.getMatrix4();
+    Vector3 t = getTranslation();
+    m[12] = t.x;
+    m[13] = t.y;
+    m[14] = t.z;
+    return m;
+}
+
+
+
+DualQuaternion& DualQuaternion::normalize()
+{
+    // unit real part, and a dual part orthogonal to it
+    float invLength = 1.0f / real.length();
+    real = real * invLength;
+    dual = dual * invLength;
+    dual = dual - real * real.dot(dual);
+    return *this;
+}
+
+
+
+DualQuaternion nlerp(const DualQuaternion& a, const DualQuaternion& b, float t)
+{
+    float tb = (a.real.dot(b.real) < 0) ? -t : t;       // take the shorter arc
+    DualQuaternion dq;
+    dq.real = a.real * (1 - t) + b.real * tb;
+    dq.dual = a.dual * (1 - t) + b.dual * tb;
+    return dq.normalize();
+}
+
+
+
+std::ostream& operator<<(std::ostream& os, const DualQuaternion& dq)
+{
+    os << "[" << dq.real << ", " << dq.dual << "]";
+    return os;
+}
@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////
+// Quaternion.h
+// ============
+// Unit quaternions for rotations, dual quaternions for rigid transforms
+//
+// A rotation of angle a around the unit axis (ax, ay, az) is
+//   q = (x, y, z, w) = (ax*sin(a/2), ay*sin(a/2), az*sin(a/2), cos(a/2))
+// q1 * q2 rotates by q2 first, then q1, like Matrix4 m1 * m2. Composing two
+// rotations costs 16 multiplies (one SSE Hamilton product) against 64 for
+// Matrix4 * Matrix4, and a rotation that advances by a fixed step each frame
+// needs no sin/cos at all: multiply by the step quaternion.
+//
+// Angles are in degree, as in Matrix4::rotate().
+//
+// A DualQuaternion holds a rotation (real) and a translation (dual =
+// 0.5 * t * real). It transforms like the rigid Matrix4 [R t] but blends
+// without shearing or shrinking, so poses of many objects interpolate
+// cheaply and correctly.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_QUATERNION_H
+#define MATH_QUATERNION_H
+
+#include <cstddef>
+#include <iostream>
+#include "Matrices.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// quaternion, vector part (x, y, z) and scalar part w
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(16) Quaternion
+{
+    float x;
+    float y;
+    float z;
+    float w;
+
+    // ctors
+    Quaternion() : x(0), y(0), z(0), w(1) {};           // identity rotation
+    Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {};
+    Quaternion(const Vector3& axis, float angle);       // rotate angle(degree) along the given axis
+
+    // conversions; the matrix must be a pure rotation
+    static Quaternion fromMatrix(const Matrix3& m);
+    static Quaternion fromMatrix(const Matrix4& m);     // upper-left 3x3
+    Matrix3     getMatrix3() const;                     // q must be unit length
+    Matrix4     getMatrix4() const;
+
+    // utils functions
+    void        set(float x, float y, float z, float w);
+    Quaternion& identity();
+    float       length() const;
+    Quaternion& normalize();
+    float       dot(const Quaternion& q) const;
+    Quaternion  conjugate() const;                      // inverse of a unit quaternion
+    Quaternion  inverse() const;                        // any non-zero quaternion
+    Vector3     rotate(const Vector3& v) const;         // v' = q * v * q^-1, q must be unit length
+    float       getAngle() const;                       // rotation angle in degree
+    Vector3     getAxis() const;                        // rotation axis, x axis for the identity
+
+    // operators
+    Quaternion  operator-() const;                      // same rotation, opposite sign
+    Quaternion  operator+(const Quaternion& rhs) const;
+    Quaternion  operator-(const Quaternion& rhs) const;
+    Quaternion  operator*(const Quaternion& rhs) const; // Hamilton product: rotate by rhs, then this
+    Quaternion& operator*=(const Quaternion& rhs);
+    Quaternion  operator*(float s) const;
+    bool        operator==(const Quaternion& rhs) const; // exact compare, no epsilon
+    bool        operator!=(const Quaternion& rhs) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const Quaternion& q);
+};
+
+// interpolation along the shorter arc; t in [0, 1]
+Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t);    // normalized lerp, no trig
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float t);    // constant angular speed
+
+// array versions, out may be the same array as an input
+void multiplyQuaternions(const Quaternion* a, const Quaternion* b, Quaternion* out, size_t count);
+void nlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count);
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// dual quaternion: rotation real, then translation
+///////////////////////////////////////////////////////////////////////////////
+struct DualQuaternion
+{
+    Quaternion real;                                    // rotation
+    Quaternion dual;                                    // 0.5 * translation * real
+
+    // ctors
+    DualQuaternion() : real(), dual(0, 0, 0, 0) {};     // identity transform
+    DualQuaternion(const Quaternion& rotation, const Vector3& translation);
+    static DualQuaternion fromMatrix(const Matrix4& m); // m must be rotation + translation
+
+    Quaternion  getRotation() const                     { return real; }
+    Vector3     getTranslation() const;
+    Matrix4     getMatrix() const;
+    DualQuaternion& normalize();
+    DualQuaternion conjugate() const;                   // inverse transform of a unit dual quaternion
+    Vector3     transform(const Vector3& p) const;      // p' = R * p + t
+
+    // operators
+    DualQuaternion operator*(const DualQuaternion& rhs) const; // apply rhs first, then this
+    DualQuaternion& operator*=(const DualQuaternion& rhs);
+
+    friend std::ostream& operator<<(std::ostream& os, const DualQuaternion& dq);
+};
+
+// dual quaternion linear blend: shortest path, renormalized
+DualQuaternion nlerp(const DualQuaternion& a, const DualQuaternion& b, float t);
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// inline functions for Quaternion
+///////////////////////////////////////////////////////////////////////////////
+inline void Quaternion::set(float x, float y, float z, float w) {
+    this->x = x; this->y = y; this->z = z; this->w = w;
+}
+
+inline Quaternion& Quaternion::identity() {
+    x = y = z = 0; w = 1; return *this;
+}
+
+inline float Quaternion::length() const {
+    return sqrtf(x*x + y*y + z*z + w*w);
+}
+
+inline Quaternion& Quaternion::normalize() {
+    float invLength = 1.0f / sqrtf(x*x + y*y + z*z + w*w);
+    x *= invLength; y *= invLength; z *= invLength; w *= invLength;
+    return *this;
+}
+
+inline float Quaternion::dot(const Quaternion& q) const {
+    return x*q.x + y*q.y + z*q.z + w*q.w;
+}
+
+inline Quaternion Quaternion::conjugate() const {
+    return Quaternion(-x, -y, -z, w);
+}
+
+inline Quaternion Quaternion::inverse() const {
+    float invLengthSq = 1.0f / dot(*this);
+    return Quaternion(-x * invLengthSq, -y * invLengthSq, -z * invLengthSq, w * invLengthSq);
+}
+
+inline Vector3 Quaternion::rotate(const Vector3& v) const {
+    // v + w*t + u x t, with u = (x, y, z) and t = 2 * u x v
+    Vector3 u(x, y, z);
+    Vector3 t = u.cross(v) * 2.0f;
+    return v + t * w + u.cross(t);
+}
+
+inline Quaternion Quaternion::operator-() const {
+    return Quaternion(-x, -y, -z, -w);
+}
+
+inline Quaternion Quaternion::operator+(const Quaternion& rhs) const {
+    return Quaternion(x+rhs.x, y+rhs.y, z+rhs.z, w+rhs.w);
+}
+
+inline Quaternion Quaternion::operator-(const Quaternion& rhs) const {
+    return Quaternion(x-rhs.x, y-rhs.y, z-rhs.z, w-rhs.w);
+}
+
+inline Quaternion Quaternion::operator*(const Quaternion& q) const {
+#if defined(MATH_SSE)
+    // lanes (x, y, z, w); the 4th lane of the 2nd and 3rd terms is negated,
+    // and the terms are summed in the order of the scalar code below
+    const __m128 a = _mm_loadu_ps(&x);
+    const __m128 b = _mm_loadu_ps(&q.x);
+    const __m128 signW = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+    __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3)), b);
+    r = _mm_add_ps(r, _mm_xor_ps(signW, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0,2,1,0)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(0,3,3,3)))));
+    r = _mm_add_ps(r, _mm_xor_ps(signW, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1,0,2,1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1,1,0,2)))));
+    r = _mm_sub_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2,1,0,2)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(2,0,2,1))));
+    Quaternion p;
+    _mm_store_ps(&p.x, r);
+    return p;
+#else
+    return Quaternion(w*q.x + x*q.w + y*q.z - z*q.y,
+                      w*q.y + y*q.w + z*q.x - x*q.z,
+                      w*q.z + z*q.w + x*q.y - y*q.x,
+                      w*q.w - x*q.x - y*q.y - z*q.z);
+#endif
+}
+
+inline Quaternion& Quaternion::operator*=(const Quaternion& rhs) {
+    return *this = *this * rhs;
+}
+
+inline Quaternion Quaternion::operator*(float s) const {
+    return Quaternion(x*s, y*s, z*s, w*s);
+}
+
+inline bool Quaternion::operator==(const Quaternion& rhs) const {
+    return (x == rhs.x) && (y == rhs.y) && (z == rhs.z) && (w == rhs.w);
+}
+
+inline bool Quaternion::operator!=(const Quaternion& rhs) const {
+    return !(*this == rhs);
+}
+
+inline Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) {
+    float tb = (a.dot(b) < 0) ? -t : t;                 // take the shorter arc
+    return Quaternion(a.x + (b.x*tb - a.x*t), a.y + (b.y*tb - a.y*t),
+                      a.z + (b.z*tb - a.z*t), a.w + (b.w*tb - a.w*t)).normalize();
+}
+// END OF QUATERNION //////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// inline functions for DualQuaternion
+///////////////////////////////////////////////////////////////////////////////
+inline DualQuaternion::DualQuaternion(const Quaternion& rotation, const Vector3& translation)
+    : real(rotation), dual(Quaternion(translation.x, translation.y, translation.z, 0) * rotation * 0.5f) {
+}
+
+inline Vector3 DualQuaternion::getTranslation() const {
+    Quaternion t = dual * real.conjugate();
+    return Vector3(2.0f * t.x, 2.0f * t.y, 2.0f * t.z);
+}
+
+inline Vector3 DualQuaternion::transform(const Vector3& p) const {
+    return real.rotate(p) + getTranslation();
+}
+
+inline DualQuaternion DualQuaternion::conjugate() const {
+    DualQuaternion dq;
+    dq.real = real.conjugate();
+    dq.dual = dual.conjugate();
+    return dq;
+}
+
+inline DualQuaternion DualQuaternion::operator*(const DualQuaternion& rhs) const {
+    DualQuaternion dq;
+    dq.real = real * rhs.real;
+    dq.dual = real * rhs.dual + dual * rhs.real;
+    return dq;
+}
+
+inline DualQuaternion& DualQuaternion::operator*=(const DualQuaternion& rhs) {
+    return *this = *this * rhs;
+}
+// END OF DUALQUATERNION //////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,398 @@
+///////////////////////////////////////////////////////////////////////////////
+// RenderCommands.cpp
+// ==================
+// The command buffer, its sort and the double-buffered frame queue.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include "RenderCommands.h"
+
+namespace
+{
+	// RenderState has padding, so states are compared and hashed field by field
+	bool sameState(const RenderState &a, const RenderState &b)
+	{
+		return memcmp(a.transform.get(), b.transform.get(), 16 * sizeof(float)) == 0 &&
+			a.depthTest == b.depthTest && a.depthWrite == b.depthWrite && a.depthFunc == b.depthFunc &&
+			a.stencilTest == b.stencilTest && a.stencilFunc == b.stencilFunc &&
+			a.stencilRef == b.stencilRef && a.stencilMask == b.stencilMask &&
+			a.stencilFail == b.stencilFail && a.depthFail == b.depthFail && a.depthPass == b.depthPass &&
+			a.blend == b.blend && a.cull == b.cull && a.colorWrite == b.colorWrite &&
+			a.texture == b.texture && a.filter == b.filter && a.repeat == b.repeat &&
+			a.lineWidth == b.lineWidth && a.pointSize == b.pointSize;
+	}
+
+	const unsigned int FNV_OFFSET = 2166136261u;
+	const unsigned int FNV_PRIME = 16777619u;
+
+	unsigned int hashBytes(unsigned int hash, const void *data, size_t size)
+	{
+		const unsigned char *p = (const unsigned char *)data;
+		for (size_t i = 0; i < size; i++)
+			hash = (hash ^ p[i]) * FNV_PRIME;
+		return hash;
+	}
+
+	unsigned int hashInt(unsigned int hash, int value)
+	{
+		return hashBytes(hash, &value, sizeof(value));
+	}
+
+	unsigned int hashState(unsigned int hash, const RenderState &s)
+	{
+		hash = hashBytes(hash, s.transform.get(), 16 * sizeof(float));
+		const int fields[] = { s.depthTest, s.depthWrite, s.depthFunc, s.stencilTest, s.stencilFunc,
+			s.stencilRef, s.stencilMask, s.stencilFail, s.depthFail, s.depthPass,
+			s.blend, s.cull, s.colorWrite, s.texture, s.filter, s.repeat };
+		hash = hashBytes(hash, fields, sizeof(fields));
+		hash = hashBytes(hash, &s.lineWidth, sizeof(float));
+		return hashBytes(hash, &s.pointSize, sizeof(float));
+	}
+
+	const char *primitiveName(PrimitiveType type)
+	{
+		static const char *names[] = { "triangles", "lines", "points" };
+		return names[type];
+	}
+
+	const char *compareName(CompareFunc func)
+	{
+		static const char *names[] = { "never", "less", "equal", "lequal", "greater", "notequal", "gequal", "always" };
+		return names[func];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CommandBuffer
+///////////////////////////////////////////////////////////////////////////////
+
+CommandBuffer::CommandBuffer(Renderer *device)
+	: device(device), width(device->getWidth()), height(device->getHeight())
+{
+}
+
+CommandBuffer::CommandBuffer(int width, int height) : device(NULL), width(width), height(height)
+{
+}
+
+int CommandBuffer::createTexture(int width, int height, const unsigned char *rgba)
+{
+	return device ? device->createTexture(width, height, rgba) : 0;
+}
+
+void CommandBuffer::deleteTexture(int texture)
+{
+	if (device)
+		device->deleteTexture(texture);
+}
+
+void CommandBuffer::reset()
+{
+	commands.clear();
+	vertices.clear();
+	states.clear();
+}
+
+int CommandBuffer::findState(const RenderState &state)
+{
+	// a frame has a handful of states, most draws reuse the last one
+	for (int i = (int)states.size() - 1; i >= 0; i--)
+	{
+		if (sameState(states[i], state))
+			return i;
+	}
+	states.push_back(state);
+	return (int)states.size() - 1;
+}
+
+void CommandBuffer::clear(unsigned int flags, const RenderColor &color, float depth, unsigned char stencil)
+{
+	Command c;
+	memset(&c, 0, sizeof(c));
+	c.kind = COMMAND_CLEAR;
+	c.flags = flags;
+	c.color = color;
+	c.depth = depth;
+	c.stencil = stencil;
+	commands.push_back(c);
+}
+
+void CommandBuffer::draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state)
+{
+	// drop the partial primitive at the end, as the backends do
+	count -= count % (type == PRIMITIVE_TRIANGLES ? 3 : type == PRIMITIVE_LINES ? 2 : 1);
+	if (count == 0)
+		return;
+	int s = findState(state);
+	this->vertices.insert(this->vertices.end(), vertices, vertices + count);
+
+	// the arena is contiguous, so a draw like the last one just extends it
+	if (!commands.empty())
+	{
+		Command &last = commands.back();
+		if (last.kind == COMMAND_DRAW && last.type == type && last.state == s)
+		{
+			last.count += count;
+			return;
+		}
+	}
+	Command c;
+	memset(&c, 0, sizeof(c));
+	c.kind = COMMAND_DRAW;
+	c.type = type;
+	c.state = s;
+	c.first = this->vertices.size() - count;
+	c.count = count;
+	commands.push_back(c);
+}
+
+void CommandBuffer::replay(Renderer &target) const
+{
+	for (auto &c : commands)
+	{
+		if (c.kind == COMMAND_CLEAR)
+			target.clear(c.flags, c.color, c.depth, c.stencil);
+		else
+			target.draw(c.type, &vertices[c.first], c.count, states[c.state]);
+	}
+	target.finish();
+}
+
+// the depth test decides which of these draws shows at a pixel, whatever
+// their order, except at equal depths (see RenderCommands.h)
+bool CommandBuffer::isReorderable(const Command &command) const
+{
+	if (command.kind != COMMAND_DRAW)
+		return false;
+	const RenderState &s = states[command.state];
+	return s.depthTest && s.depthWrite && s.colorWrite && s.blend == BLEND_NONE && !s.stencilTest &&
+		(s.depthFunc == COMPARE_LESS || s.depthFunc == COMPARE_LEQUAL);
+}
+
+void CommandBuffer::sortByState()
+{
+	// stable sort each run of reorderable draws by state, then type
+	size_t begin = 0;
+	while (begin < commands.size())
+	{
+		if (!isReorderable(commands[begin]))
+		{
+			begin++;
+			continue;
+		}
+		size_t end = begin + 1;
+		while (end < commands.size() && isReorderable(commands[end]))
+			end++;
+		std::stable_sort(commands.begin() + begin, commands.begin() + end, [](const Command &a, const Command &b) {
+			return a.state != b.state ? a.state < b.state : a.type < b.type;
+		});
+		begin = end;
+	}
+
+	// rebuild the arena in the new order and merge the draws that now touch
+	std::vector<RenderVertex> sorted;
+	sorted.reserve(vertices.size());
+	std::vector<Command> merged;
+	merged.reserve(commands.size());
+	for (auto &c : commands)
+	{
+		if (c.kind == COMMAND_DRAW)
+		{
+			sorted.insert(sorted.end(), vertices.begin() + c.first, vertices.begin() + c.first + c.count);
+			if (!merged.empty() && merged.back().kind == COMMAND_DRAW &&
+				merged.back().type == c.type && merged.back().state == c.state)
+			{
+				merged.back().count += c.count;
+				continue;
+			}
+			merged.push_back(c);
+			merged.back().first = sorted.size() - c.count;
+		}
+		else
+			merged.push_back(c);
+	}
+	commands.swap(merged);
+	vertices.swap(sorted);
+}
+
+CommandStats CommandBuffer::getStats() const
+{
+	CommandStats stats = { 0, 0, 0, (int)states.size(), 0 };
+	int lastState = -1;
+	for (auto &c : commands)
+	{
+		if (c.kind == COMMAND_CLEAR)
+		{
+			stats.clears++;
+			continue;
+		}
+		stats.draws++;
+		stats.vertices += (int)c.count;
+		if (c.state != lastState)
+			stats.stateChanges++;
+		lastState = c.state;
+	}
+	return stats;
+}
+
+unsigned int CommandBuffer::checksum() const
+{
+	unsigned int hash = FNV_OFFSET;
+	hash = hashInt(hash, width);
+	hash = hashInt(hash, height);
+	for (auto &c : commands)
+	{
+		hash = hashInt(hash, c.kind);
+		if (c.kind == COMMAND_CLEAR)
+		{
+			hash = hashInt(hash, c.flags);
+			hash = hashBytes(hash, &c.color, sizeof(c.color));
+			hash = hashBytes(hash, &c.depth, sizeof(c.depth));
+			hash = hashInt(hash, c.stencil);
+			continue;
+		}
+		// the state itself, not its index, so equal frames hash equal however they were recorded
+		hash = hashInt(hash, c.type);
+		hash = hashState(hash, states[c.state]);
+		hash = hashInt(hash, (int)c.count);
+		hash = hashBytes(hash, &vertices[c.first], c.count * sizeof(RenderVertex));
+	}
+	return hash;
+}
+
+void CommandBuffer::write(FILE *fp) const
+{
+	CommandStats stats = getStats();
+	fprintf(fp, "commands %d x %d: %d clears, %d draws, %d vertices, %d states, %d state changes\n",
+		width, height, stats.clears, stats.draws, stats.vertices, stats.states, stats.stateChanges);
+	for (size_t i = 0; i < states.size(); i++)
+	{
+		const RenderState &s = states[i];
+		const float *m = s.transform.get();
+		fprintf(fp, "state %d: transform", (int)i);
+		for (int k = 0; k < 16; k++)
+			fprintf(fp, " %g", m[k]);
+		fprintf(fp, " depth %s/%s/%s stencil %s/%s ref %d mask %02x ops %d %d %d blend %d cull %d color %s"
+			" texture %d filter %d repeat %d line %g point %g\n",
+			s.depthTest ? "on" : "off", s.depthWrite ? "write" : "nowrite", compareName(s.depthFunc),
+			s.stencilTest ? "on" : "off", compareName(s.stencilFunc), s.stencilRef, s.stencilMask,
+			s.stencilFail, s.depthFail, s.depthPass, s.blend, s.cull, s.colorWrite ? "on" : "off",
+			s.texture, s.filter, s.repeat ? 1 : 0, s.lineWidth, s.pointSize);
+	}
+	for (size_t i = 0; i < commands.size(); i++)
+	{
+		const Command &c = commands[i];
+		if (c.kind == COMMAND_CLEAR)
+			fprintf(fp, "%d clear flags %u color %d %d %d %d depth %g stencil %d\n", (int)i, c.flags,
+				c.color.red, c.color.green, c.color.blue, c.color.alpha, c.depth, c.stencil);
+		else
+			fprintf(fp, "%d draw %s vertices %d state %d hash %08x\n", (int)i, primitiveName(c.type), (int)c.count,
+				c.state, hashBytes(FNV_OFFSET, &vertices[c.first], c.count * sizeof(RenderVertex)));
+	}
+}
+
+bool CommandBuffer::sameCommand(const CommandBuffer &a, const Command &ca, const CommandBuffer &b, const Command &cb)
+{
+	if (ca.kind != cb.kind)
+		return false;
+	if (ca.kind == COMMAND_CLEAR)
+		return ca.flags == cb.flags && memcmp(&ca.color, &cb.color, sizeof(RenderColor)) == 0 &&
+			ca.depth == cb.depth && ca.stencil == cb.stencil;
+	return ca.type == cb.type && ca.count == cb.count && sameState(a.states[ca.state], b.states[cb.state]) &&
+		memcmp(&a.vertices[ca.first], &b.vertices[cb.first], ca.count * sizeof(RenderVertex)) == 0;
+}
+
+int CommandBuffer::compare(const CommandBuffer &a, const CommandBuffer &b)
+{
+	size_t n = a.commands.size() < b.commands.size() ? a.commands.size() : b.commands.size();
+	for (size_t i = 0; i < n; i++)
+	{
+		if (!sameCommand(a, a.commands[i], b, b.commands[i]))
+			return (int)i;
+	}
+	return a.commands.size() == b.commands.size() ? -1 : (int)n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FrameQueue
+///////////////////////////////////////////////////////////////////////////////
+
+// two buffers: the producer always holds one (back), the other is spare, queued
+// (ready) or being submitted (front)
+struct FrameQueue::Impl
+{
+	Impl(Renderer *device) : a(device), b(device) { init(); }
+	Impl(int width, int height) : a(width, height), b(width, height) { init(); }
+
+	void init()
+	{
+		back = &a;
+		spare = &b;
+		ready = front = NULL;
+		closed = false;
+	}
+
+	CommandBuffer a, b;
+	CommandBuffer *back, *spare, *ready, *front;
+	bool closed;
+	std::mutex lock;
+	std::condition_variable changed;
+};
+
+FrameQueue::FrameQueue(Renderer *device) : impl(new Impl(device))
+{
+}
+
+FrameQueue::FrameQueue(int width, int height) : impl(new Impl(width, height))
+{
+}
+
+FrameQueue::~FrameQueue()
+{
+	delete impl;
+}
+
+CommandBuffer &FrameQueue::record()
+{
+	impl->back->reset();
+	return *impl->back;
+}
+
+void FrameQueue::publish()
+{
+	std::unique_lock<std::mutex> guard(impl->lock);
+	impl->changed.wait(guard, [this] { return impl->spare != NULL; });
+	impl->ready = impl->back;
+	impl->back = impl->spare;
+	impl->spare = NULL;
+	impl->changed.notify_all();
+}
+
+void FrameQueue::close()
+{
+	std::lock_guard<std::mutex> guard(impl->lock);
+	impl->closed = true;
+	impl->changed.notify_all();
+}
+
+const CommandBuffer *FrameQueue::acquire()
+{
+	std::unique_lock<std::mutex> guard(impl->lock);
+	impl->changed.wait(guard, [this] { return impl->ready != NULL || impl->closed; });
+	impl->front = impl->ready;
+	impl->ready = NULL;
+	return impl->front;
+}
+
+void FrameQueue::release()
+{
+	std::lock_guard<std::mutex> guard(impl->lock);
+	if (impl->front == NULL)
+		return;
+	impl->spare = impl->front;
+	impl->front = NULL;
+	impl->changed.notify_all();
+}
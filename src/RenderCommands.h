@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////
+// RenderCommands.h
+// ================
+// Records Renderer calls into a per-frame command buffer that a backend
+// replays later, so building a frame and submitting it are separate steps.
+//
+// A CommandBuffer is itself a Renderer: a scene draws into it exactly as it
+// would draw into a GLRenderer or SoftRenderer, and replay() sends the same
+// calls to any backend, as many times as needed. Vertices go into one arena
+// and every distinct RenderState is stored once, so a command is a few
+// words. A draw with the same primitive type and state as the draw before
+// it is merged into that draw when it is recorded.
+//
+// sortByState() reorders opaque draws (depth test and depth write on, no
+// blending, no stencil, color writes on) by state between barriers; any
+// other draw and every clear is a barrier that keeps its place. It does not
+// preserve the image in general: where two reordered draws cover the same
+// pixel at exactly the same depth (coplanar or touching surfaces, decals),
+// COMPARE_LESS keeps whichever comes first and COMPARE_LEQUAL whichever
+// comes last, so the sorted frame can show the other one there. Only sort
+// frames without such ties, or compare the images of a sorted and an
+// unsorted replay first.
+//
+// checksum(), getStats(), write() and compare() are for tests and tools:
+// they tell whether a frame changed (and can be reused as it is), count its
+// draw calls, dump it as text, and find the first command two frames differ
+// in.
+//
+// FrameQueue double-buffers two CommandBuffers between a thread that builds
+// frames and the thread that owns the backend, so frame N+1 is recorded
+// while frame N is submitted.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef RENDER_COMMANDS_H
+#define RENDER_COMMANDS_H
+
+#include <stdio.h>
+#include <vector>
+#include "Renderer.h"
+
+struct CommandStats
+{
+	int clears;
+	int draws;
+	int vertices;
+	int states;                         // distinct states
+	int stateChanges;                   // draws whose state differs from the draw before
+};
+
+class CommandBuffer : public Renderer
+{
+public:
+	// textures are created on (and sizes taken from) device, which must
+	// outlive the buffer; without one the size is given and there are none
+	explicit CommandBuffer(Renderer *device);
+	CommandBuffer(int width, int height);
+
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+
+	// these go to the device right away, they are not recorded
+	int createTexture(int width, int height, const unsigned char *rgba);
+	void deleteTexture(int texture);
+
+	void clear(unsigned int flags, const RenderColor &color, float depth = 1.0f, unsigned char stencil = 0);
+	void draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state);
+	void finish() {}
+
+	void reset();                       // empties the buffer, keeps its memory
+	bool empty() const { return commands.empty(); }
+	size_t size() const { return commands.size(); }
+
+	// sends every command to target in order, then finishes it; the buffer is kept
+	void replay(Renderer &target) const;
+
+	void sortByState();                 // can change pixels where draws tie in depth, see above
+	CommandStats getStats() const;
+	unsigned int checksum() const;      // FNV-1a of the commands, states and vertices
+	void write(FILE *fp) const;         // one line per state and per command
+
+	// the index of the first command a and b differ in, or -1 when they are the same
+	static int compare(const CommandBuffer &a, const CommandBuffer &b);
+
+private:
+	enum CommandKind
+	{
+		COMMAND_CLEAR,
+		COMMAND_DRAW
+	};
+
+	struct Command
+	{
+		CommandKind kind;
+		PrimitiveType type;
+		int state;                      // index into states
+		size_t first, count;            // range in the vertex arena
+		unsigned int flags;             // clear
+		RenderColor color;
+		float depth;
+		unsigned char stencil;
+	};
+
+	int findState(const RenderState &state);
+	bool isReorderable(const Command &command) const;
+	static bool sameCommand(const CommandBuffer &a, const Command &ca, const CommandBuffer &b, const Command &cb);
+
+	Renderer *device;
+	int width, height;
+	std::vector<Command> commands;
+	std::vector<RenderVertex> vertices;
+	std::vector<RenderState> states;
+};
+
+class FrameQueue
+{
+public:
+	explicit FrameQueue(Renderer *device);
+	FrameQueue(int width, int height);
+	~FrameQueue();
+
+	// producer: record() hands out an empty buffer, publish() queues it and
+	// waits until the consumer has released the frame before
+	CommandBuffer &record();
+	void publish();
+	void close();                       // no more frames; acquire() returns NULL when drained
+
+	// consumer: acquire() waits for a frame, release() hands it back; the
+	// consumer drains the queue, or a producer thread waits in publish()
+	const CommandBuffer *acquire();
+	void release();
+
+private:
+	FrameQueue(const FrameQueue &);
+	FrameQueue &operator=(const FrameQueue &);
+
+	struct Impl;    // the buffers, mutex and condition live in the .cpp
+	Impl *impl;
+};
+
+#endif
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// Renderer.h
+// ==========
+// A small render interface with an OpenGL backend (GLRenderer) and a CPU
+// one (SoftRenderer), so a scene can be drawn without a window.
+//
+// The interface is stateless: every draw call carries its full RenderState
+// (transform, depth, stencil, blending, culling, texture), and vertices are
+// plain structs in object space. The transform is projection * modelview,
+// column major like glLoadMatrixf, and the viewport is the whole target.
+// The rules follow OpenGL: counter-clockwise front faces, depth in [0, 1],
+// the stencil test before the depth test, GL's stencil operations, window
+// row 0 at the bottom.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <stddef.h>
+#include "Matrices.h"
+
+struct RenderVertex
+{
+	float x, y, z;
+	float u, v;
+	unsigned char red, green, blue, alpha;
+};
+
+struct RenderColor
+{
+	unsigned char red, green, blue, alpha;
+};
+
+enum PrimitiveType
+{
+	PRIMITIVE_TRIANGLES,
+	PRIMITIVE_LINES,            // pairs of vertices, lineWidth pixels wide
+	PRIMITIVE_POINTS            // pointSize pixel squares
+};
+
+enum CompareFunc
+{
+	COMPARE_NEVER, COMPARE_LESS, COMPARE_EQUAL, COMPARE_LEQUAL,
+	COMPARE_GREATER, COMPARE_NOTEQUAL, COMPARE_GEQUAL, COMPARE_ALWAYS
+};
+
+enum StencilOp
+{
+	STENCIL_KEEP, STENCIL_ZERO, STENCIL_REPLACE, STENCIL_INCR, STENCIL_DECR, STENCIL_INVERT
+};
+
+enum BlendMode
+{
+	BLEND_NONE,
+	BLEND_ALPHA,                // src * alpha + dst * (1 - alpha)
+	BLEND_ADD                   // src + dst
+};
+
+enum CullMode
+{
+	CULL_NONE, CULL_BACK, CULL_FRONT
+};
+
+enum TextureFilter
+{
+	FILTER_NEAREST, FILTER_LINEAR
+};
+
+enum ClearFlags
+{
+	CLEAR_COLOR = 1, CLEAR_DEPTH = 2, CLEAR_STENCIL = 4
+};
+
+struct RenderState
+{
+	Matrix4 transform;                  // projection * modelview
+
+	bool depthTest;
+	bool depthWrite;
+	CompareFunc depthFunc;
+
+	bool stencilTest;
+	CompareFunc stencilFunc;            // compares ref & mask with stencil & mask
+	unsigned char stencilRef, stencilMask;
+	StencilOp stencilFail, depthFail, depthPass;
+
+	BlendMode blend;
+	CullMode cull;
+	bool colorWrite;
+
+	int texture;                        // 0: none; the color is modulated by the texel
+	TextureFilter filter;
+	bool repeat;                        // else clamp to the edge
+
+	float lineWidth;
+	float pointSize;
+
+	RenderState()
+		: depthTest(false), depthWrite(true), depthFunc(COMPARE_LESS),
+		stencilTest(false), stencilFunc(COMPARE_ALWAYS), stencilRef(0), stencilMask(0xff),
+		stencilFail(STENCIL_KEEP), depthFail(STENCIL_KEEP), depthPass(STENCIL_KEEP),
+		blend(BLEND_NONE), cull(CULL_NONE), colorWrite(true),
+		texture(0), filter(FILTER_NEAREST), repeat(true), lineWidth(1.0f), pointSize(1.0f) {}
+};
+
+class Renderer
+{
+public:
+	virtual ~Renderer() {}
+
+	virtual int getWidth() const = 0;
+	virtual int getHeight() const = 0;
+
+	// texels are RGBA8, bottom row first like glTexImage2D; returns an id > 0
+	virtual int createTexture(int width, int height, const unsigned char *rgba) = 0;
+	virtual void deleteTexture(int texture) = 0;
+
+	virtual void clear(unsigned int flags, const RenderColor &color, float depth = 1.0f, unsigned char stencil = 0) = 0;
+	virtual void draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state) = 0;
+
+	// returns when everything drawn so far is in the target
+	virtual void finish() = 0;
+};
+
+#endif
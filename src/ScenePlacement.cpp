@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////
+// ScenePlacement.cpp
+// ==================
+// Grid accelerated placement of non-overlapping bodies. See ScenePlacement.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include "ScenePlacement.h"
+
+namespace
+{
+	///////////////////////////////////////////////////////////////////////////
+	// Uniform grid over the world holding the index of the (single) point in
+	// each cell, or -1.
+	///////////////////////////////////////////////////////////////////////////
+	class PlacementGrid
+	{
+	public:
+		PlacementGrid(double width, double height, double minDist)
+		{
+			invCell = sqrt(2.0) / minDist;
+			cols = std::max(1, (int)ceil(width * invCell));
+			rows = std::max(1, (int)ceil(height * invCell));
+			cells.assign((size_t)cols * (size_t)rows, -1);
+			minDistSq = minDist * minDist;
+		}
+
+		bool isFree(double x, double y, const std::vector<double> &xs, const std::vector<double> &ys) const
+		{
+			int cx = (int)(x * invCell);
+			int cy = (int)(y * invCell);
+			int x0 = std::max(cx - 2, 0), x1 = std::min(cx + 2, cols - 1);
+			int y0 = std::max(cy - 2, 0), y1 = std::min(cy + 2, rows - 1);
+			for (int j = y0; j <= y1; j++)
+			{
+				const int *row = &cells[(size_t)j * cols];
+				for (int i = x0; i <= x1; i++)
+				{
+					int index = row[i];
+					if (index < 0)
+						continue;
+					double dx = xs[index] - x;
+					double dy = ys[index] - y;
+					if (dx * dx + dy * dy < minDistSq)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		void insert(double x, double y, int index)
+		{
+			int cx = std::min((int)(x * invCell), cols - 1);
+			int cy = std::min((int)(y * invCell), rows - 1);
+			cells[(size_t)cy * cols + cx] = index;
+		}
+
+	private:
+		double invCell, minDistSq;
+		int cols, rows;
+		std::vector<int> cells;
+	};
+
+	bool inWorld(double x, double y, double width, double height)
+	{
+		return x >= 0.0 && x < width && y >= 0.0 && y < height;
+	}
+
+	// registers the points already in xs/ys so new ones keep clear of them
+	void insertExisting(PlacementGrid &grid, double width, double height,
+	                    const std::vector<double> &xs, const std::vector<double> &ys)
+	{
+		for (size_t i = 0; i < xs.size(); i++)
+			if (inWorld(xs[i], ys[i], width, height))
+				grid.insert(xs[i], ys[i], (int)i);
+	}
+
+	// the memory of placeRandom's batches, kept from one to the next
+	struct Batch
+	{
+		std::vector<double> xs, ys;             // the points so far, then the candidates as drawn
+		std::vector<uint64_t> keys, scratch;    // cell << 32 | point
+		std::vector<double> sortedX, sortedY;   // in the order of keys
+		std::vector<uint64_t> pairs;            // later point << 32 | earlier point
+		std::vector<uint32_t> start;            // pairs of candidate i from start[i]
+		std::vector<unsigned char> accepted;
+	};
+
+	// stable radix sort by the cell in the upper half; the points of a cell
+	// stay in increasing order
+	void sortByCell(std::vector<uint64_t> &keys, std::vector<uint64_t> &scratch, uint64_t cellCount)
+	{
+		int bits = 1;
+		while (bits < 32 && (cellCount - 1) >> bits != 0)
+			bits++;
+		const int passes = (bits + 11) / 12, digit = (bits + passes - 1) / passes;
+		const uint64_t mask = ((uint64_t)1 << digit) - 1;
+		std::vector<size_t> start((size_t)mask + 2);
+		scratch.resize(keys.size());
+		for (int shift = 32; shift < 32 + bits; shift += digit)
+		{
+			std::fill(start.begin(), start.end(), 0);
+			for (size_t i = 0; i < keys.size(); i++)
+				start[((keys[i] >> shift) & mask) + 1]++;
+			for (size_t d = 0; d <= mask; d++)
+				start[d + 1] += start[d];
+			for (size_t i = 0; i < keys.size(); i++)
+				scratch[start[(keys[i] >> shift) & mask]++] = keys[i];
+			keys.swap(scratch);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// One batch of placeRandom's dart throwing. The candidates are the ones
+	// the loop draws, in the same order, and each is accepted exactly when
+	// the loop would accept it: when no point placed before it is closer than
+	// minDist. Sorted by cell, the close pairs are found in one sweep through
+	// memory instead of a grid lookup (several cache misses) per candidate,
+	// and without a grid over the whole world. Leaves rng, placed and
+	// attempts where the loop would have them after the same candidates, and
+	// returns the fraction of the candidates accepted (0 when it cannot run).
+	///////////////////////////////////////////////////////////////////////////
+	double throwBatch(Batch &b, SimRandom &rng, double width, double height, double minDist, int count,
+	                  int maxAttempts, std::vector<double> &xs, std::vector<double> &ys, int &placed, int &attempts)
+	{
+		// cells a bit over minDist wide, so two points closer than minDist are
+		// in the same or adjacent cells even after rounding
+		const double invCell = 1.0 / (minDist * (1.0 + 1e-9));
+		const double cols = std::max(1.0, ceil(width * invCell)), rows = std::max(1.0, ceil(height * invCell));
+		const double cellCount = cols * rows;
+		if (!(minDist > 0.0 && width > 0.0 && height > 0.0) || !(cellCount < 4294967296.0) ||
+		    xs.size() + cellCount > 4294967295.0)
+			return 0.0;
+
+		b.xs.clear();
+		b.ys.clear();
+		for (size_t i = 0; i < xs.size(); i++)
+			if (inWorld(xs[i], ys[i], width, height))
+			{
+				b.xs.push_back(xs[i]);
+				b.ys.push_back(ys[i]);
+			}
+		const uint32_t first = (uint32_t)b.xs.size();
+
+		// as many candidates as the rest takes if each point kept a disc of
+		// radius minDist to itself (more than it does, the discs overlap) up
+		// to 80% of the world; and about one per cell at most, which keeps
+		// the sweep linear
+		const double disc = 3.14159265358979 * minDist * minDist / (width * height);
+		const double coveredBefore = std::min(0.8, first * disc);
+		const double coveredAfter = std::min(0.8, coveredBefore + (count - placed) * disc);
+		const double expected = log((1.0 - coveredBefore) / (1.0 - coveredAfter)) / disc;
+		const size_t batch = (size_t)std::min(1.1 * expected + 64.0, cellCount);
+
+		SimRandom ahead = rng;
+		const uint64_t width64 = (uint64_t)cols, rows64 = (uint64_t)rows;
+		b.xs.reserve(first + batch);
+		b.ys.reserve(first + batch);
+		b.keys.resize(first + batch);
+		for (size_t i = 0; i < first + batch; i++)
+		{
+			if (i >= first)
+			{
+				b.xs.push_back(ahead.uniform(0.0, width));
+				b.ys.push_back(ahead.uniform(0.0, height));
+			}
+			const uint64_t col = std::min((uint64_t)(b.xs[i] * invCell), width64 - 1);
+			const uint64_t row = std::min((uint64_t)(b.ys[i] * invCell), rows64 - 1);
+			b.keys[i] = (row * width64 + col) << 32 | i;
+		}
+		sortByCell(b.keys, b.scratch, (uint64_t)cellCount);
+		b.sortedX.resize(b.keys.size());
+		b.sortedY.resize(b.keys.size());
+		for (size_t p = 0; p < b.keys.size(); p++)
+		{
+			b.sortedX[p] = b.xs[(uint32_t)b.keys[p]];
+			b.sortedY[p] = b.ys[(uint32_t)b.keys[p]];
+		}
+
+		// every close pair that involves a candidate, once; each point looks
+		// forward only: the rest of its cell, the next cell and three cells of
+		// the row below
+		const double minDistSq = minDist * minDist;
+		b.pairs.clear();
+		b.start.assign(batch + 1, 0);
+		size_t below = 0;
+		for (size_t p = 0; p < b.keys.size(); p++)
+		{
+			const uint64_t cell = b.keys[p] >> 32;
+			const uint64_t col = std::min((uint64_t)(b.sortedX[p] * invCell), width64 - 1);     // cell % width64
+			const uint64_t lastHere = col + 1 < width64 ? cell + 1 : cell;
+			const uint64_t lowBelow = cell + width64 - (col > 0 ? 1 : 0);
+			const uint64_t highBelow = cell + width64 + (col + 1 < width64 ? 1 : 0);
+			while (below < b.keys.size() && (b.keys[below] >> 32) < lowBelow)
+				below++;
+			for (int part = 0; part < 2; part++)
+			{
+				const uint64_t last = part == 0 ? lastHere : highBelow;
+				for (size_t q = part == 0 ? p + 1 : below; q < b.keys.size() && (b.keys[q] >> 32) <= last; q++)
+				{
+					const double dx = b.sortedX[q] - b.sortedX[p];
+					const double dy = b.sortedY[q] - b.sortedY[p];
+					const uint32_t i = (uint32_t)b.keys[p], j = (uint32_t)b.keys[q];
+					if (dx * dx + dy * dy < minDistSq && std::max(i, j) >= first)
+					{
+						b.pairs.push_back((uint64_t)std::max(i, j) << 32 | std::min(i, j));
+						b.start[std::max(i, j) - first + 1]++;
+					}
+				}
+			}
+		}
+
+		// the earlier points of each candidate together, by counting
+		for (size_t i = 0; i < batch; i++)
+			b.start[i + 1] += b.start[i];
+		b.scratch.resize(b.pairs.size());
+		for (size_t k = 0; k < b.pairs.size(); k++)
+			b.scratch[b.start[(b.pairs[k] >> 32) - first]++] = b.pairs[k];
+		for (size_t i = batch; i > 0; i--)
+			b.start[i] = b.start[i - 1];
+		b.start[0] = 0;
+
+		// accept in the order of drawing, stopping where the loop would
+		b.accepted.assign(first + batch, 0);
+		std::fill(b.accepted.begin(), b.accepted.begin() + first, 1);
+		const int placedBefore = placed;
+		size_t used = 0;
+		for (; used < batch && placed < count && attempts < maxAttempts; used++, attempts++)
+		{
+			const uint32_t i = first + (uint32_t)used;
+			bool free = true;
+			for (uint32_t k = b.start[used]; k < b.start[used + 1] && free; k++)
+				free = !b.accepted[(uint32_t)b.scratch[k]];
+			if (!free)
+				continue;
+			b.accepted[i] = 1;
+			xs.push_back(b.xs[i]);
+			ys.push_back(b.ys[i]);
+			placed++;
+			attempts = -1;  // the budget is per point
+		}
+
+		if (used == batch)
+			rng = ahead;
+		else
+			for (size_t n = 0; n < 2 * used; n++)
+				rng.next();
+		return used > 0 ? (double)(placed - placedBefore) / used : 0.0;
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// dart throwing: each candidate is uniform over the world and accepted when
+// no neighbour is closer than minDist. Batches sorted by cell do most of
+// the work; what they leave (a scene close to full) goes through the grid
+// one candidate at a time.
+///////////////////////////////////////////////////////////////////////////////
+int placeRandom(SimRandom &rng, double width, double height, double minDist, int count,
+                std::vector<double> &xs, std::vector<double> &ys, int maxAttempts)
+{
+	xs.reserve(xs.size() + std::max(count, 0));
+	ys.reserve(ys.size() + std::max(count, 0));
+	// batches while they pay; once most candidates miss, the grid is cheaper
+	Batch batch;
+	int placed = 0, attempts = 0;
+	while (placed < count && attempts < maxAttempts &&
+	       throwBatch(batch, rng, width, height, minDist, count, maxAttempts, xs, ys, placed, attempts) > 0.5)
+		;
+	if (placed >= count || attempts >= maxAttempts)
+		return placed;
+
+	PlacementGrid grid(width, height, minDist);
+	insertExisting(grid, width, height, xs, ys);
+	for (; placed < count && attempts < maxAttempts; attempts++)
+	{
+		double x = rng.uniform(0.0, width);
+		double y = rng.uniform(0.0, height);
+		if (!grid.isFree(x, y, xs, ys))
+			continue;
+		grid.insert(x, y, (int)xs.size());
+		xs.push_back(x);
+		ys.push_back(y);
+		placed++;
+		attempts = -1;  // the budget is per point
+	}
+	return placed;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Bridson's Poisson-disk sampling: new points are tried in the annulus
+// [minDist, 2*minDist) around a random active point; an active point that
+// fails maxAttempts times is retired. Candidates are drawn from the bounding
+// square and rejected outside the annulus, which is cheaper than cos/sin.
+///////////////////////////////////////////////////////////////////////////////
+int placePoissonDisk(SimRandom &rng, double width, double height, double minDist, int count,
+                     std::vector<double> &xs, std::vector<double> &ys, int maxAttempts)
+{
+	const double minDistSq = minDist * minDist;
+	PlacementGrid grid(width, height, minDist);
+	insertExisting(grid, width, height, xs, ys);
+	xs.reserve(xs.size() + count);
+	ys.reserve(ys.size() + count);
+
+	std::vector<int> active;
+	for (size_t i = 0; i < xs.size(); i++)
+		if (inWorld(xs[i], ys[i], width, height))
+			active.push_back((int)i);
+
+	int placed = 0;
+	if (active.empty() && count > 0)
+	{
+		double x = rng.uniform(0.0, width);
+		double y = rng.uniform(0.0, height);
+		grid.insert(x, y, (int)xs.size());
+		active.push_back((int)xs.size());
+		xs.push_back(x);
+		ys.push_back(y);
+		placed++;
+	}
+
+	while (placed < count && !active.empty())
+	{
+		int slot = rng.nextInt((int)active.size());
+		int center = active[slot];
+		bool found = false;
+		for (int k = 0; k < maxAttempts; k++)
+		{
+			// uniform point of the square around the center, kept if it falls in the annulus
+			double dx = minDist * (4.0 * rng.uniform01() - 2.0);
+			double dy = minDist * (4.0 * rng.uniform01() - 2.0);
+			double dSq = dx * dx + dy * dy;
+			if (dSq < minDistSq || dSq >= 4.0 * minDistSq)
+				continue;
+			double x = xs[center] + dx;
+			double y = ys[center] + dy;
+			if (!inWorld(x, y, width, height) || !grid.isFree(x, y, xs, ys))
+				continue;
+			grid.insert(x, y, (int)xs.size());
+			active.push_back((int)xs.size());
+			xs.push_back(x);
+			ys.push_back(y);
+			placed++;
+			found = true;
+			break;
+		}
+		if (!found)
+		{
+			active[slot] = active.back();
+			active.pop_back();
+		}
+	}
+	return placed;
+}
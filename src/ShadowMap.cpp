@@ -0,0 +1,383 @@
+///////////////////////////////////////////////////////////////////////////////
+// ShadowMap.cpp
+// =============
+// Depth map shadows, GL and CPU reference. See ShadowMap.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#ifndef WIN32
+#include <GL/glx.h>
+#endif
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "ShadowMap.h"
+#include "GLLoader.h"
+#include "Camera.h"
+#include "SoftRenderer.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// the GL 1.3 - 3.0 names the depth map needs; gl.h stops at 1.1
+#ifndef GL_TEXTURE0
+#define GL_TEXTURE0 0x84C0
+#define GL_TEXTURE1 0x84C1
+#endif
+#ifndef GL_CLAMP_TO_BORDER
+#define GL_CLAMP_TO_BORDER 0x812D
+#endif
+#ifndef GL_DEPTH_COMPONENT24
+#define GL_DEPTH_COMPONENT24 0x81A6
+#endif
+#ifndef GL_TEXTURE_COMPARE_MODE
+#define GL_TEXTURE_COMPARE_MODE 0x884C
+#define GL_TEXTURE_COMPARE_FUNC 0x884D
+#define GL_COMPARE_R_TO_TEXTURE 0x884E
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_VERTEX_SHADER 0x8B31
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_LINK_STATUS 0x8B82
+#endif
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#define GL_FRAMEBUFFER_BINDING 0x8CA6
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define GL_DEPTH_ATTACHMENT 0x8D00
+#endif
+
+namespace
+{
+	typedef GLuint (APIENTRY *CreateShaderProc)(GLenum type);
+	typedef void (APIENTRY *ShaderSourceProc)(GLuint shader, GLsizei count, const char *const *source, const GLint *length);
+	typedef void (APIENTRY *ShaderProc)(GLuint shader);
+	typedef void (APIENTRY *GetivProc)(GLuint object, GLenum name, GLint *value);
+	typedef GLuint (APIENTRY *CreateProgramProc)(void);
+	typedef void (APIENTRY *AttachShaderProc)(GLuint program, GLuint shader);
+	typedef GLint (APIENTRY *GetUniformLocationProc)(GLuint program, const char *name);
+	typedef void (APIENTRY *Uniform1iProc)(GLint location, GLint value);
+	typedef void (APIENTRY *UniformMatrix4fvProc)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+	typedef void (APIENTRY *ActiveTextureProc)(GLenum texture);
+	typedef void (APIENTRY *GenFramebuffersProc)(GLsizei n, GLuint *framebuffers);
+	typedef void (APIENTRY *DeleteFramebuffersProc)(GLsizei n, const GLuint *framebuffers);
+	typedef void (APIENTRY *BindFramebufferProc)(GLenum target, GLuint framebuffer);
+	typedef void (APIENTRY *FramebufferTexture2DProc)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+	typedef GLenum (APIENTRY *CheckFramebufferStatusProc)(GLenum target);
+
+	struct ShadowFunctions
+	{
+		CreateShaderProc createShader;
+		ShaderSourceProc shaderSource;
+		ShaderProc compileShader, deleteShader, linkProgram, deleteProgram, useProgram;
+		GetivProc getShaderiv, getProgramiv;
+		CreateProgramProc createProgram;
+		AttachShaderProc attachShader;
+		GetUniformLocationProc getUniformLocation;
+		Uniform1iProc uniform1i;
+		UniformMatrix4fvProc uniformMatrix4fv;
+		ActiveTextureProc activeTexture;
+		GenFramebuffersProc genFramebuffers;
+		DeleteFramebuffersProc deleteFramebuffers;
+		BindFramebufferProc bindFramebuffer;
+		FramebufferTexture2DProc framebufferTexture2D;
+		CheckFramebufferStatusProc checkFramebufferStatus;
+	};
+	ShadowFunctions gl;
+
+	bool loadShadowFunctions()
+	{
+		// shaders and glActiveTexture are GL 2.0; framebuffers are GL 3.0 or
+		// ARB_framebuffer_object under the same names, or the EXT extension
+		const char *framebuffer = hasGLVersion(3, 0) || hasGLExtension("GL_ARB_framebuffer_object") ? "" :
+			(hasGLExtension("GL_EXT_framebuffer_object") ? "EXT" : NULL);
+		if (!hasGLVersion(2, 0) || framebuffer == NULL)
+			return false;
+		return loadGLFunction(gl.createShader, "glCreateShader") && loadGLFunction(gl.shaderSource, "glShaderSource") &&
+			loadGLFunction(gl.compileShader, "glCompileShader") && loadGLFunction(gl.deleteShader, "glDeleteShader") &&
+			loadGLFunction(gl.linkProgram, "glLinkProgram") && loadGLFunction(gl.deleteProgram, "glDeleteProgram") &&
+			loadGLFunction(gl.useProgram, "glUseProgram") && loadGLFunction(gl.getShaderiv, "glGetShaderiv") &&
+			loadGLFunction(gl.getProgramiv, "glGetProgramiv") && loadGLFunction(gl.createProgram, "glCreateProgram") &&
+			loadGLFunction(gl.attachShader, "glAttachShader") &&
+			loadGLFunction(gl.getUniformLocation, "glGetUniformLocation") &&
+			loadGLFunction(gl.uniform1i, "glUniform1i") && loadGLFunction(gl.uniformMatrix4fv, "glUniformMatrix4fv") &&
+			loadGLFunction(gl.activeTexture, "glActiveTexture") &&
+			loadGLFunction(gl.genFramebuffers, "glGenFramebuffers", framebuffer) &&
+			loadGLFunction(gl.deleteFramebuffers, "glDeleteFramebuffers", framebuffer) &&
+			loadGLFunction(gl.bindFramebuffer, "glBindFramebuffer", framebuffer) &&
+			loadGLFunction(gl.framebufferTexture2D, "glFramebufferTexture2D", framebuffer) &&
+			loadGLFunction(gl.checkFramebufferStatus, "glCheckFramebufferStatus", framebuffer);
+	}
+
+	// GL_LIGHT0 as the fixed-function pipeline does it per vertex, with the
+	// diffuse part kept apart so the fragment can drop it in shadow
+	const char *vertexShader =
+		"#version 120\n"
+		"uniform mat4 eyeToMap;\n"
+		"varying vec4 mapCoord;\n"
+		"varying vec3 unlit;\n"
+		"varying vec3 diffuse;\n"
+		"void main()\n"
+		"{\n"
+		"	vec4 eye = gl_ModelViewMatrix * gl_Vertex;\n"
+		"	vec3 normal = normalize(gl_NormalMatrix * gl_Normal);\n"
+		"	vec4 light = gl_LightSource[0].position;\n"
+		"	vec3 toLight = normalize(light.xyz - eye.xyz * light.w);\n"
+		"	unlit = gl_FrontLightModelProduct.sceneColor.rgb + gl_FrontLightProduct[0].ambient.rgb;\n"
+		"	diffuse = gl_FrontLightProduct[0].diffuse.rgb * max(dot(normal, toLight), 0.0);\n"
+		"	mapCoord = eyeToMap * eye;\n"
+		"	gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;\n"
+		"	gl_Position = ftransform();\n"
+		"}\n";
+
+	// behind the light (w <= 0) is lit, like ShadowMap::lookup()
+	const char *fragmentShader =
+		"#version 120\n"
+		"uniform sampler2D image;\n"
+		"uniform sampler2DShadow map;\n"
+		"uniform bool textured;\n"
+		"varying vec4 mapCoord;\n"
+		"varying vec3 unlit;\n"
+		"varying vec3 diffuse;\n"
+		"void main()\n"
+		"{\n"
+		"	float lit = 1.0;\n"
+		"	if (mapCoord.w > 0.0)\n"
+		"		lit = shadow2DProj(map, mapCoord).r;\n"
+		"	vec4 color = vec4(min(unlit + diffuse * lit, 1.0), gl_FrontMaterial.diffuse.a);\n"
+		"	if (textured)\n"
+		"		color *= texture2D(image, gl_TexCoord[0].st);\n"
+		"	gl_FragColor = color;\n"
+		"}\n";
+
+	GLuint compileShader(GLenum type, const char *source)
+	{
+		GLuint shader = gl.createShader(type);
+		gl.shaderSource(shader, 1, &source, NULL);
+		gl.compileShader(shader);
+		GLint ok = 0;
+		gl.getShaderiv(shader, GL_COMPILE_STATUS, &ok);
+		if (!ok)
+		{
+			gl.deleteShader(shader);
+			return 0;
+		}
+		return shader;
+	}
+
+	GLuint buildProgram()
+	{
+		GLuint vs = compileShader(GL_VERTEX_SHADER, vertexShader);
+		GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentShader);
+		GLuint program = 0;
+		if (vs != 0 && fs != 0)
+		{
+			program = gl.createProgram();
+			gl.attachShader(program, vs);
+			gl.attachShader(program, fs);
+			gl.linkProgram(program);
+			GLint ok = 0;
+			gl.getProgramiv(program, GL_LINK_STATUS, &ok);
+			if (!ok)
+			{
+				gl.deleteProgram(program);
+				program = 0;
+			}
+		}
+		if (vs != 0)
+			gl.deleteShader(vs);
+		if (fs != 0)
+			gl.deleteShader(fs);
+		return program;
+	}
+}
+
+ShadowMap::ShadowMap(int size)
+	: size(size < 1 ? 1 : size), bias(0.0005f), ready(false), texture(0), framebuffer(0), program(0),
+	previousFramebuffer(0), textureMatrixLocation(-1), texturedLocation(-1)
+{
+	makeTextureMatrix();
+}
+
+void ShadowMap::setLight(const Vector3 &position, const Vector3 &target, float fovY, float zNear, float zFar)
+{
+	// any up that is not along the light direction
+	Vector3 direction = target - position;
+	Vector3 up(0.0f, 1.0f, 0.0f);
+	if (direction.x * direction.x + direction.z * direction.z < 1e-6f * direction.y * direction.y)
+		up.set(0.0f, 0.0f, -1.0f);
+	view = lookAtMatrix(position, target, up);
+	projection = perspectiveMatrix(fovY, 1.0f, zNear, zFar);
+	makeTextureMatrix();
+}
+
+void ShadowMap::setBias(float bias)
+{
+	this->bias = bias;
+	makeTextureMatrix();
+}
+
+// clip space to 0..1, the bias taken off the depth
+void ShadowMap::makeTextureMatrix()
+{
+	const Matrix4 toUnit(0.5f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.5f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.5f, 0.0f,
+		0.5f, 0.5f, 0.5f - bias, 1.0f);
+	textureMatrix = toUnit * projection * view;
+}
+
+void ShadowMap::render(const RenderVertex *triangles, size_t count, int threads)
+{
+	SoftRenderer device(size, size, threads);
+	const RenderColor black = { 0, 0, 0, 0 };
+	device.clear(CLEAR_DEPTH, black, 1.0f);
+
+	// back faces only, so a closed caster does not shadow its own lit side
+	RenderState state;
+	state.transform = projection * view;
+	state.depthTest = true;
+	state.cull = CULL_FRONT;
+	state.colorWrite = false;
+	if (count > 0)
+		device.draw(PRIMITIVE_TRIANGLES, triangles, count, state);
+
+	const float *d = device.getDepth();
+	depth.assign(d, d + (size_t)size * size);
+}
+
+float ShadowMap::lookup(const Vector3 &point) const
+{
+	const Vector4 p = textureMatrix * Vector4(point.x, point.y, point.z, 1.0f);
+	if (p.w <= 0.0f || depth.empty())
+		return 1.0f;
+	const float s = p.x / p.w, t = p.y / p.w;
+	if (s < 0.0f || s >= 1.0f || t < 0.0f || t >= 1.0f)
+		return 1.0f;                // the border is at the far plane, and r is clamped to it
+	float r = p.z / p.w;
+	r = r < 0.0f ? 0.0f : (r > 1.0f ? 1.0f : r);
+	return r <= depth[(size_t)(t * size) * size + (size_t)(s * size)] ? 1.0f : 0.0f;
+}
+
+bool ShadowMap::init()
+{
+	if (ready)
+		release();
+	if (!loadShadowFunctions() || (program = buildProgram()) == 0)
+		return false;
+
+	gl.useProgram(program);
+	gl.uniform1i(gl.getUniformLocation(program, "image"), 0);
+	gl.uniform1i(gl.getUniformLocation(program, "map"), 1);
+	textureMatrixLocation = gl.getUniformLocation(program, "eyeToMap");
+	texturedLocation = gl.getUniformLocation(program, "textured");
+	gl.useProgram(0);
+
+	// outside the map reads the far plane, so it is lit
+	const GLfloat border[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, size, size, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+	glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_R_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	GLint previous = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+	gl.genFramebuffers(1, &framebuffer);
+	gl.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	gl.framebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture, 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+	const bool complete = gl.checkFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+	gl.bindFramebuffer(GL_FRAMEBUFFER, (GLuint)previous);
+
+	ready = true;
+	if (!complete)
+		release();
+	return ready;
+}
+
+void ShadowMap::release()
+{
+	if (!ready)
+		return;
+	gl.deleteFramebuffers(1, &framebuffer);
+	glDeleteTextures(1, &texture);
+	gl.deleteProgram(program);
+	framebuffer = texture = program = 0;
+	ready = false;
+}
+
+void ShadowMap::beginDepthPass()
+{
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+	gl.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glPushAttrib(GL_VIEWPORT_BIT | GL_ENABLE_BIT | GL_POLYGON_BIT | GL_DEPTH_BUFFER_BIT | GL_TRANSFORM_BIT);
+	glViewport(0, 0, size, size);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glDepthMask(GL_TRUE);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	glDisable(GL_LIGHTING);
+	glDisable(GL_TEXTURE_2D);
+	glEnable(GL_CULL_FACE);
+	glCullFace(GL_FRONT);           // as render() does
+
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadMatrixf(projection.get());
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadMatrixf(view.get());
+}
+
+void ShadowMap::endDepthPass()
+{
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	glPopAttrib();
+	gl.bindFramebuffer(GL_FRAMEBUFFER, (GLuint)previousFramebuffer);
+}
+
+void ShadowMap::beginLighting(const Matrix4 &view)
+{
+	Matrix4 eyeToWorld = view;
+	eyeToWorld.invert();
+	const Matrix4 eyeToMap = textureMatrix * eyeToWorld;
+
+	gl.useProgram(program);
+	gl.uniformMatrix4fv(textureMatrixLocation, 1, GL_FALSE, eyeToMap.get());
+	gl.uniform1i(texturedLocation, 0);
+	gl.activeTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	gl.activeTexture(GL_TEXTURE0);
+}
+
+void ShadowMap::setTextured(bool textured)
+{
+	gl.uniform1i(texturedLocation, textured ? 1 : 0);
+}
+
+void ShadowMap::endLighting()
+{
+	gl.activeTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	gl.activeTexture(GL_TEXTURE0);
+	gl.useProgram(0);
+}
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// ShadowMap.h
+// ===========
+// Shadows from a spot light with a depth map: the casters are drawn once
+// from the light into a depth texture, and every receiver looks itself up
+// in it while it is lit, so shadows fall on any surface for one extra pass
+// instead of one flattened copy of the casters per receiving plane
+// (shadowMatrix in Geometry.h).
+//
+// setLight() places the light and its frustum. The map stores the window
+// depth of the casters' back faces (front faces are culled, so a closed
+// caster does not shadow its own lit side). A point is lit if it is outside
+// the frustum sideways or behind the light, or if its light depth minus
+// bias is at most the stored depth. Depth beyond the far plane counts as
+// the far plane.
+//
+// GL path: beginDepthPass() .. endDepthPass() around the casters, drawn in
+// world coordinates, renders into a depth texture through a framebuffer
+// object (the window's buffers are not touched). beginLighting() ..
+// endLighting() around the scene binds a GLSL 1.20 program that does the
+// fixed-function lighting of GL_LIGHT0 per vertex (emission, ambient and
+// diffuse, no specular or attenuation) and scales the diffuse part by the
+// shadow test per fragment, on texture unit 1 with GL_NEAREST like the CPU
+// lookup. init() returns false without shaders, framebuffer objects or
+// depth textures; the demo then keeps its projected shadows.
+//
+// CPU reference: render() draws world space triangles into the same map
+// with a SoftRenderer, and lookup() is the shadow test the shader does, so
+// the two can be checked against each other and against exact ray casts
+// (benchCheck -shadowbench).
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHADOW_MAP_H
+#define SHADOW_MAP_H
+
+#include <stddef.h>
+#include <vector>
+#include "Matrices.h"
+
+struct RenderVertex;
+
+class ShadowMap
+{
+public:
+	explicit ShadowMap(int size = 512);
+
+	// a spot light at position looking at target, fovY in degree
+	void setLight(const Vector3 &position, const Vector3 &target, float fovY, float zNear, float zFar);
+	void setBias(float bias);       // in window depth, 0..1
+	int getSize() const { return size; }
+	const Matrix4 &getLightView() const { return view; }
+	const Matrix4 &getLightProjection() const { return projection; }
+	// world to (s, t, depth - bias) in 0..1, before the divide by w
+	const Matrix4 &getTextureMatrix() const { return textureMatrix; }
+
+	// CPU reference; threads = 0: one per hardware thread
+	void render(const RenderVertex *triangles, size_t count, int threads = 0);
+	const std::vector<float> &getDepth() const { return depth; }    // size x size, bottom row first
+	float lookup(const Vector3 &point) const;                       // 1: lit, 0: in shadow
+
+	// GL path; init() needs a current GL context
+	bool init();
+	void release();                 // while the context is still current
+	bool isReady() const { return ready; }
+	void beginDepthPass();
+	void endDepthPass();
+	// view: the camera part of the modelview while the scene is drawn
+	void beginLighting(const Matrix4 &view);
+	void setTextured(bool textured);    // modulate by texture unit 0, like GL_MODULATE
+	void endLighting();
+
+private:
+	ShadowMap(const ShadowMap &);
+	ShadowMap &operator=(const ShadowMap &);
+
+	void makeTextureMatrix();
+
+	int size;
+	float bias;
+	Matrix4 view, projection, textureMatrix;
+	std::vector<float> depth;
+
+	bool ready;
+	unsigned int texture, framebuffer, program;
+	int previousFramebuffer;
+	int textureMatrixLocation, texturedLocation;
+};
+
+#endif
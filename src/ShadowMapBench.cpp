@@ -0,0 +1,246 @@
+///////////////////////////////////////////////////////////////////////////////
+// ShadowMapBench.cpp
+// ==================
+// Shadow map check against ray casts. See ShadowMapBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <math.h>
+#include "BenchCommon.h"
+#include "SimRandom.h"
+#include "Geometry.h"
+#include "Renderer.h"
+#include "ShadowMap.h"
+#include "ShadowMapBench.h"
+
+namespace
+{
+	// projShadow's light and room
+	const Vector3 lightPosition(50.0f, 50.0f, -320.0f);
+	const Vector3 lightTarget(-30.0f, -80.0f, -460.0f);
+	const float lightFov = 140.0f, lightNear = 10.0f, lightFar = 400.0f;
+	const float roomMin[3] = { -100.0f, -100.0f, -520.0f }, roomMax[3] = { 100.0f, 100.0f, -320.0f };
+	const int slices = 32, stacks = 16;
+
+	// a sphere as triangles facing out, counter-clockwise like gluSphere's
+	void addSphere(std::vector<RenderVertex> &triangles, const Sphere &sphere)
+	{
+		const double pi = 3.14159265358979;
+		for (int i = 0; i < stacks; i++)
+		{
+			for (int j = 0; j < slices; j++)
+			{
+				Vector3 corner[4];
+				for (int k = 0; k < 4; k++)
+				{
+					const double theta = pi * (i + (k >> 1)) / stacks, phi = 2.0 * pi * (j + ((k + (k >> 1)) & 1)) / slices;
+					corner[k] = sphere.center + Vector3((float)(sin(theta) * cos(phi)), (float)cos(theta),
+						(float)(-sin(theta) * sin(phi))) * sphere.radius;
+				}
+				// corners 0 1 on the upper ring, 3 2 below them
+				const int order[6] = { 0, 3, 2, 0, 2, 1 };
+				for (int t = 0; t < 6; t += 3)
+				{
+					const Vector3 &a = corner[order[t]], &b = corner[order[t + 1]], &c = corner[order[t + 2]];
+					if ((b - a).cross(c - a).length() <= 0.0f)
+						continue;           // the pole ends of the strips
+					Vector3 abc[3] = { a, b, c };
+					if ((b - a).cross(c - a).dot(a - sphere.center) < 0.0f)
+						abc[1] = c, abc[2] = b;
+					for (int k = 0; k < 3; k++)
+					{
+						RenderVertex v = { abc[k].x, abc[k].y, abc[k].z, 0.0f, 0.0f, 255, 255, 255, 255 };
+						triangles.push_back(v);
+					}
+				}
+			}
+		}
+	}
+
+	// grid x grid points at the cell centers of each wall, floor and ceiling
+	void makeReceivers(int grid, std::vector<Vector3> &points)
+	{
+		points.clear();
+		for (int axis = 0; axis < 3; axis++)
+		{
+			for (int side = 0; side < 2; side++)
+			{
+				if (axis == 2 && side == 1)
+					continue;               // the open front of the room, where the camera looks in
+				const int u = (axis + 1) % 3, v = (axis + 2) % 3;
+				for (int i = 0; i < grid; i++)
+				{
+					for (int j = 0; j < grid; j++)
+					{
+						float p[3];
+						p[axis] = side ? roomMax[axis] : roomMin[axis];
+						p[u] = roomMin[u] + (roomMax[u] - roomMin[u]) * (i + 0.5f) / grid;
+						p[v] = roomMin[v] + (roomMax[v] - roomMin[v]) * (j + 0.5f) / grid;
+						points.push_back(Vector3(p[0], p[1], p[2]));
+					}
+				}
+			}
+		}
+	}
+
+	// the exact answer, and whether the point is close enough to an edge
+	// that the map may answer differently
+	bool rayShadowed(const Vector3 &point, const std::vector<Sphere> &spheres, const ShadowMap &map, bool &nearEdge)
+	{
+		const Ray ray(point, lightPosition - point);
+		const float inner = cosf(3.14159265f / slices) * cosf(3.14159265f / stacks);
+		Vector3 axis = lightTarget - lightPosition;
+		axis.normalize();
+		const float texelAtUnit = 2.0f * tanf(0.5f * lightFov * 3.14159265f / 180.0f) / map.getSize();
+		bool shadowed = false;
+		nearEdge = false;
+		for (auto &s : spheres)
+		{
+			float t;
+			if (intersectRaySphere(ray, s, t) && t <= 1.0f)
+				shadowed = true;
+
+			// distance of the ray from the center, against the silhouette
+			// of the mesh and 1.5 texels there
+			const Vector3 toCenter = s.center - point;
+			float along = toCenter.dot(ray.direction) / ray.direction.dot(ray.direction);
+			along = along < 0.0f ? 0.0f : (along > 1.0f ? 1.0f : along);
+			const float distance = (ray.at(along) - s.center).length();
+			Vector3 fromLight = s.center - lightPosition;
+			const float range = fromLight.length();
+			const float cosine = fromLight.dot(axis) / range;
+			const float texel = 1.5f * range * texelAtUnit / (cosine * cosine);
+			if (distance >= s.radius * inner - texel && distance <= s.radius + texel)
+				nearEdge = true;
+		}
+		return shadowed;
+	}
+
+	bool covered(const ShadowMap &map, const Vector3 &point)
+	{
+		const Vector4 p = map.getTextureMatrix() * Vector4(point.x, point.y, point.z, 1.0f);
+		return p.w > 0.0f && p.x >= 0.0f && p.x < p.w && p.y >= 0.0f && p.y < p.w;
+	}
+
+	int runScene(std::vector<ShadowMapBenchRow> &rows, const char *scene, const std::vector<Sphere> &spheres,
+		const std::vector<Vector3> &receivers, int size)
+	{
+		ShadowMap map(size);
+		map.setLight(lightPosition, lightTarget, lightFov, lightNear, lightFar);
+		std::vector<RenderVertex> triangles;
+		for (auto &s : spheres)
+			addSphere(triangles, s);
+
+		ShadowMapBenchRow row;
+		row.scene = scene;
+		row.casters = (int)spheres.size();
+		row.receivers = (int)receivers.size();
+		row.shadowed = row.uncovered = row.missed = row.edge = row.mismatches = 0;
+		row.mapTriangles = (int)(triangles.size() / 3);
+		row.planarTriangles = 5 * row.mapTriangles;
+
+		row.renderMs = bestNs([&] { map.render(&triangles[0], triangles.size()); }, 5) * 1e-6;
+
+		std::vector<float> lit(receivers.size());
+		row.lookupNs = elapsedNs([&]
+		{
+			for (size_t i = 0; i < receivers.size(); i++)
+				lit[i] = map.lookup(receivers[i]);
+		}) / receivers.size();
+
+		for (size_t i = 0; i < receivers.size(); i++)
+		{
+			bool nearEdge;
+			const bool shadowed = rayShadowed(receivers[i], spheres, map, nearEdge);
+			row.shadowed += shadowed ? 1 : 0;
+			if (!covered(map, receivers[i]))
+			{
+				row.uncovered++;
+				row.missed += shadowed ? 1 : 0;
+				continue;
+			}
+			if (shadowed == (lit[i] == 0.0f))
+				continue;
+			if (nearEdge)
+				row.edge++;
+			else if (row.mismatches++ < 5)
+				printf("shadowbench: %s: (%g, %g, %g) is %s by the rays\n", scene, receivers[i].x, receivers[i].y,
+					receivers[i].z, shadowed ? "shadowed" : "lit");
+		}
+		rows.push_back(row);
+		return row.mismatches;
+	}
+}
+
+int runShadowMapBench(int size, int grid, std::vector<ShadowMapBenchRow> &rows)
+{
+	std::vector<Vector3> receivers;
+	makeReceivers(grid, receivers);
+	int mismatches = 0;
+
+	// the demo's ball where it starts and later on its way up
+	std::vector<Sphere> spheres(1, Sphere(Vector3(60.0f, -50.0f, -360.0f), 3.0f));
+	mismatches += runScene(rows, "demo", spheres, receivers, size);
+	spheres[0].center.y = 0.0f;
+	mismatches += runScene(rows, "demo-late", spheres, receivers, size);
+
+	// big casters whose shadows reach several walls
+	spheres.clear();
+	spheres.push_back(Sphere(Vector3(0.0f, -40.0f, -420.0f), 25.0f));
+	spheres.push_back(Sphere(Vector3(-40.0f, 0.0f, -380.0f), 12.0f));
+	spheres.push_back(Sphere(Vector3(30.0f, 20.0f, -470.0f), 18.0f));
+	mismatches += runScene(rows, "large", spheres, receivers, size);
+
+	// random spheres clear of the walls and the light
+	SimRandom random(246);
+	spheres.clear();
+	while (spheres.size() < 24)
+	{
+		const float radius = (float)random.uniform(2.0, 12.0);
+		Vector3 center;
+		for (int k = 0; k < 3; k++)
+			center[k] = (float)random.uniform(roomMin[k] + radius + 5.0, roomMax[k] - radius - 5.0);
+		if ((center - lightPosition).length() > radius + 2.0f * lightNear)
+			spheres.push_back(Sphere(center, radius));
+	}
+	mismatches += runScene(rows, "random", spheres, receivers, size);
+	return mismatches;
+}
+
+int runShadowMapBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("shadowbench", argc, argv);
+	const char *outFile = args.text("out", "shadow_bench.csv");
+	const int size = args.integer("size", 512), grid = args.integer("grid", 200);
+	args.reportUnknown();
+	if (size <= 0 || grid <= 0)
+	{
+		printf("shadowbench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<ShadowMapBenchRow> rows;
+	int mismatches = runShadowMapBench(size, grid, rows);
+	for (auto &row : rows)
+	{
+		printf("%-10s %2d casters %7d points %6d shadowed %6d uncovered (%d shadowed) %4d edge %d mismatches"
+			"  map %.2f ms  lookup %.1f ns  triangles %d (planar %d)\n", row.scene, row.casters, row.receivers,
+			row.shadowed, row.uncovered, row.missed, row.edge, row.mismatches, row.renderMs, row.lookupNs, row.mapTriangles,
+			row.planarTriangles);
+	}
+
+	FILE *fp = openCsv("shadowbench", outFile,
+		"scene,casters,receivers,shadowed,uncovered,missed,edge,mismatches,render_ms,lookup_ns,map_triangles,planar_triangles");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+	{
+		fprintf(fp, "%s,%d,%d,%d,%d,%d,%d,%d,%.4f,%.2f,%d,%d\n", row.scene, row.casters, row.receivers, row.shadowed,
+			row.uncovered, row.missed, row.edge, row.mismatches, row.renderMs, row.lookupNs, row.mapTriangles, row.planarTriangles);
+	}
+	if (!closeCsv("shadowbench", fp, outFile))
+		return 1;
+	if (mismatches)
+		printf("shadowbench: %d mismatches\n", mismatches);
+	return mismatches ? 1 : 0;
+}
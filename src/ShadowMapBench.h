@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+// ShadowMapBench.h
+// ================
+// Correctness check and cost of the CPU reference shadow map (ShadowMap.h).
+//
+// Each scene is projShadow's room and light with some spheres as casters.
+// Every receiver point on a grid over the five walls is tested twice: by
+// the shadow map, and exactly by casting a ray to the light against the
+// spheres (intersectRaySphere). The map may only disagree near a shadow's
+// edge, where the tessellation of the spheres and the size of a texel
+// decide; anything else is a mismatch. Points the light's frustum does not
+// cover are counted apart: the map calls them lit, and those of them the
+// rays shadow are shadows a spot light misses.
+//
+// The cost columns give the time to render the map and to look a point up,
+// and the triangles a frame draws for its shadows: the casters once for the
+// map, against once per receiving plane for projected shadows.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHADOW_MAP_BENCH_H
+#define SHADOW_MAP_BENCH_H
+
+#include <vector>
+
+struct ShadowMapBenchRow
+{
+	const char *scene;
+	int casters;                // spheres
+	int receivers;              // points tested
+	int shadowed;               // by the ray casts
+	int uncovered;              // outside the light's frustum
+	int missed;                 // shadowed by the ray casts but uncovered, so lit
+	int edge;                   // disagreements within the edge band
+	int mismatches;             // disagreements outside it
+	double renderMs;            // one map
+	double lookupNs;            // per point
+	int mapTriangles;           // drawn per frame for the map
+	int planarTriangles;        // drawn per frame for projected shadows on the five walls
+};
+
+// returns the total number of mismatches
+int runShadowMapBench(int size, int grid, std::vector<ShadowMapBenchRow> &rows);
+
+// benchCheck's command line front end, exits with 1 on any mismatch:
+//   -shadowbench [out=file.csv] [size=n] [grid=n]
+int runShadowMapBenchCommand(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+// SimRandom.h
+// ===========
+// Seeded random number service shared by the simulation demos.
+//
+// All scene initialization draws its numbers from one SimRandom object so a
+// run can be reproduced from its seed alone (see SimReplay.h).
+//
+// The generator is xoshiro256** (32 bytes of state, a few cycles per draw)
+// seeded through splitmix64. The uniform and normal conversions are done
+// here rather than by <random> so a seed gives the same sequence with every
+// compiler and standard library.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIM_RANDOM_H
+#define SIM_RANDOM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cmath>
+#include <ctime>
+#include <random>
+
+class SimRandom
+{
+public:
+	SimRandom() { setSeed(5489u); }
+	SimRandom(unsigned int s) { setSeed(s); }
+
+	// restart the sequence from the given seed
+	void setSeed(unsigned int s)
+	{
+		seed = s;
+		uint64_t x = s;
+		for (int i = 0; i < 4; i++)
+			state[i] = splitMix64(x);
+		hasSpare = false;
+	}
+	unsigned int getSeed() const { return seed; }
+
+	// the complete generator state, so a checkpoint can resume the sequence
+	struct State
+	{
+		uint64_t words[4];
+		double spare;
+		unsigned int seed;
+		int hasSpare;
+	};
+	State getState() const
+	{
+		State st;
+		for (int i = 0; i < 4; i++)
+			st.words[i] = state[i];
+		st.spare = hasSpare ? spare : 0.0;
+		st.seed = seed;
+		st.hasSpare = hasSpare ? 1 : 0;
+		return st;
+	}
+	void setState(const State &st)
+	{
+		for (int i = 0; i < 4; i++)
+			state[i] = st.words[i];
+		spare = st.spare;
+		seed = st.seed;
+		hasSpare = st.hasSpare != 0;
+	}
+
+	// raw 64 random bits (xoshiro256**)
+	uint64_t next()
+	{
+		const uint64_t result = rotl(state[1] * 5, 7) * 9;
+		const uint64_t t = state[1] << 17;
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+		return result;
+	}
+
+	// integer in [0, n), by multiply and shift instead of a division
+	int nextInt(int n) { return (int)(((next() >> 32) * (uint64_t)n) >> 32); }
+	// real number in [0, 1) with 53 random bits
+	double uniform01() { return (double)(next() >> 11) * (1.0 / 9007199254740992.0); }
+	// real number in [lo, hi)
+	double uniform(double lo, double hi) { return lo + (hi - lo) * uniform01(); }
+	// normally distributed real number; Box-Muller, the second value is kept for the next call
+	double normal(double mean, double dev)
+	{
+		if (hasSpare)
+		{
+			hasSpare = false;
+			return mean + dev * spare;
+		}
+		double n0, n1;
+		boxMuller(n0, n1);
+		spare = n1;
+		hasSpare = true;
+		return mean + dev * n0;
+	}
+
+	// batched generators: fill out[0..n) in one pass
+	void fillUniform(double out[], size_t n, double lo, double hi)
+	{
+		const double scale = (hi - lo) * (1.0 / 9007199254740992.0);
+		for (size_t i = 0; i < n; i++)
+			out[i] = lo + scale * (double)(next() >> 11);
+	}
+	void fillNormal(double out[], size_t n, double mean, double dev)
+	{
+		size_t i = 0;
+		for (; i + 1 < n; i += 2)
+		{
+			boxMuller(out[i], out[i + 1]);
+			out[i] = mean + dev * out[i];
+			out[i + 1] = mean + dev * out[i + 1];
+		}
+		if (i < n)
+			out[i] = normal(mean, dev);
+	}
+
+	// a fresh seed for runs that are not replayed
+	static unsigned int makeSeed() { return (unsigned int)time(0) ^ std::random_device()(); }
+
+	// one generator per thread, for work that does not need to be replayed
+	static SimRandom &perThread()
+	{
+		static thread_local SimRandom rng(makeSeed());  // random_device differs per call
+		return rng;
+	}
+
+private:
+	static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+	static uint64_t splitMix64(uint64_t &x)
+	{
+		uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+	void boxMuller(double &n0, double &n1)
+	{
+		const double twoPi = 6.283185307179586;
+		double u = 1.0 - uniform01();   // (0, 1], keeps log() finite
+		double v = uniform01();
+		double r = sqrt(-2.0 * log(u));
+		n0 = r * cos(twoPi * v);
+		n1 = r * sin(twoPi * v);
+	}
+
+	unsigned int seed;
+	uint64_t state[4];
+	double spare;
+	bool hasSpare;
+};
+
+#endif
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+// SimReplay.cpp
+// =============
+// Records the per-step inputs of a simulation run into a compact binary log
+// and plays them back. See SimReplay.h for the file layout.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "SimReplay.h"
+
+static const char replayMagic[4] = { 'S', 'R', 'P', 'L' };
+static const unsigned int replayVersion = 3;	// 2: xoshiro256** generator and grid placement, 3: Vector2d scalar * no longer modifies its operand
+
+static void putU32(std::vector<unsigned char> &buf, unsigned int v)
+{
+	for (int i = 0; i < 4; i++)
+		buf.push_back((unsigned char)(v >> (8 * i)));
+}
+
+static unsigned int getU32(const unsigned char *p)
+{
+	return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+// doubles are stored by their bit pattern so they round trip exactly
+static void putF64(std::vector<unsigned char> &buf, double v)
+{
+	unsigned char bytes[8];
+	memcpy(bytes, &v, 8);
+	buf.insert(buf.end(), bytes, bytes + 8);
+}
+
+static double getF64(const unsigned char *p)
+{
+	double v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ReplayRecorder
+///////////////////////////////////////////////////////////////////////////////
+void ReplayRecorder::begin(const char *fileName, unsigned int seed, const double params[], int paramCount)
+{
+	close();
+	name.assign(fileName, fileName + strlen(fileName) + 1);
+	buffer.clear();
+	for (int i = 0; i < 4; i++)
+		buffer.push_back((unsigned char)replayMagic[i]);
+	putU32(buffer, replayVersion);
+	putU32(buffer, seed);
+	putU32(buffer, (unsigned int)paramCount);
+	for (int i = 0; i < paramCount; i++)
+		putF64(buffer, params[i]);
+	stepCount = 0;
+	recording = true;
+}
+
+void ReplayRecorder::record(unsigned int passedMs, int key)
+{
+	if (!recording)
+		return;
+	buffer.push_back((unsigned char)key);
+	// frame times are small, so a varint keeps most steps at two bytes
+	while (passedMs >= 0x80)
+	{
+		buffer.push_back((unsigned char)(passedMs | 0x80));
+		passedMs >>= 7;
+	}
+	buffer.push_back((unsigned char)passedMs);
+	stepCount++;
+}
+
+bool ReplayRecorder::close()
+{
+	if (!recording)
+		return false;
+	recording = false;
+
+	FILE *fp = fopen(&name[0], "wb");
+	if (fp == NULL)
+	{
+		printf("ReplayRecorder: cannot write %s\n", &name[0]);
+		return false;
+	}
+	size_t written = fwrite(&buffer[0], 1, buffer.size(), fp);
+	fclose(fp);
+	printf("ReplayRecorder: %d steps, %d bytes written to %s\n", (int)stepCount, (int)written, &name[0]);
+	return written == buffer.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ReplayPlayer
+///////////////////////////////////////////////////////////////////////////////
+bool ReplayPlayer::open(const char *fileName)
+{
+	buffer.clear();
+	params.clear();
+	readPos = firstStep = 0;
+
+	FILE *fp = fopen(fileName, "rb");
+	if (fp == NULL)
+	{
+		printf("ReplayPlayer: cannot open %s\n", fileName);
+		return false;
+	}
+	unsigned char chunk[4096];
+	size_t n;
+	while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+		buffer.insert(buffer.end(), chunk, chunk + n);
+	fclose(fp);
+
+	if (buffer.size() < 16 || memcmp(&buffer[0], replayMagic, 4) != 0 || getU32(&buffer[4]) != replayVersion)
+	{
+		printf("ReplayPlayer: %s is not a replay log\n", fileName);
+		buffer.clear();
+		return false;
+	}
+	seed = getU32(&buffer[8]);
+	unsigned int paramCount = getU32(&buffer[12]);
+	if (buffer.size() < 16 + 8 * (size_t)paramCount)
+	{
+		buffer.clear();
+		return false;
+	}
+	for (unsigned int i = 0; i < paramCount; i++)
+		params.push_back(getF64(&buffer[16 + 8 * i]));
+
+	readPos = firstStep = 16 + 8 * (size_t)paramCount;
+	return true;
+}
+
+void ReplayPlayer::rewind()
+{
+	readPos = firstStep;
+}
+
+bool ReplayPlayer::next(unsigned int &passedMs, int &key)
+{
+	if (readPos >= buffer.size())
+		return false;
+
+	key = buffer[readPos++];
+	passedMs = 0;
+	for (int shift = 0; readPos < buffer.size(); shift += 7)
+	{
+		unsigned char b = buffer[readPos++];
+		passedMs |= (unsigned int)(b & 0x7f) << shift;
+		if ((b & 0x80) == 0)
+			return true;
+	}
+	return false; // truncated step
+}
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// SimReplay.h
+// ===========
+// Records the per-step inputs of a simulation run into a compact binary log
+// and plays them back, so the same run can be re-simulated bit for bit.
+//
+// A log holds the RNG seed and the scene parameters of the run, followed by
+// one record per simulation step: the key read that frame and the number of
+// milliseconds the step advanced. The demos derive their time increment from
+// the integer millisecond count, so replaying the count reproduces timeInc
+// exactly.
+//
+// File layout (little endian):
+//   "SRPL" | version(u32) | seed(u32) | paramCount(u32) | params(f64 * count)
+//   step*  : key(u8) | passedMs(LEB128 varint)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIM_REPLAY_H
+#define SIM_REPLAY_H
+
+#include <stddef.h>
+#include <vector>
+
+class ReplayRecorder
+{
+public:
+	ReplayRecorder() : recording(false), stepCount(0) {}
+	~ReplayRecorder() { close(); }
+
+	// start a new log; nothing is written to disk until close()
+	void begin(const char *fileName, unsigned int seed, const double params[], int paramCount);
+	void record(unsigned int passedMs, int key);
+	bool close();                                   // flush the log to disk
+
+	bool isRecording() const { return recording; }
+	size_t getStepCount() const { return stepCount; }
+
+private:
+	bool recording;
+	size_t stepCount;
+	std::vector<char> name;
+	std::vector<unsigned char> buffer;
+};
+
+
+
+class ReplayPlayer
+{
+public:
+	ReplayPlayer() : readPos(0) {}
+
+	bool open(const char *fileName);                // load a whole log into memory
+	void rewind();                                  // restart from the first step
+
+	unsigned int getSeed() const { return seed; }
+	int getParamCount() const { return (int)params.size(); }
+	double getParam(int index) const { return params[index]; }
+
+	// read the next step; returns false once the log is exhausted
+	bool next(unsigned int &passedMs, int &key);
+
+private:
+	unsigned int seed;
+	std::vector<double> params;
+	std::vector<unsigned char> buffer;
+	size_t firstStep;
+	size_t readPos;
+};
+
+#endif
@@ -0,0 +1,411 @@
+///////////////////////////////////////////////////////////////////////////////
+// SimSnapshot.cpp
+// ===============
+// Checkpoint files with full and delta snapshots, written on a background
+// thread. See SimSnapshot.h for the file layout.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "SimSnapshot.h"
+
+static const char snapshotMagic[4] = { 'S', 'S', 'N', 'P' };
+static const char deltaMagic[4] = { 'S', 'D', 'L', 'T' };
+static const unsigned int snapshotVersion = 1;
+static const size_t headerSize = 32;
+static const size_t tableEntrySize = 24;
+static const size_t payloadAlign = 64;
+static const size_t blockSize = 64;     // delta granularity
+
+static void putU32(std::vector<unsigned char> &buf, unsigned int v)
+{
+	unsigned char bytes[4];
+	memcpy(bytes, &v, 4);
+	buf.insert(buf.end(), bytes, bytes + 4);
+}
+
+static void putU64(std::vector<unsigned char> &buf, unsigned long long v)
+{
+	unsigned char bytes[8];
+	memcpy(bytes, &v, 8);
+	buf.insert(buf.end(), bytes, bytes + 8);
+}
+
+static unsigned int getU32(const unsigned char *p)
+{
+	unsigned int v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static unsigned long long getU64(const unsigned char *p)
+{
+	unsigned long long v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+static size_t alignUp(size_t n, size_t align)
+{
+	return (n + align - 1) / align * align;
+}
+
+// FNV-1a, guards the delta records against a torn write
+static unsigned int checksum(const unsigned char *p, size_t n)
+{
+	unsigned int hash = 2166136261u;
+	for (size_t i = 0; i < n; i++)
+		hash = (hash ^ p[i]) * 16777619u;
+	return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SnapshotState
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotState::add(unsigned int tag, const void *data, size_t size)
+{
+	const unsigned char *bytes = (const unsigned char *)data;
+	for (auto &chunk : chunks)
+	{
+		if (chunk.tag == tag)
+		{
+			chunk.data.assign(bytes, bytes + size);
+			return;
+		}
+	}
+	chunks.push_back(Chunk());
+	chunks.back().tag = tag;
+	chunks.back().data.assign(bytes, bytes + size);
+}
+
+const unsigned char *SnapshotState::find(unsigned int tag, size_t &size) const
+{
+	for (auto &chunk : chunks)
+	{
+		if (chunk.tag == tag)
+		{
+			size = chunk.data.size();
+			return chunk.data.empty() ? (const unsigned char *)"" : &chunk.data[0];
+		}
+	}
+	size = 0;
+	return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SnapshotWriter
+///////////////////////////////////////////////////////////////////////////////
+struct SnapshotWriter::Impl
+{
+	Impl() : fullInterval(32), sinceFull(0), written(0), bytes(0), busy(false), quit(false) {}
+
+	void run();
+	bool writeFull(const SnapshotState &state);
+	bool appendDelta(const SnapshotState &state);
+
+	std::string fileName;
+	int fullInterval;
+	int sinceFull;                  // deltas appended since the last full snapshot
+	SnapshotState previous;         // what the file currently restores to
+	int written;
+	size_t bytes;
+
+	std::thread worker;
+	std::mutex lock;
+	std::condition_variable wake, idle;
+	std::deque<SnapshotState> queue;
+	bool busy, quit;
+};
+
+void SnapshotWriter::Impl::run()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	for (;;)
+	{
+		wake.wait(guard, [this] { return quit || !queue.empty(); });
+		if (queue.empty())
+			break;
+		SnapshotState state;
+		std::swap(state.chunks, queue.front().chunks);
+		queue.pop_front();
+		busy = true;
+		guard.unlock();
+
+		bool ok = (sinceFull == 0 || sinceFull >= fullInterval) ? writeFull(state) : appendDelta(state);
+		if (ok)
+			std::swap(previous.chunks, state.chunks);
+
+		guard.lock();
+		busy = false;
+		if (ok)
+			written++;
+		idle.notify_all();
+	}
+}
+
+bool SnapshotWriter::Impl::writeFull(const SnapshotState &state)
+{
+	std::vector<unsigned char> head;
+	size_t offset = alignUp(headerSize + tableEntrySize * state.chunks.size(), payloadAlign);
+	std::vector<size_t> offsets;
+	for (auto &chunk : state.chunks)
+	{
+		offsets.push_back(offset);
+		offset = alignUp(offset + chunk.data.size(), payloadAlign);
+	}
+
+	head.insert(head.end(), snapshotMagic, snapshotMagic + 4);
+	putU32(head, snapshotVersion);
+	putU32(head, (unsigned int)state.chunks.size());
+	putU32(head, 0);
+	putU64(head, offset);   // deltas start after the last payload
+	putU64(head, 0);
+	for (size_t i = 0; i < state.chunks.size(); i++)
+	{
+		putU32(head, state.chunks[i].tag);
+		putU32(head, 0);
+		putU64(head, offsets[i]);
+		putU64(head, state.chunks[i].data.size());
+	}
+
+	// written next to the old file and renamed, so a crash never leaves a half snapshot
+	std::string tmpName = fileName + ".tmp";
+	FILE *fp = fopen(tmpName.c_str(), "wb");
+	if (fp == NULL)
+	{
+		printf("SnapshotWriter: cannot write %s\n", tmpName.c_str());
+		return false;
+	}
+	static const unsigned char zeros[payloadAlign] = { 0 };
+	size_t pos = fwrite(&head[0], 1, head.size(), fp);
+	for (size_t i = 0; i < state.chunks.size(); i++)
+	{
+		pos += fwrite(zeros, 1, offsets[i] - pos, fp);
+		if (!state.chunks[i].data.empty())
+			pos += fwrite(&state.chunks[i].data[0], 1, state.chunks[i].data.size(), fp);
+	}
+	pos += fwrite(zeros, 1, offset - pos, fp);
+	bool ok = (fclose(fp) == 0 && pos == offset);
+	remove(fileName.c_str());
+	if (!ok || rename(tmpName.c_str(), fileName.c_str()) != 0)
+	{
+		printf("SnapshotWriter: cannot write %s\n", fileName.c_str());
+		return false;
+	}
+	bytes += offset;
+	sinceFull = 1;
+	return true;
+}
+
+bool SnapshotWriter::Impl::appendDelta(const SnapshotState &state)
+{
+	std::vector<unsigned char> body;
+	for (auto &chunk : state.chunks)
+	{
+		size_t oldSize = 0;
+		const unsigned char *old = previous.find(chunk.tag, oldSize);
+		size_t size = chunk.data.size();
+		putU32(body, chunk.tag);
+		putU32(body, (unsigned int)size);
+		size_t countPos = body.size();
+		putU32(body, 0);
+
+		unsigned int blockCount = 0;
+		for (size_t start = 0; start < size; start += blockSize)
+		{
+			size_t n = size - start < blockSize ? size - start : blockSize;
+			if (old != NULL && start + n <= oldSize && memcmp(&chunk.data[start], old + start, n) == 0)
+				continue;
+			putU32(body, (unsigned int)(start / blockSize));
+			body.insert(body.end(), chunk.data.begin() + start, chunk.data.begin() + start + n);
+			blockCount++;
+		}
+		memcpy(&body[countPos], &blockCount, 4);
+	}
+
+	std::vector<unsigned char> record;
+	record.insert(record.end(), deltaMagic, deltaMagic + 4);
+	putU32(record, (unsigned int)body.size());
+	putU32(record, (unsigned int)state.chunks.size());
+	putU32(record, body.empty() ? checksum(NULL, 0) : checksum(&body[0], body.size()));
+	record.insert(record.end(), body.begin(), body.end());
+
+	FILE *fp = fopen(fileName.c_str(), "ab");
+	if (fp == NULL)
+	{
+		printf("SnapshotWriter: cannot append to %s\n", fileName.c_str());
+		return false;
+	}
+	size_t n = fwrite(&record[0], 1, record.size(), fp);
+	bool ok = (fclose(fp) == 0 && n == record.size());
+	if (ok)
+	{
+		bytes += n;
+		sinceFull++;
+	}
+	return ok;
+}
+
+SnapshotWriter::SnapshotWriter() : impl(new Impl)
+{
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+	{
+		std::lock_guard<std::mutex> guard(impl->lock);
+		impl->quit = true;
+	}
+	impl->wake.notify_all();
+	if (impl->worker.joinable())
+		impl->worker.join();
+	delete impl;
+}
+
+void SnapshotWriter::begin(const char *fileName, int fullInterval)
+{
+	flush();
+	std::lock_guard<std::mutex> guard(impl->lock);
+	impl->fileName = fileName;
+	impl->fullInterval = fullInterval > 1 ? fullInterval : 1;
+	impl->sinceFull = 0;
+	impl->previous.clear();
+	if (!impl->worker.joinable())
+		impl->worker = std::thread(&Impl::run, impl);
+}
+
+void SnapshotWriter::submit(SnapshotState &state)
+{
+	{
+		std::lock_guard<std::mutex> guard(impl->lock);
+		if (impl->fileName.empty())
+			return;
+		impl->queue.push_back(SnapshotState());
+		std::swap(impl->queue.back().chunks, state.chunks);
+	}
+	impl->wake.notify_one();
+}
+
+void SnapshotWriter::flush()
+{
+	std::unique_lock<std::mutex> guard(impl->lock);
+	impl->idle.wait(guard, [this] { return impl->queue.empty() && !impl->busy; });
+}
+
+int SnapshotWriter::getWrittenCount() const
+{
+	std::lock_guard<std::mutex> guard(impl->lock);
+	return impl->written;
+}
+
+size_t SnapshotWriter::getWrittenBytes() const
+{
+	std::lock_guard<std::mutex> guard(impl->lock);
+	return impl->bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// loadSnapshot
+///////////////////////////////////////////////////////////////////////////////
+bool SnapshotState::applyDelta(const unsigned char *body, size_t bodySize, unsigned int chunkCount)
+{
+	SnapshotState next;
+	size_t pos = 0;
+	for (unsigned int c = 0; c < chunkCount; c++)
+	{
+		if (pos + 12 > bodySize)
+			return false;
+		unsigned int tag = getU32(body + pos);
+		size_t size = getU32(body + pos + 4);
+		unsigned int blockCount = getU32(body + pos + 8);
+		pos += 12;
+
+		size_t oldSize = 0;
+		const unsigned char *old = find(tag, oldSize);
+		next.chunks.push_back(SnapshotState::Chunk());
+		std::vector<unsigned char> &data = next.chunks.back().data;
+		next.chunks.back().tag = tag;
+		data.assign(size, 0);
+		if (old != NULL && oldSize > 0)
+			memcpy(&data[0], old, oldSize < size ? oldSize : size);
+
+		for (unsigned int b = 0; b < blockCount; b++)
+		{
+			if (pos + 4 > bodySize)
+				return false;
+			size_t start = (size_t)getU32(body + pos) * blockSize;
+			pos += 4;
+			if (start >= size)
+				return false;
+			size_t n = size - start < blockSize ? size - start : blockSize;
+			if (pos + n > bodySize)
+				return false;
+			memcpy(&data[start], body + pos, n);
+			pos += n;
+		}
+	}
+	if (pos != bodySize)
+		return false;
+	std::swap(chunks, next.chunks);
+	return true;
+}
+
+bool loadSnapshot(const char *fileName, SnapshotState &state)
+{
+	state.clear();
+	FILE *fp = fopen(fileName, "rb");
+	if (fp == NULL)
+	{
+		printf("loadSnapshot: cannot open %s\n", fileName);
+		return false;
+	}
+	std::vector<unsigned char> buffer;
+	unsigned char block[65536];
+	size_t n;
+	while ((n = fread(block, 1, sizeof(block), fp)) > 0)
+		buffer.insert(buffer.end(), block, block + n);
+	fclose(fp);
+
+	if (buffer.size() < headerSize || memcmp(&buffer[0], snapshotMagic, 4) != 0 || getU32(&buffer[4]) != snapshotVersion)
+	{
+		printf("loadSnapshot: %s is not a snapshot\n", fileName);
+		return false;
+	}
+	unsigned int chunkCount = getU32(&buffer[8]);
+	size_t deltaOffset = (size_t)getU64(&buffer[16]);
+	if (headerSize + tableEntrySize * (size_t)chunkCount > buffer.size() || deltaOffset > buffer.size())
+		return false;
+	for (unsigned int i = 0; i < chunkCount; i++)
+	{
+		const unsigned char *entry = &buffer[headerSize + tableEntrySize * i];
+		size_t offset = (size_t)getU64(entry + 8);
+		size_t size = (size_t)getU64(entry + 16);
+		if (offset > deltaOffset || size > deltaOffset - offset)
+		{
+			state.clear();
+			return false;
+		}
+		state.add(getU32(entry), &buffer[0] + offset, size);
+	}
+
+	// apply the deltas in order; stop at the first incomplete one
+	int deltas = 0;
+	for (size_t pos = deltaOffset; pos + 16 <= buffer.size(); deltas++)
+	{
+		const unsigned char *record = &buffer[pos];
+		size_t bodySize = getU32(record + 4);
+		if (memcmp(record, deltaMagic, 4) != 0 || bodySize > buffer.size() - pos - 16)
+			break;
+		if (checksum(record + 16, bodySize) != getU32(record + 12))
+			break;
+		if (!state.applyDelta(record + 16, bodySize, getU32(record + 8)))
+			break;   // state is only replaced once the whole record applied
+		pos += 16 + bodySize;
+	}
+	printf("loadSnapshot: %s, %d chunks and %d deltas\n", fileName, state.getChunkCount(), deltas);
+	return true;
+}
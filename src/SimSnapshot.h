@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// SimSnapshot.h
+// =============
+// Checkpoint and restore of a complete simulation state.
+//
+// A demo copies its state into a SnapshotState as tagged chunks of plain
+// bytes (arrays of its ball structs, the clock, the RNG state...) and hands
+// it to a SnapshotWriter. Capturing is a memcpy per chunk; diffing and file
+// I/O happen on the writer's own thread, so the step loop does not stall.
+//
+// The writer keeps one file per run. Every fullInterval-th checkpoint
+// rewrites it as a full snapshot, the ones in between append a delta that
+// holds only the 64 byte blocks that changed since the previous checkpoint.
+// loadSnapshot() reads the full snapshot and applies every complete delta,
+// so a restore resumes from the most recent checkpoint.
+//
+// File layout (native byte order, the payloads are raw structs):
+//   header : "SSNP" | version(u32) | chunkCount(u32) | 0(u32) | deltaOffset(u64) | 0(u64)
+//   table  : chunkCount * { tag(u32) | 0(u32) | offset(u64) | size(u64) }
+//   chunks : payloads, each at a 64 byte aligned offset, so a mapped file can
+//            be used in place
+//   deltas : from deltaOffset on, records of
+//            "SDLT" | bodySize(u32) | chunkCount(u32) | checksum(u32) | body
+//            body = chunkCount * { tag(u32) | size(u32) | blockCount(u32) |
+//                                  blockCount * { block(u32) | bytes } }
+//   A delta lists every chunk of the new state; chunks it leaves out are
+//   dropped. A truncated or corrupt last record is ignored.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIM_SNAPSHOT_H
+#define SIM_SNAPSHOT_H
+
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+// builds a chunk tag from four characters
+#define SNAPSHOT_TAG(a, b, c, d) \
+	((unsigned int)(a) | ((unsigned int)(b) << 8) | ((unsigned int)(c) << 16) | ((unsigned int)(d) << 24))
+
+class SnapshotState
+{
+public:
+	void clear() { chunks.clear(); }
+	int getChunkCount() const { return (int)chunks.size(); }
+
+	// copies size bytes into a new chunk (or over the chunk with the same tag)
+	void add(unsigned int tag, const void *data, size_t size);
+	template <class T> void addValue(unsigned int tag, const T &value) { add(tag, &value, sizeof(T)); }
+	template <class T> void addArray(unsigned int tag, const T *items, size_t count) { add(tag, items, sizeof(T) * count); }
+
+	// returns the payload of a chunk or NULL when the tag is missing
+	const unsigned char *find(unsigned int tag, size_t &size) const;
+
+	template <class T> bool getValue(unsigned int tag, T &value) const
+	{
+		size_t size;
+		const unsigned char *p = find(tag, size);
+		if (p == NULL || size != sizeof(T))
+			return false;
+		memcpy(&value, p, sizeof(T));
+		return true;
+	}
+	// reads a chunk into exactly count items
+	template <class T> bool getArray(unsigned int tag, T *items, size_t count) const
+	{
+		size_t size;
+		const unsigned char *p = find(tag, size);
+		if (p == NULL || size != sizeof(T) * count)
+			return false;
+		memcpy(items, p, size);
+		return true;
+	}
+	// replaces the contents of items with the chunk
+	template <class T> bool getArray(unsigned int tag, std::vector<T> &items) const
+	{
+		size_t size;
+		const unsigned char *p = find(tag, size);
+		if (p == NULL || size % sizeof(T) != 0)
+			return false;
+		items.assign((const T *)p, (const T *)p + size / sizeof(T));
+		return true;
+	}
+
+private:
+	friend class SnapshotWriter;
+	friend bool loadSnapshot(const char *fileName, SnapshotState &state);
+
+	// replaces the chunks with a delta record body applied to them; on
+	// failure the state is left as it was
+	bool applyDelta(const unsigned char *body, size_t bodySize, unsigned int chunkCount);
+
+	struct Chunk
+	{
+		unsigned int tag;
+		std::vector<unsigned char> data;
+	};
+	std::vector<Chunk> chunks;
+};
+
+
+
+class SnapshotWriter
+{
+public:
+	SnapshotWriter();
+	~SnapshotWriter();                              // finishes the pending writes
+
+	// checkpoints go to fileName; every fullInterval-th one is a full snapshot
+	void begin(const char *fileName, int fullInterval = 32);
+	// queues a captured state for the writer thread and returns at once;
+	// state is left empty
+	void submit(SnapshotState &state);
+	void flush();                                   // waits until every queued state is on disk
+
+	int getWrittenCount() const;                    // checkpoints written so far
+	size_t getWrittenBytes() const;                 // bytes written so far
+
+private:
+	SnapshotWriter(const SnapshotWriter &);
+	SnapshotWriter &operator=(const SnapshotWriter &);
+
+	struct Impl;    // the thread lives in the .cpp, away from the demos' globals
+	Impl *impl;
+};
+
+// reads a checkpoint file written by SnapshotWriter, with all of its deltas
+bool loadSnapshot(const char *fileName, SnapshotState &state);
+
+#endif
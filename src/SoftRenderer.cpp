@@ -0,0 +1,701 @@
+///////////////////////////////////////////////////////////////////////////////
+// SoftRenderer.cpp
+// ================
+// Tile-binned, multithreaded software rasterizer. See SoftRenderer.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "ImageIO.h"
+#include "SoftRenderer.h"
+
+namespace
+{
+	const int tileSize = 64;
+	const int subPixelBits = 8;                 // fixed point window coordinates
+	const int subPixel = 1 << subPixelBits;
+	const float guardBand = 16.0f;              // clip x and y at +-16 w, keeps the fixed point small
+	const size_t flushPrimitives = 1 << 16;     // bound the bins of one huge frame
+
+	enum { ATTR_U, ATTR_V, ATTR_RED, ATTR_GREEN, ATTR_BLUE, ATTR_ALPHA, ATTR_COUNT };
+
+	// after the transform; attributes are u, v and color in 0..1
+	struct ClipVertex
+	{
+		float x, y, z, w;
+		float attr[ATTR_COUNT];
+	};
+
+	// after the perspective divide: pixels, depth 0..1, attributes / w
+	struct WindowVertex
+	{
+		float x, y, z;
+		float invW;
+		float attr[ATTR_COUNT];
+	};
+
+	// value(x, y) = c + dx * x + dy * y over window coordinates
+	struct Plane
+	{
+		float c, dx, dy;
+	};
+
+	enum { PLANE_Z, PLANE_INV_W, PLANE_ATTR };
+
+	// one triangle ready for the tiles
+	struct Setup
+	{
+		int minX, minY, maxX, maxY;             // pixels, inclusive, on screen
+		long long a[3], b[3], c[3];             // edge i: a*X + b*Y + c >= 0 inside, X, Y fixed point
+		Plane plane[PLANE_ATTR + ATTR_COUNT];
+		int state;
+	};
+
+	struct Texture
+	{
+		int width, height;
+		std::vector<unsigned char> texels;
+	};
+
+	ClipVertex lerp(const ClipVertex &p, const ClipVertex &q, float t)
+	{
+		ClipVertex r;
+		r.x = p.x + (q.x - p.x) * t;
+		r.y = p.y + (q.y - p.y) * t;
+		r.z = p.z + (q.z - p.z) * t;
+		r.w = p.w + (q.w - p.w) * t;
+		for (int k = 0; k < ATTR_COUNT; k++)
+			r.attr[k] = p.attr[k] + (q.attr[k] - p.attr[k]) * t;
+		return r;
+	}
+
+	// signed distance to clip plane i: near, far, left, right, bottom, top
+	float clipDistance(const ClipVertex &v, int i)
+	{
+		switch (i)
+		{
+		case 0: return v.z + v.w;
+		case 1: return v.w - v.z;
+		case 2: return v.x + guardBand * v.w;
+		case 3: return guardBand * v.w - v.x;
+		case 4: return v.y + guardBand * v.w;
+		default: return guardBand * v.w - v.y;
+		}
+	}
+
+	// Sutherland-Hodgman; returns the vertex count of the clipped polygon
+	int clipPolygon(ClipVertex *poly, int count)
+	{
+		ClipVertex out[9];
+		for (int plane = 0; plane < 6 && count > 0; plane++)
+		{
+			int n = 0;
+			for (int i = 0; i < count; i++)
+			{
+				const ClipVertex &p = poly[i], &q = poly[(i + 1) % count];
+				float dp = clipDistance(p, plane), dq = clipDistance(q, plane);
+				if (dp >= 0)
+					out[n++] = p;
+				if ((dp >= 0) != (dq >= 0))
+					out[n++] = lerp(p, q, dp / (dp - dq));
+			}
+			count = n;
+			memcpy(poly, out, sizeof(ClipVertex) * n);
+		}
+		return count;
+	}
+
+	// clips the segment p-q; false if nothing is left
+	bool clipSegment(ClipVertex &p, ClipVertex &q)
+	{
+		float t0 = 0.0f, t1 = 1.0f;
+		for (int plane = 0; plane < 6; plane++)
+		{
+			float dp = clipDistance(p, plane), dq = clipDistance(q, plane);
+			if (dp < 0 && dq < 0)
+				return false;
+			if (dp < 0)
+				t0 = fmaxf(t0, dp / (dp - dq));
+			else if (dq < 0)
+				t1 = fminf(t1, dp / (dp - dq));
+		}
+		if (t0 > t1)
+			return false;
+		ClipVertex a = lerp(p, q, t0), b = lerp(p, q, t1);
+		p = a;
+		q = b;
+		return true;
+	}
+
+	Plane makePlane(const float *x, const float *y, float f0, float f1, float f2)
+	{
+		float x1 = x[1] - x[0], y1 = y[1] - y[0], x2 = x[2] - x[0], y2 = y[2] - y[0];
+		float invDet = 1.0f / (x1 * y2 - x2 * y1);
+		Plane p;
+		p.dx = ((f1 - f0) * y2 - (f2 - f0) * y1) * invDet;
+		p.dy = ((f2 - f0) * x1 - (f1 - f0) * x2) * invDet;
+		p.c = f0 - p.dx * x[0] - p.dy * y[0];
+		return p;
+	}
+
+	bool compare(CompareFunc func, float a, float b)
+	{
+		switch (func)
+		{
+		case COMPARE_NEVER: return false;
+		case COMPARE_LESS: return a < b;
+		case COMPARE_EQUAL: return a == b;
+		case COMPARE_LEQUAL: return a <= b;
+		case COMPARE_GREATER: return a > b;
+		case COMPARE_NOTEQUAL: return a != b;
+		case COMPARE_GEQUAL: return a >= b;
+		default: return true;
+		}
+	}
+
+	unsigned char applyStencil(StencilOp op, unsigned char value, unsigned char ref)
+	{
+		switch (op)
+		{
+		case STENCIL_ZERO: return 0;
+		case STENCIL_REPLACE: return ref;
+		case STENCIL_INCR: return value < 255 ? value + 1 : 255;
+		case STENCIL_DECR: return value > 0 ? value - 1 : 0;
+		case STENCIL_INVERT: return (unsigned char)~value;
+		default: return value;
+		}
+	}
+
+	int wrap(int i, int size, bool repeat)
+	{
+		if (repeat)
+			return (size & (size - 1)) == 0 ? i & (size - 1) : ((i % size) + size) % size;
+		return i < 0 ? 0 : (i >= size ? size - 1 : i);
+	}
+
+	// texel (RGBA 0..1) at u, v
+	void sample(const Texture &t, float u, float v, TextureFilter filter, bool repeat, float *rgba)
+	{
+		if (filter == FILTER_NEAREST)
+		{
+			int x = wrap((int)floorf(u * t.width), t.width, repeat);
+			int y = wrap((int)floorf(v * t.height), t.height, repeat);
+			const unsigned char *p = &t.texels[(y * t.width + x) * 4];
+			for (int k = 0; k < 4; k++)
+				rgba[k] = p[k] * (1.0f / 255.0f);
+			return;
+		}
+		float fu = u * t.width - 0.5f, fv = v * t.height - 0.5f;
+		float x0f = floorf(fu), y0f = floorf(fv);
+		float fx = fu - x0f, fy = fv - y0f;
+		int x0 = wrap((int)x0f, t.width, repeat), x1 = wrap((int)x0f + 1, t.width, repeat);
+		int y0 = wrap((int)y0f, t.height, repeat), y1 = wrap((int)y0f + 1, t.height, repeat);
+		const unsigned char *p00 = &t.texels[(y0 * t.width + x0) * 4], *p10 = &t.texels[(y0 * t.width + x1) * 4];
+		const unsigned char *p01 = &t.texels[(y1 * t.width + x0) * 4], *p11 = &t.texels[(y1 * t.width + x1) * 4];
+		for (int k = 0; k < 4; k++)
+		{
+			float bottom = p00[k] + (p10[k] - p00[k]) * fx;
+			float top = p01[k] + (p11[k] - p01[k]) * fx;
+			rgba[k] = (bottom + (top - bottom) * fy) * (1.0f / 255.0f);
+		}
+	}
+
+	unsigned char toByte(float c)
+	{
+		c = c < 0.0f ? 0.0f : (c > 1.0f ? 1.0f : c);
+		return (unsigned char)(c * 255.0f + 0.5f);
+	}
+}
+
+
+
+struct SoftRenderer::Impl
+{
+	int width, height;
+	int tilesX, tilesY;
+	std::vector<unsigned char> color;
+	std::vector<float> depth;
+	std::vector<unsigned char> stencil;
+	std::vector<Texture> textures;              // id - 1; a deleted one has no texels
+
+	// the frame so far
+	std::vector<RenderState> states;
+	std::vector<Setup> setups;
+	std::vector<std::vector<int> > bins;        // setup indices per tile, in submission order
+
+	// the pool; the calling thread rasterizes too
+	std::vector<std::thread> workers;
+	std::mutex lock;
+	std::condition_variable wake, idle;
+	int generation, busy;
+	bool quit;
+	std::atomic<int> nextTile;
+
+	Impl(int width, int height, int threads);
+	~Impl();
+
+	void addTriangle(const WindowVertex &v0, const WindowVertex &v1, const WindowVertex &v2, bool cull);
+	void addQuad(const WindowVertex *corner);
+	WindowVertex toWindow(const ClipVertex &v) const;
+	void flush();
+	void run();
+	void work();
+	void rasterize(const Setup &s, const RenderState &state, int x0, int y0, int x1, int y1);
+};
+
+SoftRenderer::Impl::Impl(int width, int height, int threads)
+	: width(width), height(height), generation(0), busy(0), quit(false), nextTile(0)
+{
+	tilesX = (width + tileSize - 1) / tileSize;
+	tilesY = (height + tileSize - 1) / tileSize;
+	color.assign((size_t)width * height * 4, 0);
+	depth.assign((size_t)width * height, 1.0f);
+	stencil.assign((size_t)width * height, 0);
+	bins.resize(tilesX * tilesY);
+	if (threads <= 0)
+		threads = (int)std::thread::hardware_concurrency();
+	for (int i = 1; i < threads; i++)
+		workers.push_back(std::thread(&Impl::run, this));
+}
+
+SoftRenderer::Impl::~Impl()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		quit = true;
+	}
+	wake.notify_all();
+	for (auto &t : workers)
+		t.join();
+}
+
+void SoftRenderer::Impl::run()
+{
+	int seen = 0;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wake.wait(guard, [&] { return quit || generation != seen; });
+			if (quit)
+				return;
+			seen = generation;
+		}
+		work();
+		std::lock_guard<std::mutex> guard(lock);
+		if (--busy == 0)
+			idle.notify_one();
+	}
+}
+
+void SoftRenderer::Impl::work()
+{
+	const int tileCount = tilesX * tilesY;
+	for (int t = nextTile++; t < tileCount; t = nextTile++)
+	{
+		int x0 = (t % tilesX) * tileSize, y0 = (t / tilesX) * tileSize;
+		int x1 = x0 + tileSize < width ? x0 + tileSize : width;
+		int y1 = y0 + tileSize < height ? y0 + tileSize : height;
+		for (int index : bins[t])
+			rasterize(setups[index], states[setups[index].state], x0, y0, x1, y1);
+	}
+}
+
+void SoftRenderer::Impl::flush()
+{
+	if (setups.empty())
+	{
+		states.clear();
+		return;
+	}
+	nextTile = 0;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		busy = (int)workers.size();
+		generation++;
+	}
+	wake.notify_all();
+	work();
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		idle.wait(guard, [&] { return busy == 0; });
+	}
+	for (auto &bin : bins)
+		bin.clear();
+	setups.clear();
+	states.clear();
+}
+
+WindowVertex SoftRenderer::Impl::toWindow(const ClipVertex &v) const
+{
+	WindowVertex r;
+	r.invW = 1.0f / v.w;
+	r.x = (v.x * r.invW + 1.0f) * 0.5f * width;
+	r.y = (v.y * r.invW + 1.0f) * 0.5f * height;
+	r.z = (v.z * r.invW + 1.0f) * 0.5f;
+	for (int k = 0; k < ATTR_COUNT; k++)
+		r.attr[k] = v.attr[k] * r.invW;
+	return r;
+}
+
+void SoftRenderer::Impl::addTriangle(const WindowVertex &v0, const WindowVertex &v1, const WindowVertex &v2, bool cull)
+{
+	const RenderState &state = states.back();
+	const WindowVertex *v[3] = { &v0, &v1, &v2 };
+	long long X[3], Y[3];
+	for (int i = 0; i < 3; i++)
+	{
+		X[i] = (long long)floor(v[i]->x * subPixel + 0.5f);
+		Y[i] = (long long)floor(v[i]->y * subPixel + 0.5f);
+	}
+	long long area = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+	if (area == 0)
+		return;
+	if (cull && ((state.cull == CULL_BACK && area < 0) || (state.cull == CULL_FRONT && area > 0)))
+		return;
+	if (area < 0)                               // make it counter-clockwise
+	{
+		const WindowVertex *t = v[1]; v[1] = v[2]; v[2] = t;
+		long long tx = X[1]; X[1] = X[2]; X[2] = tx;
+		long long ty = Y[1]; Y[1] = Y[2]; Y[2] = ty;
+	}
+
+	Setup s;
+	long long minX = X[0], maxX = X[0], minY = Y[0], maxY = Y[0];
+	for (int i = 1; i < 3; i++)
+	{
+		minX = X[i] < minX ? X[i] : minX; maxX = X[i] > maxX ? X[i] : maxX;
+		minY = Y[i] < minY ? Y[i] : minY; maxY = Y[i] > maxY ? Y[i] : maxY;
+	}
+	// pixels whose centers are in the box
+	const long long half = subPixel / 2;
+	s.minX = (int)((minX - half + subPixel - 1) >> subPixelBits);
+	s.minY = (int)((minY - half + subPixel - 1) >> subPixelBits);
+	s.maxX = (int)((maxX - half) >> subPixelBits);
+	s.maxY = (int)((maxY - half) >> subPixelBits);
+	s.minX = s.minX < 0 ? 0 : s.minX;
+	s.minY = s.minY < 0 ? 0 : s.minY;
+	s.maxX = s.maxX >= width ? width - 1 : s.maxX;
+	s.maxY = s.maxY >= height ? height - 1 : s.maxY;
+	if (s.minX > s.maxX || s.minY > s.maxY)
+		return;
+
+	// edge i runs from vertex i+1 to i+2; a point exactly on an edge is
+	// inside only for edges going up, or going left along a horizontal
+	for (int i = 0; i < 3; i++)
+	{
+		int p = (i + 1) % 3, q = (i + 2) % 3;
+		s.a[i] = -(Y[q] - Y[p]);
+		s.b[i] = X[q] - X[p];
+		s.c[i] = -(s.a[i] * X[p] + s.b[i] * Y[p]);
+		bool topLeft = Y[q] > Y[p] || (Y[q] == Y[p] && X[q] < X[p]);
+		if (!topLeft)
+			s.c[i] -= 1;
+	}
+
+	const float x[3] = { X[0] / (float)subPixel, X[1] / (float)subPixel, X[2] / (float)subPixel };
+	const float y[3] = { Y[0] / (float)subPixel, Y[1] / (float)subPixel, Y[2] / (float)subPixel };
+	s.plane[PLANE_Z] = makePlane(x, y, v[0]->z, v[1]->z, v[2]->z);
+	s.plane[PLANE_INV_W] = makePlane(x, y, v[0]->invW, v[1]->invW, v[2]->invW);
+	for (int k = 0; k < ATTR_COUNT; k++)
+		s.plane[PLANE_ATTR + k] = makePlane(x, y, v[0]->attr[k], v[1]->attr[k], v[2]->attr[k]);
+	s.state = (int)states.size() - 1;
+
+	int index = (int)setups.size();
+	setups.push_back(s);
+	for (int ty = s.minY / tileSize; ty <= s.maxY / tileSize; ty++)
+		for (int tx = s.minX / tileSize; tx <= s.maxX / tileSize; tx++)
+			bins[ty * tilesX + tx].push_back(index);
+}
+
+// corners counter-clockwise; lines and points are never culled
+void SoftRenderer::Impl::addQuad(const WindowVertex *corner)
+{
+	addTriangle(corner[0], corner[1], corner[2], false);
+	addTriangle(corner[0], corner[2], corner[3], false);
+}
+
+void SoftRenderer::Impl::rasterize(const Setup &s, const RenderState &state, int x0, int y0, int x1, int y1)
+{
+	int minX = s.minX > x0 ? s.minX : x0, maxX = s.maxX < x1 - 1 ? s.maxX : x1 - 1;
+	int minY = s.minY > y0 ? s.minY : y0, maxY = s.maxY < y1 - 1 ? s.maxY : y1 - 1;
+	if (minX > maxX || minY > maxY)
+		return;
+
+	const Texture *texture = NULL;
+	if (state.texture > 0 && state.texture <= (int)textures.size() && !textures[state.texture - 1].texels.empty())
+		texture = &textures[state.texture - 1];
+	const unsigned char ref = state.stencilRef & state.stencilMask;
+	const long long step[3] = { s.a[0] * subPixel, s.a[1] * subPixel, s.a[2] * subPixel };
+
+	for (int y = minY; y <= maxY; y++)
+	{
+		const long long X = (long long)minX * subPixel + subPixel / 2, Y = (long long)y * subPixel + subPixel / 2;
+		long long e0 = s.a[0] * X + s.b[0] * Y + s.c[0];
+		long long e1 = s.a[1] * X + s.b[1] * Y + s.c[1];
+		long long e2 = s.a[2] * X + s.b[2] * Y + s.c[2];
+		const float fy = y + 0.5f;
+		for (int x = minX; x <= maxX; x++, e0 += step[0], e1 += step[1], e2 += step[2])
+		{
+			if ((e0 | e1 | e2) < 0)
+				continue;
+			const float fx = x + 0.5f;
+			const size_t pixel = (size_t)y * width + x;
+
+			// stencil, then depth
+			unsigned char &st = stencil[pixel];
+			if (state.stencilTest && !compare(state.stencilFunc, ref, (float)(st & state.stencilMask)))
+			{
+				st = applyStencil(state.stencilFail, st, state.stencilRef);
+				continue;
+			}
+			const Plane &pz = s.plane[PLANE_Z];
+			float z = pz.c + pz.dx * fx + pz.dy * fy;
+			z = z < 0.0f ? 0.0f : (z > 1.0f ? 1.0f : z);
+			if (state.depthTest && !compare(state.depthFunc, z, depth[pixel]))
+			{
+				if (state.stencilTest)
+					st = applyStencil(state.depthFail, st, state.stencilRef);
+				continue;
+			}
+			if (state.stencilTest)
+				st = applyStencil(state.depthPass, st, state.stencilRef);
+			if (state.depthTest && state.depthWrite)
+				depth[pixel] = z;
+			if (!state.colorWrite)
+				continue;
+
+			// perspective-correct attributes
+			const Plane &pw = s.plane[PLANE_INV_W];
+			const float w = 1.0f / (pw.c + pw.dx * fx + pw.dy * fy);
+			float attr[ATTR_COUNT];
+			for (int k = texture ? 0 : ATTR_RED; k < ATTR_COUNT; k++)
+			{
+				const Plane &p = s.plane[PLANE_ATTR + k];
+				attr[k] = (p.c + p.dx * fx + p.dy * fy) * w;
+			}
+			float rgba[4] = { attr[ATTR_RED], attr[ATTR_GREEN], attr[ATTR_BLUE], attr[ATTR_ALPHA] };
+			if (texture)
+			{
+				float texel[4];
+				sample(*texture, attr[ATTR_U], attr[ATTR_V], state.filter, state.repeat, texel);
+				for (int k = 0; k < 4; k++)
+					rgba[k] *= texel[k];
+			}
+
+			unsigned char *dst = &color[pixel * 4];
+			if (state.blend == BLEND_ALPHA)
+			{
+				float a = rgba[3] < 0.0f ? 0.0f : (rgba[3] > 1.0f ? 1.0f : rgba[3]);
+				for (int k = 0; k < 4; k++)
+					rgba[k] = rgba[k] * a + dst[k] * (1.0f / 255.0f) * (1.0f - a);
+			}
+			else if (state.blend == BLEND_ADD)
+			{
+				for (int k = 0; k < 4; k++)
+					rgba[k] += dst[k] * (1.0f / 255.0f);
+			}
+			for (int k = 0; k < 4; k++)
+				dst[k] = toByte(rgba[k]);
+		}
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// SoftRenderer
+///////////////////////////////////////////////////////////////////////////////
+SoftRenderer::SoftRenderer(int width, int height, int threads)
+	: impl(new Impl(width, height, threads))
+{
+}
+
+SoftRenderer::~SoftRenderer()
+{
+	delete impl;
+}
+
+int SoftRenderer::getWidth() const
+{
+	return impl->width;
+}
+
+int SoftRenderer::getHeight() const
+{
+	return impl->height;
+}
+
+int SoftRenderer::getThreadCount() const
+{
+	return (int)impl->workers.size() + 1;
+}
+
+int SoftRenderer::createTexture(int width, int height, const unsigned char *rgba)
+{
+	Texture t;
+	t.width = width;
+	t.height = height;
+	t.texels.assign(rgba, rgba + (size_t)width * height * 4);
+	for (size_t i = 0; i < impl->textures.size(); i++)
+	{
+		if (impl->textures[i].texels.empty())
+		{
+			impl->flush();                      // pending draws may still refer to the old id
+			impl->textures[i] = t;
+			return (int)i + 1;
+		}
+	}
+	impl->textures.push_back(t);
+	return (int)impl->textures.size();
+}
+
+void SoftRenderer::deleteTexture(int texture)
+{
+	impl->flush();
+	if (texture > 0 && texture <= (int)impl->textures.size())
+		std::vector<unsigned char>().swap(impl->textures[texture - 1].texels);
+}
+
+void SoftRenderer::clear(unsigned int flags, const RenderColor &color, float depth, unsigned char stencil)
+{
+	impl->flush();
+	const size_t pixels = (size_t)impl->width * impl->height;
+	if (flags & CLEAR_COLOR)
+	{
+		const unsigned char rgba[4] = { color.red, color.green, color.blue, color.alpha };
+		for (size_t i = 0; i < pixels; i++)
+			memcpy(&impl->color[i * 4], rgba, 4);
+	}
+	if (flags & CLEAR_DEPTH)
+		impl->depth.assign(pixels, depth);
+	if (flags & CLEAR_STENCIL)
+		impl->stencil.assign(pixels, stencil);
+}
+
+void SoftRenderer::draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state)
+{
+	if (count == 0)
+		return;
+	if (impl->setups.size() > flushPrimitives)
+		impl->flush();
+	impl->states.push_back(state);
+
+	// object space to clip space
+	const float *m = state.transform.get();
+	std::vector<ClipVertex> clip(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const RenderVertex &v = vertices[i];
+		ClipVertex &c = clip[i];
+		c.x = m[0] * v.x + m[4] * v.y + m[8] * v.z + m[12];
+		c.y = m[1] * v.x + m[5] * v.y + m[9] * v.z + m[13];
+		c.z = m[2] * v.x + m[6] * v.y + m[10] * v.z + m[14];
+		c.w = m[3] * v.x + m[7] * v.y + m[11] * v.z + m[15];
+		c.attr[ATTR_U] = v.u;
+		c.attr[ATTR_V] = v.v;
+		c.attr[ATTR_RED] = v.red * (1.0f / 255.0f);
+		c.attr[ATTR_GREEN] = v.green * (1.0f / 255.0f);
+		c.attr[ATTR_BLUE] = v.blue * (1.0f / 255.0f);
+		c.attr[ATTR_ALPHA] = v.alpha * (1.0f / 255.0f);
+	}
+
+	if (type == PRIMITIVE_TRIANGLES)
+	{
+		for (size_t i = 0; i + 2 < count; i += 3)
+		{
+			ClipVertex poly[9] = { clip[i], clip[i + 1], clip[i + 2] };
+			int n = clipPolygon(poly, 3);
+			if (n < 3)
+				continue;
+			WindowVertex window[9];
+			for (int k = 0; k < n; k++)
+				window[k] = impl->toWindow(poly[k]);
+			for (int k = 1; k + 1 < n; k++)
+				impl->addTriangle(window[0], window[k], window[k + 1], true);
+		}
+	}
+	else if (type == PRIMITIVE_LINES)
+	{
+		const float half = state.lineWidth * 0.5f;
+		for (size_t i = 0; i + 1 < count; i += 2)
+		{
+			ClipVertex p = clip[i], q = clip[i + 1];
+			if (!clipSegment(p, q))
+				continue;
+			WindowVertex a = impl->toWindow(p), b = impl->toWindow(q);
+			float dx = b.x - a.x, dy = b.y - a.y;
+			float length = sqrtf(dx * dx + dy * dy);
+			if (length == 0.0f)
+				continue;
+			float nx = -dy / length * half, ny = dx / length * half;
+			WindowVertex corner[4] = { a, b, b, a };
+			corner[0].x -= nx; corner[0].y -= ny;
+			corner[1].x -= nx; corner[1].y -= ny;
+			corner[2].x += nx; corner[2].y += ny;
+			corner[3].x += nx; corner[3].y += ny;
+			impl->addQuad(corner);
+		}
+	}
+	else
+	{
+		const float half = state.pointSize * 0.5f;
+		for (size_t i = 0; i < count; i++)
+		{
+			bool inside = true;
+			for (int plane = 0; plane < 6 && inside; plane++)
+				inside = clipDistance(clip[i], plane) >= 0;
+			if (!inside)
+				continue;
+			WindowVertex p = impl->toWindow(clip[i]);
+			WindowVertex corner[4] = { p, p, p, p };
+			corner[0].x -= half; corner[0].y -= half;
+			corner[1].x += half; corner[1].y -= half;
+			corner[2].x += half; corner[2].y += half;
+			corner[3].x -= half; corner[3].y += half;
+			impl->addQuad(corner);
+		}
+	}
+}
+
+void SoftRenderer::finish()
+{
+	impl->flush();
+}
+
+const unsigned char *SoftRenderer::getColor()
+{
+	impl->flush();
+	return &impl->color[0];
+}
+
+const float *SoftRenderer::getDepth()
+{
+	impl->flush();
+	return &impl->depth[0];
+}
+
+const unsigned char *SoftRenderer::getStencil()
+{
+	impl->flush();
+	return &impl->stencil[0];
+}
+
+bool SoftRenderer::saveImage(const char *fileName)
+{
+	return writeImage(fileName, getColor(), impl->width, impl->height, true);
+}
+
+unsigned int SoftRenderer::checksum()
+{
+	const unsigned char *p = getColor();
+	unsigned int h = 2166136261u;
+	for (size_t i = 0; i < impl->color.size(); i++)
+		h = (h ^ p[i]) * 16777619u;
+	return h;
+}
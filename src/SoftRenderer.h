@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+// SoftRenderer.h
+// ==============
+// CPU backend of the Renderer interface: renders into an in-memory RGBA8
+// framebuffer with a float depth and an 8 bit stencil buffer, for headless
+// runs, servers without a GPU and regression images.
+//
+// draw() transforms and clips the vertices (near/far planes, and a guard
+// band around the sides), turns lines and points into screen-space quads,
+// sets up each triangle once and bins it into the 64x64 pixel tiles it
+// covers. The tiles are rasterized by a pool of threads, each tile by one
+// thread in submission order, so the image is the same for any thread
+// count. Coverage uses 8 bit sub-pixel fixed point and a top-left rule
+// (shared edges are drawn once), attributes are perspective-correct, and
+// textures are sampled nearest or bilinear with repeat or clamp.
+//
+// Work is deferred until finish(), clear() or a read of the framebuffer.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_RENDERER_H
+#define SOFT_RENDERER_H
+
+#include "Renderer.h"
+
+class SoftRenderer : public Renderer
+{
+public:
+	// threads = 0: one per hardware thread
+	SoftRenderer(int width, int height, int threads = 0);
+	~SoftRenderer();
+
+	int getWidth() const;
+	int getHeight() const;
+	int getThreadCount() const;
+
+	int createTexture(int width, int height, const unsigned char *rgba);
+	void deleteTexture(int texture);
+
+	void clear(unsigned int flags, const RenderColor &color, float depth = 1.0f, unsigned char stencil = 0);
+	void draw(PrimitiveType type, const RenderVertex *vertices, size_t count, const RenderState &state);
+	void finish();
+
+	// the buffers, bottom row first; these finish() first
+	const unsigned char *getColor();
+	const float *getDepth();
+	const unsigned char *getStencil();
+	bool saveImage(const char *fileName);       // PNG for *.png, else PPM
+	unsigned int checksum();                    // FNV-1a of the color buffer
+
+private:
+	SoftRenderer(const SoftRenderer &);
+	SoftRenderer &operator=(const SoftRenderer &);
+
+	struct Impl;    // the tile bins and threads live in the .cpp
+	Impl *impl;
+};
+
+#endif
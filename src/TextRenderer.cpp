@@ -0,0 +1,267 @@
+///////////////////////////////////////////////////////////////////////////////
+// TextRenderer.cpp
+// ================
+// Glyph atlas text drawing. See TextRenderer.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "TextRenderer.h"
+#include "Renderer.h"
+#include "Camera.h"
+#include "bitmapfont/ysglfontdata.h"
+
+namespace
+{
+	// GL 1.1 textures need power of two sizes
+	int powerOfTwo(int n)
+	{
+		int p = 1;
+		while (p < n)
+			p *= 2;
+		return p;
+	}
+}
+
+TextRenderer::TextRenderer(unsigned char *const font[], int glyphWidth, int glyphHeight)
+	: font(font), glyphWidth(glyphWidth), glyphHeight(glyphHeight),
+	atlasWidth(powerOfTwo(16 * glyphWidth)), atlasHeight(powerOfTwo(16 * glyphHeight)),
+	lastQuads(0), initialized(false), texture(0), target(NULL), targetTexture(0)
+{
+	makeAtlas();
+}
+
+// glyph c goes to cell (c % 16, c / 16), cell row 0 at the bottom; the font
+// rows are bottom first and padded to 32 bits, the leftmost pixel in the
+// high bit, like glBitmap takes them
+void TextRenderer::makeAtlas()
+{
+	const int bytesPerRow = ((glyphWidth + 31) / 32) * 4;
+	atlas.assign((size_t)atlasWidth * atlasHeight, 0);
+	for (int c = 0; c < 256; c++)
+	{
+		const unsigned char *glyph = font[c];
+		unsigned char *cell = &atlas[(size_t)(c / 16) * glyphHeight * atlasWidth + (c % 16) * glyphWidth];
+		blank[c] = true;
+		for (int y = 0; y < glyphHeight; y++)
+		{
+			const unsigned char *row = glyph + y * bytesPerRow;
+			for (int x = 0; x < glyphWidth; x++)
+			{
+				if (row[x >> 3] & (0x80 >> (x & 7)))
+				{
+					cell[(size_t)y * atlasWidth + x] = 255;
+					blank[c] = false;
+				}
+			}
+		}
+	}
+}
+
+void TextRenderer::init()
+{
+	if (initialized)
+		release();
+	initialized = true;
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, atlasWidth, atlasHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &atlas[0]);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TextRenderer::release()
+{
+	if (!initialized)
+		return;
+	glDeleteTextures(1, &texture);
+	texture = 0;
+	initialized = false;
+}
+
+void TextRenderer::clear()
+{
+	labels.clear();
+	texts.clear();
+}
+
+void TextRenderer::add(int x, int y, const char *str,
+	unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha)
+{
+	Label label = { x, y, texts.size(), red, green, blue, alpha };
+	labels.push_back(label);
+	texts.insert(texts.end(), str, str + strlen(str) + 1);
+}
+
+void TextRenderer::makeQuads()
+{
+	quads.clear();
+	const float du = (float)glyphWidth / atlasWidth, dv = (float)glyphHeight / atlasHeight;
+	for (auto &label : labels)
+	{
+		// the bottom row of the glyphs is pixel row y, so their bottom edge is y + 1
+		const float bottom = (float)(label.y + 1), top = bottom - glyphHeight;
+		float left = (float)label.x;
+		for (const char *s = &texts[label.text]; *s != 0; s++, left += glyphWidth)
+		{
+			const unsigned char c = (unsigned char)*s;
+			if (blank[c])
+				continue;
+			const float u = (c % 16) * du, v = (c / 16) * dv, right = left + glyphWidth;
+			const unsigned char r = label.red, g = label.green, b = label.blue, a = label.alpha;
+			const GlyphVertex corner[4] = {
+				{ left, bottom, u, v, r, g, b, a }, { right, bottom, u + du, v, r, g, b, a },
+				{ right, top, u + du, v + dv, r, g, b, a }, { left, top, u, v + dv, r, g, b, a } };
+			quads.insert(quads.end(), corner, corner + 4);
+		}
+	}
+	lastQuads = quads.size() / 4;
+}
+
+void TextRenderer::draw()
+{
+	if (!initialized)
+		init();
+	makeQuads();
+	if (quads.empty())
+		return;
+
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT | GL_TRANSFORM_BIT);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glOrtho(0, viewport[2], viewport[3], 0, -1, 1);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+
+	glDisable(GL_LIGHTING);
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_ALPHA_TEST);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(2, GL_FLOAT, sizeof(GlyphVertex), &quads[0].x);
+	glTexCoordPointer(2, GL_FLOAT, sizeof(GlyphVertex), &quads[0].u);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(GlyphVertex), &quads[0].red);
+	glDrawArrays(GL_QUADS, 0, (GLsizei)quads.size());
+
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glPopClientAttrib();
+	glPopAttrib();
+}
+
+void TextRenderer::draw(Renderer &device)
+{
+	makeQuads();
+	if (quads.empty())
+		return;
+	if (target != &device || targetTexture == 0)
+	{
+		std::vector<unsigned char> rgba(atlas.size() * 4, 255);
+		for (size_t i = 0; i < atlas.size(); i++)
+			rgba[4 * i + 3] = atlas[i];
+		target = &device;
+		targetTexture = device.createTexture(atlasWidth, atlasHeight, &rgba[0]);
+	}
+
+	// each quad as two triangles
+	std::vector<RenderVertex> vertices;
+	vertices.reserve(quads.size() / 4 * 6);
+	static const int corners[6] = { 0, 1, 2, 0, 2, 3 };
+	for (size_t q = 0; q < quads.size(); q += 4)
+	{
+		for (int k = 0; k < 6; k++)
+		{
+			const GlyphVertex &g = quads[q + corners[k]];
+			RenderVertex v = { g.x, g.y, 0.0f, g.u, g.v, g.red, g.green, g.blue, g.alpha };
+			vertices.push_back(v);
+		}
+	}
+	RenderState state;
+	state.transform = orthoMatrix(0.0f, (float)device.getWidth(), (float)device.getHeight(), 0.0f, -1.0f, 1.0f);
+	state.blend = BLEND_ALPHA;
+	state.texture = targetTexture;
+	state.repeat = false;
+	device.draw(PRIMITIVE_TRIANGLES, &vertices[0], vertices.size(), state);
+}
+
+void TextRenderer::blit(unsigned char *rgba, int width, int height, int threads) const
+{
+	if (labels.empty() || width <= 0 || height <= 0)
+		return;
+
+	// the labels of each band of rows, in the order they were added; a glyph
+	// is at most 32 rows high, so a label is in one or two bands
+	const int bandRows = 32;
+	const int bands = (height + bandRows - 1) / bandRows;
+	std::vector<std::vector<size_t> > bandLabels(bands);
+	for (size_t i = 0; i < labels.size(); i++)
+	{
+		const int bottom = height - 1 - labels[i].y, top = bottom + glyphHeight;
+		const int first = bottom > 0 ? bottom / bandRows : 0;
+		const int last = top < height ? (top - 1) / bandRows : bands - 1;
+		for (int b = first; b <= last && top > 0; b++)
+			bandLabels[b].push_back(i);
+	}
+
+	std::atomic<int> nextBand(0);
+	auto worker = [&]()
+	{
+		for (;;)
+		{
+			const int b = nextBand.fetch_add(1);
+			if (b >= bands)
+				return;
+			for (size_t i : bandLabels[b])
+			{
+				const Label &label = labels[i];
+				YsGlBlendStringToRGBA8BitmapClip(&texts[label.text], label.red, label.green, label.blue, label.alpha,
+					rgba, width, height, label.x, height - 1 - label.y,
+					0, b * bandRows, width, (b + 1) * bandRows, font, glyphWidth, glyphHeight);
+			}
+		}
+	};
+
+	if (threads <= 0)
+		threads = (int)std::thread::hardware_concurrency();
+	threads = threads < bands ? threads : bands;
+	std::vector<std::thread> pool;
+	for (int i = 1; i < threads; i++)
+		pool.push_back(std::thread(worker));
+	worker();
+	for (auto &thread : pool)
+		thread.join();
+}
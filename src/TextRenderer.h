@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+// TextRenderer.h
+// ==============
+// Draws all the text of a frame (menus, HUD) in one draw call.
+//
+// The glyphs of a YsFont (e.g. YsFont8x12 from bitmapfont/ysglfontdata.h)
+// are packed once into a single alpha texture, a 16 x 16 grid of cells. A
+// demo adds its strings every frame and calls draw() once: every glyph
+// becomes a textured quad in one client-side vertex array, drawn with one
+// glDrawArrays, instead of a glRasterPos and a glCallLists (one glBitmap
+// per character) for each string. Blank glyphs such as spaces are skipped.
+//
+// Positions are window pixels counted from the top-left corner, and name the
+// bottom-left pixel of the first glyph, which is where glRasterPos2i(x, y)
+// puts it under the demos' menu projection
+// glOrtho(-0.5, w - 0.5, h - 0.5, -0.5, -1, 1). draw() sets up that pixel
+// mapping itself and restores the GL state it changes, so it does not
+// depend on the current matrices, and the glyphs are pixel-exact copies of
+// what glBitmap draws.
+//
+// init() needs a current GL context; draw() calls it if it has not been.
+// draw(Renderer &) draws the same quads as triangles through a Renderer
+// backend, and blit() writes the strings into an RGBA8 image on the CPU,
+// blended over it (YsGlBlendStringToRGBA8BitmapClip, 4 pixels per SSE2
+// store), for headless frames; many labels on a large image go faster on
+// several threads.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXT_RENDERER_H
+#define TEXT_RENDERER_H
+
+#include <stddef.h>
+#include <vector>
+
+class Renderer;
+
+class TextRenderer
+{
+public:
+	// font is one of the YsFont tables, which must outlive the renderer
+	TextRenderer(unsigned char *const font[], int glyphWidth, int glyphHeight);
+
+	void init();
+	void release();                 // deletes the texture, while the context is still current
+	int getGlyphWidth() const { return glyphWidth; }
+	int getGlyphHeight() const { return glyphHeight; }
+
+	void clear();
+	size_t size() const { return labels.size(); }
+	void add(int x, int y, const char *str,
+		unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255);
+
+	// draws every string added since the last clear(), in one draw call
+	void draw();
+	void draw(Renderer &target);    // in target's pixels; no GL needed, no init()
+
+	// blends the strings into rgba (width x height, bottom row first like
+	// glReadPixels), clipped to it, in the order they were added. threads
+	// split the image into bands of rows (0: one per hardware thread); the
+	// image is the same for any count
+	void blit(unsigned char *rgba, int width, int height, int threads = 1) const;
+
+	// the glyph quads the last draw emitted
+	size_t getLastQuads() const { return lastQuads; }
+
+private:
+	struct Label
+	{
+		int x, y;
+		size_t text;                // offset of the string in texts
+		unsigned char red, green, blue, alpha;
+	};
+
+	struct GlyphVertex
+	{
+		float x, y;
+		float u, v;
+		unsigned char red, green, blue, alpha;
+	};
+
+	void makeAtlas();
+	void makeQuads();
+
+	unsigned char *const *font;
+	int glyphWidth, glyphHeight;
+	int atlasWidth, atlasHeight;
+	std::vector<unsigned char> atlas;   // alpha, bottom row first
+	bool blank[256];
+
+	std::vector<Label> labels;
+	std::vector<char> texts;            // the strings, each with its terminator
+	std::vector<GlyphVertex> quads;     // 4 per visible glyph
+	size_t lastQuads;
+
+	bool initialized;
+	unsigned int texture;
+	Renderer *target;                   // the Renderer targetTexture was created on
+	int targetTexture;
+
+	TextRenderer(const TextRenderer &);
+	TextRenderer &operator=(const TextRenderer &);
+};
+
+#endif
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+// TraceHistory.cpp
+// ================
+// Chunked trace store with Douglas-Peucker level of detail. See
+// TraceHistory.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <utility>
+#include "TraceHistory.h"
+#include "SimSnapshot.h"
+
+namespace
+{
+	const int maxLevel = 64;
+
+	// squared distance from p to the segment a-b
+	float segmentDistanceSq(const TraceVertex &p, const TraceVertex &a, const TraceVertex &b)
+	{
+		float abx = b.x - a.x, aby = b.y - a.y, abz = b.z - a.z;
+		float apx = p.x - a.x, apy = p.y - a.y, apz = p.z - a.z;
+		float length = abx * abx + aby * aby + abz * abz;
+		float t = length > 0.0f ? (apx * abx + apy * aby + apz * abz) / length : 0.0f;
+		t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+		float dx = apx - t * abx, dy = apy - t * aby, dz = apz - t * abz;
+		return dx * dx + dy * dy + dz * dz;
+	}
+}
+
+TraceHistory::TraceHistory(size_t chunkSize, int fullChunks, float tolerance, size_t budget)
+	: chunkSize(chunkSize < 2 ? 2 : chunkSize), fullChunks(fullChunks < 0 ? 0 : fullChunks),
+	tolerance(tolerance), budget(budget), total(0), kept(0), revision(0)
+{
+}
+
+void TraceHistory::clear()
+{
+	chunks.clear();
+	total = kept = 0;
+	revision++;
+}
+
+void TraceHistory::append(const TraceVertex &point)
+{
+	if (chunks.empty() || chunks.back().points.size() >= chunkSize)
+		seal();
+	chunks.back().points.push_back(point);
+	total++;
+	kept++;
+}
+
+size_t TraceHistory::getMemory() const
+{
+	size_t bytes = 0;
+	for (auto &c : chunks)
+		bytes += c.points.capacity() * sizeof(TraceVertex);
+	return bytes;
+}
+
+float TraceHistory::getTolerance(int level) const
+{
+	return ldexpf(tolerance, level - 1);
+}
+
+void TraceHistory::simplify(Chunk &chunk, int level)
+{
+	chunk.level = level;
+	std::vector<TraceVertex> &points = chunk.points;
+	const size_t n = points.size();
+	if (n <= 2)
+		return;
+
+	// Douglas-Peucker with an explicit stack of the spans still to check
+	const float toleranceSq = getTolerance(level) * getTolerance(level);
+	keep.assign(n, 0);
+	keep[0] = keep[n - 1] = 1;
+	std::vector<std::pair<size_t, size_t> > spans(1, std::make_pair((size_t)0, n - 1));
+	while (!spans.empty())
+	{
+		size_t a = spans.back().first, b = spans.back().second;
+		spans.pop_back();
+		size_t farthest = a;
+		float farthestSq = toleranceSq;
+		for (size_t i = a + 1; i < b; i++)
+		{
+			float d = segmentDistanceSq(points[i], points[a], points[b]);
+			if (d > farthestSq)
+			{
+				farthestSq = d;
+				farthest = i;
+			}
+		}
+		if (farthest == a)
+			continue;
+		keep[farthest] = 1;
+		spans.push_back(std::make_pair(a, farthest));
+		spans.push_back(std::make_pair(farthest, b));
+	}
+
+	std::vector<TraceVertex> simplified;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (keep[i])
+			simplified.push_back(points[i]);
+	}
+	kept -= n - simplified.size();
+	points.swap(simplified);        // also gives back the memory of the dropped points
+}
+
+void TraceHistory::seal()
+{
+	Chunk open;
+	open.level = 0;
+	chunks.push_back(open);
+	chunks.back().points.reserve(chunkSize);
+
+	// the sealed chunks at full resolution, the new open one left out
+	size_t firstFull = chunks.size() - 1;
+	while (firstFull > 0 && chunks[firstFull - 1].level == 0)
+		firstFull--;
+	if ((int)(chunks.size() - 1 - firstFull) <= fullChunks)
+		return;
+
+	simplify(chunks[firstFull], 1);
+	revision++;
+
+	mergeLevels();
+
+	// as long as the kept points are over budget, coarsen the oldest chunks
+	bool coarsened = false;
+	for (size_t i = 0; kept > budget && i < chunks.size() && chunks[i].level > 0; )
+	{
+		size_t before = chunks[i].points.size();
+		if (chunks[i].level < maxLevel)
+			simplify(chunks[i], chunks[i].level + 1);
+		coarsened = true;
+		if (chunks[i].points.size() == before)
+			i++;
+	}
+	if (coarsened)
+		mergeLevels();
+}
+
+// merges neighbours of the same level into one chunk of the next level
+void TraceHistory::mergeLevels()
+{
+	for (size_t i = 1; i < chunks.size(); )
+	{
+		Chunk &older = chunks[i - 1], &newer = chunks[i];
+		if (newer.level == 0 || older.level != newer.level || older.level >= maxLevel)
+		{
+			i++;
+			continue;
+		}
+		older.points.insert(older.points.end(), newer.points.begin(), newer.points.end());
+		chunks.erase(chunks.begin() + i);
+		simplify(chunks[i - 1], chunks[i - 1].level + 1);
+		if (i > 1)
+			i--;        // the merged chunk may now match the one before it
+	}
+}
+
+void TraceHistory::getCoarse(std::vector<TraceVertex> &points) const
+{
+	points.clear();
+	for (auto &c : chunks)
+	{
+		if (c.level == 0)
+		{
+			if (!points.empty() && !c.points.empty())
+				points.push_back(c.points.front());
+			break;
+		}
+		points.insert(points.end(), c.points.begin(), c.points.end());
+	}
+}
+
+void TraceHistory::getFine(std::vector<TraceVertex> &points) const
+{
+	points.clear();
+	for (auto &c : chunks)
+	{
+		if (c.level == 0)
+			points.insert(points.end(), c.points.begin(), c.points.end());
+	}
+}
+
+void TraceHistory::capture(SnapshotState &state) const
+{
+	// layout: total, then the point count and level of every chunk
+	std::vector<unsigned int> layout(1, (unsigned int)total);
+	std::vector<TraceVertex> points;
+	points.reserve(kept);
+	for (auto &c : chunks)
+	{
+		layout.push_back((unsigned int)c.points.size());
+		layout.push_back((unsigned int)c.level);
+		points.insert(points.end(), c.points.begin(), c.points.end());
+	}
+	state.addArray(SNAPSHOT_TAG('T', 'R', 'C', 'K'), &layout[0], layout.size());
+	state.addArray(SNAPSHOT_TAG('T', 'R', 'A', 'C'), points.empty() ? NULL : &points[0], points.size());
+}
+
+bool TraceHistory::restore(const SnapshotState &state)
+{
+	std::vector<unsigned int> layout;
+	std::vector<TraceVertex> points;
+	if (!state.getArray(SNAPSHOT_TAG('T', 'R', 'C', 'K'), layout) || layout.size() % 2 != 1 ||
+		!state.getArray(SNAPSHOT_TAG('T', 'R', 'A', 'C'), points))
+		return false;
+	size_t sum = 0;
+	for (size_t i = 1; i < layout.size(); i += 2)
+	{
+		if (layout[i] == 0 || (int)layout[i + 1] > maxLevel)
+			return false;
+		sum += layout[i];
+	}
+	if (sum != points.size() || sum > layout[0])
+		return false;
+
+	chunks.resize((layout.size() - 1) / 2);
+	size_t first = 0;
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		size_t count = layout[1 + 2 * i];
+		chunks[i].points.assign(points.begin() + first, points.begin() + first + count);
+		chunks[i].level = (int)layout[2 + 2 * i];
+		first += count;
+	}
+	total = layout[0];
+	kept = sum;
+	revision++;
+	return true;
+}
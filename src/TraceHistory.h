@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// TraceHistory.h
+// ==============
+// An unbounded trace (every point an object has passed through) kept in a
+// bounded amount of memory by simplifying its older parts.
+//
+// Points go into chunks of chunkSize points. The newest fullChunks sealed
+// chunks and the open one stay at full resolution. When one more chunk is
+// sealed, the oldest full one is simplified with Douglas-Peucker to level 1
+// (no kept segment is farther than tolerance from the points it replaces).
+// Two neighbouring chunks of the same level are merged and simplified at
+// the next level, whose tolerance is twice as large, like the carries of a
+// binary counter. So the chunk levels fall from the oldest chunk to the
+// newest, the number of chunks grows with the log of the run's length,
+// and each level has at most one chunk.
+//
+// If the kept points still exceed the budget, the oldest coarse chunks are
+// simplified again one level coarser. Simplifying twice at least doubles
+// the tolerance, so the error of a chunk stays below twice its level's
+// tolerance. The full-resolution chunks are never touched, so the budget
+// should be well above (fullChunks + 1) * chunkSize.
+//
+// The points of consecutive chunks join into one polyline: simplification
+// keeps the first and last point of every chunk.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_HISTORY_H
+#define TRACE_HISTORY_H
+
+#include <stddef.h>
+#include <vector>
+#include "TraceStream.h"
+
+class SnapshotState;
+
+class TraceHistory
+{
+public:
+	TraceHistory(size_t chunkSize = 1024, int fullChunks = 4, float tolerance = 0.01f, size_t budget = 16384);
+
+	void clear();
+	void append(const TraceVertex &point);
+
+	bool empty() const { return total == 0; }
+	const TraceVertex &back() const { return chunks.back().points.back(); }    // not when empty
+	size_t getTotal() const { return total; }           // points appended since clear()
+	size_t size() const { return kept; }                // points kept
+	size_t getMemory() const;                           // bytes held by the points
+	size_t getChunkCount() const { return chunks.size(); }
+	int getLevel(size_t chunk) const { return chunks[chunk].level; }
+	const std::vector<TraceVertex> &getPoints(size_t chunk) const { return chunks[chunk].points; }
+
+	// the most points that are ever at full resolution
+	size_t getFullSpan() const { return (fullChunks + 1) * chunkSize; }
+
+	// the simplified chunks as one polyline, oldest first, ending at the first
+	// full-resolution point so it joins the rest; it only changes when
+	// getRevision() does
+	void getCoarse(std::vector<TraceVertex> &points) const;
+	// the full-resolution points, oldest first
+	void getFine(std::vector<TraceVertex> &points) const;
+	unsigned int getRevision() const { return revision; }
+
+	// the chunks as snapshot chunks 'TRAC' (the points) and 'TRCK' (the layout)
+	void capture(SnapshotState &state) const;
+	bool restore(const SnapshotState &state);
+
+private:
+	struct Chunk
+	{
+		std::vector<TraceVertex> points;
+		int level;                  // 0: full resolution
+	};
+
+	void seal();
+	void mergeLevels();
+	void simplify(Chunk &chunk, int level);
+	float getTolerance(int level) const;
+
+	size_t chunkSize;
+	int fullChunks;
+	float tolerance;
+	size_t budget;
+
+	std::vector<Chunk> chunks;      // oldest first; the last one is open
+	size_t total, kept;
+	unsigned int revision;
+	std::vector<unsigned char> keep;    // scratch for simplify()
+};
+
+#endif
@@ -0,0 +1,298 @@
+///////////////////////////////////////////////////////////////////////////////
+// TraceStream.cpp
+// ===============
+// Ring-buffered trace point streaming. See TraceStream.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifndef MACOSX
+#include <GL/gl.h>
+#ifndef WIN32
+#include <GL/glx.h>
+#endif
+#else
+#include <OpenGL/gl.h>
+#endif
+
+#include "TraceStream.h"
+#include "GLLoader.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// the GL 1.5 and 4.4 names the buffer paths need; gl.h stops at 1.1
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_DYNAMIC_DRAW
+#define GL_DYNAMIC_DRAW 0x88E8
+#endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT 0x0002
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_TIMEOUT_EXPIRED 0x911B
+#endif
+
+namespace
+{
+	typedef void *SyncObject;       // GLsync, which old headers do not have
+	typedef void (APIENTRY *GenBuffersProc)(GLsizei n, GLuint *buffers);
+	typedef void (APIENTRY *DeleteBuffersProc)(GLsizei n, const GLuint *buffers);
+	typedef void (APIENTRY *BindBufferProc)(GLenum target, GLuint buffer);
+	typedef void (APIENTRY *BufferDataProc)(GLenum target, ptrdiff_t size, const void *data, GLenum usage);
+	typedef void (APIENTRY *BufferSubDataProc)(GLenum target, ptrdiff_t offset, ptrdiff_t size, const void *data);
+	typedef void (APIENTRY *BufferStorageProc)(GLenum target, ptrdiff_t size, const void *data, GLbitfield flags);
+	typedef void *(APIENTRY *MapBufferRangeProc)(GLenum target, ptrdiff_t offset, ptrdiff_t length, GLbitfield access);
+	typedef GLboolean (APIENTRY *UnmapBufferProc)(GLenum target);
+	typedef SyncObject (APIENTRY *FenceSyncProc)(GLenum condition, GLbitfield flags);
+	typedef GLenum (APIENTRY *ClientWaitSyncProc)(SyncObject sync, GLbitfield flags, unsigned long long timeout);
+	typedef void (APIENTRY *DeleteSyncProc)(SyncObject sync);
+	typedef void (APIENTRY *MultiDrawArraysProc)(GLenum mode, const GLint *first, const GLsizei *count, GLsizei draws);
+
+	struct BufferFunctions
+	{
+		GenBuffersProc genBuffers;
+		DeleteBuffersProc deleteBuffers;
+		BindBufferProc bindBuffer;
+		BufferDataProc bufferData;
+		BufferSubDataProc bufferSubData;
+		BufferStorageProc bufferStorage;
+		MapBufferRangeProc mapBufferRange;
+		UnmapBufferProc unmapBuffer;
+		FenceSyncProc fenceSync;
+		ClientWaitSyncProc clientWaitSync;
+		DeleteSyncProc deleteSync;
+		MultiDrawArraysProc multiDrawArrays;
+	};
+	BufferFunctions gl;
+
+	// GL 1.4 or EXT_multi_draw_arrays; NULL draws a wrapped ring in two calls
+	void loadMultiDraw()
+	{
+		const char *suffix = hasGLVersion(1, 4) ? "" : (hasGLExtension("GL_EXT_multi_draw_arrays") ? "EXT" : NULL);
+		if (suffix == NULL || !loadGLFunction(gl.multiDrawArrays, "glMultiDrawArrays", suffix))
+			gl.multiDrawArrays = NULL;
+	}
+
+	// GL 1.5 or ARB_vertex_buffer_object
+	bool loadBufferFunctions()
+	{
+		const char *suffix = hasGLVersion(1, 5) ? "" : (hasGLExtension("GL_ARB_vertex_buffer_object") ? "ARB" : NULL);
+		return suffix != NULL && loadGLFunction(gl.genBuffers, "glGenBuffers", suffix) &&
+			loadGLFunction(gl.deleteBuffers, "glDeleteBuffers", suffix) &&
+			loadGLFunction(gl.bindBuffer, "glBindBuffer", suffix) &&
+			loadGLFunction(gl.bufferData, "glBufferData", suffix) &&
+			loadGLFunction(gl.bufferSubData, "glBufferSubData", suffix);
+	}
+
+	// glBufferStorage is GL 4.4 or ARB_buffer_storage, taken here only with
+	// GL 3.2 for glMapBufferRange and the fences; none of them has a suffix
+	bool loadPersistentFunctions()
+	{
+		if (!hasGLVersion(4, 4) && !(hasGLVersion(3, 2) && hasGLExtension("GL_ARB_buffer_storage")))
+			return false;
+		return loadGLFunction(gl.bufferStorage, "glBufferStorage") &&
+			loadGLFunction(gl.mapBufferRange, "glMapBufferRange") && loadGLFunction(gl.unmapBuffer, "glUnmapBuffer") &&
+			loadGLFunction(gl.fenceSync, "glFenceSync") && loadGLFunction(gl.clientWaitSync, "glClientWaitSync") &&
+			loadGLFunction(gl.deleteSync, "glDeleteSync");
+	}
+}
+
+TraceStream::TraceStream(size_t capacity)
+	: capacity(capacity < 1 ? 1 : capacity), path(PATH_CLIENT), initialized(false),
+	head(0), filled(0), drawn(0), lastUpload(0), buffer(0), mapped(NULL), fence(NULL)
+{
+}
+
+bool TraceStream::init(Path requested)
+{
+	if (initialized)
+		release();
+	initialized = true;
+	head = filled = drawn = 0;      // the points uploaded so far are gone with the old ring
+	loadMultiDraw();
+
+	const ptrdiff_t bytes = (ptrdiff_t)(capacity * sizeof(TraceVertex));
+	const bool buffers = requested != PATH_CLIENT && loadBufferFunctions();
+	if (buffers && (requested == PATH_AUTO || requested == PATH_PERSISTENT) && loadPersistentFunctions())
+	{
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gl.genBuffers(1, &buffer);
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+		gl.bufferStorage(GL_ARRAY_BUFFER, bytes, NULL, flags);
+		mapped = (TraceVertex *)gl.mapBufferRange(GL_ARRAY_BUFFER, 0, bytes, flags);
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+		if (mapped != NULL)
+		{
+			path = PATH_PERSISTENT;
+			return true;
+		}
+		gl.deleteBuffers(1, &buffer);
+		buffer = 0;
+	}
+	if (buffers)
+	{
+		gl.genBuffers(1, &buffer);
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+		gl.bufferData(GL_ARRAY_BUFFER, bytes, NULL, GL_DYNAMIC_DRAW);
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+		path = PATH_SUBDATA;
+		return requested != PATH_PERSISTENT;
+	}
+	ring.resize(capacity);
+	path = PATH_CLIENT;
+	return requested == PATH_AUTO || requested == PATH_CLIENT;
+}
+
+void TraceStream::release()
+{
+	if (!initialized)
+		return;
+	if (fence != NULL)
+		gl.deleteSync(fence);
+	if (mapped != NULL)
+	{
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+		gl.unmapBuffer(GL_ARRAY_BUFFER);
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+	if (buffer != 0)
+		gl.deleteBuffers(1, &buffer);
+	buffer = 0;
+	mapped = NULL;
+	fence = NULL;
+	std::vector<TraceVertex>().swap(ring);
+	initialized = false;
+}
+
+void TraceStream::clear()
+{
+	pending.clear();
+	head = filled = 0;
+}
+
+size_t TraceStream::size() const
+{
+	size_t count = filled + pending.size();
+	return count < capacity ? count : capacity;
+}
+
+void TraceStream::write(size_t slot, const TraceVertex *points, size_t count)
+{
+	if (path == PATH_PERSISTENT)
+		memcpy(mapped + slot, points, count * sizeof(TraceVertex));
+	else if (path == PATH_SUBDATA)
+		gl.bufferSubData(GL_ARRAY_BUFFER, (ptrdiff_t)(slot * sizeof(TraceVertex)),
+			(ptrdiff_t)(count * sizeof(TraceVertex)), points);
+	else
+		memcpy(&ring[slot], points, count * sizeof(TraceVertex));
+}
+
+void TraceStream::upload()
+{
+	lastUpload = 0;
+	if (pending.empty())
+		return;
+
+	// of more than a ring's worth only the newest points would survive
+	const TraceVertex *points = &pending[0];
+	size_t count = pending.size();
+	if (count > capacity)
+	{
+		points += count - capacity;
+		head = (head + count - capacity) % capacity;
+		count = capacity;
+	}
+
+	// the GPU may still read the slots the last draw covered; a write that
+	// only goes past them (the ring still filling up) needs no wait
+	if (fence != NULL && (head < drawn || head + count > capacity))
+	{
+		while (gl.clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull) == GL_TIMEOUT_EXPIRED)
+			;
+		gl.deleteSync(fence);
+		fence = NULL;
+	}
+
+	if (path == PATH_SUBDATA)
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	const size_t first = capacity - head < count ? capacity - head : count;
+	write(head, points, first);
+	if (first < count)
+		write(0, points + first, count - first);
+	if (path == PATH_SUBDATA)
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	head = (head + count) % capacity;
+	filled = filled + count < capacity ? filled + count : capacity;
+	lastUpload = count;
+	pending.clear();
+}
+
+void TraceStream::draw(float pointSize)
+{
+	if (!initialized)
+		init();
+	upload();
+	if (filled == 0)
+		return;
+
+	glPushAttrib(GL_ENABLE_BIT | GL_POINT_BIT);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glDisable(GL_LIGHTING);
+	glDisable(GL_TEXTURE_2D);
+	glPointSize(pointSize);
+
+	const char *base = NULL;
+	if (path == PATH_CLIENT)
+		base = (const char *)&ring[0];
+	else
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(TraceVertex), base);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TraceVertex), base + offsetof(TraceVertex, red));
+
+	// oldest to newest like the points were made, so the newest is on top where
+	// they overlap: once the ring has wrapped that is two ranges in one call
+	if (filled < capacity || head == 0)
+		glDrawArrays(GL_POINTS, 0, (GLsizei)filled);
+	else
+	{
+		const GLint first[2] = { (GLint)head, 0 };
+		const GLsizei count[2] = { (GLsizei)(capacity - head), (GLsizei)head };
+		if (gl.multiDrawArrays != NULL)
+			gl.multiDrawArrays(GL_POINTS, first, count, 2);
+		else
+		{
+			glDrawArrays(GL_POINTS, first[0], count[0]);
+			glDrawArrays(GL_POINTS, first[1], count[1]);
+		}
+	}
+	if (path != PATH_CLIENT)
+		gl.bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glPopClientAttrib();
+	glPopAttrib();
+
+	if (path == PATH_PERSISTENT)
+	{
+		if (fence != NULL)
+			gl.deleteSync(fence);
+		fence = gl.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+	drawn = filled;
+}
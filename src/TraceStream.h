@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// TraceStream.h
+// =============
+// Streams the points of a trace (the path an object leaves behind) to the
+// GPU incrementally and draws them in one call.
+//
+// A demo appends each new trace point as it is made; draw() uploads only
+// the points appended since the last draw into a ring of capacity points
+// and draws the ring, oldest point first, with one glDrawArrays (or, once
+// it has wrapped around, one glMultiDrawArrays) of GL_POINTS. Once the
+// ring is full the newest point overwrites the oldest, so the stream shows
+// the last capacity points. Uploads cost the new points of a frame, not the
+// whole history.
+//
+// Three paths:
+//   persistent  the ring is a buffer created with glBufferStorage and
+//               mapped once, persistently and coherently (GL 4.4, or
+//               GL 3.2 with ARB_buffer_storage). New points are copied straight into
+//               the mapping; a fence after each draw keeps a write from
+//               overwriting points the GPU may still be reading.
+//   subdata     the ring is a plain vertex buffer (GL 1.5) and new points
+//               go in with glBufferSubData, at most two calls per frame.
+//   client      the fallback: the ring lives in client memory and is drawn
+//               as a GL 1.1 vertex array, so the driver copies all of it at
+//               each draw.
+//
+// init() needs a current GL context; draw() calls it if it has not been.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_STREAM_H
+#define TRACE_STREAM_H
+
+#include <stddef.h>
+#include <vector>
+
+struct TraceVertex
+{
+	float x, y, z;
+	unsigned char red, green, blue, alpha;
+};
+
+class TraceStream
+{
+public:
+	enum Path
+	{
+		PATH_AUTO,          // the first of the three the driver can do
+		PATH_PERSISTENT,
+		PATH_SUBDATA,
+		PATH_CLIENT
+	};
+
+	explicit TraceStream(size_t capacity = 16384);
+
+	// returns false when the path asked for is not available; the stream
+	// then uses the best one that is
+	bool init(Path path = PATH_AUTO);
+	void release();                 // deletes the GL objects, while the context is still current
+	Path getPath() const { return path; }
+	size_t getCapacity() const { return capacity; }
+
+	void clear();                   // drops every point
+	void append(const TraceVertex &point) { pending.push_back(point); }
+	void append(const TraceVertex *points, size_t count) { pending.insert(pending.end(), points, points + count); }
+
+	// the points draw() shows, and how many the last draw() uploaded
+	size_t size() const;
+	size_t getLastUpload() const { return lastUpload; }
+
+	// uploads what was appended since the last draw, then draws the ring
+	// through the current modelview and projection, unlit and untextured
+	void draw(float pointSize = 1.0f);
+
+private:
+	void upload();
+	void write(size_t slot, const TraceVertex *points, size_t count);
+
+	size_t capacity;
+	Path path;
+	bool initialized;
+	std::vector<TraceVertex> pending;   // appended, not uploaded yet
+	size_t head;                        // the slot the next point goes to
+	size_t filled;                      // slots holding points
+	size_t drawn;                       // slots the last draw read, for the fence
+	size_t lastUpload;
+
+	unsigned int buffer;                // persistent and subdata paths
+	TraceVertex *mapped;                // persistent path
+	void *fence;
+	std::vector<TraceVertex> ring;      // client path
+
+	TraceStream(const TraceStream &);
+	TraceStream &operator=(const TraceStream &);
+};
+
+#endif
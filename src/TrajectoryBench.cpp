@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+// TrajectoryBench.cpp
+// ===================
+// Integrator accuracy/cost benchmark. See TrajectoryBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "BenchCommon.h"
+#include "ProjectileStep.h"
+#include "TrajectoryBench.h"
+
+BenchConfig::BenchConfig()
+	: speed(15.0), angle(3.14159265358979323846 / 3.0), gravity(9.81), drag(0.0),
+	  duration(0.0), bodyCount(256), budget(0.0)
+{
+	const double steps[] = { 0.1, 0.05, 0.02, 0.01, 0.005, 0.002, 0.001, 0.0005, 0.0002, 0.0001 };
+	timeSteps.assign(steps, steps + sizeof(steps) / sizeof(steps[0]));
+}
+
+namespace
+{
+	// structure of arrays, so every integrator is one tight loop over the bodies
+	struct Bodies
+	{
+		std::vector<double> x, y, vx, vy;
+
+		void reset(const BenchConfig &config)
+		{
+			int n = config.bodyCount;
+			x.assign(n, 0.0);
+			y.assign(n, 0.0);
+			vx.resize(n);
+			vy.resize(n);
+			for (int i = 0; i < n; i++)
+			{
+				// slightly different launches so no two bodies are the same
+				double speed = config.speed * (1.0 + 0.01 * i / n);
+				vx[i] = speed * cos(config.angle);
+				vy[i] = speed * sin(config.angle);
+			}
+		}
+	};
+
+	typedef void (*StepFunction)(Bodies &b, const ProjectileModel &m, double dt);
+
+	// the ProjectileStep.h steps over every body
+	template <void (*step)(const ProjectileModel &, double, double &, double &, double &, double &)>
+	void stepAll(Bodies &b, const ProjectileModel &m, double dt)
+	{
+		const size_t n = b.x.size();
+		for (size_t i = 0; i < n; i++)
+			step(m, dt, b.x[i], b.y[i], b.vx[i], b.vy[i]);
+	}
+
+	void stepClosedForm(Bodies &b, const ProjectileModel &m, double dt)
+	{
+		const ClosedFormStep step(m, dt);
+		const size_t n = b.x.size();
+		for (size_t i = 0; i < n; i++)
+			step(b.x[i], b.y[i], b.vx[i], b.vy[i]);
+	}
+
+	// analytic state at time t of a body launched from the origin with (vx0, vy0)
+	void analytic(const ProjectileModel &m, double vx0, double vy0, double t, double &x, double &y, double &vx, double &vy)
+	{
+		const double g = -m.gy;
+		if (m.k == 0.0)
+		{
+			x = vx0 * t;
+			y = vy0 * t - 0.5 * g * t * t;
+			vx = vx0;
+			vy = vy0 - g * t;
+			return;
+		}
+		double e = exp(-m.k * t);
+		double terminal = g / m.k;
+		x = vx0 * (1.0 - e) / m.k;
+		y = (vy0 + terminal) * (1.0 - e) / m.k - terminal * t;
+		vx = vx0 * e;
+		vy = (vy0 + terminal) * e - terminal;
+	}
+
+	// time until the analytic trajectory is back at y = 0 (Newton's method)
+	double flightTime(const ProjectileModel &m, double vy0)
+	{
+		double t = 2.0 * vy0 / -m.gy;
+		for (int i = 0; i < 50 && m.k != 0.0; i++)
+		{
+			double x, y, vx, vy;
+			analytic(m, 0.0, vy0, t, x, y, vx, vy);
+			t -= y / vy;
+		}
+		return t;
+	}
+
+	struct Integrator
+	{
+		const char *name;
+		StepFunction step;
+	};
+	const Integrator integrators[] =
+	{
+		{ "euler", stepAll<eulerStep> },
+		{ "semiImplicit", stepAll<semiImplicitStep> },
+		{ "verlet", stepAll<verletStep> },
+		{ "rk4", stepAll<rk4Step> },
+		{ "closedForm", stepClosedForm },
+	};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// each (integrator, dt) gets an untimed pass that tracks the error against
+// the analytic trajectory and a timed pass without any checking
+///////////////////////////////////////////////////////////////////////////////
+void runTrajectoryBench(const BenchConfig &config, std::vector<BenchRow> &rows)
+{
+	const ProjectileModel model = { -config.gravity, config.drag };     // y is up
+	double duration = config.duration > 0.0 ? config.duration : flightTime(model, config.speed * sin(config.angle));
+	Bodies bodies, start;
+	start.reset(config);
+	const int n = config.bodyCount;
+
+	rows.clear();
+	for (auto &integrator : integrators)
+	{
+		for (double dt : config.timeSteps)
+		{
+			BenchRow row;
+			row.integrator = integrator.name;
+			row.dt = dt;
+			row.steps = (int)(duration / dt + 0.5);
+			row.maxPosError = row.finalPosError = row.finalVelError = 0.0;
+
+			bodies = start;
+			for (int s = 1; s <= row.steps; s++)
+			{
+				integrator.step(bodies, model, dt);
+				for (int i = 0; i < n; i++)
+				{
+					double x, y, vx, vy;
+					analytic(model, start.vx[i], start.vy[i], s * dt, x, y, vx, vy);
+					double dx = bodies.x[i] - x, dy = bodies.y[i] - y;
+					double posError = sqrt(dx * dx + dy * dy);
+					row.maxPosError = posError > row.maxPosError ? posError : row.maxPosError;
+					if (s == row.steps)
+					{
+						double dvx = bodies.vx[i] - vx, dvy = bodies.vy[i] - vy;
+						double velError = sqrt(dvx * dvx + dvy * dvy);
+						row.finalPosError = posError > row.finalPosError ? posError : row.finalPosError;
+						row.finalVelError = velError > row.finalVelError ? velError : row.finalVelError;
+					}
+				}
+			}
+
+			// repeat short runs so every timing covers a few million body steps
+			double bodySteps = (double)row.steps * n;
+			int repeat = bodySteps > 0.0 ? (int)(4.0e6 / bodySteps) + 1 : 1;
+			double checksum = 0.0;
+			const double ns = elapsedNs([&]
+			{
+				for (int r = 0; r < repeat; r++)
+				{
+					bodies = start;
+					for (int s = 0; s < row.steps; s++)
+						integrator.step(bodies, model, dt);
+					checksum += bodies.x[0];
+				}
+			});
+			row.nsPerStep = bodySteps > 0.0 ? ns / (bodySteps * repeat) : 0.0;
+			if (checksum != checksum)   // keeps the timed loop from being optimized away
+				printf("runTrajectoryBench: %s diverged\n", integrator.name);
+			rows.push_back(row);
+		}
+	}
+}
+
+bool writeBenchCsv(const char *fileName, const std::vector<BenchRow> &rows)
+{
+	FILE *fp = openCsv("writeBenchCsv", fileName,
+		"integrator,dt,steps,ns_per_step,ns_per_sim_second,max_pos_error,final_pos_error,final_vel_error");
+	if (fp == NULL)
+		return false;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%g,%d,%.3f,%.1f,%.6e,%.6e,%.6e\n", row.integrator, row.dt, row.steps, row.nsPerStep,
+			row.nsPerStep / row.dt, row.maxPosError, row.finalPosError, row.finalVelError);
+	return closeCsv("writeBenchCsv", fp, fileName);
+}
+
+int runBenchCommand(int argc, char *argv[], const BenchConfig &defaults)
+{
+	BenchArgs args("bench", argc, argv);
+	BenchConfig config = defaults;
+	const char *outFile = args.text("out", "integrators.csv");
+	config.drag = args.number("drag", config.drag);
+	config.bodyCount = args.integer("bodies", config.bodyCount);
+	config.duration = args.number("duration", config.duration);
+	config.budget = args.number("budget", config.budget);
+	if (const char *list = args.text("dt", NULL))
+	{
+		config.timeSteps.clear();
+		for (const char *p = list; *p != 0; )
+		{
+			char *end;
+			double dt = strtod(p, &end);
+			if (end == p)
+				break;
+			if (dt > 0.0)
+				config.timeSteps.push_back(dt);
+			p = (*end == ',') ? end + 1 : end;
+		}
+	}
+	args.reportUnknown();
+	if (config.bodyCount <= 0 || config.timeSteps.empty())
+	{
+		printf("bench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<BenchRow> rows;
+	runTrajectoryBench(config, rows);
+	for (auto &row : rows)
+		printf("%-13s dt=%-7g %8.2f ns/step  max error %.3e m\n", row.integrator, row.dt, row.nsPerStep, row.maxPosError);
+
+	if (config.budget > 0.0)
+	{
+		// cheapest per simulated second, since a larger dt needs fewer steps
+		const BenchRow *best = NULL;
+		for (auto &row : rows)
+			if (row.maxPosError <= config.budget && (best == NULL || row.nsPerStep / row.dt < best->nsPerStep / best->dt))
+				best = &row;
+		if (best != NULL)
+			printf("cheapest within %g m: %s at dt=%g (%.1f ns per body and simulated second)\n",
+				config.budget, best->integrator, best->dt, best->nsPerStep / best->dt);
+		else
+			printf("no integrator meets %g m\n", config.budget);
+	}
+	return writeBenchCsv(outFile, rows) ? 0 : 1;
+}
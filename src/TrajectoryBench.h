@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////
+// TrajectoryBench.h
+// =================
+// Accuracy and cost benchmark of the trajectory integrators.
+//
+// Every integrator advances the same set of projectiles (gravity plus
+// optional linear air resistance) over a sweep of time steps. For each
+// integrator and dt the bench reports the cost per body step and the
+// position/velocity error against the analytic trajectory, so the cheapest
+// integrator that meets an error budget can be picked.
+//
+// The integrators are the steps in ProjectileStep.h, the ones the demo runs:
+//   euler          explicit Euler, position from the old velocity (project2)
+//   semiImplicit   symplectic Euler, position from the new velocity
+//                  (simpleProjectile's updateNumPhysics)
+//   verlet         velocity Verlet
+//   rk4            classic fourth order Runge-Kutta
+//   closedForm     exact step from the current state (updatePrecisePhysics)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRAJECTORY_BENCH_H
+#define TRAJECTORY_BENCH_H
+
+#include <vector>
+
+struct BenchConfig
+{
+	double speed;               // m/s
+	double angle;               // radian above the horizon
+	double gravity;             // m/s*s, positive
+	double drag;                // linear air resistance, 1/s
+	double duration;            // s simulated per run; <= 0 uses the time of flight
+	int bodyCount;              // projectiles advanced together
+	double budget;              // position error budget in m, <= 0 for none
+	std::vector<double> timeSteps;
+
+	BenchConfig();
+};
+
+struct BenchRow
+{
+	const char *integrator;
+	double dt;
+	int steps;
+	double nsPerStep;           // per body step
+	double maxPosError;         // largest position error over the run, m
+	double finalPosError;       // m
+	double finalVelError;       // m/s
+};
+
+void runTrajectoryBench(const BenchConfig &config, std::vector<BenchRow> &rows);
+
+bool writeBenchCsv(const char *fileName, const std::vector<BenchRow> &rows);
+
+// command line front end, for simpleProjectile with its launch and for
+// benchCheck -trajbench with the BenchConfig defaults:
+//   -bench [out=file.csv] [dt=a,b,c...] [drag=k] [bodies=n] [duration=s] [budget=m]
+int runBenchCommand(int argc, char *argv[], const BenchConfig &defaults);
+
+#endif
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+// TransformBench.cpp
+// ==================
+// Typed transform microbenchmark. See TransformBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "BenchCommon.h"
+#include "SimRandom.h"
+#include "Camera.h"
+#include "Transform.h"
+#include "TransformBench.h"
+
+namespace
+{
+	struct Data
+	{
+		std::vector<Matrix4> rigid, projective, out;
+		std::vector<RigidTransform> rigidT, rigidOut;
+		std::vector<AffineTransform> affineT, affineOut;
+		std::vector<ProjectiveTransform> projectiveT, projectiveOut;
+		std::vector<Vector3> points, outPoints;
+
+		// the typed results as matrices, for the comparison
+		template <class T>
+		void collect(const std::vector<T> &typed)
+		{
+			for (size_t i = 0; i < typed.size(); i++)
+				out[i] = typed[i].getMatrix();
+		}
+	};
+
+	// every form is called through a pointer so none is inlined into the timing loop
+	typedef void (*Run)(Data &d);
+
+	void invertMatrix(Data &d)
+	{
+		for (size_t i = 0; i < d.rigid.size(); i++)
+			d.out[i] = Matrix4(d.rigid[i]).invert();
+	}
+
+	void invertRigid(Data &d)
+	{
+		for (size_t i = 0; i < d.rigidT.size(); i++)
+			d.rigidOut[i] = d.rigidT[i].inverse();
+	}
+
+	void invertAffine(Data &d)
+	{
+		for (size_t i = 0; i < d.affineT.size(); i++)
+			d.affineOut[i] = d.affineT[i].inverse();
+	}
+
+	void invertProjectiveMatrix(Data &d)
+	{
+		for (size_t i = 0; i < d.projective.size(); i++)
+			d.out[i] = Matrix4(d.projective[i]).invert();
+	}
+
+	void invertProjective(Data &d)
+	{
+		for (size_t i = 0; i < d.projectiveT.size(); i++)
+			d.projectiveOut[i] = d.projectiveT[i].inverse();
+	}
+
+	void composeMatrix(Data &d)
+	{
+		const size_t n = d.rigid.size();
+		for (size_t i = 0; i < n; i++)
+			d.out[i] = d.rigid[i] * d.rigid[n - 1 - i];
+	}
+
+	void composeRigid(Data &d)
+	{
+		const size_t n = d.rigid.size();
+		for (size_t i = 0; i < n; i++)
+			d.rigidOut[i] = d.rigidT[i] * d.rigidT[n - 1 - i];
+	}
+
+	void pointMatrix(Data &d)
+	{
+		for (size_t i = 0; i < d.rigid.size(); i++)
+		{
+			Vector4 p = d.rigid[i] * Vector4(d.points[i].x, d.points[i].y, d.points[i].z, 1.0f);
+			d.outPoints[i] = Vector3(p.x, p.y, p.z);
+		}
+	}
+
+	void pointRigid(Data &d)
+	{
+		for (size_t i = 0; i < d.rigid.size(); i++)
+			d.outPoints[i] = d.rigidT[i].transformPoint(d.points[i]);
+	}
+
+	double difference(const std::vector<Matrix4> &a, const std::vector<Matrix4> &b)
+	{
+		double d = 0.0;
+		for (size_t i = 0; i < a.size(); i++)
+			for (int k = 0; k < 16; k++)
+				d = fmax(d, fabs(a[i][k] - b[i][k]));
+		return d;
+	}
+
+	double difference(const std::vector<Vector3> &a, const std::vector<Vector3> &b)
+	{
+		double d = 0.0;
+		for (size_t i = 0; i < a.size(); i++)
+			for (int k = 0; k < 3; k++)
+				d = fmax(d, fabs(a[i][k] - b[i][k]));
+		return d;
+	}
+
+	// checks each typed form against the Matrix4 result, then times them all
+	// taking turns
+	void compare(std::vector<TransformBenchRow> &rows, const char *operation, Run reference,
+		const char **forms, const Run *runs, int count, Data &d, int repeats)
+	{
+		const size_t first = rows.size();
+		TransformBenchRow row;
+		row.operation = operation;
+		row.form = "Matrix4";
+		row.count = (int)d.rigid.size();
+		row.maxDifference = 0.0;
+		rows.push_back(row);
+
+		reference(d);
+		std::vector<Matrix4> expected = d.out;
+		std::vector<Vector3> expectedPoints = d.outPoints;
+		for (int i = 0; i < count; i++)
+		{
+			runs[i](d);
+			double diff;
+			if (strcmp(operation, "point") == 0)
+				diff = difference(expectedPoints, d.outPoints);
+			else
+			{
+				if (strcmp(forms[i], "AffineTransform") == 0)
+					d.collect(d.affineOut);
+				else if (strcmp(forms[i], "ProjectiveTransform") == 0)
+					d.collect(d.projectiveOut);
+				else
+					d.collect(d.rigidOut);
+				diff = difference(expected, d.out);
+			}
+			row.form = forms[i];
+			row.maxDifference = diff;
+			rows.push_back(row);
+		}
+
+		std::vector<double> ns(count + 1);
+		bestNsInTurns(count + 1, [&](int f)
+		{
+			for (int k = 0; k < repeats; k++)
+				(f == 0 ? reference : runs[f - 1])(d);
+		}, &ns[0]);
+		for (int i = 0; i <= count; i++)
+			rows[first + i].nsPerElement = ns[i] / ((double)repeats * d.rigid.size());
+	}
+}
+
+void runTransformBench(int count, int repeats, std::vector<TransformBenchRow> &rows)
+{
+	rows.clear();
+	Data d;
+	SimRandom random(5489u);
+	const Matrix4 projection = perspectiveMatrix(45.f, 4.f / 3.f, 0.1f, 150.f);
+	for (int i = 0; i < count; i++)
+	{
+		Vector3 axis((float)random.uniform(-1.0, 1.0), (float)random.uniform(-1.0, 1.0), (float)random.uniform(0.1, 1.0));
+		Matrix4 m;
+		m.rotate((float)random.uniform(-180.0, 180.0), axis.normalize());
+		m.translate((float)random.uniform(-50.0, 50.0), (float)random.uniform(-50.0, 50.0), (float)random.uniform(-50.0, 50.0));
+		d.rigid.push_back(m);
+		d.projective.push_back(projection * m);
+		d.rigidT.push_back(RigidTransform(m));
+		d.affineT.push_back(AffineTransform(m));
+		d.projectiveT.push_back(ProjectiveTransform(projection * m));
+		d.points.push_back(Vector3((float)random.uniform(-10.0, 10.0), (float)random.uniform(-10.0, 10.0), (float)random.uniform(-10.0, 10.0)));
+	}
+	d.out.resize(count);
+	d.outPoints.resize(count);
+	d.rigidOut.resize(count);
+	d.affineOut.resize(count);
+	d.projectiveOut.resize(count);
+
+	const char *inverseForms[] = { "RigidTransform", "AffineTransform" };
+	const Run inverseRuns[] = { invertRigid, invertAffine };
+	compare(rows, "inverse", invertMatrix, inverseForms, inverseRuns, 2, d, repeats);
+
+	const char *projectiveForms[] = { "ProjectiveTransform" };
+	const Run projectiveRuns[] = { invertProjective };
+	compare(rows, "inverse-projective", invertProjectiveMatrix, projectiveForms, projectiveRuns, 1, d, repeats);
+
+	const char *composeForms[] = { "RigidTransform" };
+	const Run composeRuns[] = { composeRigid };
+	compare(rows, "compose", composeMatrix, composeForms, composeRuns, 1, d, repeats);
+
+	const char *pointForms[] = { "RigidTransform" };
+	const Run pointRuns[] = { pointRigid };
+	compare(rows, "point", pointMatrix, pointForms, pointRuns, 1, d, repeats);
+}
+
+int runTransformBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("xformbench", argc, argv);
+	const char *outFile = args.text("out", "transform_bench.csv");
+	const int count = args.integer("count", 4096), repeats = args.integer("repeats", 500);
+	args.reportUnknown();
+	if (count <= 0 || repeats <= 0)
+	{
+		printf("xformbench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<TransformBenchRow> rows;
+	runTransformBench(count, repeats, rows);
+	double base = 0.0;
+	for (auto &row : rows)
+	{
+		if (strcmp(row.form, "Matrix4") == 0)
+			base = row.nsPerElement;
+		printf("%-18s %-19s %7.2f ns  x%.2f  max diff %.2e\n", row.operation, row.form, row.nsPerElement,
+			base / row.nsPerElement, row.maxDifference);
+	}
+
+	FILE *fp = openCsv("xformbench", outFile, "operation,form,count,ns_per_element,max_difference");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%s,%d,%.4f,%.3e\n", row.operation, row.form, row.count, row.nsPerElement, row.maxDifference);
+	return closeCsv("xformbench", fp, outFile) ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+///////////////////////////////////////////////////////////////////////////////
+// TransformBench.h
+// ================
+// Typed transforms (Transform.h) against the untyped Matrix4 calls.
+//
+// Each operation runs over an array of rigid transforms (random rotation
+// and translation), or of projections times rigid transforms for the
+// projective rows: once with Matrix4 (invert() with its run-time test,
+// operator*, M * (p, 1)) and once with the typed class. The report gives
+// ns per operation and the largest difference between the two results.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSFORM_BENCH_H
+#define TRANSFORM_BENCH_H
+
+#include <vector>
+
+struct TransformBenchRow
+{
+	const char *operation;      // inverse, compose, point
+	const char *form;           // Matrix4, RigidTransform, ...
+	int count;
+	double nsPerElement;
+	double maxDifference;       // against the Matrix4 result
+};
+
+void runTransformBench(int count, int repeats, std::vector<TransformBenchRow> &rows);
+
+// benchCheck's command line front end:
+//   -xformbench [out=file.csv] [count=n] [repeats=n]
+int runTransformBenchCommand(int argc, char *argv[]);
+
+#endif
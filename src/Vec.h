@@ -0,0 +1,363 @@
+///////////////////////////////////////////////////////////////////////////////
+// Vec.h
+// =====
+// Vec<N,T>: vector of N components of type T
+//
+// This is the one vector type of the project; the older headers only give
+// it their names:
+//   Vector2, Vector3, Vector4   (Vectors.h)    = Vec<2,float> .. Vec<4,float>
+//   Vector2d<T>, Vector3d<T>    (vector2d/3d.h) = Vec<2,T>, Vec<3,T>
+// so a Vector3d<float> is a Vector3 and goes into Matrix4 without a copy,
+// and each simulation picks its precision with T. The matching matrices
+// are Mat<N,T> in Mat.h.
+//
+// Vec<2>, Vec<3> and Vec<4> have x, y, z, w members; other sizes hold an
+// array. Constructors, +, -, scalar * and /, dot, LengthSq and cross are
+// constexpr. Arithmetic is written out for 2, 3 and 4 components and runs
+// a loop of compile-time length N otherwise; Vec<4,float> does +, -, * and
+// scale with one SSE/NEON instruction each and is 16-byte aligned (see
+// Matrices.h). Define MATH_NO_SIMD to build scalar code only.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MATH_VEC_H
+#define MATH_VEC_H
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define MATH_SSE
+#include <xmmintrin.h>
+#elif !defined(MATH_NO_SIMD) && (defined(__ARM_NEON) || defined(_M_ARM) || defined(_M_ARM64))
+#define MATH_NEON
+#include <arm_neon.h>
+#endif
+
+// where the compiler can tell constant evaluation apart, the SIMD kernels
+// are constexpr too and fall back to the scalar ones in constant expressions;
+// elsewhere Vec<4,float> arithmetic is only evaluated at run time
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif (defined(_MSC_VER) && _MSC_VER >= 1925) || (defined(__GNUC__) && __GNUC__ >= 9)
+#define MATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if defined(MATH_CONSTANT_EVALUATED)
+#define MATH_SIMD_CONSTEXPR constexpr
+#else
+#define MATH_SIMD_CONSTEXPR
+#endif
+
+template<int N, typename T> struct Vec;
+template<int N, typename T> struct VecKernel;
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// functions and operators shared by every Vec<N,T>
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T>
+struct VecOps
+{
+    typedef Vec<N, T> V;
+    typedef decltype(std::sqrt(T())) Real;              // float for float, double otherwise
+
+    // utils functions
+    Real        length() const                          { return std::sqrt(Real(dot(self()))); }
+    Real        distance(const V& vec) const            { V d = vec - self(); return std::sqrt(Real(d.dot(d))); }
+    V&          normalize();                            // Vec<4> leaves w untouched
+    constexpr T dot(const V& vec) const                 { return VecKernel<N, T>::dot(self(), vec); }
+    bool        equal(const V& vec, T e) const;         // compare with epsilon
+    double      Length() const                          { return std::sqrt(LengthSq()); }
+    constexpr double LengthSq() const                   { return double(dot(self())); }
+
+    // operators
+    constexpr V operator-() const                       { return VecKernel<N, T>::neg(self()); }
+    V&          operator+=(const V& rhs)                { return self() = VecKernel<N, T>::add(self(), rhs); }
+    V&          operator-=(const V& rhs)                { return self() = VecKernel<N, T>::sub(self(), rhs); }
+    V&          operator*=(const V& rhs)                { return self() = VecKernel<N, T>::mul(self(), rhs); }
+    V&          operator/=(const V& rhs)                { for(int i = 0; i < N; ++i) data()[i] /= rhs[i]; return self(); }
+    V&          operator*=(const T a)                   { return self() = VecKernel<N, T>::scale(self(), a); }
+    V&          operator/=(const T a)                   { for(int i = 0; i < N; ++i) data()[i] /= a; return self(); }
+    V&          operator+=(const T a)                   { for(int i = 0; i < N; ++i) data()[i] += a; return self(); }
+    V&          operator-=(const T a)                   { for(int i = 0; i < N; ++i) data()[i] -= a; return self(); }
+    T           operator[](int index) const             { return data()[index]; }
+    T&          operator[](int index)                   { return data()[index]; }
+
+    // non-template friends, so a float or int scales a Vec<N,double>
+    friend constexpr V operator+(const V& a, const V& b)    { return VecKernel<N, T>::add(a, b); }
+    friend constexpr V operator-(const V& a, const V& b)    { return VecKernel<N, T>::sub(a, b); }
+    friend constexpr V operator*(const V& a, const V& b)    { return VecKernel<N, T>::mul(a, b); }
+    friend constexpr V operator*(const V& v, const T s)     { return VecKernel<N, T>::scale(v, s); }
+    friend constexpr V operator*(const T s, const V& v)     { return VecKernel<N, T>::scale(v, s); }
+    friend constexpr V operator/(const V& v, const T s)     { return VecKernel<N, T>::div(v, s); }
+    friend bool operator==(const V& a, const V& b)      { for(int i = 0; i < N; ++i) if(a[i] != b[i]) return false; return true; }
+    friend bool operator!=(const V& a, const V& b)      { return !(a == b); }
+    friend bool operator<(const V& a, const V& b)       // comparison for sort
+    {
+        for(int i = 0; i < N; ++i)
+        {
+            if(a[i] < b[i]) return true;
+            if(a[i] > b[i]) return false;
+        }
+        return false;
+    }
+    friend std::ostream& operator<<(std::ostream& os, const V& vec)
+    {
+        os << "(" << vec[0];
+        for(int i = 1; i < N; ++i)
+            os << ", " << vec[i];
+        return os << ")";
+    }
+
+private:
+    V&          self()                                  { return static_cast<V&>(*this); }
+    constexpr const V& self() const                     { return static_cast<const V&>(*this); }
+    T*          data()                                  { return self().data(); }
+    const T*    data() const                            { return self().data(); }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// N components
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T>
+struct Vec : VecOps<N, T>
+{
+    T v[N];
+
+    // ctors
+    constexpr Vec() : v() {}
+
+    T*          data()                                  { return v; }
+    const T*    data() const                            { return v; }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// 2D vector
+///////////////////////////////////////////////////////////////////////////////
+template<typename T>
+struct Vec<2, T> : VecOps<2, T>
+{
+    T x;
+    T y;
+
+    // ctors
+    constexpr Vec() : x(0), y(0) {}
+    constexpr Vec(T x, T y) : x(x), y(y) {}
+    template<typename U>
+    constexpr explicit Vec(const Vec<2, U>& v) : x(T(v.x)), y(T(v.y)) {}
+
+    void        set(T x, T y)                           { this->x = x; this->y = y; }
+    T*          data()                                  { return &x; }
+    const T*    data() const                            { return &x; }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// 3D vector
+///////////////////////////////////////////////////////////////////////////////
+template<typename T>
+struct Vec<3, T> : VecOps<3, T>
+{
+    T x;
+    T y;
+    T z;
+
+    // ctors
+    constexpr Vec() : x(0), y(0), z(0) {}
+    constexpr Vec(T x, T y, T z) : x(x), y(y), z(z) {}
+    template<typename U>
+    constexpr explicit Vec(const Vec<3, U>& v) : x(T(v.x)), y(T(v.y)), z(T(v.z)) {}
+
+    void        set(T x, T y, T z)                      { this->x = x; this->y = y; this->z = z; }
+    constexpr Vec cross(const Vec& v) const             { return Vec(y*v.z - z*v.y, z*v.x - x*v.z, x*v.y - y*v.x); }
+    T*          data()                                  { return &x; }
+    const T*    data() const                            { return &x; }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// 4D vector
+// aligned to 4 components (at most 16 bytes) so 4 floats load into one SIMD
+// register
+///////////////////////////////////////////////////////////////////////////////
+template<typename T>
+struct alignas(4 * sizeof(T) < 16 ? 4 * sizeof(T) : 16) Vec<4, T> : VecOps<4, T>
+{
+    T x;
+    T y;
+    T z;
+    T w;
+
+    // ctors
+    constexpr Vec() : x(0), y(0), z(0), w(0) {}
+    constexpr Vec(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
+    template<typename U>
+    constexpr explicit Vec(const Vec<4, U>& v) : x(T(v.x)), y(T(v.y)), z(T(v.z)), w(T(v.w)) {}
+
+    void        set(T x, T y, T z, T w)                 { this->x = x; this->y = y; this->z = z; this->w = w; }
+    T*          data()                                  { return &x; }
+    const T*    data() const                            { return &x; }
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// component kernels: a loop for any N, written out for 2, 3 and 4 so the
+// result is built in registers, and SSE/NEON for 4 floats
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T>
+struct VecKernel
+{
+    typedef Vec<N, T> V;
+    static constexpr V add(const V& a, const V& b)  { V r; for(int i = 0; i < N; ++i) r.v[i] = a.v[i] + b.v[i]; return r; }
+    static constexpr V sub(const V& a, const V& b)  { V r; for(int i = 0; i < N; ++i) r.v[i] = a.v[i] - b.v[i]; return r; }
+    static constexpr V mul(const V& a, const V& b)  { V r; for(int i = 0; i < N; ++i) r.v[i] = a.v[i] * b.v[i]; return r; }
+    static constexpr V scale(const V& a, T s)       { V r; for(int i = 0; i < N; ++i) r.v[i] = a.v[i] * s; return r; }
+    static constexpr V div(const V& a, T s)         { V r; for(int i = 0; i < N; ++i) r.v[i] = a.v[i] / s; return r; }
+    static constexpr V neg(const V& a)              { V r; for(int i = 0; i < N; ++i) r.v[i] = -a.v[i]; return r; }
+    static constexpr T dot(const V& a, const V& b)  { T d = a.v[0] * b.v[0]; for(int i = 1; i < N; ++i) d += a.v[i] * b.v[i]; return d; }
+};
+
+template<typename T>
+struct VecKernel<2, T>
+{
+    typedef Vec<2, T> V;
+    static constexpr V add(const V& a, const V& b)  { return V(a.x + b.x, a.y + b.y); }
+    static constexpr V sub(const V& a, const V& b)  { return V(a.x - b.x, a.y - b.y); }
+    static constexpr V mul(const V& a, const V& b)  { return V(a.x * b.x, a.y * b.y); }
+    static constexpr V scale(const V& a, T s)       { return V(a.x * s, a.y * s); }
+    static constexpr V div(const V& a, T s)         { return V(a.x / s, a.y / s); }
+    static constexpr V neg(const V& a)              { return V(-a.x, -a.y); }
+    static constexpr T dot(const V& a, const V& b)  { return a.x * b.x + a.y * b.y; }
+};
+
+template<typename T>
+struct VecKernel<3, T>
+{
+    typedef Vec<3, T> V;
+    static constexpr V add(const V& a, const V& b)  { return V(a.x + b.x, a.y + b.y, a.z + b.z); }
+    static constexpr V sub(const V& a, const V& b)  { return V(a.x - b.x, a.y - b.y, a.z - b.z); }
+    static constexpr V mul(const V& a, const V& b)  { return V(a.x * b.x, a.y * b.y, a.z * b.z); }
+    static constexpr V scale(const V& a, T s)       { return V(a.x * s, a.y * s, a.z * s); }
+    static constexpr V div(const V& a, T s)         { return V(a.x / s, a.y / s, a.z / s); }
+    static constexpr V neg(const V& a)              { return V(-a.x, -a.y, -a.z); }
+    static constexpr T dot(const V& a, const V& b)  { return a.x * b.x + a.y * b.y + a.z * b.z; }
+};
+
+// the scalar 4 component kernel, also what the SIMD one does in constant
+// expressions
+template<typename T>
+struct VecKernel4
+{
+    typedef Vec<4, T> V;
+    static constexpr V add(const V& a, const V& b)  { return V(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+    static constexpr V sub(const V& a, const V& b)  { return V(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+    static constexpr V mul(const V& a, const V& b)  { return V(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+    static constexpr V scale(const V& a, T s)       { return V(a.x * s, a.y * s, a.z * s, a.w * s); }
+    static constexpr V div(const V& a, T s)         { return V(a.x / s, a.y / s, a.z / s, a.w / s); }
+    static constexpr V neg(const V& a)              { return V(-a.x, -a.y, -a.z, -a.w); }
+    static constexpr T dot(const V& a, const V& b)  { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+};
+
+template<typename T>
+struct VecKernel<4, T> : VecKernel4<T>
+{
+};
+
+#if defined(MATH_CONSTANT_EVALUATED)
+#define MATH_IF_CONSTANT_EVALUATED(fallback) if(MATH_CONSTANT_EVALUATED()) return fallback;
+#else
+#define MATH_IF_CONSTANT_EVALUATED(fallback)
+#endif
+
+#if defined(MATH_SSE)
+template<>
+struct VecKernel<4, float> : VecKernel4<float>
+{
+    typedef Vec<4, float> V;
+    static MATH_SIMD_CONSTEXPR V add(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::add(a, b))
+        V r; _mm_storeu_ps(&r.x, _mm_add_ps(_mm_loadu_ps(&a.x), _mm_loadu_ps(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V sub(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::sub(a, b))
+        V r; _mm_storeu_ps(&r.x, _mm_sub_ps(_mm_loadu_ps(&a.x), _mm_loadu_ps(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V mul(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::mul(a, b))
+        V r; _mm_storeu_ps(&r.x, _mm_mul_ps(_mm_loadu_ps(&a.x), _mm_loadu_ps(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V scale(const V& a, float s)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::scale(a, s))
+        V r; _mm_storeu_ps(&r.x, _mm_mul_ps(_mm_loadu_ps(&a.x), _mm_set1_ps(s))); return r;
+    }
+};
+#elif defined(MATH_NEON)
+template<>
+struct VecKernel<4, float> : VecKernel4<float>
+{
+    typedef Vec<4, float> V;
+    static MATH_SIMD_CONSTEXPR V add(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::add(a, b))
+        V r; vst1q_f32(&r.x, vaddq_f32(vld1q_f32(&a.x), vld1q_f32(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V sub(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::sub(a, b))
+        V r; vst1q_f32(&r.x, vsubq_f32(vld1q_f32(&a.x), vld1q_f32(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V mul(const V& a, const V& b)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::mul(a, b))
+        V r; vst1q_f32(&r.x, vmulq_f32(vld1q_f32(&a.x), vld1q_f32(&b.x))); return r;
+    }
+    static MATH_SIMD_CONSTEXPR V scale(const V& a, float s)
+    {
+        MATH_IF_CONSTANT_EVALUATED(VecKernel4<float>::scale(a, s))
+        V r; vst1q_f32(&r.x, vmulq_n_f32(vld1q_f32(&a.x), s)); return r;
+    }
+};
+#endif
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// inline functions for VecOps
+///////////////////////////////////////////////////////////////////////////////
+template<int N, typename T>
+inline typename VecOps<N, T>::V& VecOps<N, T>::normalize()
+{
+    const int n = (N == 4) ? 3 : N;
+    T sum = data()[0] * data()[0];
+    for(int i = 1; i < n; ++i)
+        sum += data()[i] * data()[i];
+    Real invLength = Real(1) / std::sqrt(Real(sum));
+    for(int i = 0; i < n; ++i)
+        data()[i] = T(data()[i] * invLength);
+    return self();
+}
+
+template<int N, typename T>
+inline bool VecOps<N, T>::equal(const V& rhs, T epsilon) const
+{
+    for(int i = 0; i < N; ++i)
+        if(!(std::abs(data()[i] - rhs[i]) < epsilon))
+            return false;
+    return true;
+}
+
+#endif
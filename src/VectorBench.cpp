@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+// VectorBench.cpp
+// ===============
+// Vector operator overhead microbenchmark. See VectorBench.h.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "BenchCommon.h"
+#include "vector2d.h"
+#include "vector3d.h"
+#include "VectorBench.h"
+
+namespace
+{
+	template <class V>
+	struct Bodies
+	{
+		std::vector<V> pos, vel, acc;
+	};
+
+	// called through a pointer so neither form is inlined into the timing loop
+	template <class V, class T>
+	struct Step
+	{
+		typedef void (*Function)(Bodies<V> &b, T dt);
+	};
+
+	template <class T>
+	void stepOperators2(Bodies<Vector2d<T> > &b, T dt)
+	{
+		const T half = T(0.5) * dt * dt;
+		const size_t n = b.pos.size();
+		for (size_t i = 0; i < n; i++)
+			b.pos[i] = b.pos[i] + b.vel[i] * dt + b.acc[i] * half;
+	}
+
+	template <class T>
+	void stepComponents2(Bodies<Vector2d<T> > &b, T dt)
+	{
+		const T half = T(0.5) * dt * dt;
+		const size_t n = b.pos.size();
+		for (size_t i = 0; i < n; i++)
+		{
+			Vector2d<T> &p = b.pos[i];
+			const Vector2d<T> &v = b.vel[i], &a = b.acc[i];
+			p.x = p.x + v.x * dt + a.x * half;
+			p.y = p.y + v.y * dt + a.y * half;
+		}
+	}
+
+	template <class T>
+	void stepOperators3(Bodies<Vector3d<T> > &b, T dt)
+	{
+		const T half = T(0.5) * dt * dt;
+		const size_t n = b.pos.size();
+		for (size_t i = 0; i < n; i++)
+			b.pos[i] = b.pos[i] + b.vel[i] * dt + b.acc[i] * half;
+	}
+
+	template <class T>
+	void stepComponents3(Bodies<Vector3d<T> > &b, T dt)
+	{
+		const T half = T(0.5) * dt * dt;
+		const size_t n = b.pos.size();
+		for (size_t i = 0; i < n; i++)
+		{
+			Vector3d<T> &p = b.pos[i];
+			const Vector3d<T> &v = b.vel[i], &a = b.acc[i];
+			p.x = p.x + v.x * dt + a.x * half;
+			p.y = p.y + v.y * dt + a.y * half;
+			p.z = p.z + v.z * dt + a.z * half;
+		}
+	}
+
+	template <class T>
+	void fill(std::vector<Vector2d<T> > &v, int count, double scale)
+	{
+		v.resize(count);
+		for (int i = 0; i < count; i++)
+			v[i] = Vector2d<T>(T(scale * (i % 97)), T(-scale * (i % 89)));
+	}
+
+	template <class T>
+	void fill(std::vector<Vector3d<T> > &v, int count, double scale)
+	{
+		v.resize(count);
+		for (int i = 0; i < count; i++)
+			v[i] = Vector3d<T>(T(scale * (i % 97)), T(-scale * (i % 89)), T(scale * (i % 83)));
+	}
+
+	template <class V, class T>
+	void compare(const char *type, typename Step<V, T>::Function operators, typename Step<V, T>::Function components,
+		int count, int repeats, std::vector<VectorBenchRow> &rows)
+	{
+		Bodies<V> start;
+		fill(start.pos, count, 1.0);
+		fill(start.vel, count, 0.5);
+		fill(start.acc, count, 0.25);
+
+		// ns per body step, the two forms taking turns; each keeps advancing
+		// its own copy, by the same number of steps
+		Bodies<V> b[2] = { start, start };
+		const typename Step<V, T>::Function forms[] = { components, operators };
+		double ns[2];
+		bestNsInTurns(2, [&](int f)
+		{
+			for (int r = 0; r < repeats; r++)
+				forms[f](b[f], T(0.001));
+		}, ns, 3);
+
+		VectorBenchRow row;
+		row.type = type;
+		row.count = count;
+		row.identical = true;
+
+		row.form = "components";
+		row.nsPerElement = ns[0] / ((double)repeats * count);
+		rows.push_back(row);
+
+		row.form = "operators";
+		row.nsPerElement = ns[1] / ((double)repeats * count);
+		row.identical = memcmp(&b[1].pos[0], &b[0].pos[0], count * sizeof(V)) == 0;
+		rows.push_back(row);
+	}
+}
+
+void runVectorBench(int count, int repeats, std::vector<VectorBenchRow> &rows)
+{
+	rows.clear();
+	compare<Vector2d<double>, double>("Vector2d<double>", stepOperators2<double>, stepComponents2<double>, count, repeats, rows);
+	compare<Vector3d<float>, float>("Vector3d<float>", stepOperators3<float>, stepComponents3<float>, count, repeats, rows);
+	compare<Vector3d<double>, double>("Vector3d<double>", stepOperators3<double>, stepComponents3<double>, count, repeats, rows);
+}
+
+int runVectorBenchCommand(int argc, char *argv[])
+{
+	BenchArgs args("vecbench", argc, argv);
+	const char *outFile = args.text("out", "vector_bench.csv");
+	const int count = args.integer("bodies", 4096), repeats = args.integer("repeats", 2000);
+	args.reportUnknown();
+	if (count <= 0 || repeats <= 0)
+	{
+		printf("vecbench: nothing to run\n");
+		return 1;
+	}
+
+	std::vector<VectorBenchRow> rows;
+	runVectorBench(count, repeats, rows);
+	int differ = 0;
+	for (size_t i = 0; i + 1 < rows.size(); i += 2)
+	{
+		const VectorBenchRow &c = rows[i], &o = rows[i + 1];
+		printf("%-17s components %6.3f ns  operators %6.3f ns  ratio %.2f  %s\n", c.type,
+			c.nsPerElement, o.nsPerElement, o.nsPerElement / c.nsPerElement, o.identical ? "identical" : "RESULTS DIFFER");
+		differ += o.identical ? 0 : 1;
+	}
+
+	FILE *fp = openCsv("vecbench", outFile, "type,form,bodies,ns_per_element,identical");
+	if (fp == NULL)
+		return 1;
+	for (auto &row : rows)
+		fprintf(fp, "%s,%s,%d,%.4f,%d\n", row.type, row.form, row.count, row.nsPerElement, row.identical ? 1 : 0);
+	if (!closeCsv("vecbench", fp, outFile))
+		return 1;
+	return differ ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+///////////////////////////////////////////////////////////////////////////////
+// VectorBench.h
+// =============
+// Microbenchmark of the Vector2d/Vector3d operators.
+//
+// Advances an array of bodies with pos = pos + vel*dt + acc*(0.5*dt*dt),
+// once written with the vector operators and once spelled out per
+// component in the same order. If the operators cost nothing, both forms
+// run at the same speed and give bit-identical positions.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VECTOR_BENCH_H
+#define VECTOR_BENCH_H
+
+#include <vector>
+
+struct VectorBenchRow
+{
+	const char *type;           // Vector2d<double>, Vector3d<float>
+	const char *form;           // operators, components
+	int count;                  // bodies
+	double nsPerElement;
+	bool identical;             // positions match the component form bit for bit
+};
+
+void runVectorBench(int count, int repeats, std::vector<VectorBenchRow> &rows);
+
+// benchCheck's command line front end, exits with 1 when the two forms' results differ:
+//   -vecbench [out=file.csv] [bodies=n] [repeats=n]
+int runVectorBenchCommand(int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////
+// benchCheck.cpp
+// ==============
+// The benches of the math, geometry and simulation modules as one console
+// program. It links the modules directly and opens no window, so a build
+// machine can run it.
+//
+//   benchCheck                    every check on small inputs, exits with 1
+//                                 if any of them fails
+//   benchCheck -<bench> [key=value ...]
+//                                 one bench at full size, with the arguments
+//                                 listed in its header
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "MatrixBench.h"
+#include "TransformBench.h"
+#include "GeometryBench.h"
+#include "FastMathBench.h"
+#include "VectorBench.h"
+#include "NBodyBench.h"
+#include "ShadowMapBench.h"
+#include "TrajectoryBench.h"
+
+namespace
+{
+	int runTrajectoryBenchCommand(int argc, char *argv[])
+	{
+		return runBenchCommand(argc, argv, BenchConfig());
+	}
+
+	struct Bench
+	{
+		const char *name;
+		int (*run)(int argc, char *argv[]);
+		const char *check[4];   // arguments of the quick check, none for a timing only bench
+	};
+	const Bench benches[] =
+	{
+		{ "-matrixbench", runMatrixBenchCommand, { "count=1024", "repeats=20" } },
+		{ "-xformbench", runTransformBenchCommand, { NULL } },
+		{ "-geombench", runGeometryBenchCommand, { "count=4096", "repeats=3" } },
+		{ "-mathbench", runMathBenchCommand, { "repeats=3" } },
+		{ "-vecbench", runVectorBenchCommand, { "bodies=1024", "repeats=10" } },
+		{ "-nbodybench", runNBodyBenchCommand, { NULL } },
+		{ "-shadowbench", runShadowMapBenchCommand, { "size=256", "grid=60" } },
+		{ "-trajbench", runTrajectoryBenchCommand, { NULL } },
+	};
+
+	int runChecks()
+	{
+		int checks = 0, failed = 0;
+		for (auto &bench : benches)
+		{
+			if (bench.check[0] == NULL)
+				continue;
+			char *argv[4];
+			int argc = 0;
+			printf("== benchCheck %s", bench.name);
+			for (; argc < 4 && bench.check[argc] != NULL; argc++)
+			{
+				argv[argc] = (char *)bench.check[argc];
+				printf(" %s", argv[argc]);
+			}
+			printf("\n");
+			checks++;
+			if (bench.run(argc, argv) != 0)
+			{
+				printf("benchCheck: %s failed\n", bench.name);
+				failed++;
+			}
+		}
+		if (failed)
+			printf("benchCheck: %d of %d checks failed\n", failed, checks);
+		else
+			printf("benchCheck: all %d checks passed\n", checks);
+		return failed ? 1 : 0;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+		return runChecks();
+	for (auto &bench : benches)
+	{
+		if (strcmp(argv[1], bench.name) == 0)
+			return bench.run(argc - 2, argv + 2);
+	}
+
+	printf("usage: benchCheck [-bench [key=value ...]]\n");
+	printf("without arguments every check runs on small inputs; the benches are\n");
+	for (auto &bench : benches)
+		printf("  %s\n", bench.name);
+	return 2;
+}
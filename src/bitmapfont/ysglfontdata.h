@@ -6,17 +6,24 @@
 extern "C" {
 #endif
 
-extern unsigned char *YsFont6x7[256];
-extern unsigned char *YsFont6x8[256];
-extern unsigned char *YsFont6x10[256];
-extern unsigned char *YsFont7x10[256];
-extern unsigned char *YsFont8x8[256];
-extern unsigned char *YsFont8x12[256];
-extern unsigned char *YsFont12x16[256];
-extern unsigned char *YsFont16x20[256];
-extern unsigned char *YsFont16x24[256];
-extern unsigned char *YsFont20x28[256];
-extern unsigned char *YsFont20x32[256];
+/* The glyph tables are linked in packed form (ysglfontpacked.c) and a size is
+   decoded on the first call for it; NULL if there is no such size.  Any
+   thread may call it: the check and the decode run under a lock, so a size is
+   decoded once and concurrent callers wait for it.
+   YsFont8x12 etc. stand for these calls, so YsFont8x12[c] is still glyph c. */
+unsigned char *const *YsGlGetFontBitmap(int fontWid,int fontHei);
+
+#define YsFont6x7 (YsGlGetFontBitmap(6,7))
+#define YsFont6x8 (YsGlGetFontBitmap(6,8))
+#define YsFont6x10 (YsGlGetFontBitmap(6,10))
+#define YsFont7x10 (YsGlGetFontBitmap(7,10))
+#define YsFont8x8 (YsGlGetFontBitmap(8,8))
+#define YsFont8x12 (YsGlGetFontBitmap(8,12))
+#define YsFont12x16 (YsGlGetFontBitmap(12,16))
+#define YsFont16x20 (YsGlGetFontBitmap(16,20))
+#define YsFont16x24 (YsGlGetFontBitmap(16,24))
+#define YsFont20x28 (YsGlGetFontBitmap(20,28))
+#define YsFont20x32 (YsGlGetFontBitmap(20,32))
 
 void YsGlUseFontBitmap6x7(int listBase);
 void YsGlDrawFontBitmap6x7(const char str[]);
@@ -57,6 +64,21 @@ int YsGlWriteStringToRGBA8Bitmap(
 /* In OpenGL:   c0=r  c1=g  c2=b  c3=a
    In Direct3D: c0=a  c1=r  c2=g  c3=b */
 
+int YsGlBlendStringToRGBA8Bitmap(
+    const char str[],unsigned int r,unsigned int g,unsigned int b,unsigned int a,
+    unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
+    int bottomLeftX,int bottomLeftY,
+    unsigned char *const fontPtr[],int fontWid,int fontHei);
+/* Blends (r,g,b) with alpha a over the bitmap, clipped to the bitmap. */
+
+int YsGlBlendStringToRGBA8BitmapClip(
+    const char str[],unsigned int r,unsigned int g,unsigned int b,unsigned int a,
+    unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
+    int bottomLeftX,int bottomLeftY,
+    int clipX0,int clipY0,int clipX1,int clipY1,
+    unsigned char *const fontPtr[],int fontWid,int fontHei);
+/* The same, touching only clipX0<=x<clipX1, clipY0<=y<clipY1. */
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include "ysglfontdata.h"
+#include "ysglfontpacked.h"
+
+/* The decoded glyph tables: each is filled on the first call for its size,
+   under ysFontLock so that calls from several threads decode it once.  The
+   lock is initialized statically, so there is nothing to set up first. */
+#define YS_MAX_PACKED_FONT 16
+static unsigned char *ysFontTable[YS_MAX_PACKED_FONT][256];
+static unsigned char *ysFontBitmap[YS_MAX_PACKED_FONT];
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+static SRWLOCK ysFontLock=SRWLOCK_INIT;
+#define YS_LOCK_FONT() AcquireSRWLockExclusive(&ysFontLock)
+#define YS_UNLOCK_FONT() ReleaseSRWLockExclusive(&ysFontLock)
+#else
+#include <pthread.h>
+static pthread_mutex_t ysFontLock=PTHREAD_MUTEX_INITIALIZER;
+#define YS_LOCK_FONT() pthread_mutex_lock(&ysFontLock)
+#define YS_UNLOCK_FONT() pthread_mutex_unlock(&ysFontLock)
+#endif
+
+/* Reads the run-length coded stream of ysglfontpacked.h one byte at a time. */
+struct YsPackBitsReader
+{
+	const unsigned char *dat;
+	unsigned int ptr,nByte;
+	unsigned int runLeft;
+	int literal;
+};
+
+static unsigned char ysGlNextPackedByte(struct YsPackBitsReader *reader)
+{
+	unsigned char byte;
+	if(0==reader->runLeft)
+	{
+		unsigned int n;
+		if(reader->ptr>=reader->nByte)
+		{
+			return 0;
+		}
+		n=reader->dat[reader->ptr++];
+		reader->literal=(n<128);
+		reader->runLeft=(n<128 ? n+1 : n-126);
+	}
+	byte=(reader->ptr<reader->nByte ? reader->dat[reader->ptr] : 0);
+	reader->runLeft--;
+	if(0!=reader->literal || 0==reader->runLeft)
+	{
+		reader->ptr++;
+	}
+	return byte;
+}
+
+static unsigned char **ysGlDecodeFont(int f)
+{
+	const struct YsGlPackedFont *font=&YsGlPackedFontTable[f];
+	const int fontWid=font->fontWid,fontHei=font->fontHei;
+	const unsigned int bytePerFontLine=((fontWid+31)/32)*4;
+	const unsigned int bytePerGlyph=bytePerFontLine*fontHei;
+	struct YsPackBitsReader reader;
+	unsigned char *bitmap,bits=0;
+	int c,x,y,nBitLeft=0;
+
+	bitmap=(unsigned char *)calloc(256,bytePerGlyph);
+	if(NULL==bitmap)
+	{
+		return NULL;
+	}
+
+	reader.dat=font->dat;
+	reader.ptr=0;
+	reader.nByte=font->nByte;
+	reader.runLeft=0;
+	reader.literal=0;
+
+	for(c=0; c<256; c++)
+	{
+		unsigned char *glyph=bitmap+bytePerGlyph*c;
+		ysFontTable[f][c]=glyph;
+		if(0!=(font->blank[c>>3]&(1<<(c&7))))
+		{
+			continue;
+		}
+		for(y=0; y<fontHei; y++)
+		{
+			unsigned char *fontLine=glyph+bytePerFontLine*y;
+			for(x=0; x<fontWid; x++)
+			{
+				if(0==nBitLeft)
+				{
+					bits=ysGlNextPackedByte(&reader);
+					nBitLeft=8;
+				}
+				if(0!=(bits&0x80))
+				{
+					fontLine[x>>3]|=(0x80>>(x&7));
+				}
+				bits<<=1;
+				nBitLeft--;
+			}
+		}
+	}
+
+	ysFontBitmap[f]=bitmap;
+	return ysFontTable[f];
+}
+
+unsigned char *const *YsGlGetFontBitmap(int fontWid,int fontHei)
+{
+	int f;
+	for(f=0; f<YsGlNumPackedFont && f<YS_MAX_PACKED_FONT; f++)
+	{
+		if(YsGlPackedFontTable[f].fontWid==fontWid && YsGlPackedFontTable[f].fontHei==fontHei)
+		{
+			unsigned char *const *table;
+			YS_LOCK_FONT();
+			table=(NULL!=ysFontBitmap[f] ? ysFontTable[f] : ysGlDecodeFont(f));
+			YS_UNLOCK_FONT();
+			return table;
+		}
+	}
+	return NULL;
+}
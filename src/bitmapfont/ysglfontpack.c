@@ -0,0 +1,192 @@
+/* ysglfontpack: writes the packed glyph tables (ysglfontpacked.c) from the
+   uncompressed ones in ysglfontdata.c.  The demos link only the packed
+   tables; this tool is the only program that links ysglfontdata.c.
+
+   Build and run it whenever ysglfontdata.c changes:
+     cl ysglfontpack.c ysglfontdata.c          (or cc -o ysglfontpack ...)
+     ysglfontpack ysglfontpacked.c
+
+   The format is described in ysglfontpacked.h. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Not ysglfontdata.h: that one turns these names into decoder calls. */
+extern unsigned char *YsFont6x7[256];
+extern unsigned char *YsFont6x8[256];
+extern unsigned char *YsFont6x10[256];
+extern unsigned char *YsFont7x10[256];
+extern unsigned char *YsFont8x8[256];
+extern unsigned char *YsFont8x12[256];
+extern unsigned char *YsFont12x16[256];
+extern unsigned char *YsFont16x20[256];
+extern unsigned char *YsFont16x24[256];
+extern unsigned char *YsFont20x28[256];
+extern unsigned char *YsFont20x32[256];
+
+struct YsFontSource
+{
+	unsigned char **fontPtr;
+	int fontWid,fontHei;
+};
+
+static const struct YsFontSource ysFontSource[]=
+{
+	{YsFont6x7,6,7},
+	{YsFont6x8,6,8},
+	{YsFont6x10,6,10},
+	{YsFont7x10,7,10},
+	{YsFont8x8,8,8},
+	{YsFont8x12,8,12},
+	{YsFont12x16,12,16},
+	{YsFont16x20,16,20},
+	{YsFont16x24,16,24},
+	{YsFont20x28,20,28},
+	{YsFont20x32,20,32}
+};
+
+#define YS_NUM_FONT (sizeof(ysFontSource)/sizeof(ysFontSource[0]))
+
+static int ysGlIsBlankGlyph(const unsigned char glyph[],int nByte)
+{
+	int i;
+	for(i=0; i<nByte; i++)
+	{
+		if(0!=glyph[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Returns the number of bytes written to out, which must hold nByte+nByte/128+1. */
+static unsigned int ysGlPackBits(unsigned char out[],const unsigned char in[],unsigned int nByte)
+{
+	unsigned int i=0,nOut=0;
+	while(i<nByte)
+	{
+		unsigned int run=1;
+		while(i+run<nByte && in[i+run]==in[i] && run<129)
+		{
+			run++;
+		}
+		if(2<=run)
+		{
+			out[nOut++]=(unsigned char)(126+run);
+			out[nOut++]=in[i];
+			i+=run;
+		}
+		else
+		{
+			unsigned int nLiteral=0;
+			while(i+nLiteral<nByte && nLiteral<128 &&
+			      (i+nLiteral+1>=nByte || in[i+nLiteral]!=in[i+nLiteral+1]))
+			{
+				nLiteral++;
+			}
+			out[nOut++]=(unsigned char)(nLiteral-1);
+			memcpy(out+nOut,in+i,nLiteral);
+			nOut+=nLiteral;
+			i+=nLiteral;
+		}
+	}
+	return nOut;
+}
+
+int main(int ac,char *av[])
+{
+	FILE *fp;
+	int f,nFont;
+	unsigned char blank[YS_NUM_FONT][32];
+	unsigned int totalRaw=0,totalPacked=0;
+
+	if(2!=ac)
+	{
+		fprintf(stderr,"Usage: ysglfontpack ysglfontpacked.c\n");
+		return 1;
+	}
+	fp=fopen(av[1],"w");
+	if(NULL==fp)
+	{
+		fprintf(stderr,"Cannot open %s\n",av[1]);
+		return 1;
+	}
+
+	fprintf(fp,"/* Generated by ysglfontpack from ysglfontdata.c.  Do not edit. */\n\n");
+	fprintf(fp,"#include \"ysglfontpacked.h\"\n\n");
+
+	nFont=YS_NUM_FONT;
+	for(f=0; f<nFont; f++)
+	{
+		const struct YsFontSource *src=&ysFontSource[f];
+		const int bytePerFontLine=((src->fontWid+31)/32)*4;
+		const int bytePerGlyph=bytePerFontLine*src->fontHei;
+		const unsigned int maxBit=256*src->fontWid*src->fontHei;
+		unsigned char *bits=(unsigned char *)calloc(maxBit/8+1,1);
+		unsigned char *packed=(unsigned char *)malloc(maxBit/8+maxBit/8/128+2);
+		unsigned int nBit=0,nPacked,i;
+		int c,x,y;
+
+		memset(blank[f],0,sizeof(blank[f]));
+		for(c=0; c<256; c++)
+		{
+			const unsigned char *glyph=src->fontPtr[c];
+			if(0!=ysGlIsBlankGlyph(glyph,bytePerGlyph))
+			{
+				blank[f][c>>3]|=(1<<(c&7));
+				continue;
+			}
+			for(y=0; y<src->fontHei; y++)
+			{
+				const unsigned char *fontLine=glyph+bytePerFontLine*y;
+				for(x=0; x<src->fontWid; x++,nBit++)
+				{
+					if(0!=(fontLine[x>>3]&(0x80>>(x&7))))
+					{
+						bits[nBit>>3]|=(0x80>>(nBit&7));
+					}
+				}
+			}
+		}
+		nPacked=ysGlPackBits(packed,bits,(nBit+7)/8);
+
+		fprintf(fp,"static const unsigned char ysFont%dx%dPacked[%u]={",src->fontWid,src->fontHei,nPacked);
+		for(i=0; i<nPacked; i++)
+		{
+			fprintf(fp,"%s0x%02x",(0==i%16 ? "\n" : ""),packed[i]);
+			if(i+1<nPacked)
+			{
+				fprintf(fp,",");
+			}
+		}
+		fprintf(fp,"};\n\n");
+
+		totalRaw+=256*bytePerGlyph;
+		totalPacked+=nPacked;
+		free(bits);
+		free(packed);
+	}
+
+	fprintf(fp,"const struct YsGlPackedFont YsGlPackedFontTable[%d]=\n{\n",nFont);
+	for(f=0; f<nFont; f++)
+	{
+		const struct YsFontSource *src=&ysFontSource[f];
+		int c;
+
+		fprintf(fp,"\t{%d,%d,{",src->fontWid,src->fontHei);
+		for(c=0; c<32; c++)
+		{
+			fprintf(fp,"0x%02x%s",blank[f][c],(c<31 ? "," : ""));
+		}
+		fprintf(fp,"},sizeof(ysFont%dx%dPacked),ysFont%dx%dPacked}%s\n",
+		    src->fontWid,src->fontHei,src->fontWid,src->fontHei,(f+1<nFont ? "," : ""));
+	}
+	fprintf(fp,"};\n\n");
+	fprintf(fp,"const int YsGlNumPackedFont=%d;\n",nFont);
+	fclose(fp);
+
+	printf("%d fonts, %u bytes of glyphs packed into %u bytes.\n",nFont,totalRaw,totalPacked);
+	return 0;
+}
@@ -0,0 +1,1628 @@
+/* Generated by ysglfontpack from ysglfontdata.c.  Do not edit. */
+
+#include "ysglfontpacked.h"
+
+static const unsigned char ysFont6x7Packed[490]={
+0x04,0x00,0x80,0x08,0x20,0x82,0x82,0x00,0x16,0x51,0x40,0x14,0xf9,0x45,0x3e,0x50,
+0x0f,0x0a,0x72,0x87,0x88,0x02,0x65,0x88,0x23,0x4c,0x80,0x6a,0x49,0x98,0x51,0xc0,
+0x81,0x00,0x18,0x08,0x20,0x01,0x08,0x20,0x82,0x04,0x00,0x81,0x04,0x10,0x42,0x00,
+0xa9,0xcf,0x9c,0xa8,0x00,0x08,0x23,0xe2,0x08,0x00,0x02,0x0c,0x83,0x00,0x00,0x3e,
+0x81,0x00,0x00,0x20,0x82,0x00,0x38,0x20,0x40,0x82,0x04,0x08,0x07,0x32,0xaa,0xa9,
+0x9c,0x00,0x41,0x04,0x10,0x43,0x00,0xf9,0x03,0x02,0x89,0xc0,0x1c,0x88,0x23,0x22,
+0x70,0x01,0x3e,0x91,0x45,0x0c,0x03,0xc0,0x82,0xf2,0x0f,0x80,0x72,0x28,0xbc,0x81,
+0xc0,0x10,0x40,0x81,0x02,0xf8,0x07,0x22,0x89,0xc8,0x9c,0x01,0xc0,0x9e,0x8a,0x27,
+0x80,0x00,0x0c,0x40,0x00,0x10,0x00,0x08,0x10,0x00,0x04,0x00,0x01,0x08,0x40,0x81,
+0x80,0x00,0x02,0x07,0x00,0x70,0x80,0x00,0x7f,0x40,0x81,0x08,0x40,0x00,0x08,0x00,
+0x81,0x22,0x70,0x07,0x2a,0xaa,0xe8,0x9c,0x02,0x28,0xbe,0x8a,0x27,0x00,0xf2,0x28,
+0xbc,0x8b,0xc0,0x1e,0x82,0x08,0x20,0x78,0x0f,0x22,0x8a,0x28,0xbc,0x03,0xe8,0x20,
+0xf2,0x0f,0x80,0x82,0x08,0x3c,0x83,0xe0,0x1e,0x8a,0x68,0x20,0x78,0x08,0xa2,0x8b,
+0xe8,0xa2,0x01,0xc2,0x08,0x20,0x87,0x00,0x72,0x20,0x82,0x08,0x60,0x22,0x93,0x8a,
+0x24,0x88,0x0f,0xa0,0x82,0x08,0x20,0x02,0x2a,0xaa,0xdb,0x68,0x80,0x8a,0x6a,0xaa,
+0xca,0x20,0x1c,0x8a,0x28,0xa2,0x70,0x08,0x20,0xf2,0x28,0xbc,0x01,0xe9,0xaa,0x8a,
+0x27,0x00,0x8a,0x4f,0x22,0x8b,0xc0,0x3c,0x08,0x6e,0x20,0x78,0x02,0x08,0x20,0x82,
+0x3e,0x01,0xc8,0xa2,0x8a,0x28,0x80,0x20,0x85,0x26,0x14,0x8a,0x20,0x22,0xda,0xa8,
+0xa2,0x88,0x08,0x94,0x20,0x85,0x22,0x00,0x82,0x08,0x52,0x28,0x80,0xf9,0x02,0x04,
+0x0b,0xe0,0x0c,0x20,0x82,0x08,0x30,0x00,0x84,0x20,0x84,0x20,0x00,0xc1,0x04,0x10,
+0x43,0x82,0x00,0x02,0x50,0x80,0x3e,0x85,0x00,0x41,0x01,0x08,0x03,0xd8,0xbe,0x0b,
+0xc0,0x00,0xf2,0x28,0xbc,0x82,0x00,0x1e,0x82,0x08,0x1e,0x00,0x07,0xa2,0x89,0xe0,
+0x82,0x01,0xe8,0x3e,0x89,0xe0,0x00,0x20,0x82,0x1c,0x20,0xc7,0x02,0x79,0x24,0x8e,
+0x00,0x04,0x92,0x49,0xc4,0x10,0x00,0x82,0x08,0x20,0x02,0x00,0x72,0x20,0x82,0x00,
+0x20,0x22,0xd2,0xc8,0xa0,0x80,0x03,0x84,0x10,0x41,0x0c,0x02,0x80,0xaa,0x32,0xab,
+0x40,0x00,0x8a,0x28,0xa2,0xf0,0x00,0x1c,0x8a,0x28,0x9c,0x02,0x08,0x3c,0x8a,0x2f,
+0x00,0x08,0x27,0xa2,0x89,0xc0,0x00,0x82,0x08,0x30,0xb8,0x00,0x3c,0x0b,0xe8,0x1e,
+0x00,0x03,0x08,0x20,0x87,0x08,0x01,0xe8,0xa2,0x8a,0x20,0x00,0x21,0x45,0x22,0x88,
+0x00,0x3c,0x81,0xaa,0x1f,0x00,0x08,0x94,0x21,0x48,0x80,0x02,0x04,0x08,0x52,0x20,
+0x00,0xf9,0x02,0x04,0xf8,0x00,0x04,0x21,0x82,0x08,0x10,0x02,0x08,0x20,0x82,0x08,
+0x00,0x81,0x06,0x10,0x42,0x82,0x00,0x01,0xb1,0x20};
+
+static const unsigned char ysFont6x8Packed[566]={
+0x05,0x00,0x80,0x08,0x20,0x82,0x08,0x82,0x00,0x19,0x05,0x14,0x01,0x45,0x3e,0x53,
+0xe5,0x14,0x00,0x8f,0x0a,0x72,0x87,0x88,0x02,0x65,0x88,0x23,0x4c,0x80,0x01,0xa9,
+0x24,0x68,0x85,0x1c,0x82,0x00,0x18,0x02,0x08,0x00,0x42,0x10,0x41,0x02,0x04,0x00,
+0x81,0x02,0x08,0x21,0x08,0x00,0x8a,0x9c,0xf9,0xca,0x88,0x00,0x02,0x08,0xf8,0x82,
+0x80,0x00,0x00,0x81,0x85,0x00,0x00,0xf8,0x81,0x00,0x00,0x01,0x82,0x00,0x43,0x02,
+0x04,0x10,0x20,0x41,0x02,0x01,0xc8,0xb2,0xaa,0x68,0x9c,0x00,0x41,0x04,0x10,0x41,
+0x0c,0x03,0xe8,0x18,0x10,0x28,0x9c,0x01,0xc8,0x82,0x30,0x28,0x9c,0x00,0x4f,0xa4,
+0x51,0x45,0x0c,0x03,0xc0,0x82,0xf2,0x08,0x3e,0x01,0xc8,0xa2,0xf2,0x08,0x9c,0x01,
+0x04,0x08,0x20,0x40,0xbe,0x01,0xc8,0xa2,0x72,0x28,0x9c,0x01,0xc8,0x82,0x7a,0x28,
+0x9c,0x00,0x01,0x80,0x00,0x00,0x40,0x80,0x00,0x00,0x81,0x80,0x00,0x00,0x40,0x80,
+0x00,0x03,0x01,0x08,0x40,0x81,0x81,0x00,0x02,0x1e,0x01,0xe0,0x80,0x00,0x03,0x04,
+0x08,0x10,0x84,0x80,0x00,0x5a,0x80,0x08,0x32,0x28,0x9c,0x01,0xe8,0x2e,0xaa,0xe8,
+0x9c,0x02,0x28,0xbe,0x8a,0x28,0x9c,0x03,0xc8,0xa2,0xf2,0x28,0xbc,0x01,0xc8,0xa0,
+0x82,0x08,0x9c,0x03,0x89,0x22,0x8a,0x29,0x38,0x03,0xe8,0x20,0xf2,0x08,0x3e,0x02,
+0x08,0x20,0xf2,0x08,0x3e,0x01,0xe8,0xae,0x82,0x08,0x9c,0x02,0x28,0xa2,0xfa,0x28,
+0xa2,0x01,0xc2,0x08,0x20,0x82,0x1c,0x01,0xc8,0xa2,0x08,0x20,0x8e,0x02,0x29,0x28,
+0xc2,0x89,0x22,0x03,0xe8,0x20,0x82,0x08,0x20,0x02,0x28,0xaa,0xab,0x6d,0xa2,0x02,
+0x29,0x80,0xaa,0x5b,0xac,0xa2,0x01,0xc8,0xa2,0x8a,0x28,0x9c,0x02,0x08,0x20,0xf2,
+0x28,0xbc,0x01,0xe9,0xaa,0x8a,0x28,0x9c,0x02,0x28,0xa4,0xf2,0x28,0xbc,0x01,0xc8,
+0x82,0x72,0x08,0x9c,0x00,0x82,0x08,0x20,0x82,0x3e,0x01,0xc8,0xa2,0x8a,0x28,0xa2,
+0x00,0x82,0x14,0x52,0x28,0xa2,0x02,0x2d,0xb6,0xaa,0xa8,0xa2,0x02,0x25,0x14,0x21,
+0x45,0x22,0x00,0x82,0x08,0x51,0x48,0xa2,0x03,0xe8,0x10,0x20,0x40,0xbe,0x00,0xc2,
+0x08,0x20,0x82,0x0c,0x00,0x21,0x04,0x21,0x04,0x20,0x00,0xc1,0x04,0x10,0x41,0x0c,
+0x82,0x00,0x03,0x05,0x08,0x03,0xe0,0x86,0x00,0x1e,0x42,0x10,0x01,0xd8,0x9e,0x0b,
+0xc0,0x00,0x03,0xc8,0xa2,0x8b,0xc8,0x20,0x01,0xe8,0x20,0x81,0xe0,0x00,0x01,0xe8,
+0xa2,0x89,0xe0,0x82,0x01,0xe8,0x3e,0x89,0xe0,0x80,0x00,0x29,0x82,0x08,0x70,0x82,
+0x0c,0x03,0xc0,0xbe,0x89,0xe0,0x00,0x02,0x28,0xa2,0x8b,0xc8,0x20,0x00,0x82,0x08,
+0x20,0x02,0x00,0x01,0xc8,0x82,0x08,0x00,0x80,0x02,0x29,0x38,0x9a,0x08,0x20,0x00,
+0xe1,0x04,0x10,0x41,0x0c,0x02,0x80,0xaa,0x13,0xab,0x40,0x00,0x02,0x28,0xa2,0x8b,
+0xc0,0x00,0x01,0xc8,0xa2,0x89,0xc0,0x00,0x02,0x0f,0x22,0x8b,0xc0,0x80,0x00,0x0f,
+0x27,0xa2,0x89,0xe0,0x00,0x02,0x08,0x20,0xc2,0xe0,0x00,0x03,0xc0,0xbe,0x81,0xe0,
+0x80,0x00,0x09,0xc2,0x08,0x21,0xc2,0x00,0x01,0xe8,0xa2,0x8a,0x20,0x80,0x00,0x06,
+0x85,0x14,0x8a,0x20,0x00,0x02,0x2d,0x80,0xaa,0x12,0x20,0x00,0x02,0x25,0x08,0x52,
+0x20,0x00,0x02,0x04,0x08,0x52,0x20,0x00,0x03,0xe4,0x08,0x13,0xe0,0x80,0x00,0x10,
+0x42,0x08,0x60,0x82,0x04,0x00,0x82,0x08,0x20,0x82,0x08,0x00,0x81,0x04,0x18,0x41,
+0x08,0x82,0x00,0x01,0x0a,0x16};
+
+static const unsigned char ysFont6x10Packed[699]={
+0x07,0x00,0x80,0x08,0x20,0xc3,0x0c,0x30,0xc0,0x82,0x00,0x20,0x01,0x45,0x14,0x01,
+0x45,0x3e,0x51,0x4f,0x94,0x51,0x40,0x08,0xf0,0xa2,0x9c,0xa2,0x87,0x88,0x02,0xea,
+0xae,0x40,0x81,0x3a,0xab,0xa0,0x1a,0x92,0x45,0x8a,0x61,0x45,0x0c,0x83,0x00,0x18,
+0x08,0x20,0x80,0x04,0x21,0x04,0x10,0x41,0x02,0x04,0x00,0x81,0x02,0x08,0x20,0x82,
+0x10,0x80,0x08,0xa9,0xc2,0x3e,0x21,0xca,0x88,0x80,0x00,0x03,0x08,0x23,0xe2,0x08,
+0x80,0x00,0x02,0x08,0x10,0xc0,0x85,0x00,0x01,0x03,0xe0,0x82,0x00,0x01,0x30,0xc0,
+0x82,0x00,0x58,0x02,0x08,0x10,0x40,0x81,0x04,0x08,0x20,0x08,0x52,0x2c,0xaa,0x9a,
+0x25,0x08,0x00,0x41,0x04,0x10,0x41,0x04,0x30,0x40,0x3e,0x81,0x02,0x04,0x0a,0x28,
+0x9c,0x01,0xc8,0x82,0x08,0xc0,0x82,0x89,0xc0,0x04,0x13,0xe9,0x24,0x92,0x45,0x0c,
+0x03,0xc0,0x82,0x0b,0xc8,0x20,0x83,0xe0,0x1c,0x8a,0x28,0xbc,0x82,0x08,0x9c,0x01,
+0x04,0x10,0x20,0x81,0x04,0x0b,0xe0,0x1c,0x8a,0x28,0x9c,0x8a,0x28,0x9c,0x01,0xc8,
+0x82,0x09,0xe8,0xa2,0x89,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x80,0x00,0x04,0x83,
+0x0c,0x00,0x03,0x0c,0x81,0x00,0x05,0x08,0x42,0x10,0x20,0x40,0x80,0x80,0x00,0x03,
+0x3e,0x00,0x0f,0x80,0x81,0x00,0x04,0x40,0x81,0x02,0x10,0x84,0x80,0x00,0x09,0x80,
+0x08,0x20,0x40,0xa2,0x89,0xc0,0x1e,0x82,0x6a,0x80,0xaa,0x5d,0x68,0x9c,0x02,0x28,
+0xa2,0xfa,0x28,0x94,0x50,0x80,0x3c,0x8a,0x28,0xbc,0x8a,0x28,0xbc,0x01,0xc8,0xa2,
+0x82,0x08,0x22,0x89,0xc0,0x38,0x92,0x28,0xa2,0x8a,0x29,0x38,0x03,0xe8,0x20,0x83,
+0xc8,0x20,0x83,0xe0,0x20,0x82,0x08,0x3c,0x82,0x08,0x3e,0x01,0xe8,0xa2,0xba,0x08,
+0x22,0x89,0xc0,0x22,0x8a,0x28,0xbe,0x8a,0x28,0xa2,0x01,0xc2,0x08,0x20,0x82,0x08,
+0x21,0xc0,0x1c,0x8a,0x20,0x82,0x08,0x20,0x8e,0x02,0x28,0xa4,0xa3,0x0a,0x24,0x8a,
+0x20,0x3e,0x82,0x08,0x20,0x82,0x08,0x20,0x02,0x28,0x80,0xaa,0x7b,0xad,0xb6,0xda,
+0x20,0x22,0x9a,0x6a,0xaa,0xab,0x2c,0xa2,0x01,0xc8,0xa2,0x8a,0x28,0xa2,0x89,0xc0,
+0x20,0x82,0x0f,0x22,0x8a,0x28,0xbc,0x01,0xa9,0xac,0x8a,0x28,0xa2,0x89,0xc0,0x22,
+0x8a,0x6f,0x22,0x8a,0x28,0xbc,0x01,0xc8,0x82,0x09,0xc8,0x20,0x89,0xc0,0x08,0x20,
+0x82,0x08,0x20,0x82,0x3e,0x01,0xc8,0xa2,0x8a,0x28,0xa2,0x8a,0x20,0x08,0x20,0x85,
+0x14,0x52,0x28,0xa2,0x02,0x28,0xb6,0xda,0xaa,0xa2,0x8a,0x20,0x22,0x89,0x45,0x08,
+0x51,0x48,0xa2,0x00,0x82,0x08,0x20,0x85,0x14,0x8a,0x20,0x3e,0x81,0x04,0x08,0x10,
+0x40,0xbe,0x01,0xc4,0x10,0x41,0x04,0x10,0x41,0xc0,0x02,0x08,0x41,0x08,0x41,0x08,
+0x20,0x01,0xc1,0x04,0x10,0x41,0x04,0x11,0xc0,0x82,0x00,0x04,0x02,0x25,0x08,0x03,
+0xe0,0x89,0x00,0x07,0x42,0x10,0x00,0x0f,0x66,0x48,0xe8,0x9c,0x81,0x00,0x0b,0xf2,
+0x28,0xa2,0x8b,0xc8,0x20,0x00,0x07,0xa0,0x82,0x08,0x1e,0x81,0x00,0x0b,0x7a,0x28,
+0xa2,0x89,0xe0,0x82,0x00,0x07,0xa0,0xfa,0x28,0x9c,0x81,0x00,0x0b,0x41,0x04,0x10,
+0xf1,0x04,0x0c,0xf0,0x20,0x9e,0x8a,0x29,0x9a,0x81,0x00,0x1b,0x8a,0x28,0xa2,0x8b,
+0xc8,0x20,0x00,0x02,0x08,0x20,0x82,0x08,0x00,0x87,0x22,0x08,0x20,0x82,0x08,0x20,
+0x02,0x00,0x08,0xa4,0xe2,0x48,0xa0,0x82,0x80,0x00,0x07,0x70,0x82,0x08,0x20,0x82,
+0x18,0x00,0x0a,0x81,0xaa,0x00,0xb4,0x81,0x00,0x04,0x8a,0x28,0xa2,0x8b,0xc0,0x80,
+0x00,0x13,0x07,0x22,0x8a,0x28,0x9c,0x00,0x08,0x20,0x83,0xc8,0xa2,0x8b,0xc0,0x00,
+0x08,0x20,0x9e,0x8a,0x28,0x9e,0x81,0x00,0x04,0x82,0x08,0x30,0xa2,0x60,0x80,0x00,
+0x04,0x0f,0x02,0x3b,0x88,0x1e,0x81,0x00,0x0b,0x30,0x82,0x08,0x21,0xc2,0x08,0x00,
+0x07,0xa2,0x8a,0x28,0xa2,0x81,0x00,0x04,0x20,0x85,0x14,0x8a,0x20,0x80,0x00,0x04,
+0x08,0xb6,0xaa,0xa8,0xa2,0x81,0x00,0x07,0x89,0x42,0x08,0x52,0x20,0x00,0xe0,0x40,
+0x80,0x9a,0x01,0x28,0xa2,0x81,0x00,0x04,0xf9,0x02,0x08,0x13,0xe0,0x80,0x00,0x15,
+0xc6,0x10,0x43,0x04,0x10,0x60,0xc0,0x08,0x20,0x82,0x08,0x20,0x82,0x08,0x01,0x83,
+0x04,0x10,0x61,0x04,0x31,0x80,0x83,0x00,0x01,0x0a,0x16};
+
+static const unsigned char ysFont7x10Packed[803]={
+0x08,0x00,0x40,0x01,0x02,0x06,0x0c,0x18,0x30,0x60,0x84,0x00,0x25,0xa1,0x42,0x80,
+0x09,0x12,0x7e,0x48,0x93,0xf2,0x44,0x89,0x00,0x10,0xf8,0x48,0x93,0xca,0x14,0x1f,
+0x10,0x01,0x3a,0x54,0xe4,0x06,0x02,0x72,0xa5,0xc8,0x03,0xa8,0x91,0x15,0x10,0x70,
+0x91,0x21,0x80,0x83,0x00,0x08,0x01,0x02,0x04,0x00,0x08,0x20,0x81,0x02,0x04,0x81,
+0x08,0x00,0x00,0x81,0x40,0x0c,0x81,0x02,0x04,0x10,0x40,0x01,0x0a,0x8e,0x08,0x7c,
+0x20,0xe2,0xa1,0x81,0x00,0x03,0x10,0x21,0xf0,0x81,0x81,0x00,0x80,0x10,0x00,0x60,
+0x87,0x00,0x00,0x1f,0x83,0x00,0x01,0x03,0x06,0x84,0x00,0x80,0x10,0x80,0x20,0x00,
+0x60,0x80,0x40,0x80,0x80,0x12,0x18,0x49,0x8a,0x94,0xa8,0xd0,0x92,0x18,0x00,0x20,
+0x40,0x81,0x02,0x04,0x08,0x30,0x20,0x07,0xe8,0x81,0x08,0x28,0x09,0x0a,0x13,0xc0,
+0x0f,0x21,0x02,0x04,0x30,0x10,0x28,0x4f,0x00,0x04,0x09,0xfa,0x24,0x48,0x89,0x0a,
+0x0c,0x01,0xf0,0x10,0x20,0x5f,0x20,0x40,0x81,0xf8,0x03,0xc8,0x50,0xa1,0x7c,0x81,
+0x02,0x13,0xc0,0x04,0x08,0x80,0x10,0x80,0x20,0x16,0x40,0x5f,0x80,0x3c,0x85,0x0a,
+0x13,0xc8,0x50,0xa1,0x3c,0x00,0xf2,0x10,0x20,0x4f,0xa1,0x42,0x84,0xf0,0x00,0x03,
+0x06,0x80,0x00,0x01,0x30,0x60,0x80,0x00,0x02,0x04,0x0c,0x18,0x80,0x00,0x01,0xc1,
+0x80,0x80,0x00,0x02,0x04,0x10,0x41,0x83,0x04,0x80,0x00,0x03,0x07,0xe0,0x00,0x3f,
+0x81,0x00,0x83,0x04,0x06,0x10,0x41,0x04,0x00,0x02,0x00,0x08,0x80,0x10,0x7f,0x14,
+0x28,0x4f,0x00,0x3e,0x81,0x3a,0x95,0x2a,0x53,0xa1,0x3c,0x01,0x0a,0x14,0x2f,0xd0,
+0xa1,0x24,0x48,0x60,0x07,0xc8,0x50,0xa1,0x7c,0x85,0x0a,0x17,0xc0,0x0f,0x21,0x42,
+0x81,0x02,0x04,0x28,0x4f,0x00,0x78,0x89,0x0a,0x14,0x28,0x50,0xa2,0x78,0x01,0xfa,
+0x04,0x08,0x1f,0x20,0x40,0x81,0xf8,0x04,0x08,0x10,0x20,0x7c,0x81,0x02,0x07,0xe0,
+0x0f,0xa1,0x42,0x9d,0x02,0x04,0x28,0x4f,0x00,0x42,0x85,0x0a,0x17,0xe8,0x50,0xa1,
+0x42,0x00,0xe0,0x81,0x02,0x04,0x08,0x10,0x20,0xe0,0x03,0xc8,0x50,0x81,0x02,0x04,
+0x08,0x10,0xe0,0x10,0xa2,0x48,0xa1,0x82,0x84,0x88,0x90,0x80,0x7e,0x81,0x02,0x04,
+0x08,0x10,0x20,0x40,0x01,0x0a,0x14,0x2b,0x56,0xb3,0x66,0xcd,0x08,0x04,0x28,0x68,
+0xd1,0xa5,0x52,0xa5,0x8b,0x14,0x20,0x0f,0x21,0x42,0x85,0x0a,0x14,0x28,0x4f,0x00,
+0x40,0x81,0x03,0xe4,0x28,0x50,0xa1,0x7c,0x00,0xea,0x34,0xc8,0x50,0xa1,0x42,0x84,
+0xf0,0x04,0x28,0x50,0xbe,0x42,0x85,0x0a,0x17,0xc0,0x0f,0x21,0x02,0x04,0xf2,0x04,
+0x08,0x4f,0x00,0x10,0x20,0x40,0x81,0x02,0x04,0x08,0x7e,0x00,0xf2,0x14,0x28,0x50,
+0xa1,0x42,0x85,0x08,0x01,0x83,0x09,0x12,0x24,0x49,0x0a,0x14,0x20,0x10,0xa1,0x66,
+0xcd,0x6a,0xd4,0x28,0x50,0x80,0x42,0x84,0x91,0x21,0x84,0x89,0x21,0x42,0x00,0x40,
+0x81,0x02,0x04,0x14,0x24,0x85,0x08,0x07,0xe8,0x83,0x08,0x1b,0x17,0xe0,0x0e,0x10,
+0x20,0x40,0x81,0x02,0x04,0x0e,0x00,0x02,0x08,0x10,0x41,0x82,0x08,0x10,0x40,0x00,
+0xe0,0x40,0x81,0x02,0x04,0x08,0x10,0xe0,0x83,0x00,0x05,0x01,0x11,0x41,0x00,0x1f,
+0x80,0x8a,0x00,0x09,0x02,0x08,0x20,0x00,0x03,0xec,0x64,0x47,0xa1,0x3c,0x81,0x00,
+0x06,0x0f,0x90,0xa1,0x42,0x85,0xf2,0x04,0x80,0x00,0x05,0x1f,0x40,0x81,0x02,0x03,
+0xe0,0x81,0x00,0x0d,0x7d,0x0a,0x14,0x28,0x4f,0x81,0x02,0x00,0x01,0xf4,0x0f,0xd0,
+0xa1,0x3c,0x81,0x00,0x0e,0x04,0x08,0x10,0x20,0xf8,0x81,0x01,0xcf,0x80,0x81,0x3e,
+0x85,0x0a,0x33,0xa0,0x81,0x00,0x06,0x85,0x0a,0x14,0x28,0x5f,0x20,0x40,0x80,0x00,
+0x17,0x81,0x02,0x04,0x08,0x10,0x00,0x41,0xe4,0x20,0x40,0x81,0x02,0x04,0x08,0x00,
+0x20,0x00,0x21,0x4c,0xe1,0x32,0x14,0x08,0x10,0x80,0x00,0x0d,0x70,0x40,0x81,0x02,
+0x04,0x08,0x30,0x00,0x02,0x95,0x2a,0x54,0xa9,0x6c,0x81,0x00,0x05,0x08,0x50,0xa1,
+0x42,0x85,0xf0,0x81,0x00,0x0d,0x1e,0x42,0x85,0x0a,0x13,0xc0,0x00,0x20,0x40,0x81,
+0xf2,0x14,0x28,0x5f,0x80,0x00,0x06,0x04,0x08,0x13,0xe8,0x50,0xa1,0x3e,0x81,0x00,
+0x05,0x08,0x10,0x20,0x60,0xa1,0x38,0x81,0x00,0x05,0x3e,0x02,0x1d,0xc2,0x03,0xe0,
+0x81,0x00,0x0d,0x38,0x40,0x81,0x02,0x0f,0x08,0x10,0x00,0x01,0xf4,0x28,0x50,0xa1,
+0x42,0x81,0x00,0x05,0x03,0x06,0x12,0x24,0x85,0x08,0x81,0x00,0x05,0x21,0x66,0xb5,
+0x6a,0x14,0x20,0x81,0x00,0x0d,0x84,0x90,0xc1,0x84,0x90,0x80,0x00,0xf0,0x10,0x13,
+0xa8,0xd0,0xa1,0x42,0x81,0x00,0x01,0x0f,0xc8,0x80,0x08,0x01,0x09,0xf8,0x80,0x00,
+0x05,0x06,0x18,0x20,0x41,0x81,0x02,0x80,0x06,0x09,0x00,0x10,0x20,0x40,0x81,0x02,
+0x04,0x08,0x10,0x00,0x80,0xc0,0x05,0x81,0x03,0x04,0x08,0x30,0xc0,0x84,0x00,0x02,
+0x02,0x43,0x60};
+
+static const unsigned char ysFont8x8Packed[739]={
+0x03,0x00,0x10,0x00,0x10,0x82,0x18,0x83,0x00,0x81,0x28,0x00,0x00,0x80,0x28,0x02,
+0x7c,0x28,0x7c,0x80,0x28,0x17,0x00,0x10,0x78,0x14,0x7c,0x50,0x3c,0x10,0x00,0x8e,
+0x4a,0x2e,0x10,0xe8,0xa4,0xe2,0x00,0x3a,0x44,0x4a,0x28,0x10,0x28,0x38,0x83,0x00,
+0x00,0x10,0x80,0x18,0x02,0x00,0x08,0x10,0x81,0x20,0x04,0x10,0x08,0x00,0x20,0x10,
+0x81,0x08,0x09,0x10,0x20,0x00,0x10,0x54,0x38,0x10,0x38,0x54,0x10,0x80,0x00,0x80,
+0x10,0x00,0x7c,0x80,0x10,0x80,0x00,0x00,0x10,0x80,0x18,0x86,0x00,0x00,0x7c,0x83,
+0x00,0x80,0x18,0x83,0x00,0x10,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x00,0x7c,0xc2,
+0xa2,0x92,0x8a,0x86,0x7c,0x00,0x38,0x82,0x10,0x06,0x30,0x10,0x00,0xfe,0x40,0x30,
+0x0c,0x80,0x82,0x0c,0x7c,0x00,0x7c,0x82,0x02,0x1c,0x02,0x82,0x7c,0x00,0x08,0xfe,
+0x88,0x80,0x48,0x04,0x28,0x38,0x00,0x7c,0x82,0x80,0x02,0x04,0xfc,0x80,0xfe,0x00,
+0x7c,0x80,0x82,0x00,0xfc,0x80,0x80,0x01,0x7e,0x00,0x80,0x20,0x06,0x10,0x08,0x04,
+0x02,0xfe,0x00,0x7c,0x80,0x82,0x00,0x7c,0x80,0x82,0x02,0x7c,0x00,0xfc,0x80,0x02,
+0x00,0x7e,0x80,0x82,0x00,0x7c,0x80,0x00,0x80,0x18,0x80,0x00,0x80,0x18,0x01,0x00,
+0x30,0x80,0x18,0x80,0x00,0x80,0x18,0x07,0x00,0x08,0x10,0x20,0x40,0x20,0x10,0x08,
+0x81,0x00,0x02,0x7c,0x00,0x7c,0x81,0x00,0x17,0x40,0x20,0x10,0x08,0x10,0x20,0x40,
+0x00,0x10,0x00,0x10,0x18,0x04,0x44,0x38,0x00,0x7c,0x40,0x5c,0x54,0x5c,0x44,0x38,
+0x00,0x80,0x82,0x00,0xfe,0x80,0x82,0x03,0x44,0x38,0x00,0xfc,0x80,0x82,0x00,0xfc,
+0x80,0x82,0x03,0xfc,0x00,0x3c,0x42,0x81,0x80,0x04,0x42,0x3c,0x00,0xf8,0x84,0x81,
+0x82,0x03,0x84,0xf8,0x00,0xfe,0x80,0x80,0x00,0xfe,0x80,0x80,0x01,0xfe,0x00,0x81,
+0x80,0x00,0xf8,0x80,0x80,0x04,0xfe,0x00,0x3c,0x42,0x8e,0x80,0x80,0x02,0x42,0x3c,
+0x00,0x81,0x82,0x00,0xfe,0x81,0x82,0x01,0x00,0x38,0x83,0x10,0x04,0x38,0x00,0x38,
+0x44,0x84,0x81,0x04,0x0a,0x0e,0x00,0x82,0x84,0x88,0xf0,0x88,0x84,0x82,0x00,0xfe,
+0x84,0x80,0x00,0x00,0x81,0x82,0x0e,0x92,0xaa,0xc6,0x82,0x00,0x82,0x86,0x8a,0x92,
+0xa2,0xc2,0x82,0x00,0x38,0x44,0x81,0x82,0x02,0x44,0x38,0x00,0x81,0x80,0x00,0xfc,
+0x80,0x82,0x04,0xfc,0x00,0x3a,0x44,0x8a,0x80,0x82,0x02,0x44,0x38,0x00,0x80,0x82,
+0x01,0x84,0xfc,0x80,0x82,0x09,0xfc,0x00,0x7c,0x82,0x04,0x38,0x40,0x82,0x7c,0x00,
+0x84,0x10,0x02,0xfe,0x00,0x7c,0x84,0x82,0x01,0x00,0x10,0x80,0x28,0x80,0x44,0x80,
+0x82,0x00,0x00,0x80,0x44,0x01,0xaa,0x92,0x81,0x82,0x08,0x00,0x82,0x44,0x28,0x10,
+0x28,0x44,0x82,0x00,0x82,0x10,0x0c,0x28,0x44,0x82,0x00,0xfe,0x40,0x20,0x10,0x08,
+0x04,0xfe,0x00,0x38,0x83,0x20,0x0a,0x38,0x00,0x02,0x04,0x08,0x10,0x20,0x40,0x80,
+0x00,0x38,0x83,0x08,0x00,0x38,0x83,0x00,0x04,0x44,0x28,0x10,0x00,0x7c,0x89,0x00,
+0x09,0x08,0x10,0x20,0x00,0x7a,0x86,0x82,0x7e,0x02,0xfc,0x80,0x00,0x00,0xfc,0x81,
+0x82,0x00,0xfc,0x80,0x80,0x01,0x00,0x7e,0x81,0x80,0x00,0x7e,0x81,0x00,0x00,0x7e,
+0x81,0x82,0x00,0x7e,0x80,0x02,0x05,0x00,0x7e,0x80,0xfe,0x82,0x7c,0x81,0x00,0x81,
+0x10,0x00,0x3c,0x80,0x10,0x03,0x1c,0xfc,0x02,0xfe,0x80,0x82,0x00,0x7e,0x81,0x00,
+0x81,0x82,0x01,0x84,0xf8,0x80,0x80,0x00,0x00,0x83,0x10,0x03,0x00,0x10,0x38,0x44,
+0x80,0x82,0x80,0x02,0x07,0x00,0x02,0x00,0x86,0x98,0xe0,0x98,0x86,0x80,0x80,0x01,
+0x00,0x38,0x83,0x10,0x01,0x30,0x00,0x82,0x92,0x00,0xec,0x81,0x00,0x81,0x82,0x01,
+0x84,0xf8,0x81,0x00,0x00,0x7c,0x81,0x82,0x00,0x7c,0x80,0x00,0x01,0x80,0xfc,0x81,
+0x82,0x00,0xfc,0x80,0x00,0x01,0x02,0x7e,0x81,0x82,0x00,0x7e,0x81,0x00,0x80,0x80,
+0x02,0xc0,0xa0,0x9e,0x81,0x00,0x04,0xfc,0x02,0x7e,0x80,0x7e,0x81,0x00,0x00,0x3c,
+0x81,0x20,0x00,0xfc,0x80,0x20,0x02,0x00,0x7a,0x86,0x81,0x82,0x81,0x00,0x01,0x10,
+0x28,0x80,0x44,0x00,0x82,0x81,0x00,0x80,0x44,0x02,0xaa,0x92,0x82,0x81,0x00,0x04,
+0xc6,0x28,0x10,0x28,0xc6,0x80,0x00,0x02,0xfc,0x02,0x7e,0x81,0x82,0x81,0x00,0x04,
+0xfe,0x20,0x10,0x08,0xfe,0x81,0x00,0x00,0x18,0x80,0x20,0x00,0x60,0x80,0x20,0x01,
+0x18,0x00,0x85,0x10,0x01,0x00,0x60,0x80,0x10,0x00,0x18,0x80,0x10,0x00,0x60,0x85,
+0x00,0x00,0x7c};
+
+static const unsigned char ysFont8x12Packed[942]={
+0x00,0x00,0x80,0x30,0x00,0x00,0x81,0x20,0x83,0x30,0x87,0x00,0x81,0x28,0x00,0x00,
+0x81,0x28,0x00,0xfe,0x81,0x28,0x00,0xfe,0x81,0x28,0x00,0x00,0x80,0x28,0x00,0xfc,
+0x80,0x2a,0x00,0xfe,0x80,0xa8,0x00,0x7e,0x80,0x28,0x01,0x00,0x8e,0x80,0x4a,0x04,
+0x2e,0x20,0x10,0x08,0xe8,0x80,0xa4,0x03,0xe2,0x00,0x72,0x8c,0x80,0x84,0x03,0x8a,
+0x52,0x20,0x50,0x80,0x48,0x00,0x38,0x87,0x00,0x00,0x20,0x80,0x30,0x02,0x00,0x08,
+0x10,0x80,0x20,0x81,0x40,0x80,0x20,0x04,0x10,0x08,0x00,0x40,0x20,0x80,0x10,0x81,
+0x08,0x80,0x10,0x03,0x20,0x40,0x00,0x10,0x80,0x54,0x04,0x38,0x10,0x7c,0x10,0x38,
+0x80,0x54,0x00,0x10,0x82,0x00,0x80,0x10,0x00,0x7c,0x80,0x10,0x82,0x00,0x00,0x60,
+0x80,0x30,0x8c,0x00,0x00,0x7c,0x85,0x00,0x80,0x30,0x87,0x00,0x00,0x80,0x80,0x40,
+0x80,0x20,0x00,0x10,0x80,0x08,0x80,0x04,0x02,0x02,0x00,0x38,0x80,0x44,0x80,0xa2,
+0x00,0x92,0x80,0x8a,0x80,0x44,0x01,0x38,0x00,0x86,0x10,0x0a,0x50,0x30,0x10,0x00,
+0xfe,0x80,0x40,0x20,0x18,0x04,0x02,0x80,0x82,0x0e,0x44,0x38,0x00,0x38,0x44,0x82,
+0x02,0x04,0x18,0x04,0x02,0x82,0x44,0x38,0x00,0x80,0x04,0x01,0xfe,0x84,0x81,0x44,
+0x80,0x24,0x05,0x14,0x0c,0x00,0x38,0x44,0x82,0x80,0x02,0x01,0x04,0xf8,0x81,0x80,
+0x03,0xfe,0x00,0x38,0x44,0x81,0x82,0x06,0xc4,0xb8,0x80,0x82,0x44,0x38,0x00,0x81,
+0x10,0x81,0x08,0x80,0x04,0x80,0x02,0x03,0xfe,0x00,0x38,0x44,0x80,0x82,0x02,0x44,
+0x38,0x44,0x80,0x82,0x08,0x44,0x38,0x00,0x38,0x44,0x82,0x02,0x3a,0x46,0x81,0x82,
+0x01,0x44,0x38,0x80,0x00,0x80,0x30,0x83,0x00,0x80,0x30,0x80,0x00,0x00,0x60,0x80,
+0x30,0x83,0x00,0x80,0x30,0x81,0x00,0x08,0x04,0x08,0x10,0x20,0x40,0x20,0x10,0x08,
+0x04,0x83,0x00,0x00,0x7c,0x81,0x00,0x00,0x7c,0x83,0x00,0x08,0x40,0x20,0x10,0x08,
+0x04,0x08,0x10,0x20,0x40,0x80,0x00,0x80,0x18,0x00,0x00,0x80,0x10,0x80,0x08,0x81,
+0x44,0x04,0x38,0x00,0x3c,0x40,0x5c,0x81,0x54,0x03,0x5c,0x44,0x48,0x30,0x80,0x00,
+0x81,0x82,0x00,0x7c,0x81,0x44,0x81,0x28,0x03,0x10,0x00,0xf8,0x84,0x80,0x82,0x02,
+0x84,0xf8,0x84,0x80,0x82,0x04,0x84,0xf8,0x00,0x38,0x44,0x80,0x82,0x81,0x80,0x80,
+0x82,0x05,0x44,0x38,0x00,0xf0,0x88,0x84,0x83,0x82,0x04,0x84,0x88,0xf0,0x00,0xfe,
+0x82,0x80,0x00,0xfc,0x82,0x80,0x01,0xfe,0x00,0x83,0x80,0x00,0xfc,0x82,0x80,0x05,
+0xfe,0x00,0x3a,0x46,0x82,0x9e,0x81,0x80,0x80,0x82,0x02,0x44,0x38,0x00,0x83,0x82,
+0x00,0xfe,0x83,0x82,0x01,0x00,0x38,0x87,0x10,0x05,0x38,0x00,0x30,0x48,0x88,0x84,
+0x84,0x04,0x0e,0x0e,0x00,0x82,0x84,0x88,0x90,0xa0,0xc0,0xa0,0x90,0x88,0x84,0x82,
+0x00,0xfe,0x88,0x80,0x00,0x00,0x82,0x82,0x80,0x92,0x80,0xaa,0x80,0xc6,0x02,0x82,
+0x00,0x82,0x80,0x86,0x80,0x8a,0x00,0x92,0x80,0xa2,0x80,0xc2,0x03,0x82,0x00,0x38,
+0x44,0x85,0x82,0x02,0x44,0x38,0x00,0x82,0x80,0x01,0xf8,0x84,0x81,0x82,0x06,0x84,
+0xf8,0x00,0x3a,0x44,0x8a,0x92,0x83,0x82,0x02,0x44,0x38,0x00,0x81,0x82,0x02,0x84,
+0xf8,0x84,0x81,0x82,0x0e,0x84,0xf8,0x00,0x38,0x44,0x82,0x02,0x04,0x38,0x40,0x80,
+0x82,0x44,0x38,0x00,0x88,0x10,0x03,0xfe,0x00,0x38,0x44,0x87,0x82,0x00,0x00,0x80,
+0x10,0x81,0x28,0x81,0x44,0x81,0x82,0x00,0x00,0x81,0x44,0x80,0xaa,0x80,0x92,0x82,
+0x82,0x01,0x00,0x82,0x80,0x44,0x80,0x28,0x00,0x10,0x80,0x28,0x80,0x44,0x01,0x82,
+0x00,0x84,0x10,0x80,0x28,0x80,0x44,0x04,0x82,0x00,0xfe,0x80,0x40,0x80,0x20,0x00,
+0x10,0x80,0x08,0x04,0x04,0x02,0xfe,0x00,0x78,0x87,0x40,0x02,0x78,0x00,0x02,0x80,
+0x04,0x80,0x08,0x00,0x10,0x80,0x20,0x80,0x40,0x02,0x80,0x00,0x78,0x87,0x08,0x00,
+0x78,0x87,0x00,0x04,0x44,0x28,0x10,0x00,0xfe,0x91,0x00,0x02,0x08,0x10,0x20,0x80,
+0x00,0x01,0xfa,0x86,0x80,0x82,0x02,0x7e,0x02,0xfc,0x83,0x00,0x01,0xf8,0x84,0x81,
+0x82,0x01,0x84,0xf8,0x81,0x80,0x80,0x00,0x01,0x3c,0x42,0x81,0x80,0x01,0x42,0x3c,
+0x83,0x00,0x01,0x3e,0x42,0x81,0x82,0x01,0x42,0x3e,0x81,0x02,0x80,0x00,0x00,0x7e,
+0x80,0x80,0x00,0xfe,0x80,0x82,0x00,0x7c,0x83,0x00,0x83,0x20,0x00,0xf8,0x80,0x20,
+0x05,0x10,0x0c,0xfc,0x02,0x7e,0xc2,0x81,0x82,0x01,0x86,0x7a,0x83,0x00,0x82,0x82,
+0x02,0xc2,0xc4,0xb8,0x81,0x80,0x80,0x00,0x00,0x38,0x83,0x10,0x06,0x30,0x00,0x10,
+0x00,0x70,0x88,0x84,0x83,0x04,0x02,0x0c,0x00,0x04,0x81,0x00,0x06,0x86,0x98,0xe0,
+0xa0,0x90,0x88,0x86,0x81,0x80,0x80,0x00,0x00,0x38,0x86,0x10,0x00,0x30,0x80,0x00,
+0x84,0x92,0x00,0xec,0x83,0x00,0x83,0x82,0x01,0xc2,0xbc,0x83,0x00,0x00,0x7c,0x83,
+0x82,0x00,0x7c,0x81,0x00,0x80,0x80,0x00,0xfc,0x83,0x82,0x00,0xfc,0x81,0x00,0x80,
+0x02,0x00,0x7e,0x83,0x82,0x00,0x7c,0x83,0x00,0x82,0x80,0x02,0xc0,0xb0,0x8e,0x83,
+0x00,0x00,0xfc,0x80,0x02,0x00,0x7e,0x80,0x80,0x00,0x7e,0x83,0x00,0x00,0x18,0x83,
+0x20,0x00,0x78,0x80,0x20,0x81,0x00,0x01,0x7a,0x86,0x83,0x82,0x83,0x00,0x00,0x10,
+0x80,0x28,0x80,0x44,0x80,0x82,0x83,0x00,0x00,0x44,0x80,0xaa,0x80,0x92,0x80,0x82,
+0x83,0x00,0x06,0x82,0x44,0x28,0x10,0x28,0x44,0x82,0x81,0x00,0x00,0xfc,0x80,0x02,
+0x01,0x7a,0x86,0x82,0x82,0x83,0x00,0x06,0xfe,0x40,0x20,0x10,0x08,0x04,0xfe,0x82,
+0x00,0x00,0x18,0x82,0x20,0x00,0x40,0x82,0x20,0x01,0x18,0x00,0x89,0x10,0x01,0x00,
+0x60,0x82,0x10,0x00,0x08,0x82,0x10,0x00,0x60,0x88,0x00,0x01,0x48,0x36};
+
+static const unsigned char ysFont12x16Packed[1949]={
+0x81,0x00,0x02,0x0c,0x00,0xc0,0x81,0x00,0x0e,0x08,0x00,0x80,0x08,0x00,0xc0,0x0c,
+0x00,0xc0,0x0e,0x00,0xe0,0x0e,0x00,0xe0,0x90,0x00,0x1d,0x22,0x02,0x20,0x33,0x03,
+0x30,0x00,0x01,0x10,0x11,0x01,0x10,0x11,0x07,0xfc,0x11,0x01,0x10,0x11,0x01,0x10,
+0x11,0x07,0xfc,0x11,0x01,0x10,0x11,0x01,0x10,0x80,0x00,0x1f,0xa0,0x0a,0x01,0xf0,
+0x2a,0x84,0xa4,0x4a,0x40,0xa8,0x1f,0x02,0xa0,0x4a,0x44,0xa4,0x2a,0x81,0xf0,0x0a,
+0x00,0xa0,0x00,0x08,0x18,0x42,0x44,0x42,0x24,0x21,0x24,0x09,0x80,0x80,0x23,0x04,
+0x00,0x20,0x32,0x04,0x90,0x84,0x88,0x44,0x48,0x43,0x02,0x00,0x03,0xc0,0x42,0x28,
+0x14,0x80,0x88,0x14,0x42,0x22,0x20,0x14,0x00,0x80,0x14,0x02,0x20,0x21,0x02,0x10,
+0x11,0x00,0xe0,0x90,0x00,0x05,0x08,0x00,0x80,0x0c,0x00,0xc0,0x80,0x00,0x2c,0x10,
+0x02,0x00,0x40,0x04,0x00,0x80,0x08,0x01,0x00,0x10,0x01,0x00,0x08,0x00,0x80,0x04,
+0x00,0x40,0x02,0x00,0x10,0x00,0x01,0x00,0x08,0x00,0x40,0x04,0x00,0x20,0x02,0x00,
+0x10,0x01,0x00,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x08,0x01,0x81,0x00,0x13,0x40,
+0x44,0x42,0x48,0x24,0x81,0x50,0x0e,0x00,0x40,0x7f,0xc0,0x40,0x0e,0x01,0x50,0x24,
+0x82,0x48,0x44,0x80,0x40,0x84,0x00,0x0c,0x04,0x00,0x40,0x04,0x00,0x40,0x7f,0xc0,
+0x40,0x04,0x00,0x40,0x04,0x84,0x00,0x05,0x01,0x00,0x18,0x00,0xc0,0x0c,0x9b,0x00,
+0x01,0x7f,0xc0,0x8d,0x00,0x01,0xc0,0x0c,0x90,0x00,0x16,0x08,0x00,0x40,0x04,0x00,
+0x20,0x01,0x00,0x08,0x00,0x80,0x04,0x00,0x20,0x02,0x00,0x10,0x00,0x80,0x04,0x00,
+0x40,0x02,0x80,0x00,0x5d,0xe0,0x11,0x02,0x08,0x40,0x44,0x04,0x80,0x28,0x02,0x80,
+0x28,0x02,0x80,0x24,0x04,0x40,0x42,0x08,0x11,0x00,0xe0,0x00,0x01,0xe0,0x04,0x00,
+0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x01,0x40,
+0x0c,0x00,0x40,0x00,0x0f,0xfe,0x40,0x02,0x00,0x10,0x00,0x80,0x04,0x00,0x20,0x01,
+0x00,0x08,0x00,0x48,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x00,0x01,0xf0,0x20,0x84,
+0x04,0x80,0x28,0x02,0x00,0x20,0x04,0x03,0x80,0x04,0x00,0x28,0x02,0x80,0x24,0x04,
+0x20,0x81,0xf0,0x80,0x00,0x45,0x10,0x01,0x0f,0xfe,0x81,0x08,0x10,0x41,0x04,0x10,
+0x21,0x02,0x10,0x11,0x00,0x90,0x09,0x00,0x50,0x05,0x00,0x30,0x00,0x01,0xf0,0x20,
+0x84,0x04,0x80,0x20,0x02,0x00,0x20,0x04,0x00,0x8f,0xf0,0x80,0x08,0x00,0x80,0x08,
+0x00,0x80,0x0f,0xfe,0x00,0x01,0xf0,0x20,0x84,0x04,0x80,0x28,0x02,0x80,0x28,0x02,
+0xc0,0x4a,0x08,0x9f,0x08,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x80,0x00,0x45,0x80,
+0x08,0x00,0x80,0x04,0x00,0x40,0x02,0x00,0x20,0x01,0x00,0x10,0x00,0x80,0x08,0x00,
+0x40,0x04,0x00,0x2f,0xfe,0x00,0x01,0xf0,0x20,0x84,0x04,0x80,0x28,0x02,0x80,0x24,
+0x04,0x3f,0x84,0x04,0x80,0x28,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x00,0x01,0xf0,
+0x20,0x84,0x04,0x80,0x20,0x02,0x00,0x23,0xfa,0x40,0x68,0x02,0x80,0x28,0x02,0x80,
+0x24,0x04,0x20,0x81,0xf0,0x83,0x00,0x01,0xc0,0x0c,0x88,0x00,0x01,0xc0,0x0c,0x84,
+0x00,0x05,0x03,0x00,0x18,0x00,0xc0,0x0c,0x88,0x00,0x01,0xc0,0x0c,0x87,0x00,0x12,
+0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x01,0x00,0x08,0x00,0x40,0x02,0x00,
+0x10,0x00,0x80,0x88,0x00,0x01,0x3f,0x80,0x82,0x00,0x01,0x3f,0x80,0x88,0x00,0x12,
+0x20,0x01,0x00,0x08,0x00,0x40,0x02,0x00,0x10,0x00,0x80,0x10,0x02,0x00,0x40,0x08,
+0x01,0x00,0x20,0x82,0x00,0x01,0x60,0x06,0x80,0x00,0x11,0x04,0x00,0x40,0x04,0x00,
+0x20,0x01,0x00,0x08,0x20,0x42,0x04,0x20,0x41,0x08,0x09,0x00,0x60,0x81,0x00,0x0f,
+0x3f,0xc4,0x00,0x4e,0xc5,0x14,0x51,0x45,0x14,0x51,0x44,0xe4,0x40,0x42,0x08,0x1f,
+0x84,0x00,0x4a,0x08,0x02,0x80,0x24,0x04,0x40,0x44,0x04,0x20,0x83,0xf8,0x20,0x81,
+0x10,0x11,0x00,0xa0,0x0a,0x00,0xa0,0x04,0x00,0x40,0x00,0x0f,0xf0,0x80,0x88,0x04,
+0x80,0x28,0x02,0x80,0x28,0x04,0xff,0x88,0x04,0x80,0x28,0x02,0x80,0x28,0x04,0x80,
+0x8f,0xf0,0x00,0x01,0xf0,0x20,0x84,0x04,0x80,0x28,0x02,0x80,0x08,0x00,0x80,0x08,
+0x00,0x80,0x08,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x00,0x0f,0xc0,0x83,0x80,0x08,
+0x71,0x80,0x48,0x04,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x04,0x80,0x48,0x08,
+0x83,0x0f,0xc0,0x00,0x0f,0xfe,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0xff,
+0xc8,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x0f,0xfe,0x00,0x08,0x00,0x80,0x08,
+0x00,0x80,0x08,0x00,0x80,0x08,0x00,0xff,0x88,0x00,0x80,0x08,0x00,0x80,0x08,0x00,
+0x80,0x0f,0xfe,0x00,0x01,0xf2,0x20,0xa4,0x06,0x80,0x28,0x02,0x83,0xe8,0x00,0x80,
+0x08,0x00,0x80,0x08,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x00,0x08,0x02,0x80,0x28,
+0x02,0x80,0x28,0x02,0x80,0x28,0x02,0xff,0xe8,0x02,0x80,0x28,0x02,0x80,0x28,0x02,
+0x80,0x28,0x02,0x80,0x00,0x40,0xe0,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,
+0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0xe0,0x00,0x01,0xe0,0x21,
+0x04,0x08,0x40,0x88,0x04,0x80,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,
+0x04,0x00,0x40,0x0e,0x00,0x08,0x02,0x80,0x48,0x08,0x81,0x08,0x20,0x84,0x08,0x80,
+0xf0,0x08,0x80,0x84,0x08,0x20,0x81,0x80,0x08,0x19,0x80,0x48,0x02,0x00,0x0f,0xfe,
+0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,
+0x08,0x00,0x80,0x08,0x80,0x00,0x7f,0x08,0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x80,
+0x28,0x42,0x84,0x28,0xa2,0x8a,0x29,0x12,0xa0,0xac,0x06,0xc0,0x68,0x02,0x00,0x08,
+0x02,0x80,0x68,0x06,0x80,0xa8,0x12,0x82,0x28,0x22,0x84,0x28,0x82,0x88,0x29,0x02,
+0xa0,0x2c,0x02,0xc0,0x28,0x02,0x00,0x01,0xf0,0x20,0x84,0x04,0x80,0x28,0x02,0x80,
+0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x00,0x08,
+0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x0f,0xf0,0x80,0x88,0x04,0x80,0x28,0x02,
+0x80,0x28,0x04,0x80,0x8f,0xf0,0x00,0x01,0xf2,0x20,0xc4,0x0c,0x41,0x48,0x22,0x84,
+0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x40,0x44,0x04,0x20,0x81,0xf0,0x00,0x08,
+0x02,0x80,0x48,0x08,0x80,0x88,0x10,0x26,0x82,0x0f,0xf0,0x80,0x88,0x04,0x80,0x28,
+0x02,0x80,0x28,0x04,0x80,0x8f,0xf0,0x00,0x01,0xf0,0x20,0x84,0x04,0x80,0x28,0x02,
+0x00,0x40,0x08,0x1f,0x02,0x00,0x40,0x08,0x02,0x80,0x24,0x04,0x20,0x81,0xf0,0x80,
+0x00,0x15,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,
+0x00,0x40,0x04,0x00,0x40,0x04,0x0f,0xfe,0x81,0x00,0x14,0x1f,0x02,0x08,0x40,0x48,
+0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,
+0x81,0x00,0x1e,0x04,0x00,0x40,0x0a,0x00,0xa0,0x11,0x01,0x10,0x11,0x02,0x08,0x20,
+0x82,0x08,0x40,0x44,0x04,0x80,0x28,0x02,0x00,0x02,0x08,0x20,0x83,0x18,0x31,0x84,
+0xa4,0x4a,0x82,0x44,0x21,0x04,0x40,0x44,0x04,0x80,0x28,0x02,0x80,0x28,0x02,0x00,
+0x08,0x02,0x40,0x44,0x04,0x20,0x81,0x10,0x0a,0x00,0xa0,0x04,0x00,0xa0,0x0a,0x01,
+0x10,0x20,0x84,0x04,0x40,0x48,0x02,0x80,0x00,0x45,0x40,0x04,0x00,0x40,0x04,0x00,
+0x40,0x04,0x00,0x40,0x04,0x00,0xa0,0x0a,0x01,0x10,0x20,0x84,0x04,0x40,0x48,0x02,
+0x00,0x0f,0xfe,0x80,0x04,0x00,0x20,0x01,0x00,0x08,0x00,0x80,0x04,0x00,0x20,0x02,
+0x00,0x10,0x00,0x80,0x04,0x00,0x2f,0xfe,0x00,0x01,0xf0,0x10,0x01,0x00,0x10,0x01,
+0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0xf0,
+0x80,0x00,0x14,0x02,0x00,0x40,0x04,0x00,0x80,0x10,0x02,0x00,0x20,0x04,0x00,0x80,
+0x08,0x01,0x00,0x20,0x04,0x00,0x40,0x08,0x80,0x00,0x13,0x01,0xf0,0x01,0x00,0x10,
+0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x80,
+0x01,0x00,0xf0,0x90,0x00,0x08,0x20,0x81,0x10,0x0a,0x00,0x40,0x00,0x0f,0xfe,0xa5,
+0x00,0x04,0x02,0x00,0x40,0x08,0x01,0x82,0x00,0x0c,0x7e,0x28,0x14,0x80,0x84,0x08,
+0x3f,0x80,0x08,0x80,0x84,0x08,0x3f,0x89,0x00,0x13,0xbf,0x8c,0x04,0x80,0x28,0x02,
+0x80,0x28,0x02,0x80,0x2c,0x04,0xbf,0x88,0x00,0x80,0x08,0x00,0x80,0x08,0x82,0x00,
+0x0d,0x3f,0x84,0x04,0x80,0x28,0x00,0x80,0x08,0x00,0x80,0x24,0x04,0x3f,0x80,0x88,
+0x00,0x14,0x3f,0xa4,0x06,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x24,0x06,0x3f,0xa0,
+0x02,0x00,0x20,0x02,0x00,0x20,0x02,0x81,0x00,0x0d,0x3f,0xc4,0x02,0x80,0x08,0x00,
+0xff,0xe8,0x02,0x80,0x24,0x04,0x3f,0x80,0x88,0x00,0x24,0x08,0x00,0x80,0x08,0x00,
+0x80,0x08,0x00,0x80,0x08,0x03,0xf0,0x08,0x00,0x80,0x08,0x00,0x80,0x04,0x00,0x30,
+0x7f,0x08,0x0c,0x00,0x23,0xe2,0x41,0xa8,0x06,0x80,0x28,0x02,0x80,0x66,0x0a,0x1f,
+0x89,0x00,0x13,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x2c,0x02,0xa0,0x49,0x08,0x8f,
+0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x82,0x00,0x0c,0x0e,0x00,0x40,0x04,0x00,0x40,
+0x04,0x00,0x40,0x04,0x00,0x40,0x0c,0x80,0x00,0x00,0x04,0x83,0x00,0x03,0x1c,0x02,
+0x20,0x41,0x80,0x08,0x80,0x80,0x08,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x01,0x80,
+0x80,0x00,0x00,0x80,0x85,0x00,0x13,0x80,0x68,0x18,0x86,0x09,0x80,0xe0,0x09,0x80,
+0x86,0x08,0x18,0x80,0x68,0x00,0x80,0x08,0x00,0x80,0x08,0x82,0x00,0x14,0x1e,0x00,
+0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,
+0x04,0x01,0xc0,0x81,0x00,0x0d,0x84,0x28,0x42,0x84,0x28,0x42,0x84,0x28,0x42,0x84,
+0x2c,0x44,0xbb,0x80,0x88,0x00,0x0d,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x28,0x02,
+0x80,0x2c,0x04,0xbf,0x80,0x88,0x00,0x0d,0x3f,0x84,0x04,0x80,0x28,0x02,0x80,0x28,
+0x02,0x80,0x24,0x04,0x3f,0x80,0x85,0x00,0x10,0x80,0x08,0x00,0x80,0x0f,0xf8,0x80,
+0x48,0x02,0x80,0x28,0x02,0x80,0x28,0x04,0xff,0x80,0x86,0x00,0x0f,0x20,0x02,0x00,
+0x23,0xfa,0x40,0x68,0x02,0x80,0x28,0x02,0x80,0x24,0x06,0x3f,0xa0,0x88,0x00,0x0d,
+0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x0c,0x00,0xb0,0x08,0xc2,0x83,0xc0,0x88,0x00,
+0x0d,0xff,0x80,0x04,0x00,0x20,0x02,0x7f,0xc8,0x00,0x80,0x04,0x00,0x3f,0xe0,0x88,
+0x00,0x10,0x07,0x00,0x80,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x7f,0x01,
+0x00,0x10,0x01,0x85,0x00,0x0d,0x3f,0xa4,0x06,0x80,0x28,0x02,0x80,0x28,0x02,0x80,
+0x28,0x02,0x80,0x20,0x88,0x00,0x0d,0x04,0x00,0xa0,0x0a,0x01,0x10,0x11,0x02,0x08,
+0x40,0x44,0x04,0x80,0x20,0x88,0x00,0x0d,0x40,0x44,0x04,0xa0,0xa9,0x12,0x8a,0x28,
+0x42,0x84,0x28,0x02,0x80,0x20,0x88,0x00,0x0d,0xc0,0x62,0x08,0x11,0x00,0xa0,0x04,
+0x00,0xa0,0x11,0x02,0x08,0xc0,0x60,0x85,0x00,0x10,0xff,0x80,0x04,0x00,0x21,0xf2,
+0x20,0xa4,0x06,0x80,0x28,0x02,0x80,0x28,0x02,0x80,0x20,0x88,0x00,0x0d,0xff,0xe4,
+0x00,0x30,0x00,0x80,0x04,0x00,0x20,0x01,0x80,0x04,0xff,0xe0,0x87,0x00,0x15,0x30,
+0x04,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x38,0x00,0x80,0x08,0x00,0x80,0x08,
+0x00,0x80,0x04,0x00,0x30,0x80,0x00,0x2c,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,
+0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,0x03,
+0x00,0x08,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0x00,0x40,0x04,0x00,0x40,
+0x04,0x00,0x40,0x08,0x03,0x92,0x00,0x04,0x04,0x30,0x24,0x81,0x84};
+
+static const unsigned char ysFont16x20Packed[3233]={
+0x82,0x00,0x02,0x06,0x00,0x06,0x81,0x00,0x1d,0x04,0x00,0x04,0x00,0x04,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,
+0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x9a,0x00,0x0b,0x08,0x80,0x08,0x80,0x08,0x80,
+0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x80,0x00,0x25,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+0x20,0x08,0x20,0x7f,0xfc,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
+0x20,0x08,0x20,0x7f,0xfc,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x80,
+0x00,0x09,0x04,0x40,0x04,0x40,0x1f,0xf0,0x34,0x58,0x64,0x4c,0x80,0x44,0x0b,0x04,
+0x44,0x04,0x4c,0x04,0x58,0x1f,0xf0,0x34,0x40,0x64,0x40,0x80,0x44,0x09,0x64,0x4c,
+0x34,0x58,0x1f,0xf0,0x04,0x40,0x04,0x40,0x82,0x00,0x25,0x80,0x30,0xc0,0x78,0x60,
+0xcc,0x21,0x86,0x31,0x02,0x19,0x86,0x0c,0xcc,0x04,0x78,0x06,0x30,0x03,0x00,0x19,
+0x80,0x3c,0xc0,0x66,0x40,0xc3,0x60,0x81,0x30,0xc3,0x18,0x66,0x08,0x3c,0x0c,0x18,
+0x06,0x80,0x00,0x24,0x0f,0x00,0x19,0x86,0x30,0xcc,0x60,0x78,0xc0,0x10,0x80,0x3c,
+0xc0,0x66,0x60,0x42,0x30,0xc0,0x19,0x80,0x0f,0x00,0x06,0x00,0x0f,0x00,0x19,0x80,
+0x10,0x80,0x10,0x80,0x18,0x80,0x0d,0x80,0x07,0x9b,0x00,0x0a,0x02,0x00,0x02,0x00,
+0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x84,0x00,0x22,0xc0,0x01,0x80,0x01,0x00,0x03,
+0x00,0x02,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x06,
+0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0xc0,0x82,0x00,0x22,
+0x06,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,
+0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xc0,0x00,0x80,0x00,0x80,0x01,0x80,0x01,0x00,
+0x03,0x00,0x06,0x81,0x00,0x24,0x01,0x00,0x21,0x08,0x31,0x18,0x11,0x10,0x19,0x30,
+0x0d,0x60,0x05,0x40,0x07,0xc0,0x01,0x00,0x3f,0xf8,0x01,0x00,0x07,0xc0,0x05,0x40,
+0x0d,0x60,0x19,0x30,0x11,0x10,0x31,0x18,0x21,0x08,0x01,0x89,0x00,0x14,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x3f,0xf8,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x8b,0x00,0x09,0x0c,0x00,0x06,0x00,0x03,0x80,0x03,0x80,0x03,0x80,
+0xac,0x00,0x01,0x3f,0xf8,0x98,0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0x9a,0x00,
+0x25,0x80,0x00,0xc0,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x04,
+0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x40,0x00,0x60,0x00,0x30,0x00,
+0x18,0x00,0x08,0x00,0x0c,0x00,0x06,0x80,0x00,0x0f,0x03,0x80,0x06,0xc0,0x04,0x40,
+0x0c,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x18,0x30,0x84,0x10,0x0f,0x18,0x30,0x08,
+0x20,0x08,0x20,0x08,0x20,0x0c,0x60,0x04,0x40,0x06,0xc0,0x03,0x80,0x80,0x00,0x24,
+0x07,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x07,0x00,0x03,0x00,0x01,0x81,0x00,0x19,0x1f,0xf0,0x10,0x00,0x18,0x00,0x08,0x00,
+0x0c,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x20,
+0x00,0x30,0x80,0x10,0x09,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,0xc0,0x03,0x80,0x80,
+0x00,0x09,0x03,0x80,0x06,0xc0,0x0c,0x60,0x08,0x20,0x18,0x30,0x80,0x10,0x0d,0x00,
+0x30,0x00,0x60,0x00,0xc0,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x80,0x10,0x09,
+0x18,0x30,0x08,0x20,0x0c,0x60,0x06,0xc0,0x03,0x80,0x81,0x00,0x24,0x40,0x00,0x40,
+0x00,0x40,0x00,0x40,0x1f,0xf0,0x10,0x40,0x18,0x40,0x08,0x40,0x0c,0x40,0x04,0x40,
+0x04,0x40,0x06,0x40,0x02,0x40,0x02,0x40,0x03,0x40,0x01,0x40,0x01,0x40,0x01,0xc0,
+0x00,0xc0,0x80,0x00,0x25,0x07,0x80,0x0c,0xc0,0x18,0x60,0x00,0x30,0x00,0x10,0x00,
+0x10,0x00,0x10,0x00,0x30,0x00,0x60,0x01,0xc0,0x1f,0x00,0x10,0x00,0x10,0x00,0x10,
+0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x1f,0xf0,0x80,0x00,0x09,0x03,0x80,
+0x06,0xc0,0x0c,0x60,0x08,0x20,0x18,0x30,0x85,0x10,0x08,0x30,0x1c,0x60,0x17,0xc0,
+0x10,0x00,0x10,0x00,0x80,0x10,0x09,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,0xc0,0x03,
+0x80,0x80,0x00,0x25,0x04,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x02,0x00,0x03,0x00,
+0x01,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x00,0x60,
+0x00,0x20,0x00,0x20,0x00,0x30,0x00,0x10,0x1f,0xf0,0x80,0x00,0x25,0x03,0x80,0x06,
+0xc0,0x0c,0x60,0x08,0x20,0x18,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,0xc0,0x03,
+0x80,0x06,0xc0,0x0c,0x60,0x08,0x20,0x18,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,
+0xc0,0x03,0x80,0x80,0x00,0x09,0x03,0x80,0x06,0xc0,0x0c,0x60,0x08,0x20,0x18,0x30,
+0x80,0x10,0x0a,0x00,0x10,0x03,0x90,0x06,0xd0,0x0c,0x70,0x08,0x30,0x18,0x83,0x10,
+0x09,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,0xc0,0x03,0x80,0x86,0x00,0x05,0x03,0x80,
+0x03,0x80,0x03,0x80,0x8a,0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0x8a,0x00,0x09,
+0x0c,0x00,0x06,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x8a,0x00,0x05,0x03,0x80,0x03,
+0x80,0x03,0x80,0x89,0x00,0x24,0x10,0x00,0x30,0x00,0x60,0x00,0xc0,0x01,0x80,0x03,
+0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,0x00,0x03,
+0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x00,0x10,0x8c,0x00,0x01,0x3f,0xf0,
+0x88,0x00,0x01,0x3f,0xf0,0x8c,0x00,0x24,0x20,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,
+0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x00,0x60,0x00,0xc0,
+0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x30,0x00,0x20,0x83,0x00,0x03,
+0x01,0x80,0x01,0x80,0x82,0x00,0x1b,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x80,0x00,0xc0,0x00,0x60,0x00,0x20,0x10,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x06,
+0xc0,0x03,0x80,0x82,0x00,0x16,0x0f,0xf8,0x18,0x00,0x30,0x00,0x23,0xb8,0x26,0xe8,
+0x24,0x48,0x24,0x48,0x26,0x48,0x23,0xc8,0x20,0xc8,0x27,0x88,0x30,0x80,0x18,0x04,
+0x30,0x0c,0x60,0x07,0xc0,0x86,0x00,0x0d,0x80,0x02,0xc0,0x06,0x40,0x04,0x60,0x0c,
+0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x10,0x14,0x1f,0xf0,0x18,0x30,0x08,0x20,0x0c,
+0x60,0x04,0x40,0x04,0x40,0x06,0xc0,0x02,0x80,0x02,0x80,0x03,0x80,0x01,0x81,0x00,
+0x25,0xff,0xe0,0x80,0x38,0x80,0x0c,0x80,0x06,0x80,0x02,0x80,0x02,0x80,0x06,0x80,
+0x0c,0x80,0x38,0xff,0xe0,0x80,0x38,0x80,0x0c,0x80,0x06,0x80,0x02,0x80,0x02,0x80,
+0x06,0x80,0x0c,0x80,0x38,0xff,0xe0,0x80,0x00,0x03,0x03,0xc0,0x0e,0x70,0x80,0x18,
+0x19,0x30,0x0c,0x20,0x04,0x60,0x06,0x40,0x02,0xc0,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0xc0,0x00,0x40,0x02,0x60,0x06,0x20,0x04,0x30,0x0c,0x80,0x18,0x03,0x0e,0x70,
+0x03,0xc0,0x80,0x00,0x00,0xff,0x80,0x80,0x22,0xe0,0x80,0x30,0x80,0x18,0x80,0x08,
+0x80,0x0c,0x80,0x04,0x80,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x80,0x04,
+0x80,0x0c,0x80,0x08,0x80,0x18,0x80,0x30,0x80,0xe0,0xff,0x80,0x80,0x00,0x25,0xff,
+0xfe,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0xff,0xfc,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0xff,0xfe,0x80,0x00,0x25,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xf0,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xfe,0x80,0x00,
+0x1f,0x03,0xc2,0x0e,0x72,0x18,0x1a,0x30,0x0e,0x20,0x06,0x60,0x02,0x40,0x02,0xc0,
+0x7e,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x02,0x60,0x06,0x20,0x04,0x30,
+0x0c,0x80,0x18,0x03,0x0e,0x70,0x03,0xc0,0x80,0x00,0x25,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xff,0xfe,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x00,0x25,0x03,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x80,0x80,0x00,0x04,0x07,0x00,0x1d,
+0xc0,0x30,0x80,0x60,0x1e,0x30,0xc0,0x10,0x80,0x18,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x1c,0x80,0x00,0x1a,0x80,0x06,0x80,0x1c,0x80,0x30,0x80,0xe0,0x81,
+0x80,0x83,0x00,0x8e,0x00,0x98,0x00,0xb0,0x00,0xf0,0x00,0x98,0x00,0x8c,0x00,0x86,
+0x00,0x83,0x80,0x80,0x08,0xc0,0x80,0x70,0x80,0x18,0x80,0x0c,0x80,0x06,0x80,0x00,
+0x24,0xff,0xfe,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x81,0x00,0x25,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x81,0x02,0x83,0x82,0x86,0xc2,0x8c,
+0x62,0x88,0x22,0x98,0x32,0xb0,0x1a,0xa0,0x0a,0xe0,0x0e,0xc0,0x06,0x80,0x02,0x80,
+0x00,0x25,0x80,0x02,0x80,0x06,0x80,0x0e,0x80,0x1a,0x80,0x32,0x80,0x62,0x80,0x42,
+0x80,0xc2,0x81,0x82,0x81,0x02,0x83,0x02,0x86,0x02,0x8c,0x02,0x98,0x02,0xb0,0x02,
+0xa0,0x02,0xe0,0x02,0xc0,0x02,0x80,0x02,0x80,0x00,0x25,0x07,0xc0,0x1c,0x70,0x30,
+0x18,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x40,0x04,0x60,0x0c,0x30,0x18,0x1c,0x70,0x07,
+0xc0,0x80,0x00,0x25,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0xff,0xc0,0x80,0x70,0x80,0x18,0x80,0x0c,0x80,0x04,0x80,0x06,0x80,0x06,
+0x80,0x04,0x80,0x0c,0x80,0x18,0x80,0x70,0xff,0xc0,0x80,0x00,0x25,0x07,0xc2,0x1c,
+0x76,0x30,0x1c,0x60,0x1c,0x40,0x34,0xc0,0x66,0x80,0xc2,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x40,0x04,0x60,0x0c,0x30,0x18,0x1c,
+0x70,0x07,0xc0,0x80,0x00,0x25,0x80,0x02,0x80,0x06,0x80,0x0c,0x80,0x18,0x80,0x30,
+0x80,0x60,0x80,0xc0,0xff,0xc0,0x80,0x70,0x80,0x18,0x80,0x0c,0x80,0x06,0x80,0x02,
+0x80,0x02,0x80,0x06,0x80,0x0c,0x80,0x18,0x80,0x70,0xff,0xc0,0x80,0x00,0x25,0x0f,
+0xf0,0x38,0x18,0x60,0x0c,0xc0,0x06,0x80,0x02,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,
+0x18,0x1f,0xf0,0x30,0x00,0x60,0x00,0xc0,0x00,0xc0,0x00,0x40,0x02,0x60,0x06,0x30,
+0x0c,0x1c,0x38,0x07,0xe0,0x80,0x00,0x25,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,0xfe,0x80,0x00,
+0x25,0x1f,0xf0,0x30,0x18,0x60,0x0c,0xc0,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x00,0x13,0x01,0x00,0x03,0x80,0x02,0x80,
+0x06,0xc0,0x04,0x40,0x04,0x40,0x0c,0x60,0x08,0x20,0x18,0x20,0x10,0x30,0x80,0x10,
+0x0f,0x30,0x18,0x20,0x08,0x20,0x08,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x02,0x80,
+0x02,0x80,0x00,0x82,0x10,0x80,0x38,0x1f,0x2c,0x68,0x24,0x48,0x24,0x48,0x26,0xc8,
+0x22,0x88,0x63,0x8c,0x41,0x04,0x41,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0xc0,0x06,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x00,0x08,0x80,0x02,0xc0,0x06,0x60,
+0x0c,0x20,0x08,0x30,0x80,0x18,0x0f,0x30,0x0c,0x60,0x06,0xc0,0x02,0x80,0x03,0x80,
+0x02,0x80,0x06,0xc0,0x0c,0x60,0x18,0x80,0x30,0x08,0x18,0x20,0x08,0x60,0x0c,0xc0,
+0x06,0x80,0x02,0x80,0x00,0x1a,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x80,0x06,0xc0,0x04,0x40,0x0c,0x60,
+0x18,0x80,0x30,0x08,0x18,0x20,0x08,0x60,0x0c,0xc0,0x06,0x80,0x02,0x80,0x00,0x25,
+0xff,0xfe,0xc0,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,0x00,
+0x03,0x00,0x01,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x00,0x10,0x00,0x18,
+0x00,0x0c,0x00,0x06,0xff,0xfe,0x82,0x00,0x23,0x07,0xc0,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x07,0xc0,0x81,0x00,0x23,
+0x06,0x00,0x0c,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x40,0x00,0xc0,0x01,
+0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x18,0x00,0x30,0x00,0x20,
+0x00,0x60,0x00,0xc0,0x83,0x00,0x23,0x07,0xc0,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x07,0xc0,0x9c,0x00,0x08,0x18,0x30,
+0x0c,0x60,0x06,0xc0,0x03,0x80,0x01,0x81,0x00,0x01,0xff,0xfe,0xc1,0x00,0x07,0xc0,
+0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x83,0x00,0x19,0x7f,0xf2,0x80,0x0a,0x80,0x06,
+0x80,0x02,0x80,0x02,0x80,0x02,0x60,0x02,0x1f,0xfe,0x00,0x02,0x00,0x04,0x00,0x04,
+0xc0,0x18,0x3f,0xe0,0x8e,0x00,0x20,0x8f,0xe0,0xb8,0x38,0xe0,0x0c,0x80,0x04,0x80,
+0x06,0x80,0x02,0x80,0x02,0x80,0x06,0x80,0x04,0xe0,0x0c,0xb8,0x38,0x8f,0xe0,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x83,0x00,0x19,0x0f,0xf0,0x38,0x1c,0x60,
+0x06,0xc0,0x02,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x02,0x60,
+0x06,0x38,0x1c,0x0f,0xf0,0x8c,0x00,0x23,0x0f,0xe2,0x38,0x3a,0x60,0x0e,0xc0,0x06,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x60,0x0e,0x38,0x3a,
+0x0f,0xe2,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x82,0x00,0x15,0x0f,
+0xf0,0x38,0x1c,0x60,0x06,0xc0,0x02,0x80,0x00,0x80,0x00,0xff,0xfe,0x80,0x02,0x80,
+0x02,0xc0,0x06,0x60,0x0c,0x80,0x38,0x01,0x0f,0xe0,0x8c,0x00,0x41,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x1f,0xe0,0x04,0x00,0x04,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x01,
+0xe0,0xff,0xf8,0x00,0x0c,0x00,0x06,0x00,0x02,0x3f,0xfe,0x60,0x02,0xc0,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x60,0x0e,0x3f,0xfa,0x8c,
+0x00,0x22,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,
+0x80,0x06,0xc0,0x04,0xe0,0x0c,0xb0,0x18,0x9c,0x70,0x87,0xc0,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x83,0x00,0x18,0x07,0x80,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x07,0x81,0x00,0x02,0x03,0x00,0x03,0x85,0x00,0x01,0x3f,0xc0,0x80,0x60,0x17,0xc0,
+0x30,0x80,0x10,0x00,0x18,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x08,0x00,0x08,0x00,0x38,0x81,0x00,0x02,0x18,0x00,0x18,0x86,0x00,0x10,
+0x80,0x0e,0x80,0x38,0x80,0xe0,0x83,0x80,0xee,0x00,0xb8,0x00,0x8c,0x00,0x87,0x00,
+0x81,0x80,0x80,0x0f,0xe0,0x80,0x30,0x80,0x1c,0x80,0x06,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x83,0x00,0x22,0x07,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x07,0x83,0x00,0x19,0x81,0x02,0x81,
+0x02,0x81,0x02,0x81,0x02,0x81,0x02,0x81,0x02,0x81,0x02,0x81,0x02,0x81,0x02,0xc1,
+0x82,0xe1,0xc6,0xb1,0x64,0x9f,0x3c,0x8c,0x00,0x19,0x80,0x02,0x80,0x02,0x80,0x02,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0xe0,0x0c,
+0xb0,0x18,0x9f,0xf0,0x8c,0x00,0x19,0x07,0xc0,0x1c,0x70,0x30,0x18,0x60,0x0c,0xc0,
+0x06,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x60,0x0c,0x30,0x18,0x1c,0x70,0x07,
+0xc0,0x88,0x00,0x1d,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xf0,0x80,0x1c,
+0x80,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x80,0x1c,
+0xff,0xf0,0x89,0x00,0x1c,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x1f,0xfe,0x70,0x02,
+0xc0,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xc0,0x02,0x70,0x0e,
+0x1f,0xfa,0x8c,0x00,0x16,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0xc0,0x00,0xe0,0x00,0xb0,0x00,0x98,0x00,0x8e,0x00,0x83,0x80,0x80,0x00,0xfe,
+0x8c,0x00,0x19,0x1f,0xf0,0x70,0x1c,0xc0,0x06,0x80,0x02,0x00,0x06,0x00,0x7c,0x07,
+0xc0,0x7c,0x00,0xc0,0x00,0x80,0x02,0xc0,0x06,0x70,0x1c,0x1f,0xf0,0x8c,0x00,0x20,
+0x01,0xe0,0x03,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x3f,0xe0,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x85,0x00,0x19,0x0f,0xf2,0x10,0x0a,0x20,0x06,0x20,0x06,0x40,0x02,0x40,0x02,
+0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0xc0,0x02,0x8c,0x00,
+0x0c,0x01,0x00,0x03,0x80,0x06,0xc0,0x04,0x40,0x0c,0x60,0x18,0x20,0x10,0x80,0x30,
+0x0a,0x18,0x20,0x08,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x02,0x8c,0x00,0x82,0x10,
+0x80,0x38,0x80,0x28,0x11,0x2c,0x68,0x24,0x48,0x66,0xcc,0x43,0x84,0x41,0x04,0x40,
+0x04,0xc0,0x06,0x80,0x02,0x80,0x02,0x8c,0x00,0x04,0xc0,0x06,0x60,0x0c,0x30,0x80,
+0x18,0x0b,0x30,0x0c,0x60,0x06,0xc0,0x03,0x80,0x06,0xc0,0x0c,0x60,0x18,0x80,0x30,
+0x04,0x18,0x60,0x0c,0xc0,0x06,0x88,0x00,0x1d,0xff,0xf0,0x00,0x18,0x00,0x0c,0x07,
+0x84,0x1c,0xe6,0x30,0x32,0x60,0x1a,0x40,0x0e,0xc0,0x06,0x80,0x06,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x8c,0x00,0x19,0xff,0xfe,0x60,0x00,0x30,0x00,
+0x18,0x00,0x0c,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,
+0x00,0x18,0xff,0xfe,0x8d,0x00,0x22,0xc0,0x03,0x80,0x02,0x00,0x06,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x1c,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x06,0x00,0x02,0x00,0x03,0x80,0x00,0xc0,0x82,0x00,0x22,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x83,0x00,0x22,0x06,0x00,0x03,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x00,0x40,0x00,
+0x40,0x00,0x40,0x00,0x40,0x00,0x70,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0xc0,0x00,0x80,0x03,0x80,0x06,0x9f,0x00,0x07,0x20,0x70,0x30,0xd8,0x19,0x8c,0x0f,
+0x04};
+
+static const unsigned char ysFont16x24Packed[3708]={
+0x82,0x00,0x04,0x07,0x00,0x07,0x00,0x07,0x83,0x00,0x21,0x06,0x00,0x06,0x00,0x06,
+0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x07,
+0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0xa2,0x00,0x0b,
+0x08,0x80,0x08,0x80,0x08,0x80,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x82,0x00,0x2b,0x08,
+0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x7f,0xfc,0x08,0x20,0x08,
+0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x7f,0xfc,0x08,
+0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x82,0x00,0x27,0x02,0x40,
+0x02,0x40,0x02,0x40,0x0f,0xf0,0x1a,0x58,0x32,0x4c,0x22,0x44,0x02,0x44,0x02,0x4c,
+0x02,0x58,0x0f,0xf0,0x1a,0x40,0x32,0x40,0x22,0x40,0x22,0x44,0x32,0x4c,0x1a,0x58,
+0x0f,0xf0,0x02,0x40,0x02,0x40,0x86,0x00,0x2b,0x80,0x70,0xc0,0xd8,0x61,0x8c,0x33,
+0x06,0x12,0x02,0x1b,0x06,0x09,0x8c,0x0c,0xd8,0x06,0x70,0x03,0x00,0x01,0x00,0x01,
+0x80,0x00,0x80,0x1c,0xc0,0x36,0x60,0x63,0x20,0xc1,0xb0,0x80,0x98,0xc1,0x8c,0x63,
+0x04,0x36,0x06,0x1c,0x02,0x82,0x00,0x0f,0x0f,0x02,0x19,0x86,0x30,0xcc,0x60,0x78,
+0xc0,0x30,0x80,0x38,0x80,0x6c,0x80,0x44,0x80,0xc0,0x14,0x60,0x80,0x31,0x80,0x1b,
+0x00,0x0e,0x00,0x0e,0x00,0x1b,0x00,0x31,0x80,0x20,0x80,0x31,0x80,0x1b,0x00,0x0e,
+0xa7,0x00,0x0a,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x84,0x00,
+0x2a,0x20,0x00,0x60,0x00,0x40,0x00,0xc0,0x00,0x80,0x01,0x80,0x01,0x00,0x01,0x00,
+0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x00,
+0x01,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x00,0x60,0x00,0x20,0x82,0x00,0x2a,0x02,
+0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x00,0x40,0x00,
+0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0x40,0x00,
+0xc0,0x00,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x83,0x00,0x2a,0x01,0x00,0x31,
+0x18,0x11,0x10,0x19,0x30,0x09,0x20,0x0d,0x60,0x05,0x40,0x07,0xc0,0x03,0x80,0x01,
+0x00,0x3f,0xf8,0x01,0x00,0x03,0x80,0x07,0xc0,0x05,0x40,0x0d,0x60,0x09,0x20,0x19,
+0x30,0x11,0x10,0x31,0x18,0x01,0x00,0x01,0x8d,0x00,0x14,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x3f,0xf8,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x8f,0x00,0x09,0x0e,0x00,0x07,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0xb8,0x00,0x01,
+0x3f,0xf8,0x9c,0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0xa6,0x00,0x14,0x80,0x00,
+0xc0,0x00,0x40,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x06,0x00,
+0x02,0x00,0x01,0x80,0x00,0x12,0x80,0x00,0xc0,0x00,0x40,0x00,0x20,0x00,0x30,0x00,
+0x18,0x00,0x08,0x00,0x04,0x00,0x06,0x00,0x02,0x82,0x00,0x09,0x03,0x80,0x06,0xc0,
+0x0c,0x60,0x08,0x20,0x18,0x30,0x82,0x10,0x0f,0x30,0x18,0x20,0x08,0x20,0x08,0x20,
+0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x30,0x18,0x82,0x10,0x09,0x18,0x30,0x08,0x20,
+0x0c,0x60,0x06,0xc0,0x03,0x80,0x82,0x00,0x2a,0x07,0xc0,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x0d,0x00,0x07,
+0x00,0x03,0x00,0x01,0x83,0x00,0x23,0x3f,0xf8,0x20,0x00,0x30,0x00,0x10,0x00,0x18,
+0x00,0x0c,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0x80,0x00,0xc0,0x00,
+0x60,0x00,0x20,0x00,0x30,0x00,0x18,0x20,0x08,0x30,0x18,0x80,0x10,0x05,0x18,0x30,
+0x0e,0xe0,0x03,0x80,0x82,0x00,0x04,0x03,0x80,0x0e,0xe0,0x18,0x80,0x30,0x1c,0x10,
+0x20,0x18,0x20,0x08,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x60,0x01,0xc0,
+0x00,0x60,0x00,0x30,0x00,0x18,0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x10,0x05,0x18,
+0x30,0x0e,0xe0,0x03,0x80,0x83,0x00,0x0a,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x3f,0xf8,0x82,0x20,0x1b,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x04,0x20,
+0x04,0x20,0x02,0x20,0x02,0x20,0x01,0x20,0x01,0x20,0x00,0xa0,0x00,0xa0,0x00,0x60,
+0x00,0x60,0x82,0x00,0x04,0x03,0x80,0x0e,0xe0,0x18,0x80,0x30,0x24,0x10,0x20,0x18,
+0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x60,
+0x3f,0xc0,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x3f,0xf8,0x82,0x00,0x04,0x03,0x80,0x0e,0xe0,0x18,0x80,0x30,0x1c,0x10,0x20,0x18,
+0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x30,0x18,0x38,0x30,0x2c,0x60,
+0x27,0xc0,0x20,0x00,0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x10,0x05,0x18,0x30,0x0e,
+0xe0,0x03,0x80,0x82,0x00,0x2b,0x08,0x00,0x08,0x00,0x0c,0x00,0x04,0x00,0x06,0x00,
+0x02,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,
+0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x08,
+0x3f,0xf8,0x82,0x00,0x05,0x03,0x80,0x0e,0xe0,0x18,0x30,0x80,0x10,0x08,0x30,0x18,
+0x20,0x08,0x20,0x08,0x20,0x08,0x30,0x80,0x18,0x07,0x30,0x0c,0x60,0x07,0xc0,0x0c,
+0x60,0x18,0x80,0x30,0x06,0x18,0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x10,0x05,0x18,
+0x30,0x0e,0xe0,0x03,0x80,0x82,0x00,0x05,0x03,0x80,0x0e,0xe0,0x18,0x30,0x80,0x10,
+0x1b,0x30,0x18,0x20,0x08,0x20,0x08,0x00,0x08,0x07,0xc8,0x0c,0x68,0x18,0x38,0x10,
+0x18,0x30,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x10,0x05,
+0x18,0x30,0x0e,0xe0,0x03,0x80,0x86,0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0x90,
+0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0x8c,0x00,0x09,0x0c,0x00,0x06,0x00,0x03,
+0x80,0x03,0x80,0x03,0x80,0x90,0x00,0x05,0x03,0x80,0x03,0x80,0x03,0x80,0x8d,0x00,
+0x28,0x08,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,
+0x0c,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,0x00,0x03,0x00,0x01,0x80,
+0x00,0xc0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x08,0x92,0x00,0x01,0x3f,0xf8,0x88,
+0x00,0x01,0x3f,0xf8,0x92,0x00,0x28,0x20,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,
+0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x30,0x00,
+0x60,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x30,0x00,0x20,
+0x87,0x00,0x02,0x03,0x00,0x03,0x83,0x00,0x18,0x02,0x00,0x02,0x00,0x02,0x00,0x03,
+0x00,0x01,0x80,0x00,0xe0,0x00,0x30,0x00,0x10,0x00,0x18,0x20,0x08,0x20,0x08,0x30,
+0x08,0x10,0x80,0x18,0x04,0x30,0x0c,0x60,0x07,0xc0,0x86,0x00,0x0a,0x0f,0xf8,0x18,
+0x00,0x30,0x00,0x23,0xd8,0x26,0x78,0x2c,0x83,0x28,0x05,0x2c,0x28,0x26,0x28,0x23,
+0xe8,0x80,0x28,0x04,0x2c,0x68,0x27,0xc8,0x30,0x80,0x18,0x02,0x30,0x0f,0xe0,0x8a,
+0x00,0x11,0x80,0x02,0xc0,0x06,0x40,0x04,0x40,0x04,0x60,0x0c,0x20,0x08,0x20,0x08,
+0x30,0x18,0x1f,0xf0,0x80,0x10,0x16,0x18,0x30,0x08,0x20,0x08,0x20,0x0c,0x60,0x04,
+0x40,0x04,0x40,0x06,0xc0,0x02,0x80,0x02,0x80,0x03,0x80,0x01,0x00,0x01,0x83,0x00,
+0x2b,0xff,0xe0,0x80,0x38,0x80,0x0c,0x80,0x04,0x80,0x06,0x80,0x06,0x80,0x04,0x80,
+0x0c,0x80,0x18,0x80,0x70,0xff,0xc0,0x80,0x70,0x80,0x18,0x80,0x0c,0x80,0x04,0x80,
+0x06,0x80,0x06,0x80,0x04,0x80,0x0c,0x80,0x18,0x80,0x70,0xff,0xc0,0x82,0x00,0x03,
+0x03,0xc0,0x0e,0x70,0x80,0x18,0x1f,0x30,0x0c,0x20,0x04,0x60,0x06,0x40,0x02,0x40,
+0x02,0xc0,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x02,0x40,
+0x02,0x60,0x06,0x20,0x04,0x30,0x0c,0x80,0x18,0x03,0x0e,0x70,0x03,0xc0,0x82,0x00,
+0x2b,0xff,0xc0,0x80,0x70,0x80,0x18,0x80,0x08,0x80,0x0c,0x80,0x06,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x06,0x80,0x04,0x80,0x0c,0x80,0x18,0x80,0x70,0xff,0xc0,0x82,0x00,0x2b,
+0xff,0xfe,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xfc,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xfe,0x82,0x00,0x2b,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0xff,0xf0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xfe,0x82,0x00,0x25,0x03,0xc2,
+0x0e,0x72,0x18,0x1a,0x30,0x0e,0x20,0x06,0x60,0x06,0x40,0x02,0x40,0x02,0xc0,0x7e,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x02,0x40,0x02,0x60,0x06,
+0x20,0x04,0x30,0x0c,0x80,0x18,0x03,0x0e,0x70,0x03,0xc0,0x82,0x00,0x2b,0x80,0x02,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,
+0x80,0x02,0x80,0x02,0xff,0xfe,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x82,0x00,0x2b,0x03,0x80,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x80,0x82,0x00,0x04,0x07,0x00,0x1d,0xc0,
+0x30,0x80,0x60,0x24,0x30,0x40,0x10,0xc0,0x18,0x80,0x08,0x80,0x08,0x00,0x0c,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x0e,0x81,0x00,0x21,0x06,0x80,0x0c,0x80,
+0x18,0x80,0x30,0x80,0x60,0x80,0xc0,0x81,0x80,0x83,0x00,0x8e,0x00,0x98,0x00,0xb0,
+0x00,0xe0,0x00,0xb0,0x00,0x98,0x00,0x8c,0x00,0x86,0x00,0x83,0x00,0x81,0x80,0x80,
+0x08,0xe0,0x80,0x30,0x80,0x18,0x80,0x0c,0x80,0x06,0x82,0x00,0x2a,0xff,0xfe,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x83,0x00,0x14,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x81,0x02,0x81,0x02,0x83,
+0x81,0x82,0x13,0x86,0xc2,0x84,0x62,0x8c,0x22,0x98,0x32,0x90,0x1a,0xb0,0x0a,0xe0,
+0x0e,0xc0,0x06,0xc0,0x06,0x80,0x02,0x82,0x00,0x2b,0x80,0x02,0x80,0x06,0x80,0x0e,
+0x80,0x0a,0x80,0x1a,0x80,0x32,0x80,0x22,0x80,0x62,0x80,0xc2,0x80,0x82,0x81,0x82,
+0x83,0x02,0x82,0x02,0x86,0x02,0x8c,0x02,0x88,0x02,0x98,0x02,0xb0,0x02,0xa0,0x02,
+0xe0,0x02,0xc0,0x02,0x80,0x02,0x82,0x00,0x2b,0x07,0xc0,0x1c,0x70,0x30,0x18,0x20,
+0x08,0x60,0x0c,0x40,0x04,0x40,0x04,0xc0,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0x80,0x02,0xc0,0x06,0x40,0x04,0x40,0x04,0x60,0x0c,0x20,0x08,0x30,
+0x18,0x1c,0x70,0x07,0xc0,0x82,0x00,0x2b,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xff,0xc0,0x80,0x70,
+0x80,0x18,0x80,0x0c,0x80,0x04,0x80,0x06,0x80,0x06,0x80,0x04,0x80,0x0c,0x80,0x18,
+0x80,0x70,0xff,0xc0,0x82,0x00,0x2b,0x07,0xc6,0x1c,0x7c,0x30,0x18,0x20,0x38,0x60,
+0x6c,0x40,0xc4,0x41,0x84,0xc0,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
+0x02,0x80,0x02,0xc0,0x06,0x40,0x04,0x40,0x04,0x60,0x0c,0x20,0x08,0x30,0x18,0x1c,
+0x70,0x07,0xc0,0x82,0x00,0x0f,0x80,0x06,0x80,0x0c,0x80,0x0c,0x80,0x18,0x80,0x30,
+0x80,0x20,0x80,0x60,0x80,0xc0,0x80,0x80,0x19,0x81,0x80,0xff,0xc0,0x80,0x70,0x80,
+0x18,0x80,0x0c,0x80,0x04,0x80,0x06,0x80,0x06,0x80,0x04,0x80,0x0c,0x80,0x18,0x80,
+0x70,0xff,0xc0,0x82,0x00,0x2b,0x07,0xf0,0x1c,0x18,0x30,0x0c,0x60,0x06,0x40,0x02,
+0xc0,0x02,0x80,0x02,0x80,0x06,0x00,0x0c,0x00,0x38,0x0f,0xe0,0x38,0x00,0x60,0x00,
+0x40,0x00,0xc0,0x02,0x80,0x02,0xc0,0x06,0x40,0x04,0x60,0x0c,0x30,0x18,0x1c,0x70,
+0x07,0xc0,0x82,0x00,0x2b,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xff,
+0xfe,0x82,0x00,0x2b,0x1f,0xf0,0x30,0x18,0x60,0x0c,0xc0,0x06,0x80,0x02,0x80,0x02,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,
+0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,
+0x82,0x00,0x15,0x01,0x00,0x01,0x00,0x03,0x80,0x02,0x80,0x06,0xc0,0x04,0x40,0x04,
+0x40,0x0c,0x60,0x08,0x20,0x08,0x20,0x18,0x30,0x82,0x10,0x11,0x30,0x18,0x20,0x08,
+0x20,0x08,0x60,0x0c,0x40,0x04,0x40,0x04,0xc0,0x06,0x80,0x02,0x80,0x02,0x82,0x00,
+0x05,0x20,0x08,0x20,0x08,0x30,0x18,0x80,0x38,0x80,0x28,0x02,0x68,0x6c,0x4c,0x81,
+0x44,0x1b,0x46,0xc4,0x42,0x84,0x43,0x84,0x41,0x04,0x41,0x04,0x40,0x04,0x40,0x04,
+0x40,0x04,0xc0,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x82,0x00,
+0x09,0x80,0x02,0xc0,0x06,0x40,0x04,0x60,0x0c,0x30,0x18,0x80,0x10,0x13,0x18,0x30,
+0x0c,0x60,0x04,0x40,0x06,0xc0,0x03,0x80,0x03,0x80,0x06,0xc0,0x04,0x40,0x0c,0x60,
+0x18,0x30,0x80,0x10,0x09,0x30,0x18,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x02,0x82,
+0x00,0x1f,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x80,0x03,0x80,0x06,0xc0,0x04,0x40,0x0c,0x60,
+0x18,0x30,0x80,0x10,0x09,0x30,0x18,0x60,0x0c,0x40,0x04,0xc0,0x06,0x80,0x02,0x82,
+0x00,0x2b,0xff,0xfe,0xc0,0x00,0x40,0x00,0x60,0x00,0x30,0x00,0x10,0x00,0x18,0x00,
+0x0c,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x40,0x00,0x60,
+0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x0c,0x00,0x04,0x00,0x06,0xff,0xfe,0x82,0x00,
+0x2b,0x07,0xe0,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x07,0xe0,0x83,0x00,0x29,
+0x06,0x00,0x0c,0x00,0x0c,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x40,0x00,
+0xc0,0x00,0x80,0x01,0x00,0x01,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x08,0x00,0x18,
+0x00,0x10,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0xc0,0x83,0x00,0x2b,0x07,0xe0,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x07,0xe0,0xa4,0x00,0x08,0x18,0x30,0x0c,0x60,
+0x06,0xc0,0x03,0x80,0x01,0x83,0x00,0x01,0xff,0xfe,0xcf,0x00,0x07,0x80,0x01,0x80,
+0x03,0x00,0x06,0x00,0x0c,0x85,0x00,0x1d,0x3f,0xe6,0x60,0x3c,0xc0,0x04,0x80,0x04,
+0x80,0x04,0x80,0x04,0x80,0x04,0xc0,0x0c,0x60,0x1c,0x30,0x34,0x1f,0xe4,0x80,0x0c,
+0xc0,0x18,0x60,0x30,0x3f,0xe0,0x90,0x00,0x28,0x9f,0xc0,0xf0,0x70,0xc0,0x18,0x80,
+0x0c,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x0c,0xc0,
+0x18,0xf0,0x70,0x9f,0xc0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x85,0x00,0x1d,0x0f,0xc0,0x38,0x70,0x60,0x18,0x40,0x0c,0xc0,0x04,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x04,0x40,0x0c,0x60,0x18,0x38,
+0x70,0x0f,0xc0,0x90,0x00,0x29,0x0f,0xc4,0x38,0x74,0x60,0x1c,0x40,0x0c,0xc0,0x04,
+0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0xc0,0x04,0x40,0x0c,0x60,0x1c,
+0x38,0x74,0x0f,0xc4,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x84,0x00,0x1d,0x0f,0xc0,0x38,0x70,0x60,0x18,0x40,0x0c,0xc0,0x00,0x80,0x00,0x80,
+0x00,0xff,0xfc,0x80,0x04,0x80,0x04,0xc0,0x0c,0x40,0x08,0x60,0x18,0x38,0x70,0x0f,
+0xc0,0x90,0x00,0x4d,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x1f,0xe0,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x01,0xe0,0x3f,0xf0,
+0x60,0x18,0xc0,0x0c,0x80,0x04,0x00,0x04,0x00,0x04,0x3f,0xf4,0x60,0x1c,0xc0,0x0c,
+0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0xc0,0x04,0x60,0x1c,0x38,0x34,
+0x0f,0xe0,0x90,0x00,0x28,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,
+0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0xc0,0x0c,0xe0,0x18,0xb0,
+0x30,0x9f,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x85,0x00,
+0x1c,0x07,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x07,0x83,0x00,
+0x02,0x03,0x00,0x03,0x83,0x00,0x03,0x07,0x80,0x1c,0xe0,0x80,0x30,0x1d,0x60,0x18,
+0xc0,0x08,0x80,0x0c,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x1c,0x83,0x00,0x02,0x0c,
+0x00,0x0c,0x88,0x00,0x28,0x80,0x1c,0x80,0x30,0x80,0x60,0x81,0xc0,0x83,0x00,0xe6,
+0x00,0xbc,0x00,0x98,0x00,0x8c,0x00,0x86,0x00,0x83,0x00,0x81,0xc0,0x80,0x60,0x80,
+0x38,0x80,0x0c,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x85,0x00,
+0x28,0x07,0xc0,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x07,0x85,0x00,0x1a,0x82,0x04,0x82,
+0x04,0x82,0x04,0x82,0x04,0x82,0x04,0x82,0x04,0x82,0x04,0x82,0x04,0x82,0x04,0x82,
+0x04,0x82,0x04,0xc2,0x04,0xe7,0x0c,0xbd,0x80,0x98,0x00,0xf0,0x90,0x00,0x1d,0x80,
+0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,
+0x04,0x80,0x04,0x80,0x04,0xc0,0x0c,0xe0,0x18,0xb0,0x30,0x9f,0xe0,0x90,0x00,0x1d,
+0x0f,0xc0,0x38,0x70,0x60,0x18,0x40,0x08,0xc0,0x0c,0x80,0x04,0x80,0x04,0x80,0x04,
+0x80,0x04,0x80,0x04,0xc0,0x0c,0x40,0x08,0x60,0x18,0x38,0x70,0x0f,0xc0,0x8a,0x00,
+0x23,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xbf,0xf0,0xe0,0x18,0xc0,0x0c,0x80,
+0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0xc0,
+0x0c,0xe0,0x18,0xbf,0xf0,0x8b,0x00,0x22,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x3f,
+0xf4,0x60,0x1c,0xc0,0x0c,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,
+0x04,0x80,0x04,0x80,0x04,0xc0,0x0c,0x60,0x1c,0x3f,0xf4,0x90,0x00,0x1d,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0xc0,0x00,0xe0,0x00,0xb8,0x00,0x8e,0x0c,0x83,0xf8,0x90,0x00,0x1d,0xff,
+0xf0,0x00,0x18,0x00,0x0c,0x00,0x04,0x00,0x04,0x00,0x0c,0x00,0x18,0x3f,0xf0,0x60,
+0x00,0xc0,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0x60,0x00,0x3f,0xfc,0x90,0x00,0x24,
+0x01,0xe0,0x03,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x3f,0xe0,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x89,0x00,0x1d,0x3f,0xf4,0x60,0x1c,0x40,0x0c,0xc0,0x0c,
+0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,
+0x80,0x04,0x80,0x04,0x80,0x04,0x90,0x00,0x0d,0x03,0x00,0x07,0x80,0x04,0x80,0x0c,
+0xc0,0x08,0x40,0x18,0x60,0x10,0x20,0x80,0x30,0x0d,0x20,0x10,0x60,0x18,0x40,0x08,
+0xc0,0x0c,0x80,0x04,0x80,0x04,0x80,0x04,0x90,0x00,0x09,0x40,0x08,0x60,0x18,0x70,
+0x38,0x50,0x28,0x58,0x68,0x80,0x48,0x80,0xcc,0x80,0x84,0x0d,0x87,0x84,0x83,0x04,
+0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x80,0x04,0x90,0x00,0x03,0xc0,0x0c,0x60,
+0x18,0x80,0x30,0x11,0x10,0x20,0x18,0x60,0x0c,0xc0,0x07,0x80,0x03,0x00,0x07,0x80,
+0x0c,0xc0,0x18,0x40,0x10,0x60,0x80,0x30,0x03,0x60,0x18,0xc0,0x0c,0x8a,0x00,0x23,
+0xff,0x80,0x00,0xe0,0x00,0x30,0x00,0x18,0x00,0x08,0x0f,0x88,0x18,0xcc,0x30,0x64,
+0x20,0x34,0x60,0x1c,0x40,0x0c,0x40,0x04,0xc0,0x04,0x80,0x04,0x80,0x04,0x80,0x04,
+0x80,0x04,0x80,0x04,0x90,0x00,0x1d,0xff,0xfc,0xc0,0x00,0x60,0x00,0x30,0x00,0x18,
+0x00,0x0c,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xc0,0x00,0x60,0x00,0x30,0x00,
+0x18,0x00,0x0c,0xff,0xfc,0x8f,0x00,0x2a,0xe0,0x01,0x80,0x03,0x00,0x02,0x00,0x02,
+0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x1c,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x01,
+0x80,0x00,0xe0,0x82,0x00,0x2a,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x83,0x00,0x2a,0x07,0x00,0x01,0x80,0x00,0xc0,0x00,0x40,0x00,0x40,0x00,0x40,
+0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x38,0x00,0x20,0x00,0x20,
+0x00,0x20,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xc0,0x01,0x80,0x07,0xa5,
+0x00,0x09,0x20,0x60,0x30,0xf0,0x18,0x98,0x0d,0x8c,0x07,0x04};
+
+static const unsigned char ysFont20x28Packed[5640]={
+0x83,0x00,0x06,0x01,0xc0,0x00,0x1c,0x00,0x01,0xc0,0x84,0x00,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x0c,
+0x80,0x00,0x20,0xc0,0x00,0x1c,0x00,0x01,0xc0,0x00,0x1c,0x00,0x01,0xe0,0x00,0x1e,
+0x00,0x01,0xe0,0x00,0x1e,0x00,0x01,0xe0,0x00,0x1e,0x00,0x01,0xe0,0x00,0x1e,0x00,
+0x01,0xe0,0x00,0x1e,0xb4,0x00,0x0f,0x22,0x00,0x02,0x20,0x00,0x22,0x00,0x03,0x30,
+0x00,0x33,0x00,0x03,0x30,0x00,0x33,0x87,0x00,0x80,0x40,0x80,0x04,0x00,0x00,0x80,
+0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x02,0x3f,0xff,
+0x80,0x80,0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x80,
+0x04,0x00,0x00,0x80,0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x02,0x3f,0xff,0x80,0x80,
+0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x80,0x04,0x00,0x00,0x80,0x40,0x80,0x04,0x86,
+0x00,0x3d,0x01,0x10,0x00,0x11,0x00,0x03,0xf8,0x00,0xf1,0xe0,0x19,0x13,0x03,0x11,
+0x18,0x21,0x10,0x82,0x11,0x08,0x01,0x10,0x80,0x11,0x18,0x01,0x13,0x00,0x11,0x60,
+0x03,0xf8,0x00,0xd1,0x00,0x19,0x10,0x03,0x11,0x00,0x21,0x10,0x02,0x11,0x08,0x21,
+0x10,0x83,0x11,0x18,0x19,0x13,0x00,0xf1,0xe0,0x03,0xf8,0x00,0x11,0x00,0x01,0x10,
+0x86,0x00,0x06,0xc0,0x00,0x06,0x00,0xe0,0x60,0x1b,0x80,0x03,0x80,0x18,0x04,0x60,
+0xc0,0x84,0x04,0x0c,0x80,0x40,0x0a,0x46,0x0c,0x06,0x31,0x80,0x31,0xb0,0x01,0x8e,
+0x00,0x08,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x0a,0x30,0x01,0xc1,0x00,0x36,
+0x18,0x06,0x30,0x80,0xc1,0x8c,0x80,0x08,0x0f,0x60,0x80,0x82,0x0c,0x18,0x30,0x63,
+0x01,0x83,0x60,0x0c,0x1c,0x00,0xc0,0x00,0x06,0x83,0x00,0x2f,0x0f,0xf0,0x01,0x81,
+0x84,0x30,0x0c,0xc6,0x00,0x78,0xc0,0x03,0x08,0x00,0x38,0x80,0x06,0xcc,0x00,0xc4,
+0x60,0x08,0x03,0x01,0x80,0x18,0x10,0x00,0xc3,0x00,0x06,0x20,0x00,0x36,0x00,0x01,
+0xc0,0x00,0x1c,0x00,0x03,0x60,0x00,0x63,0x00,0x0c,0x18,0x00,0x80,0x80,0x80,0x08,
+0x06,0x00,0xc1,0x80,0x06,0x30,0x00,0x3e,0xb9,0x00,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0xc0,0x00,0x0c,0x80,0x00,0x02,0xc0,0x00,0x0c,0x85,0x00,
+0x02,0x10,0x00,0x03,0x80,0x00,0x02,0x60,0x00,0x0c,0x80,0x00,0x04,0x80,0x00,0x18,
+0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x03,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,
+0x02,0x60,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x06,0x80,0x00,0x02,0x20,0x00,0x02,
+0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x08,0x80,
+0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x02,0x30,0x00,0x01,0x84,0x00,0x00,0x01,0x80,
+0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x02,0x20,0x00,0x03,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x0c,0x80,0x00,0x09,0x80,0x00,
+0x08,0x00,0x01,0x80,0x00,0x10,0x00,0x01,0x80,0x00,0x02,0x30,0x00,0x02,0x80,0x00,
+0x07,0x60,0x00,0x0c,0x00,0x01,0x80,0x00,0x10,0x85,0x00,0x11,0x40,0x00,0x84,0x20,
+0x04,0x44,0x00,0x44,0x40,0x02,0x48,0x00,0x24,0x80,0x01,0x50,0x00,0x15,0x80,0x00,
+0x02,0xe0,0x00,0x0e,0x80,0x00,0x07,0x40,0x00,0x04,0x00,0x1f,0xff,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x0e,0x80,0x00,0x16,0xe0,0x00,0x15,0x00,0x01,0x50,0x00,0x24,
+0x80,0x02,0x48,0x00,0x44,0x40,0x04,0x44,0x00,0x84,0x20,0x00,0x40,0x00,0x04,0x94,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x07,0x40,0x00,
+0x04,0x00,0x1f,0xff,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x00,0x40,0x95,0x00,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x03,
+0x80,0x00,0x05,0x1c,0x00,0x01,0xc0,0x00,0x1c,0xd4,0x00,0x01,0x1f,0xff,0xac,0x00,
+0x05,0x1c,0x00,0x01,0xc0,0x00,0x1c,0xb6,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x02,
+0x40,0x00,0x02,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,
+0x40,0x00,0x06,0x80,0x00,0x02,0x20,0x00,0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x02,0x20,0x00,0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,
+0xc0,0x00,0x04,0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,
+0x80,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x84,0x00,0x0b,0xf0,0x00,0x19,0x80,
+0x03,0x0c,0x00,0x20,0x40,0x02,0x04,0x00,0x80,0x60,0x22,0x04,0x02,0x00,0x40,0x20,
+0x04,0x02,0x00,0xc0,0x30,0x08,0x01,0x00,0x80,0x10,0x08,0x01,0x00,0x80,0x10,0x08,
+0x01,0x00,0x80,0x10,0x0c,0x03,0x00,0x40,0x20,0x04,0x02,0x00,0x40,0x20,0x80,0x06,
+0x0b,0x00,0x20,0x40,0x02,0x04,0x00,0x30,0xc0,0x01,0x98,0x00,0x0f,0x84,0x00,0x03,
+0x03,0xf0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x07,0x40,0x00,0x04,
+0x00,0x03,0x40,0x00,0x1c,0x80,0x00,0x02,0xc0,0x00,0x04,0x84,0x00,0x02,0x1f,0xfe,
+0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x0c,0x80,0x00,0x02,0x60,0x00,
+0x02,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x08,0x80,0x00,0x02,0xc0,0x00,0x06,
+0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x0c,0x80,
+0x00,0x0d,0xc0,0x10,0x06,0x01,0x00,0x20,0x10,0x02,0x01,0x80,0x60,0x08,0x04,0x00,
+0x80,0xc0,0x03,0x06,0x18,0x00,0x3f,0x84,0x00,0x15,0x03,0xe0,0x00,0x63,0x00,0x0c,
+0x18,0x00,0x80,0xc0,0x18,0x04,0x01,0x00,0x60,0x10,0x02,0x01,0x00,0x20,0x00,0x06,
+0x80,0x00,0x09,0xc0,0x00,0x08,0x00,0x01,0x80,0x00,0x30,0x00,0x0e,0x80,0x00,0x05,
+0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x0d,0xc0,0x10,0x06,0x01,0x00,0x20,0x10,
+0x02,0x01,0x80,0x60,0x08,0x04,0x00,0x80,0xc0,0x03,0x06,0x18,0x00,0x3f,0x85,0x00,
+0x02,0x10,0x00,0x01,0x80,0x00,0x05,0x10,0x00,0x01,0x00,0x1f,0xfe,0x80,0x01,0x00,
+0x00,0x80,0x10,0x1a,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x00,0x04,0x10,0x00,0x41,
+0x00,0x04,0x10,0x00,0x21,0x00,0x02,0x10,0x00,0x21,0x00,0x01,0x10,0x00,0x11,0x80,
+0x00,0x02,0x90,0x00,0x09,0x80,0x00,0x02,0x90,0x00,0x05,0x80,0x00,0x02,0x50,0x00,
+0x05,0x80,0x00,0x02,0x30,0x00,0x03,0x84,0x00,0x15,0x03,0xe0,0x00,0x63,0x00,0x0c,
+0x18,0x00,0x80,0xc0,0x18,0x04,0x01,0x00,0x60,0x10,0x02,0x01,0x00,0x20,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x60,0x00,0x0c,0x80,0x00,0x08,0x80,
+0x00,0x18,0x00,0x03,0x00,0x1f,0xe0,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,
+0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x04,0x10,0x00,0x01,
+0xff,0xe0,0x83,0x00,0x2a,0x03,0xe0,0x00,0x63,0x00,0x0c,0x18,0x00,0x80,0xc0,0x18,
+0x04,0x01,0x00,0x60,0x10,0x02,0x01,0x00,0x20,0x10,0x02,0x01,0x00,0x20,0x10,0x02,
+0x01,0x80,0x60,0x1c,0x0c,0x01,0x40,0x80,0x16,0x18,0x01,0x33,0x00,0x11,0xe0,0x01,
+0x80,0x00,0x12,0x10,0x02,0x01,0x80,0x20,0x08,0x06,0x00,0xc0,0x40,0x04,0x0c,0x00,
+0x60,0x80,0x03,0x18,0x00,0x1f,0x84,0x00,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x03,
+0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x06,0x80,0x00,0x02,0x20,
+0x00,0x02,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x05,
+0x60,0x00,0x02,0x01,0xff,0xe0,0x83,0x00,0x04,0x03,0xf0,0x00,0x61,0x80,0x80,0x0c,
+0x11,0x00,0x80,0x40,0x18,0x06,0x01,0x00,0x20,0x10,0x02,0x01,0x00,0x20,0x18,0x06,
+0x00,0x80,0x40,0x80,0x0c,0x0c,0x00,0x61,0x80,0x03,0x30,0x00,0x1e,0x00,0x03,0x30,
+0x00,0x61,0x80,0x80,0x0c,0x0f,0x00,0x80,0x40,0x18,0x06,0x01,0x00,0x20,0x10,0x02,
+0x01,0x80,0x60,0x08,0x04,0x00,0x80,0xc0,0x03,0x06,0x18,0x00,0x3f,0x84,0x00,0x04,
+0x03,0xf0,0x00,0x61,0x80,0x80,0x0c,0x0e,0x00,0x80,0x40,0x18,0x06,0x01,0x00,0x20,
+0x10,0x02,0x01,0x00,0x20,0x00,0x02,0x80,0x00,0x21,0x20,0x01,0xe2,0x00,0x33,0x20,
+0x06,0x1a,0x00,0xc0,0xe0,0x08,0x06,0x01,0x80,0x60,0x10,0x02,0x01,0x00,0x20,0x10,
+0x02,0x01,0x00,0x20,0x10,0x02,0x01,0x80,0x60,0x08,0x04,0x00,0x80,0xc0,0x03,0x06,
+0x18,0x00,0x3f,0x8c,0x00,0x05,0x1c,0x00,0x01,0xc0,0x00,0x1c,0x9d,0x00,0x06,0x01,
+0xc0,0x00,0x1c,0x00,0x01,0xc0,0x90,0x00,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x03,
+0x80,0x00,0x05,0x1c,0x00,0x01,0xc0,0x00,0x1c,0x9d,0x00,0x06,0x01,0xc0,0x00,0x1c,
+0x00,0x01,0xc0,0x91,0x00,0x00,0x01,0x80,0x00,0x02,0x30,0x00,0x06,0x80,0x00,0x04,
+0xc0,0x00,0x18,0x00,0x03,0x80,0x00,0x09,0x60,0x00,0x0c,0x00,0x01,0x80,0x00,0x30,
+0x00,0x06,0x80,0x00,0x02,0xc0,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,
+0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x02,0x60,0x00,0x03,0x80,0x00,0x00,
+0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x02,0x30,0x00,0x01,0x9c,0x00,0x02,
+0x01,0xff,0xf0,0x8a,0x00,0x02,0x01,0xff,0xf0,0x9c,0x00,0x00,0x08,0x80,0x00,0x02,
+0xc0,0x00,0x06,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x02,0x60,
+0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x07,0x30,
+0x00,0x01,0x80,0x00,0x30,0x00,0x06,0x80,0x00,0x04,0xc0,0x00,0x18,0x00,0x03,0x80,
+0x00,0x09,0x60,0x00,0x0c,0x00,0x01,0x80,0x00,0x30,0x00,0x06,0x80,0x00,0x02,0xc0,
+0x00,0x08,0x88,0x00,0x02,0xc0,0x00,0x0c,0x80,0x00,0x00,0xc0,0x84,0x00,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x60,
+0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x04,0x20,
+0x00,0x03,0x01,0x00,0x80,0x10,0x80,0x01,0x0d,0x80,0x30,0x08,0x02,0x00,0xc0,0x60,
+0x06,0x0c,0x00,0x3b,0x80,0x00,0xe0,0x89,0x00,0x02,0x1f,0xf8,0x07,0x80,0x00,0x2e,
+0xc0,0x00,0x18,0x00,0x01,0x0f,0xb8,0x11,0x8e,0x81,0x30,0x68,0x12,0x02,0x81,0x20,
+0x28,0x12,0x02,0x81,0x30,0x68,0x11,0x8e,0x81,0x0f,0xa8,0x12,0x02,0x81,0x30,0x68,
+0x11,0xfc,0x81,0x00,0x08,0x18,0x00,0x80,0xc0,0x18,0x07,0x03,0x00,0x1f,0xe0,0x8d,
+0x00,0x12,0x80,0x00,0x2c,0x00,0x06,0x40,0x00,0x44,0x00,0x04,0x60,0x00,0xc2,0x00,
+0x08,0x30,0x01,0x81,0x00,0x80,0x10,0x80,0x01,0x09,0xff,0xf0,0x08,0x02,0x00,0x80,
+0x20,0x0c,0x06,0x00,0x80,0x40,0x80,0x04,0x10,0x00,0x60,0xc0,0x02,0x08,0x00,0x20,
+0x80,0x03,0x18,0x00,0x11,0x00,0x01,0xb0,0x00,0x0a,0x80,0x00,0x02,0xa0,0x00,0x0e,
+0x80,0x00,0x02,0x40,0x00,0x04,0x84,0x00,0x21,0xff,0xf8,0x08,0x00,0xe0,0x80,0x03,
+0x08,0x00,0x18,0x80,0x00,0x88,0x00,0x0c,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0xc8,
+0x00,0x08,0x80,0x01,0x88,0x00,0x30,0x80,0x0e,0x0f,0xff,0x80,0x80,0x1c,0x0e,0x08,
+0x00,0x30,0x80,0x01,0x88,0x00,0x08,0x80,0x00,0xc8,0x00,0x04,0x80,0x00,0xc8,0x00,
+0x08,0x80,0x01,0x88,0x00,0x30,0x80,0x0e,0x0f,0xff,0x80,0x83,0x00,0x16,0x03,0xfc,
+0x00,0xe0,0x70,0x18,0x01,0x83,0x00,0x0c,0x20,0x00,0x46,0x00,0x06,0x40,0x00,0x24,
+0x00,0x02,0xc0,0x00,0x28,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x13,
+0x40,0x00,0x24,0x00,0x02,0x60,0x00,0x62,0x00,0x04,0x30,0x00,0xc1,0x80,0x18,0x0e,
+0x07,0x00,0x3f,0xc0,0x83,0x00,0x40,0xff,0xf8,0x08,0x00,0xe0,0x80,0x03,0x08,0x00,
+0x18,0x80,0x00,0x88,0x00,0x0c,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0x68,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x00,0x28,0x00,0x06,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0xc8,0x00,0x08,0x80,0x01,
+0x88,0x00,0x30,0x80,0x0e,0x0f,0xff,0x80,0x83,0x00,0x80,0xff,0x00,0xe8,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x07,0x80,
+0x00,0x0f,0xff,0xf8,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x04,0x80,0x00,0x0f,0xff,0xfe,0x83,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x07,0x80,0x00,
+0x0f,0xff,0xe0,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x04,0x80,0x00,0x0f,0xff,0xfe,0x83,0x00,0x1b,0x03,0xfc,0x20,0xe0,0x72,0x18,0x01,
+0xa3,0x00,0x0e,0x20,0x00,0x66,0x00,0x06,0x40,0x00,0x24,0x00,0x02,0xc0,0x00,0x28,
+0x00,0x02,0x80,0x3f,0xe8,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x13,0x40,0x00,0x24,0x00,0x02,0x60,
+0x00,0x62,0x00,0x04,0x30,0x00,0xc1,0x80,0x18,0x0e,0x07,0x00,0x3f,0xc0,0x83,0x00,
+0x40,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x00,0x2f,0xff,0xfe,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,
+0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,
+0x00,0x02,0x83,0x00,0x03,0x01,0xf0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x1f,0x84,0x00,0x05,0x07,0xf0,0x01,0xc1,0xc0,0x30,0x80,0x06,0x0b,0x00,0x30,0x40,
+0x01,0x04,0x00,0x10,0x40,0x01,0x04,0x00,0x18,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x3e,0x83,
+0x00,0x1b,0x80,0x00,0x68,0x00,0x1c,0x80,0x03,0x08,0x00,0xe0,0x80,0x1c,0x08,0x03,
+0x00,0x80,0xe0,0x08,0x18,0x00,0x87,0x00,0x08,0xc0,0x00,0xb8,0x00,0x0f,0x80,0x00,
+0x02,0xc0,0x00,0x0e,0x80,0x00,0x1d,0xb8,0x00,0x08,0xc0,0x00,0x86,0x00,0x08,0x38,
+0x00,0x80,0xc0,0x08,0x06,0x00,0x80,0x18,0x08,0x00,0xc0,0x80,0x02,0x08,0x00,0x18,
+0x80,0x00,0xc8,0x00,0x02,0x83,0x00,0x80,0xff,0x00,0xe8,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x85,0x00,0x26,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x40,0x28,0x04,0x02,0x80,0xe0,0x28,0x0a,0x02,0x81,0xb0,0x28,0x31,0x80,0x82,0x17,
+0x08,0x28,0x60,0xc2,0x8c,0x06,0x29,0x80,0x32,0x90,0x01,0x2b,0x00,0x1a,0xe0,0x00,
+0xec,0x00,0x06,0xc0,0x00,0x68,0x00,0x02,0x83,0x00,0x1b,0x80,0x00,0x28,0x00,0x06,
+0x80,0x00,0xe8,0x00,0x0a,0x80,0x01,0x28,0x00,0x32,0x80,0x02,0x28,0x00,0x42,0x80,
+0x08,0x28,0x01,0x82,0x80,0x10,0x28,0x80,0x02,0x04,0x80,0x40,0x28,0x04,0x02,0x80,
+0x80,0x1b,0x28,0x10,0x02,0x83,0x00,0x28,0x20,0x02,0x84,0x00,0x28,0x80,0x02,0x98,
+0x00,0x29,0x00,0x02,0xa0,0x00,0x2e,0x00,0x02,0xc0,0x00,0x28,0x00,0x02,0x83,0x00,
+0x02,0x03,0xf8,0x00,0x80,0xe0,0x00,0x18,0x80,0x03,0x33,0x00,0x18,0x20,0x00,0x86,
+0x00,0x0c,0x40,0x00,0x44,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,0x80,0x00,0x28,0x00,
+0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x2c,0x00,0x06,
+0x40,0x00,0x44,0x00,0x04,0x60,0x00,0xc2,0x00,0x08,0x30,0x01,0x81,0x80,0x30,0x80,
+0x0e,0x02,0x00,0x3f,0x80,0x83,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x27,0xff,0xf8,0x08,0x00,0xe0,0x80,0x03,0x08,0x00,0x18,
+0x80,0x00,0x88,0x00,0x0c,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0x48,0x00,0x04,0x80,
+0x00,0xc8,0x00,0x08,0x80,0x01,0x88,0x00,0x30,0x80,0x0e,0x0f,0xff,0x80,0x83,0x00,
+0x16,0x03,0xf8,0x60,0xe0,0xec,0x18,0x03,0x83,0x00,0x38,0x20,0x06,0x86,0x00,0x4c,
+0x40,0x0c,0x44,0x01,0x84,0xc0,0x30,0x68,0x80,0x02,0x22,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x2c,0x00,0x06,0x40,
+0x00,0x44,0x00,0x04,0x60,0x00,0xc2,0x00,0x08,0x30,0x01,0x81,0x80,0x30,0x80,0x0e,
+0x02,0x00,0x3f,0x80,0x83,0x00,0x40,0x80,0x00,0x48,0x00,0x0c,0x80,0x00,0x88,0x00,
+0x18,0x80,0x03,0x08,0x00,0x60,0x80,0x04,0x08,0x00,0xc0,0x80,0x18,0x08,0x01,0x00,
+0xff,0xf8,0x08,0x00,0xe0,0x80,0x03,0x08,0x00,0x18,0x80,0x00,0x88,0x00,0x0c,0x80,
+0x00,0x48,0x00,0x04,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0xc8,0x00,0x08,0x80,0x01,
+0x88,0x00,0x30,0x80,0x0e,0x0f,0xff,0x80,0x83,0x00,0x25,0x03,0xfc,0x00,0xe0,0x70,
+0x18,0x01,0x83,0x00,0x0c,0x60,0x00,0x44,0x00,0x06,0xc0,0x00,0x28,0x00,0x06,0x80,
+0x00,0x40,0x00,0x0c,0x00,0x01,0x80,0x00,0x70,0x07,0xfc,0x01,0xc0,0x00,0x30,0x00,
+0x06,0x80,0x00,0x02,0xc0,0x00,0x08,0x80,0x00,0x13,0x80,0x00,0x2c,0x00,0x02,0x40,
+0x00,0x66,0x00,0x04,0x30,0x00,0xc1,0x80,0x18,0x0e,0x07,0x00,0x3f,0xc0,0x84,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x03,0x40,0x0f,0xff,0xfe,0x83,0x00,0x40,
+0x1f,0xff,0x03,0x00,0x18,0x60,0x00,0xc4,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,0x80,
+0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,
+0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,
+0x02,0x84,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0xe0,0x00,0x0a,0x80,0x00,0x10,
+0xa0,0x00,0x1b,0x00,0x01,0x10,0x00,0x31,0x80,0x02,0x08,0x00,0x20,0x80,0x06,0x0c,
+0x00,0x80,0x40,0x80,0x04,0x0b,0x00,0xc0,0x60,0x08,0x02,0x00,0x80,0x20,0x18,0x03,
+0x01,0x00,0x80,0x10,0x12,0x01,0x03,0x00,0x18,0x20,0x00,0x86,0x00,0x0c,0x40,0x00,
+0x4c,0x00,0x06,0x80,0x00,0x28,0x00,0x02,0x83,0x00,0x2a,0x08,0x02,0x00,0x80,0x20,
+0x0c,0x06,0x01,0xc0,0x70,0x14,0x05,0x01,0x60,0xd0,0x12,0x09,0x01,0x20,0x90,0x13,
+0x19,0x01,0x11,0x18,0x31,0x10,0x82,0x1b,0x08,0x20,0xa0,0x82,0x0a,0x08,0x20,0xa0,
+0x82,0x0e,0x0c,0x60,0x40,0x44,0x80,0x04,0x13,0x40,0x00,0x44,0x00,0x04,0x40,0x00,
+0x4c,0x00,0x06,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x83,0x00,0x11,
+0x80,0x00,0x2c,0x00,0x06,0x40,0x00,0x42,0x00,0x08,0x30,0x01,0x81,0x80,0x30,0x08,
+0x02,0x00,0x80,0x40,0x08,0x06,0x0c,0x00,0x20,0x80,0x01,0x10,0x00,0x0a,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x08,0xa0,0x00,0x11,0x00,0x02,0x08,0x00,0x60,0xc0,
+0x80,0x04,0x03,0x00,0x80,0x20,0x18,0x80,0x03,0x0b,0x00,0x18,0x20,0x00,0x84,0x00,
+0x04,0xc0,0x00,0x68,0x00,0x02,0x84,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x13,0x40,0x00,0x0e,
+0x00,0x01,0xb0,0x00,0x31,0x80,0x02,0x08,0x00,0x60,0xc0,0x0c,0x06,0x00,0x80,0x20,
+0x18,0x80,0x03,0x0b,0x00,0x18,0x60,0x00,0xc4,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,
+0x83,0x00,0x80,0xff,0x00,0xec,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x05,0x30,
+0x00,0x01,0x80,0x00,0x08,0x80,0x00,0x02,0x40,0x00,0x06,0x80,0x00,0x02,0x30,0x00,
+0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x20,0x00,
+0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x20,0x00,
+0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x02,0x6f,0xff,
+0xfe,0x83,0x00,0x05,0x07,0xf0,0x00,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x00,0x7f,
+0x83,0x00,0x00,0x02,0x80,0x00,0x02,0x60,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x18,
+0x00,0x01,0x80,0x00,0x02,0x20,0x00,0x04,0x80,0x00,0x04,0xc0,0x00,0x08,0x00,0x01,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x09,0x40,0x00,0x08,0x00,0x01,0x80,0x00,
+0x10,0x00,0x02,0x80,0x00,0x02,0x60,0x00,0x0c,0x80,0x00,0x04,0x80,0x00,0x10,0x00,
+0x03,0x80,0x00,0x02,0x60,0x00,0x04,0x80,0x00,0x02,0xc0,0x00,0x08,0x85,0x00,0x01,
+0x01,0xfc,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x05,0x40,0x00,0x04,0x00,0x1f,0xc0,0xb8,0x00,0x80,
+0x60,0x08,0x03,0x0c,0x00,0x19,0x80,0x00,0xf0,0x00,0x06,0x84,0x00,0x80,0xff,0x00,
+0xe0,0xf6,0x00,0x00,0x03,0x80,0x00,0x07,0x60,0x00,0x0c,0x00,0x01,0x80,0x00,0x10,
+0x86,0x00,0x27,0x03,0xff,0xc2,0x60,0x06,0x64,0x00,0x34,0xc0,0x01,0x48,0x00,0x1c,
+0x80,0x00,0x8c,0x00,0x08,0x40,0x00,0x86,0x00,0x18,0x30,0x03,0x81,0xc0,0xe8,0x07,
+0xf8,0x88,0x00,0x08,0xc0,0x01,0x87,0x00,0x30,0x1f,0xfe,0x9c,0x00,0x28,0x0b,0xff,
+0x80,0xe0,0x0e,0x08,0x00,0x30,0x80,0x01,0x08,0x00,0x18,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x18,0x80,0x01,0x08,0x00,0x30,0xe0,
+0x06,0x0b,0x81,0xc0,0x8f,0xf0,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x88,
+0x00,0x01,0x7f,0x00,0x80,0x1c,0x01,0x03,0x00,0x80,0x60,0x06,0x03,0x0c,0x00,0x18,
+0x80,0x00,0x88,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x08,0x00,
+0x08,0xc0,0x01,0x86,0x00,0x80,0x30,0x05,0x06,0x01,0xc1,0xc0,0x07,0xf0,0x9d,0x00,
+0x29,0xff,0xe8,0x38,0x03,0x86,0x00,0x18,0x40,0x00,0x8c,0x00,0x08,0x80,0x00,0x88,
+0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x8c,0x00,0x08,0x40,0x00,0x86,0x00,
+0x18,0x38,0x03,0x80,0xf0,0xe8,0x01,0xf8,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x86,0x00,0x01,0x7f,0x00,0x80,0x1c,0x01,0x03,0x00,0x80,0x60,0x06,
+0x03,0x0c,0x00,0x18,0x80,0x00,0x88,0x80,0x00,0x0d,0x80,0x00,0x0f,0xff,0xf8,0x80,
+0x00,0x88,0x00,0x08,0xc0,0x01,0x86,0x00,0x80,0x30,0x05,0x06,0x01,0xc1,0xc0,0x07,
+0xf0,0x9d,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x07,0x10,0x00,0x01,0x00,0x01,0xff,0xc0,0x01,
+0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x05,0x10,
+0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x33,0x70,0x00,0x01,0xc0,0x3f,0xfe,0x06,0x00,
+0x30,0xc0,0x01,0x08,0x00,0x18,0x0f,0xfc,0x83,0x80,0x68,0x60,0x03,0x84,0x00,0x08,
+0xc0,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0xc0,
+0x01,0x84,0x00,0x38,0x60,0x06,0x83,0x81,0xc8,0x0f,0xf0,0x80,0x9b,0x00,0x28,0x08,
+0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x01,0x8c,0x00,0x10,
+0xe0,0x03,0x0b,0x00,0x60,0x9f,0xfc,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x88,0x00,0x00,0x3e,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x05,0x80,0x00,0x08,0x00,0x03,
+0xe0,0x84,0x00,0x05,0x1c,0x00,0x01,0xc0,0x00,0x1c,0x89,0x00,0x10,0x0f,0xe0,0x03,
+0x83,0x80,0x60,0x0c,0x04,0x00,0x60,0xc0,0x02,0x08,0x00,0x30,0x80,0x01,0x80,0x00,
+0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,
+0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x03,0x10,
+0x00,0x07,0x80,0x84,0x00,0x05,0x38,0x00,0x03,0x80,0x00,0x38,0x8f,0x00,0x28,0x08,
+0x00,0x18,0x80,0x07,0x08,0x00,0xc0,0x80,0x38,0x08,0x0e,0x00,0x83,0x80,0x0e,0xe0,
+0x00,0xb8,0x00,0x08,0xe0,0x00,0x83,0x00,0x08,0x1c,0x00,0x80,0x70,0x08,0x01,0xc0,
+0x80,0x07,0x08,0x00,0x18,0x80,0x00,0x88,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x88,0x00,0x00,0x3e,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x38,0x86,0x00,0x81,0x08,
+0x80,0x80,0x00,0x88,0x80,0x08,0x80,0x80,0x00,0x88,0x80,0x08,0x80,0x80,0x00,0x88,
+0x80,0x08,0x80,0x80,0x00,0x88,0x80,0x08,0x02,0xc0,0x80,0x8c,0x80,0x08,0x0b,0xe0,
+0xc0,0x8b,0x0e,0x08,0x99,0xb0,0x88,0xd1,0x98,0x87,0x0f,0x9c,0x00,0x23,0x08,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x8c,0x00,0x08,0xc0,0x00,0x8c,0x00,0x08,0xe0,0x01,0x8b,0x00,0x30,0x98,
+0x06,0x08,0x80,0xc0,0x01,0x87,0xf8,0x9d,0x00,0x20,0xff,0x80,0x38,0x0e,0x06,0x00,
+0x30,0x40,0x01,0x0c,0x00,0x18,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0xc0,0x01,0x84,0x00,0x10,0x60,0x80,0x03,0x03,0x80,0xe0,
+0x0f,0xf8,0x95,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x03,0x8f,0xf8,0x0b,0x80,0x80,0xe0,0x1e,0x03,0x0c,0x00,0x10,0x80,0x01,0x88,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x01,0x8c,0x00,0x10,
+0xe0,0x03,0x0b,0x80,0xe0,0x8f,0xf8,0x97,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x28,
+0x80,0x00,0x08,0x0f,0xfc,0x83,0x80,0x78,0x60,0x01,0x8c,0x00,0x08,0x80,0x00,0x88,
+0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x8c,0x00,
+0x08,0x60,0x01,0x83,0x80,0x78,0x0f,0xfc,0x80,0x9b,0x00,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0xc0,0x00,
+0x0e,0x80,0x00,0x06,0xb8,0x01,0x88,0xf0,0x70,0x81,0xfc,0x9c,0x00,0x04,0x0f,0xff,
+0xe0,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x04,0x80,0x00,0x18,0x00,0x03,0x80,
+0x00,0x03,0xe0,0x3f,0xf8,0x06,0x80,0x00,0x02,0xc0,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x0c,0x80,0x00,0x07,0x60,0x00,0x03,0x80,0x00,0x0f,0xff,0x80,0x9c,0x00,0x0c,
+0x07,0x80,0x00,0xc0,0x00,0x08,0x00,0x01,0x80,0x00,0x10,0x00,0x01,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x07,0x10,0x00,0x1f,0xf8,0x00,0x10,0x00,0x01,
+0x80,0x00,0x02,0x10,0x00,0x01,0x93,0x00,0x28,0x01,0xff,0xc4,0x30,0x06,0xc6,0x00,
+0x38,0xc0,0x01,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x80,0x9c,0x00,0x0e,0x08,0x00,0x01,0xc0,0x00,0x36,0x00,0x02,0x20,0x00,0x63,
+0x00,0x0c,0x18,0x00,0x80,0x80,0x05,0x18,0x0c,0x03,0x00,0x40,0x20,0x80,0x06,0x0e,
+0x00,0x30,0x40,0x01,0x0c,0x00,0x18,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9b,
+0x00,0x11,0x01,0x00,0x40,0x10,0x04,0x03,0x80,0xe0,0x2c,0x1a,0x02,0x41,0x20,0x26,
+0x32,0x02,0x22,0x20,0x80,0x63,0x14,0x04,0x14,0x10,0x41,0xc1,0x04,0x08,0x10,0xc0,
+0x01,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9b,0x00,0x03,0x0c,
+0x00,0x18,0x60,0x80,0x03,0x0a,0x00,0x60,0x18,0x0c,0x00,0xc1,0x80,0x02,0x20,0x00,
+0x14,0x80,0x00,0x0e,0x80,0x00,0x08,0x00,0x01,0x40,0x00,0x22,0x00,0x04,0x10,0x01,
+0x80,0xc0,0x30,0x80,0x06,0x04,0x00,0x30,0xc0,0x01,0x80,0x94,0x00,0x06,0xff,0xc0,
+0x00,0x07,0x80,0x00,0x0c,0x80,0x00,0x26,0x60,0x00,0x03,0x01,0xff,0x18,0x30,0x1c,
+0x86,0x00,0x68,0xc0,0x03,0x88,0x00,0x18,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,
+0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9b,
+0x00,0x05,0x0f,0xff,0xf8,0x60,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,
+0x00,0x06,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x02,0x60,0x00,
+0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x00,0x30,0x80,
+0xff,0x00,0x80,0x9a,0x00,0x04,0xf0,0x00,0x18,0x00,0x03,0x80,0x00,0x02,0x20,0x00,
+0x06,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x07,0x40,0x00,0x04,0x00,0x03,0xc0,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0f,0x85,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x84,0x00,0x03,
+0x01,0xe0,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x7c,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x09,0xc0,0x00,0x08,0x00,0x01,0x80,0x00,0x30,0x00,0x1e,0xbb,0x00,0x09,0x30,0x3c,
+0x01,0x86,0x60,0x0c,0xc3,0x00,0x78,0x18};
+
+static const unsigned char ysFont20x32Packed[6518]={
+0x84,0x00,0x02,0xe0,0x00,0x0e,0x80,0x00,0x00,0xe0,0x84,0x00,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0xe0,0x00,0x0e,
+0x80,0x00,0x02,0xe0,0x00,0x0e,0x80,0x00,0x02,0xe0,0x00,0x0e,0x80,0x00,0x1b,0xe0,
+0x00,0x1f,0x00,0x01,0xf0,0x00,0x1f,0x00,0x01,0xf0,0x00,0x1f,0x00,0x01,0xf0,0x00,
+0x1f,0x00,0x01,0xf0,0x00,0x1f,0x00,0x01,0xf0,0x00,0x1f,0x80,0x00,0x02,0xe0,0x00,
+0x0e,0xc0,0x00,0x0e,0x04,0x10,0x00,0x61,0x80,0x06,0x18,0x00,0x71,0xc0,0x07,0x1c,
+0x00,0x30,0xc0,0x86,0x00,0x42,0x20,0x80,0x02,0x08,0x00,0x20,0x80,0x02,0x08,0x00,
+0x20,0x80,0x02,0x08,0x00,0x20,0x80,0x02,0x08,0x07,0xff,0xfc,0x02,0x08,0x00,0x20,
+0x80,0x02,0x08,0x00,0x20,0x80,0x02,0x08,0x00,0x20,0x80,0x02,0x08,0x00,0x20,0x80,
+0x02,0x08,0x07,0xff,0xfc,0x02,0x08,0x00,0x20,0x80,0x02,0x08,0x00,0x20,0x80,0x02,
+0x08,0x00,0x20,0x80,0x02,0x08,0x00,0x20,0x80,0x8d,0x00,0x3d,0x01,0x10,0x00,0x11,
+0x00,0x07,0xfc,0x01,0xd1,0x70,0x31,0x11,0x86,0x11,0x0c,0x41,0x10,0x40,0x11,0x04,
+0x01,0x10,0x40,0x11,0x0c,0x01,0x11,0x80,0x11,0x70,0x07,0xfc,0x01,0xd1,0x00,0x31,
+0x10,0x06,0x11,0x00,0x41,0x10,0x04,0x11,0x04,0x41,0x10,0x46,0x11,0x0c,0x31,0x11,
+0x81,0xd1,0x70,0x07,0xfc,0x00,0x11,0x00,0x01,0x10,0x8b,0x00,0x07,0x80,0x0e,0x0c,
+0x03,0xb8,0x40,0x60,0xc6,0x80,0x04,0x08,0x20,0xc0,0x61,0x08,0x02,0x18,0xc0,0x60,
+0x84,0x80,0x04,0x09,0x60,0xc0,0x63,0xb8,0x02,0x0e,0x00,0x10,0x00,0x01,0x80,0x00,
+0x00,0x08,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x20,0x00,0x01,0x80,0x00,
+0x07,0x10,0x00,0xe0,0x80,0x3b,0x8c,0x06,0x0c,0x80,0x40,0x08,0x42,0x0c,0x06,0x30,
+0x80,0x21,0x0c,0x06,0x08,0x80,0x40,0x07,0xc6,0x0c,0x04,0x3b,0x80,0x60,0xe0,0x02,
+0x83,0x00,0x18,0x03,0xe0,0x00,0xe3,0x80,0x18,0x0c,0x63,0x00,0x6c,0x20,0x03,0x86,
+0x00,0x18,0x40,0x03,0xc6,0x00,0x66,0x20,0x04,0x23,0x00,0xc0,0x80,0x18,0x1b,0x00,
+0x81,0x00,0x0c,0x30,0x00,0x66,0x00,0x02,0x40,0x00,0x3c,0x00,0x01,0x80,0x00,0x38,
+0x00,0x06,0xc0,0x00,0xc6,0x00,0x18,0x20,0x01,0x03,0x00,0x80,0x10,0x80,0x01,0x07,
+0x00,0x18,0x30,0x00,0xc6,0x00,0x07,0xc0,0xc8,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,
+0x02,0xc0,0x00,0x0e,0x80,0x00,0x02,0xe0,0x00,0x06,0x85,0x00,0x00,0x04,0x80,0x00,
+0x04,0xc0,0x00,0x18,0x00,0x01,0x80,0x00,0x02,0x30,0x00,0x02,0x80,0x00,0x02,0x60,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0xc0,0x00,0x08,0x80,0x00,
+0x0c,0x80,0x00,0x08,0x00,0x01,0x80,0x00,0x10,0x00,0x01,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x0c,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x06,
+0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x0c,0x80,
+0x00,0x00,0x40,0x83,0x00,0x00,0x02,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x08,
+0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x02,0x20,
+0x00,0x02,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,
+0x00,0x18,0x80,0x00,0x04,0x80,0x00,0x18,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x03,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x06,0x80,0x00,0x02,0x40,
+0x00,0x0c,0x80,0x00,0x04,0x80,0x00,0x18,0x00,0x03,0x80,0x00,0x00,0x20,0x87,0x00,
+0x19,0x02,0x00,0x08,0x20,0x80,0xc2,0x18,0x04,0x21,0x00,0x62,0x30,0x02,0x22,0x00,
+0x32,0x60,0x01,0xac,0x00,0x0a,0x80,0x00,0xf8,0x00,0x07,0x80,0x00,0x07,0x20,0x00,
+0x02,0x00,0x1f,0xff,0x80,0x02,0x80,0x00,0x1b,0x70,0x00,0x0f,0x80,0x00,0xa8,0x00,
+0x1a,0xc0,0x01,0x24,0x00,0x32,0x60,0x02,0x22,0x00,0x62,0x30,0x04,0x21,0x00,0xc2,
+0x18,0x08,0x20,0x80,0x02,0x80,0x00,0x00,0x20,0x98,0x00,0x00,0x02,0x80,0x00,0x02,
+0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x07,0x20,0x00,0x02,0x00,
+0x1f,0xff,0xc0,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x02,0x98,0x00,0x03,0x01,0x80,0x00,0x0c,0x80,0x00,0x02,
+0xe0,0x00,0x0f,0x80,0x00,0x02,0xf0,0x00,0x06,0xe3,0x00,0x02,0x1f,0xff,0xc0,0xae,
+0x00,0x02,0x60,0x00,0x0f,0x80,0x00,0x02,0xf0,0x00,0x06,0xc0,0x00,0x02,0x80,0x00,
+0x0c,0x80,0x00,0x02,0x40,0x00,0x06,0x80,0x00,0x02,0x20,0x00,0x01,0x80,0x00,0x00,
+0x18,0x80,0x00,0x02,0x80,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x20,0x00,0x01,0x80,0x00,0x00,0x10,0x80,0x00,0x02,0x80,0x00,0x0c,0x80,0x00,0x02,
+0x40,0x00,0x02,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x00,0x08,0x80,0x00,0x02,
+0xc0,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x84,0x00,0x06,0xf0,0x00,0x19,0x80,
+0x03,0x0c,0x00,0x80,0x60,0x0f,0x04,0x02,0x00,0x40,0x20,0x0c,0x03,0x00,0x80,0x10,
+0x08,0x01,0x00,0x80,0x10,0x08,0x80,0x01,0x12,0x80,0x18,0x10,0x00,0x81,0x00,0x08,
+0x10,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x00,0x08,0x18,0x01,0x80,0x80,0x0f,0x10,
+0x08,0x01,0x00,0x80,0x10,0x08,0x01,0x00,0xc0,0x30,0x04,0x02,0x00,0x40,0x20,0x80,
+0x06,0x06,0x00,0x30,0xc0,0x01,0x98,0x00,0x0f,0x84,0x00,0x03,0x01,0xf8,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,
+0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,
+0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,
+0x00,0x02,0x80,0x00,0x07,0x20,0x00,0x02,0x00,0x01,0xa0,0x00,0x0e,0x80,0x00,0x02,
+0x60,0x00,0x02,0x84,0x00,0x02,0x1f,0xff,0x81,0x80,0x00,0x00,0x18,0x80,0x00,0x02,
+0xc0,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,0x05,0x30,0x00,0x01,0x80,
+0x00,0x08,0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,
+0x02,0x30,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,
+0x02,0x30,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x0a,0x81,0x00,0x08,0x10,0x01,
+0x81,0x80,0x10,0x0c,0x03,0x00,0x80,0x60,0x04,0x03,0x0c,0x00,0x1f,0x80,0x84,0x00,
+0x03,0xf0,0x00,0x39,0xc0,0x80,0x06,0x0c,0x00,0x40,0x20,0x0c,0x03,0x01,0x80,0x18,
+0x10,0x00,0x81,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x04,0x80,0x00,
+0x18,0x00,0x03,0x80,0x00,0x02,0x20,0x00,0x06,0x80,0x00,0x02,0xc0,0x00,0x78,0x80,
+0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x00,0x18,0x80,
+0x00,0x0a,0x81,0x00,0x08,0x10,0x01,0x81,0x80,0x10,0x0c,0x03,0x00,0x80,0x60,0x04,
+0x03,0x0c,0x00,0x1f,0x80,0x84,0x00,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x0f,0x40,0x00,0x04,0x01,0xff,0xf8,0x10,0x04,
+0x01,0x80,0x40,0x08,0x04,0x00,0xc0,0x40,0x80,0x04,0x27,0x00,0x60,0x40,0x02,0x04,
+0x00,0x20,0x40,0x03,0x04,0x00,0x10,0x40,0x01,0x84,0x00,0x08,0x40,0x00,0xc4,0x00,
+0x04,0x40,0x00,0x44,0x00,0x06,0x40,0x00,0x24,0x00,0x03,0x40,0x00,0x14,0x00,0x01,
+0xc0,0x00,0x0c,0x80,0x00,0x00,0xc0,0x83,0x00,0x04,0x01,0xf8,0x00,0x30,0xc0,0x80,
+0x06,0x0c,0x00,0xc0,0x30,0x08,0x01,0x81,0x80,0x08,0x10,0x00,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x0f,0x80,0x00,
+0x08,0x00,0x01,0x80,0x00,0x30,0x00,0x0e,0x00,0x03,0x80,0x1f,0xe0,0x01,0x80,0x00,
+0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,
+0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x04,0x10,0x00,0x01,0xff,0xf8,0x83,0x00,
+0x04,0x01,0xf8,0x00,0x30,0xc0,0x80,0x06,0x23,0x00,0xc0,0x30,0x08,0x01,0x81,0x80,
+0x08,0x10,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x80,0x08,
+0x18,0x01,0x81,0xc0,0x30,0x16,0x06,0x01,0x30,0xc0,0x11,0xf8,0x01,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x11,0x10,0x00,0x01,0x00,0x08,0x10,0x00,0x81,0x00,0x08,
+0x18,0x01,0x80,0xc0,0x30,0x04,0x02,0x00,0x80,0x60,0x03,0x03,0x9c,0x00,0x0f,0x84,
+0x00,0x00,0x01,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x0c,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x60,0x00,0x02,0x80,0x00,
+0x02,0x20,0x00,0x03,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x06,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,0x05,0x10,
+0x00,0x01,0x80,0x00,0x08,0x80,0x00,0x02,0x81,0xff,0xf8,0x84,0x00,0x03,0xf0,0x00,
+0x39,0xc0,0x80,0x06,0x1b,0x00,0x40,0x20,0x0c,0x03,0x01,0x80,0x18,0x10,0x00,0x81,
+0x00,0x08,0x10,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x80,0x18,0x0c,0x03,0x00,0x40,
+0x20,0x80,0x06,0x07,0x00,0x30,0xc0,0x01,0xf8,0x00,0x30,0xc0,0x80,0x06,0x03,0x00,
+0xc0,0x30,0x18,0x80,0x01,0x0e,0x00,0x18,0x10,0x00,0x81,0x00,0x08,0x10,0x01,0x81,
+0x80,0x10,0x0c,0x03,0x00,0x80,0x60,0x04,0x03,0x0c,0x00,0x1f,0x80,0x84,0x00,0x03,
+0xf0,0x00,0x39,0xc0,0x80,0x06,0x11,0x00,0x40,0x20,0x0c,0x03,0x01,0x80,0x18,0x10,
+0x00,0x81,0x00,0x08,0x10,0x00,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x23,0x80,0x1f,0x88,0x03,0x0c,0x80,0x60,0x68,0x0c,0x03,0x81,0x80,0x18,0x10,
+0x01,0x81,0x00,0x08,0x10,0x00,0x81,0x00,0x08,0x10,0x00,0x81,0x00,0x08,0x10,0x01,
+0x81,0x80,0x10,0x0c,0x03,0x00,0x80,0x60,0x04,0x03,0x0c,0x00,0x1f,0x80,0x89,0x00,
+0x02,0x60,0x00,0x0f,0x80,0x00,0x02,0xf0,0x00,0x06,0xa5,0x00,0x00,0x06,0x80,0x00,
+0x02,0xf0,0x00,0x0f,0x80,0x00,0x00,0x60,0x90,0x00,0x03,0x01,0x80,0x00,0x0c,0x80,
+0x00,0x02,0xe0,0x00,0x0f,0x80,0x00,0x02,0xf0,0x00,0x06,0xa5,0x00,0x00,0x06,0x80,
+0x00,0x02,0xf0,0x00,0x0f,0x80,0x00,0x00,0x60,0x94,0x00,0x07,0x08,0x00,0x01,0x80,
+0x00,0x30,0x00,0x06,0x80,0x00,0x04,0xc0,0x00,0x18,0x00,0x03,0x80,0x00,0x09,0x60,
+0x00,0x0c,0x00,0x01,0x80,0x00,0x30,0x00,0x06,0x80,0x00,0x02,0xc0,0x00,0x18,0x80,
+0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,
+0x02,0x60,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,
+0x05,0x30,0x00,0x01,0x80,0x00,0x08,0x9e,0x00,0x02,0x01,0xff,0xf8,0x94,0x00,0x02,
+0x01,0xff,0xf8,0x9e,0x00,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,
+0x06,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,0x02,0x60,0x00,0x03,
+0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x07,0x30,0x00,0x01,
+0x80,0x00,0x30,0x00,0x06,0x80,0x00,0x04,0xc0,0x00,0x18,0x00,0x03,0x80,0x00,0x09,
+0x60,0x00,0x0c,0x00,0x01,0x80,0x00,0x30,0x00,0x06,0x80,0x00,0x04,0xc0,0x00,0x18,
+0x00,0x01,0x8b,0x00,0x02,0x60,0x00,0x0f,0x80,0x00,0x02,0xf0,0x00,0x06,0x85,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x06,
+0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x06,
+0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x18,0x80,0x00,0x06,0x80,0x00,0x08,0x10,
+0x00,0x81,0x00,0x80,0x18,0x00,0x01,0x80,0x80,0x03,0x10,0x0c,0x03,0x00,0x80,0x60,
+0x03,0x03,0xfc,0x00,0x0f,0x89,0x00,0x12,0x03,0xff,0x00,0xe0,0x00,0x18,0x00,0x03,
+0x0f,0x8c,0x23,0x8d,0xc2,0x60,0x74,0x24,0x02,0x42,0x40,0x80,0x24,0x23,0x02,0x42,
+0x40,0x24,0x26,0x02,0x42,0x30,0xe4,0x21,0xfa,0x42,0x06,0x24,0x26,0x06,0x42,0x30,
+0xc4,0x21,0xf8,0x42,0x06,0x04,0x30,0x00,0xc1,0x00,0x08,0x18,0x01,0x80,0xe0,0x70,
+0x03,0xfc,0x90,0x00,0x17,0x80,0x00,0x2c,0x00,0x06,0x40,0x00,0x44,0x00,0x04,0x60,
+0x00,0x42,0x00,0x0c,0x20,0x00,0x82,0x00,0x08,0x30,0x01,0x81,0x00,0x80,0x10,0x80,
+0x01,0x09,0xff,0xf0,0x08,0x02,0x00,0x80,0x20,0x0c,0x06,0x00,0x80,0x40,0x80,0x04,
+0x15,0x00,0x60,0xc0,0x02,0x08,0x00,0x20,0x80,0x03,0x18,0x00,0x11,0x00,0x01,0x10,
+0x00,0x11,0x00,0x01,0xb0,0x00,0x0a,0x80,0x00,0x02,0xa0,0x00,0x0e,0x80,0x00,0x02,
+0x40,0x00,0x04,0x84,0x00,0x4a,0xff,0xfc,0x08,0x00,0x70,0x80,0x01,0x88,0x00,0x0c,
+0x80,0x00,0x48,0x00,0x06,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x06,0x80,
+0x00,0x48,0x00,0x0c,0x80,0x01,0x88,0x00,0x70,0xff,0xfc,0x08,0x00,0x70,0x80,0x01,
+0x88,0x00,0x08,0x80,0x00,0xc8,0x00,0x06,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,
+0x00,0x02,0x80,0x00,0x68,0x00,0x0c,0x80,0x00,0x88,0x00,0x18,0x80,0x07,0x0f,0xff,
+0xc0,0x84,0x00,0x03,0xf0,0x00,0x39,0xc0,0x80,0x06,0x14,0x00,0xc0,0x30,0x18,0x01,
+0x83,0x00,0x0c,0x20,0x00,0x42,0x00,0x04,0x60,0x00,0x64,0x00,0x02,0x40,0x00,0x2c,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x16,0xc0,0x00,0x04,0x00,0x02,0x40,0x00,0x26,0x00,0x06,0x20,
+0x00,0x42,0x00,0x04,0x30,0x00,0xc1,0x80,0x18,0x0c,0x03,0x00,0x80,0x60,0x03,0x03,
+0x9c,0x00,0x0f,0x84,0x00,0x49,0xff,0xe0,0x08,0x03,0xc0,0x80,0x06,0x08,0x00,0x20,
+0x80,0x03,0x08,0x00,0x18,0x80,0x00,0x88,0x00,0x0c,0x80,0x00,0x48,0x00,0x04,0x80,
+0x00,0x48,0x00,0x06,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,
+0x28,0x00,0x02,0x80,0x00,0x68,0x00,0x04,0x80,0x00,0x48,0x00,0x04,0x80,0x00,0xc8,
+0x00,0x08,0x80,0x01,0x88,0x00,0x30,0x80,0x02,0x08,0x00,0x60,0x80,0x3c,0x0f,0xfe,
+0x84,0x00,0x80,0xff,0x00,0xe8,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x80,0xff,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x04,0x80,0x00,0x0f,0xff,0xfe,0x83,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x80,0xff,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x04,0x80,0x00,0x0f,0xff,0xfe,0x84,0x00,0x03,0xf0,0x20,0x39,0xc2,0x80,
+0x06,0x19,0x20,0xc0,0x32,0x18,0x01,0xa3,0x00,0x0e,0x20,0x00,0x62,0x00,0x06,0x60,
+0x00,0x64,0x00,0x02,0x40,0x00,0x2c,0x0f,0xfe,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x16,0xc0,0x00,0x04,0x00,0x02,
+0x40,0x00,0x26,0x00,0x06,0x20,0x00,0x42,0x00,0x04,0x30,0x00,0xc1,0x80,0x18,0x0c,
+0x03,0x00,0x80,0x60,0x03,0x03,0x9c,0x00,0x0f,0x84,0x00,0x22,0x80,0x00,0x28,0x00,
+0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0xff,0x25,0xe8,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,
+0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x83,0x00,0x03,0x01,0xf0,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,
+0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,
+0x40,0x00,0x1f,0x84,0x00,0x1d,0x01,0xe0,0x00,0xf3,0xc0,0x18,0x06,0x03,0x00,0x30,
+0x60,0x01,0x84,0x00,0x08,0x40,0x00,0x8c,0x00,0x0c,0x80,0x00,0x48,0x00,0x04,0x80,
+0x00,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x3e,0x82,0x00,0x4b,0x02,0x80,0x00,
+0x68,0x00,0x0c,0x80,0x01,0x88,0x00,0x30,0x80,0x06,0x08,0x00,0xc0,0x80,0x18,0x08,
+0x03,0x00,0x80,0x60,0x08,0x0c,0x00,0x81,0x80,0x08,0x30,0x00,0x86,0x00,0x08,0xc0,
+0x00,0xf8,0x00,0x08,0xc0,0x00,0x86,0x00,0x08,0x30,0x00,0x81,0x80,0x08,0x0c,0x00,
+0x80,0x60,0x08,0x03,0x00,0x80,0x18,0x08,0x00,0xc0,0x80,0x06,0x08,0x00,0x30,0x80,
+0x01,0x88,0x00,0x0c,0x80,0x00,0x68,0x00,0x02,0x83,0x00,0x80,0xff,0x00,0xe8,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,
+0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x85,0x00,0x4a,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x40,0x28,0x04,0x02,0x80,0xe0,0x28,0x0a,0x02,0x81,0xb0,0x28,0x11,0x02,0x83,0x18,
+0x28,0x20,0x82,0x86,0x0c,0x28,0x40,0x42,0x8c,0x06,0x28,0x80,0x22,0x98,0x03,0x29,
+0x00,0x12,0xb0,0x01,0xaa,0x00,0x0a,0xe0,0x00,0xec,0x00,0x06,0xc0,0x00,0x68,0x00,
+0x02,0x83,0x00,0x20,0x80,0x00,0x68,0x00,0x0e,0x80,0x00,0xa8,0x00,0x1a,0x80,0x01,
+0x28,0x00,0x32,0x80,0x02,0x28,0x00,0x42,0x80,0x04,0x28,0x00,0x82,0x80,0x18,0x28,
+0x01,0x02,0x80,0x20,0x28,0x80,0x02,0x04,0x80,0x40,0x28,0x04,0x02,0x80,0x80,0x20,
+0x28,0x08,0x02,0x81,0x00,0x28,0x30,0x02,0x82,0x00,0x28,0x40,0x02,0x84,0x00,0x28,
+0x80,0x02,0x98,0x00,0x29,0x00,0x02,0xb0,0x00,0x2a,0x00,0x02,0xe0,0x00,0x2c,0x00,
+0x02,0x83,0x00,0x02,0x03,0xf8,0x00,0x80,0xe0,0x40,0x38,0x03,0x82,0x00,0x08,0x60,
+0x00,0xc4,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,
+0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x2c,0x00,
+0x06,0x40,0x00,0x46,0x00,0x0c,0x30,0x01,0x81,0x80,0x30,0x80,0x0e,0x02,0x00,0x3f,
+0x80,0x83,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x27,0xff,0xfc,
+0x08,0x00,0x70,0x80,0x01,0x88,0x00,0x08,0x80,0x00,0xc8,0x00,0x06,0x80,0x00,0x28,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x68,0x00,0x0c,0x80,0x00,0x88,0x00,
+0x18,0x80,0x07,0x0f,0xff,0xc0,0x83,0x00,0x45,0x03,0xf8,0x60,0xe0,0xec,0x38,0x03,
+0x82,0x00,0x38,0x60,0x06,0xc4,0x00,0xc4,0xc0,0x18,0x68,0x03,0x02,0x80,0x20,0x28,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,
+0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x2c,0x00,0x06,0x40,0x00,0x46,0x00,0x0c,0x30,0x01,0x81,0x80,0x30,0x80,
+0x0e,0x02,0x00,0x3f,0x80,0x83,0x00,0x14,0x80,0x00,0x68,0x00,0x0c,0x80,0x00,0xc8,
+0x00,0x18,0x80,0x01,0x08,0x00,0x20,0x80,0x06,0x08,0x00,0x40,0x80,0x80,0x08,0x00,
+0x00,0x80,0x80,0x30,0x10,0x08,0x03,0x00,0x80,0x60,0x08,0x04,0x00,0xff,0xfc,0x08,
+0x00,0x70,0x80,0x01,0x88,0x00,0x08,0x80,0x00,0xc8,0x00,0x06,0x80,0x00,0x28,0x00,
+0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x68,0x00,0x0c,0x80,0x00,0x88,0x00,0x18,
+0x80,0x07,0x0f,0xff,0xc0,0x83,0x00,0x02,0x03,0xf8,0x00,0x80,0xe0,0x00,0x18,0x80,
+0x03,0x10,0x00,0x18,0x60,0x00,0xc4,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,0x80,0x00,
+0x60,0x00,0x04,0x80,0x00,0x04,0xc0,0x00,0x18,0x00,0x03,0x80,0x00,0x08,0xe0,0x03,
+0xf8,0x00,0xe0,0x00,0x18,0x00,0x03,0x80,0x00,0x02,0x60,0x00,0x04,0x80,0x00,0x13,
+0xc0,0x00,0x08,0x00,0x02,0x80,0x00,0x2c,0x00,0x06,0x40,0x00,0x46,0x00,0x0c,0x30,
+0x01,0x81,0x80,0x30,0x80,0x0e,0x02,0x00,0x3f,0x80,0x84,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x03,0x40,0x0f,0xff,0xfe,0x83,0x00,0x02,0x03,0xf8,0x00,0x80,0xe0,0x45,0x38,0x03,
+0x82,0x00,0x08,0x60,0x00,0xc4,0x00,0x04,0xc0,0x00,0x68,0x00,0x02,0x80,0x00,0x28,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,
+0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,
+0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x80,
+0x00,0x28,0x00,0x02,0x84,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0xe0,0x00,0x0a,
+0x80,0x00,0x15,0xa0,0x00,0x1b,0x00,0x01,0x10,0x00,0x11,0x00,0x01,0x10,0x00,0x31,
+0x80,0x02,0x08,0x00,0x20,0x80,0x06,0x0c,0x00,0x80,0x40,0x80,0x04,0x0b,0x00,0xc0,
+0x60,0x08,0x02,0x00,0x80,0x20,0x18,0x03,0x01,0x00,0x80,0x10,0x17,0x01,0x03,0x00,
+0x18,0x20,0x00,0x82,0x00,0x08,0x20,0x00,0x86,0x00,0x0c,0x40,0x00,0x44,0x00,0x04,
+0xc0,0x00,0x68,0x00,0x02,0x83,0x00,0x04,0x0c,0x06,0x00,0xc0,0x60,0x80,0x0e,0x00,
+0x00,0x80,0xa0,0x09,0x1a,0x0b,0x01,0x20,0x90,0x12,0x09,0x01,0x31,0x90,0x80,0x11,
+0x02,0x01,0x11,0x10,0x80,0x11,0x2f,0x03,0x1b,0x18,0x20,0xa0,0x82,0x0a,0x08,0x20,
+0xa0,0x82,0x0a,0x08,0x20,0xe0,0x82,0x04,0x08,0x20,0x40,0x86,0x04,0x0c,0x40,0x00,
+0x44,0x00,0x04,0x40,0x00,0x44,0x00,0x04,0x40,0x00,0x44,0x00,0x04,0xc0,0x00,0x68,
+0x00,0x02,0x80,0x00,0x28,0x00,0x02,0x83,0x00,0x13,0xc0,0x00,0x66,0x00,0x0c,0x60,
+0x00,0xc3,0x00,0x18,0x30,0x01,0x81,0x80,0x30,0x08,0x02,0x00,0xc0,0x60,0x80,0x04,
+0x0b,0x00,0x20,0x80,0x03,0x18,0x00,0x11,0x00,0x01,0xb0,0x00,0x0a,0x80,0x00,0x02,
+0x40,0x00,0x04,0x80,0x00,0x0b,0xa0,0x00,0x1b,0x00,0x01,0x10,0x00,0x31,0x80,0x02,
+0x08,0x00,0x80,0x40,0x05,0x0c,0x06,0x00,0x80,0x20,0x18,0x80,0x03,0x0b,0x00,0x18,
+0x30,0x01,0x86,0x00,0x0c,0x60,0x00,0xcc,0x00,0x06,0x84,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x0e,0x80,0x00,0x0b,0xa0,0x00,0x1b,
+0x00,0x01,0x10,0x00,0x31,0x80,0x06,0x0c,0x00,0x80,0x40,0x05,0x0c,0x06,0x00,0x80,
+0x20,0x18,0x80,0x03,0x0b,0x00,0x18,0x30,0x01,0x86,0x00,0x0c,0x60,0x00,0xcc,0x00,
+0x06,0x83,0x00,0x80,0xff,0x00,0xec,0x80,0x00,0x02,0x60,0x00,0x06,0x80,0x00,0x02,
+0x30,0x00,0x01,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,
+0x60,0x00,0x02,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x08,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x00,0x10,0x80,0x00,0x02,0x80,
+0x00,0x0c,0x80,0x00,0x02,0x40,0x00,0x06,0x80,0x00,0x02,0x30,0x00,0x01,0x80,0x00,
+0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x0c,0x80,0x00,0x02,0x6f,0xff,0xfe,0x83,0x00,
+0x05,0x03,0xfc,0x00,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,
+0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,
+0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,
+0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,
+0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,
+0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x01,0x3f,0xc0,0x85,0x00,0x02,0x20,0x00,0x06,
+0x80,0x00,0x02,0x40,0x00,0x0c,0x80,0x00,0x04,0x80,0x00,0x10,0x00,0x03,0x80,0x00,
+0x02,0x20,0x00,0x04,0x80,0x00,0x04,0xc0,0x00,0x08,0x00,0x01,0x80,0x00,0x02,0x10,
+0x00,0x02,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x10,0x00,0x01,
+0x80,0x00,0x02,0x20,0x00,0x06,0x80,0x00,0x09,0x40,0x00,0x08,0x00,0x01,0x80,0x00,
+0x10,0x00,0x02,0x80,0x00,0x02,0x60,0x00,0x04,0x80,0x00,0x02,0xc0,0x00,0x08,0x85,
+0x00,0x01,0x03,0xfc,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x05,0x40,0x00,0x04,0x00,0x3f,0xc0,0xc2,0x00,0x80,0x60,0x08,
+0x03,0x0c,0x00,0x19,0x80,0x00,0xf0,0x00,0x06,0x84,0x00,0x80,0xff,0x00,0xe0,0xff,
+0x00,0x87,0x00,0x02,0x18,0x00,0x03,0x80,0x00,0x07,0x60,0x00,0x0c,0x00,0x01,0x80,
+0x00,0x10,0x86,0x00,0x31,0x01,0xff,0x82,0x30,0x0e,0x66,0x00,0x34,0xc0,0x01,0xc8,
+0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x8c,0x00,0x08,0x40,0x00,0x86,0x00,
+0x08,0x38,0x03,0x80,0xe0,0xe8,0x03,0xf8,0x80,0x00,0x18,0x80,0x01,0x0c,0x00,0x30,
+0x60,0x06,0x03,0x80,0xc0,0x0f,0xf8,0x9c,0x00,0x32,0x08,0x3e,0x00,0x8e,0x38,0x09,
+0x80,0xc0,0xb0,0x06,0x0e,0x00,0x30,0xc0,0x01,0x08,0x00,0x18,0x80,0x00,0x88,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x01,0x8c,0x00,0x10,
+0xe0,0x03,0x0b,0x00,0x60,0x98,0x0c,0x08,0xe3,0x80,0x83,0xe0,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,
+0x00,0x02,0x80,0x00,0x08,0x88,0x00,0x07,0x3e,0x00,0x0e,0x38,0x01,0x80,0xc0,0x30,
+0x80,0x06,0x09,0x00,0x30,0x40,0x01,0x8c,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x02,
+0x80,0x00,0x08,0x80,0x00,0x0a,0x80,0x00,0x08,0x00,0x08,0xc0,0x01,0x84,0x00,0x10,
+0x60,0x80,0x03,0x08,0x00,0x60,0x18,0x0c,0x00,0xe3,0x80,0x03,0xe0,0x9d,0x00,0x33,
+0x3e,0x08,0x0e,0x38,0x81,0x80,0xc8,0x30,0x06,0x86,0x00,0x38,0x40,0x01,0x8c,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0xc0,0x00,0x84,0x00,0x18,0x60,0x03,0x83,0x00,0x68,0x18,0x0c,0x80,0xe3,0x88,0x03,
+0xe0,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x86,0x00,0x07,0x3e,
+0x00,0x0e,0x38,0x01,0x80,0xc0,0x30,0x80,0x06,0x09,0x00,0x30,0x40,0x01,0x8c,0x00,
+0x08,0x80,0x00,0x08,0x80,0x00,0x0f,0x80,0x00,0x0f,0xff,0xf8,0x80,0x00,0x88,0x00,
+0x08,0xc0,0x01,0x84,0x00,0x10,0x60,0x80,0x03,0x08,0x00,0x60,0x18,0x0c,0x00,0xe3,
+0x80,0x03,0xe0,0x9d,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,
+0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0xff,0xc0,0x01,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x0c,0x80,0x00,0x3c,0x60,0x00,0x03,0xc0,0x07,0xf0,0x03,0xc1,0xc0,
+0x60,0x06,0x0c,0x00,0x30,0x80,0x01,0x80,0x3e,0x08,0x1e,0x3c,0x83,0x00,0x68,0x60,
+0x03,0x8c,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,
+0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0xc0,0x00,0x86,0x00,0x38,0x30,0x06,0x81,
+0xe3,0xc8,0x03,0xe0,0x9c,0x00,0x32,0x08,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,
+0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x18,0xc0,0x01,0x0e,
+0x00,0x30,0xb0,0x06,0x09,0xe3,0xc0,0x83,0xe0,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x88,0x00,0x00,0x3f,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x05,0x40,0x00,0x04,0x00,0x03,0xe0,0x84,
+0x00,0x05,0x0c,0x00,0x01,0xe0,0x00,0x1e,0x80,0x00,0x00,0xc0,0x86,0x00,0x10,0x03,
+0xc0,0x01,0xe7,0x80,0x30,0x0c,0x06,0x00,0x60,0xc0,0x02,0x08,0x00,0x30,0x80,0x01,
+0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,
+0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,
+0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x03,0x10,0x00,0x0f,
+0x80,0x86,0x00,0x00,0x03,0x80,0x00,0x05,0x78,0x00,0x07,0x80,0x00,0x30,0x8a,0x00,
+0x19,0x08,0x00,0x18,0x80,0x07,0x08,0x00,0xc0,0x80,0x38,0x08,0x06,0x00,0x80,0xc0,
+0x08,0x38,0x00,0x86,0x00,0x09,0xc0,0x00,0xf0,0x00,0x0b,0x80,0x00,0x0d,0x9c,0x00,
+0x08,0x60,0x00,0x83,0x00,0x08,0x1c,0x00,0x80,0x60,0x08,0x03,0x80,0x80,0x06,0x0c,
+0x08,0x00,0x70,0x80,0x01,0x88,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x88,0x00,
+0x00,0x1f,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x1c,0x86,0x00,0x81,0x08,0x80,0x80,0x00,0x88,0x80,0x08,
+0x80,0x80,0x00,0x88,0x80,0x08,0x80,0x80,0x00,0x88,0x80,0x08,0x80,0x80,0x00,0x88,
+0x80,0x08,0x80,0x80,0x00,0x88,0x80,0x08,0x80,0x80,0x00,0x88,0x80,0x08,0x04,0x80,
+0xc0,0x8c,0x0c,0x08,0x80,0xe0,0x09,0x8b,0x0b,0x08,0x98,0x99,0x88,0xd8,0xd0,0x87,
+0x07,0x9c,0x00,0x31,0x08,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,
+0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x8c,0x00,0x08,0xe0,0x01,0x8b,0x00,0x10,0x98,
+0x03,0x08,0xc0,0xe0,0x87,0xf8,0x9d,0x00,0x07,0x3e,0x00,0x0e,0x38,0x01,0x80,0xc0,
+0x30,0x80,0x06,0x1b,0x00,0x30,0x40,0x01,0x0c,0x00,0x18,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0xc0,0x01,0x84,0x00,0x10,0x60,
+0x80,0x03,0x08,0x00,0x60,0x18,0x0c,0x00,0xe3,0x80,0x03,0xe0,0x95,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x2e,0x87,0xf0,0x09,0xc1,0xc0,
+0xb0,0x06,0x0e,0x00,0x30,0xc0,0x01,0x08,0x00,0x18,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x18,0xc0,0x01,
+0x0e,0x00,0x30,0xb0,0x06,0x09,0xc1,0xc0,0x87,0xf0,0x97,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x32,0x80,0x00,0x08,0x07,0xf0,0x81,0xc1,0xc8,0x30,0x06,0x86,0x00,0x38,
+0x40,0x01,0x8c,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x88,0x00,0x08,0x80,0x00,0x8c,0x00,0x08,0x40,0x01,0x86,0x00,0x38,0x30,0x06,
+0x81,0xc1,0xc8,0x07,0xf0,0x80,0x9b,0x00,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,
+0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,
+0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x08,0x80,0x00,
+0x02,0x80,0x00,0x08,0x80,0x00,0x02,0x80,0x00,0x0e,0x80,0x00,0x06,0xb8,0x00,0x08,
+0xf0,0x18,0x81,0xff,0x9d,0x00,0x01,0x3e,0x00,0x80,0x3e,0x07,0x06,0x00,0x30,0xc0,
+0x01,0x08,0x00,0x18,0x80,0x00,0x04,0x80,0x00,0x18,0x00,0x01,0x80,0x00,0x08,0x30,
+0x00,0x3e,0x00,0x3e,0x00,0x1e,0x00,0x07,0x80,0x00,0x10,0x40,0x00,0x0c,0x00,0x08,
+0xc0,0x01,0x84,0x00,0x10,0x70,0x07,0x01,0xe3,0xc0,0x03,0xe0,0x9d,0x00,0x07,0x07,
+0x80,0x00,0xc0,0x00,0x18,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,
+0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,
+0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x07,0x10,0x00,
+0x01,0x00,0x01,0xff,0x80,0x01,0x80,0x00,0x02,0x10,0x00,0x01,0x80,0x00,0x02,0x10,
+0x00,0x01,0x94,0x00,0x31,0x3f,0x08,0x0e,0x18,0x83,0x80,0xe8,0x20,0x02,0x86,0x00,
+0x38,0xc0,0x01,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,
+0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9c,0x00,0x00,0x08,0x80,0x00,0x12,0x80,0x00,
+0x1c,0x00,0x01,0x40,0x00,0x36,0x00,0x02,0x20,0x00,0x63,0x00,0x04,0x10,0x00,0xc1,
+0x80,0x80,0x08,0x19,0x01,0x80,0xc0,0x10,0x04,0x03,0x00,0x60,0x20,0x02,0x06,0x00,
+0x30,0x40,0x01,0x0c,0x00,0x18,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9c,0x00,
+0x80,0x80,0x80,0x08,0x02,0x01,0xc1,0xc0,0x80,0x14,0x02,0x01,0x41,0x40,0x80,0x36,
+0x23,0x02,0x22,0x20,0x23,0x62,0x02,0x14,0x20,0x61,0x43,0x04,0x1c,0x10,0x40,0x81,
+0x04,0x08,0x10,0xc0,0x01,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,
+0x00,0x08,0x80,0x00,0x80,0x9b,0x00,0x08,0x08,0x00,0x08,0x80,0x00,0x8c,0x00,0x18,
+0x60,0x80,0x03,0x1e,0x00,0x60,0x18,0x0c,0x00,0xc1,0x80,0x06,0x30,0x00,0x36,0x00,
+0x01,0xc0,0x00,0x08,0x00,0x01,0xc0,0x00,0x36,0x00,0x06,0x30,0x00,0xc1,0x80,0x18,
+0x0c,0x03,0x00,0x80,0x60,0x06,0x03,0x0c,0x00,0x18,0x80,0x00,0x80,0x94,0x00,0x06,
+0x7f,0xe0,0x00,0x03,0x80,0x00,0x0e,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0xff,0x08,
+0x80,0x18,0x28,0x83,0x00,0xc8,0x60,0x06,0x84,0x00,0x38,0x40,0x01,0x84,0x00,0x08,
+0xc0,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,
+0x00,0x88,0x00,0x08,0x80,0x00,0x88,0x00,0x08,0x80,0x00,0x80,0x9b,0x00,0x05,0x0f,
+0xff,0xf8,0xc0,0x00,0x06,0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x00,0x18,0x80,
+0x00,0x02,0xc0,0x00,0x06,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x0c,0x80,0x00,
+0x02,0x60,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,
+0x02,0x60,0x00,0x03,0x80,0x00,0x00,0x18,0x80,0xff,0x00,0x80,0x9a,0x00,0x02,0x1c,
+0x00,0x07,0x80,0x00,0x04,0xc0,0x00,0x18,0x00,0x01,0x80,0x00,0x02,0x30,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,
+0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x3e,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,
+0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,0x80,0x00,0x02,0x20,0x00,0x02,
+0x80,0x00,0x02,0x20,0x00,0x03,0x80,0x00,0x05,0x10,0x00,0x01,0x80,0x00,0x0c,0x80,
+0x00,0x03,0x70,0x00,0x01,0xc0,0x84,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,
+0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,
+0x84,0x00,0x03,0x03,0x80,0x00,0x0e,0x80,0x00,0x05,0x30,0x00,0x01,0x80,0x00,0x08,
+0x80,0x00,0x02,0xc0,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,
+0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x07,0x40,0x00,0x07,0xc0,0x00,
+0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x04,0x80,
+0x00,0x02,0x40,0x00,0x04,0x80,0x00,0x02,0x40,0x00,0x0c,0x80,0x00,0x04,0x80,0x00,
+0x18,0x00,0x03,0x80,0x00,0x02,0xe0,0x00,0x38,0xc5,0x00,0x09,0x30,0x78,0x01,0x8c,
+0xc0,0x0d,0x86,0x00,0x70,0x30};
+
+const struct YsGlPackedFont YsGlPackedFontTable[11]=
+{
+	{6,7,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont6x7Packed),ysFont6x7Packed},
+	{6,8,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont6x8Packed),ysFont6x8Packed},
+	{6,10,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont6x10Packed),ysFont6x10Packed},
+	{7,10,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont7x10Packed),ysFont7x10Packed},
+	{8,8,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont8x8Packed),ysFont8x8Packed},
+	{8,12,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont8x12Packed),ysFont8x12Packed},
+	{12,16,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont12x16Packed),ysFont12x16Packed},
+	{16,20,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont16x20Packed),ysFont16x20Packed},
+	{16,24,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont16x24Packed),ysFont16x24Packed},
+	{20,28,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont20x28Packed),ysFont20x28Packed},
+	{20,32,{0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},sizeof(ysFont20x32Packed),ysFont20x32Packed}
+};
+
+const int YsGlNumPackedFont=11;
@@ -0,0 +1,37 @@
+#ifndef YSGLFONTPACKED_IS_INCLUDED
+#define YSGLFONTPACKED_IS_INCLUDED
+/* { */
+
+/* Packed glyph tables, written by ysglfontpack from ysglfontdata.c and
+   decoded by YsGlGetFontBitmap.
+
+   The pixels of every non-blank glyph, in character order, are one bit
+   stream: fontHei rows, bottom row first, fontWid bits per row, the
+   leftmost pixel in the high bit, no padding between rows or glyphs.  The
+   stream is padded to a whole byte and run-length coded like PackBits:
+     n=0..127    the next n+1 bytes are copied as they are
+     n=128..255  the next byte is repeated n-126 times (2 to 129)
+   Blank glyphs (no pixel set) are not in the stream; bit (c&7) of
+   blank[c>>3] is set for them. */
+
+struct YsGlPackedFont
+{
+	int fontWid,fontHei;
+	unsigned char blank[32];
+	unsigned int nByte;
+	const unsigned char *dat;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const struct YsGlPackedFont YsGlPackedFontTable[];
+extern const int YsGlNumPackedFont;
+
+#ifdef __cplusplus
+}
+#endif
+
+/* } */
+#endif
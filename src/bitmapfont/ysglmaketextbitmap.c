@@ -1,6 +1,14 @@
 #include "ysglfontdata.h"
 #include <stdio.h>
 
+/* The RGBA8 writers expand 4 glyph pixels at a time into a 4-pixel mask and
+   write or blend all 4 with one 16-byte store (SSE2 on x86/x64, unless
+   MATH_NO_SIMD is defined; elsewhere the same per 4 pixels in plain C). */
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && 2<=_M_IX86_FP))
+#define YSGL_SSE2
+#include <emmintrin.h>
+#endif
+
 int YsGlWriteStringToSingleBitBitmap(
     const char str[],
     unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
@@ -135,104 +143,287 @@ int YsGlWriteStringToSingleBitBitmap(
 
 
 
-int YsGlWriteStringToRGBA8Bitmap(
-    const char str[],unsigned int c0,unsigned int c1,unsigned int c2,unsigned int c3,
+/* What the RGBA8 writers put into a glyph pixel.  Blending computes
+   (dst*(255-a)+c*a)/255 rounded to nearest as (t+(t>>8))>>8 with
+   t=dst*(255-a)+c*a+128, which is exact for every 8-bit dst, c and a. */
+struct YsGlRGBA8Ink
+{
+	int overwrite;
+	unsigned char color[4];      /* overwrite */
+	unsigned short srcTerm[4];   /* blend: c*a+128, and a*255+128 for alpha */
+	unsigned short inv;          /* blend: 255-a */
+#ifdef YSGL_SSE2
+	__m128i color4,srcTerm2,inv8;
+#endif
+};
+
+static void ysGlInkPixel(unsigned char pix[4],const struct YsGlRGBA8Ink *ink)
+{
+	if(0!=ink->overwrite)
+	{
+		pix[0]=ink->color[0];
+		pix[1]=ink->color[1];
+		pix[2]=ink->color[2];
+		pix[3]=ink->color[3];
+	}
+	else
+	{
+		int i;
+		for(i=0; i<4; i++)
+		{
+			unsigned int t=pix[i]*ink->inv+ink->srcTerm[i];
+			pix[i]=(unsigned char)((t+(t>>8))>>8);
+		}
+	}
+}
+
+/* Inks the pixels of pix whose bit is set in bits (the first pixel in the
+   high bit), n<=32 pixels. */
+static void ysGlInkSpan(unsigned char pix[],unsigned int bits,int n,const struct YsGlRGBA8Ink *ink)
+{
+	int x;
+#ifdef YSGL_SSE2
+	const __m128i laneBit=_mm_set_epi32(1,2,4,8);
+	const __m128i zero=_mm_setzero_si128();
+#endif
+
+	for(x=0; x+4<=n; x+=4,bits<<=4)
+	{
+		const unsigned int nibble=(bits>>28);
+		if(0!=nibble)
+		{
+#ifdef YSGL_SSE2
+			unsigned char *p=pix+x*4;
+			if(0!=ink->overwrite && 15!=nibble)
+			{
+				/* Overwriting a part of four pixels is cheaper as plain stores than a load, select, and store. */
+				int i;
+				for(i=0; i<4; i++)
+				{
+					if(0!=(nibble&(8>>i)))
+					{
+						ysGlInkPixel(p+i*4,ink);
+					}
+				}
+			}
+			else if(0!=ink->overwrite)
+			{
+				_mm_storeu_si128((__m128i *)p,ink->color4);
+			}
+			else
+			{
+				const __m128i mask=_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)nibble),laneBit),laneBit);
+				const __m128i dst=_mm_loadu_si128((const __m128i *)p);
+				__m128i lo=_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst,zero),ink->inv8),ink->srcTerm2);
+				__m128i hi=_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst,zero),ink->inv8),ink->srcTerm2);
+				lo=_mm_srli_epi16(_mm_add_epi16(lo,_mm_srli_epi16(lo,8)),8);
+				hi=_mm_srli_epi16(_mm_add_epi16(hi,_mm_srli_epi16(hi,8)),8);
+				_mm_storeu_si128((__m128i *)p,_mm_or_si128(_mm_and_si128(mask,_mm_packus_epi16(lo,hi)),_mm_andnot_si128(mask,dst)));
+			}
+#else
+			int i;
+			for(i=0; i<4; i++)
+			{
+				if(0!=(nibble&(8>>i)))
+				{
+					ysGlInkPixel(pix+(x+i)*4,ink);
+				}
+			}
+#endif
+		}
+	}
+	for(; x<n; x++,bits<<=1)
+	{
+		if(0!=(bits&0x80000000))
+		{
+			ysGlInkPixel(pix+x*4,ink);
+		}
+	}
+}
+
+/* 32 pixels of a font line from pixel x on, the first one in the high bit. */
+static unsigned int ysGlFontLineBits(const unsigned char fontLine[],unsigned int bytePerFontLine,int x)
+{
+	const unsigned int byteLoc=(x>>3),bitShift=(x&7);
+	unsigned int bits;
+	if(byteLoc+4<=bytePerFontLine)
+	{
+		bits=((unsigned int)fontLine[byteLoc]<<24)|(fontLine[byteLoc+1]<<16)|(fontLine[byteLoc+2]<<8)|fontLine[byteLoc+3];
+	}
+	else
+	{
+		unsigned int i;
+		bits=0;
+		for(i=0; i<4; i++)
+		{
+			bits=(bits<<8)|(byteLoc+i<bytePerFontLine ? fontLine[byteLoc+i] : 0);
+		}
+	}
+	if(0!=bitShift)
+	{
+		bits<<=bitShift;
+		if(byteLoc+4<bytePerFontLine)
+		{
+			bits|=(fontLine[byteLoc+4]>>(8-bitShift));
+		}
+	}
+	return bits;
+}
+
+/* Fills in the SSE2 copies of the ink, from the members its kind sets. */
+static void ysGlPrepareInk(struct YsGlRGBA8Ink *ink)
+{
+#ifdef YSGL_SSE2
+	if(0!=ink->overwrite)
+	{
+		ink->color4=_mm_set1_epi32(
+		    ink->color[0]|(ink->color[1]<<8)|(ink->color[2]<<16)|((int)ink->color[3]<<24));
+	}
+	else
+	{
+		ink->inv8=_mm_set1_epi16((short)ink->inv);
+		ink->srcTerm2=_mm_set_epi16(
+		    (short)ink->srcTerm[3],(short)ink->srcTerm[2],(short)ink->srcTerm[1],(short)ink->srcTerm[0],
+		    (short)ink->srcTerm[3],(short)ink->srcTerm[2],(short)ink->srcTerm[1],(short)ink->srcTerm[0]);
+	}
+#else
+	(void)ink;
+#endif
+}
+
+static int ysGlInkStringToRGBA8Bitmap(
+    const char str[],const struct YsGlRGBA8Ink *ink,
     unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
     int bottomLeftX,int bottomLeftY,
+    int clipX0,int clipY0,int clipX1,int clipY1,
     unsigned char *const fontPtr[],int fontWid,int fontHei)
-/* In OpenGL:   c0=r  c1=g  c2=b  c3=a
-   In Direct3D: c0=a  c1=r  c2=g  c3=b */
 {
-	int bmpY0,bmpX,fontY0;
-	int strPtr;
-
 	const unsigned int bytePerBmpLine=bmpWid*4;
 	const unsigned int bytePerFontLine=((fontWid+31)/32)*4;
+	int strPtr,bmpX,fontY0,fontY1;
 
-	unsigned char *bmpLineTop0;
-
-	if(bottomLeftY<0)
+	if(clipX0<0)
 	{
-		fontY0=-bottomLeftY;
-		bmpY0=0;
+		clipX0=0;
 	}
-	else
+	if(clipY0<0)
 	{
-		fontY0=0;
-		bmpY0=bottomLeftY;
+		clipY0=0;
+	}
+	if((int)bmpWid<clipX1)
+	{
+		clipX1=(int)bmpWid;
+	}
+	if((int)bmpHei<clipY1)
+	{
+		clipY1=(int)bmpHei;
 	}
 
-	bmpLineTop0=bmpPtr+bytePerBmpLine*bmpY0;
-
+	fontY0=(bottomLeftY<clipY0 ? clipY0-bottomLeftY : 0);
+	fontY1=(clipY1<bottomLeftY+fontHei ? clipY1-bottomLeftY : fontHei);
+	if(fontY1<=fontY0 || clipX1<=clipX0)
+	{
+		return 0;
+	}
 
 	bmpX=bottomLeftX;
-	for(strPtr=0; 0!=str[strPtr]; strPtr++,bmpX+=fontWid)
+	for(strPtr=0; 0!=str[strPtr] && bmpX<clipX1; strPtr++,bmpX+=fontWid)
 	{
 		const unsigned char c=str[strPtr];
-		unsigned char *bmpLineTop;
-		unsigned char *fontLineTop;
-
-		int fontY=fontY0;
-		int bmpY=bmpY0;
-
-		int x;
-		unsigned int fontX;
-		unsigned int bit;
+		const int x0=(bmpX<clipX0 ? clipX0-bmpX : 0);
+		const int x1=(clipX1<bmpX+fontWid ? clipX1-bmpX : fontWid);
+		int fontY;
 
-		if(bmpX<=-fontWid)
+		if(x1<=x0)
 		{
 			continue;
 		}
 
-		bmpLineTop=bmpLineTop0;
-		fontLineTop=fontPtr[c]+bytePerFontLine*fontY0;
-
-
-		while(fontY<fontHei && bmpY<bmpHei)
+		for(fontY=fontY0; fontY<fontY1; fontY++)
 		{
-			fontX=0;
-			bit=fontLineTop[fontX];
-
-			x=0;
-
-			while(x+bmpX<0)
+			const unsigned char *fontLine=fontPtr[c]+bytePerFontLine*fontY;
+			unsigned char *bmpLine=bmpPtr+bytePerBmpLine*(bottomLeftY+fontY);
+			int x;
+			for(x=x0; x<x1; x+=32)
 			{
-				bit<<=1;
-				if(7==(x&7))
+				const unsigned int bits=ysGlFontLineBits(fontLine,bytePerFontLine,x);
+				if(0!=bits)
 				{
-					bit=fontLineTop[++fontX];
+					ysGlInkSpan(bmpLine+(bmpX+x)*4,bits,(x1-x<32 ? x1-x : 32),ink);
 				}
-				x++;
 			}
+		}
+	}
 
-			for(x=x; x<fontWid && x+bmpX<bmpWid; x++)
-			{
-				if(bit&0x80)
-				{
-					unsigned int bmpXTimes4=((x+bmpX)<<2);
-					bmpLineTop[bmpXTimes4  ]=c0;
-					bmpLineTop[bmpXTimes4+1]=c1;
-					bmpLineTop[bmpXTimes4+2]=c2;
-					bmpLineTop[bmpXTimes4+3]=c3;
-				}
+	return 0;
+}
 
-				bit<<=1;
-				if(7==(x&7))
-				{
-					bit=fontLineTop[++fontX];
-				}
-			}
+static void ysGlMakeBlendInk(struct YsGlRGBA8Ink *ink,unsigned int r,unsigned int g,unsigned int b,unsigned int a)
+{
+	ink->overwrite=0;
+	ink->inv=(unsigned short)(255-a);
+	ink->srcTerm[0]=(unsigned short)(r*a+128);
+	ink->srcTerm[1]=(unsigned short)(g*a+128);
+	ink->srcTerm[2]=(unsigned short)(b*a+128);
+	ink->srcTerm[3]=(unsigned short)(255*a+128);
+}
 
-			bmpLineTop+=bytePerBmpLine;
-			fontLineTop+=bytePerFontLine;
 
-			fontY++;
-			bmpY++;
-		}
-	}
 
-	return 0;
+int YsGlWriteStringToRGBA8Bitmap(
+    const char str[],unsigned int c0,unsigned int c1,unsigned int c2,unsigned int c3,
+    unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
+    int bottomLeftX,int bottomLeftY,
+    unsigned char *const fontPtr[],int fontWid,int fontHei)
+/* In OpenGL:   c0=r  c1=g  c2=b  c3=a
+   In Direct3D: c0=a  c1=r  c2=g  c3=b */
+{
+	struct YsGlRGBA8Ink ink;
+	ink.overwrite=1;
+	ink.color[0]=(unsigned char)c0;
+	ink.color[1]=(unsigned char)c1;
+	ink.color[2]=(unsigned char)c2;
+	ink.color[3]=(unsigned char)c3;
+	ink.inv=0;
+	ysGlPrepareInk(&ink);
+	return ysGlInkStringToRGBA8Bitmap(str,&ink,bmpPtr,bmpWid,bmpHei,bottomLeftX,bottomLeftY,
+	    0,0,(int)bmpWid,(int)bmpHei,fontPtr,fontWid,fontHei);
+}
+
+
+
+int YsGlBlendStringToRGBA8Bitmap(
+    const char str[],unsigned int r,unsigned int g,unsigned int b,unsigned int a,
+    unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
+    int bottomLeftX,int bottomLeftY,
+    unsigned char *const fontPtr[],int fontWid,int fontHei)
+/* Same as YsGlWriteStringToRGBA8Bitmap, but blends the color over the bitmap
+   like glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA) instead of overwriting
+   the pixels.  The destination alpha becomes a+dst*(255-a)/255.  a=255 gives
+   the same bitmap as YsGlWriteStringToRGBA8Bitmap. */
+{
+	return YsGlBlendStringToRGBA8BitmapClip(str,r,g,b,a,bmpPtr,bmpWid,bmpHei,bottomLeftX,bottomLeftY,
+	    0,0,(int)bmpWid,(int)bmpHei,fontPtr,fontWid,fontHei);
 }
 
 
 
+int YsGlBlendStringToRGBA8BitmapClip(
+    const char str[],unsigned int r,unsigned int g,unsigned int b,unsigned int a,
+    unsigned char bmpPtr[],unsigned int bmpWid,unsigned int bmpHei,
+    int bottomLeftX,int bottomLeftY,
+    int clipX0,int clipY0,int clipX1,int clipY1,
+    unsigned char *const fontPtr[],int fontWid,int fontHei)
+/* YsGlBlendStringToRGBA8Bitmap that only touches the pixels clipX0<=x<clipX1,
+   clipY0<=y<clipY1, so that threads can each fill their own part of a bitmap. */
+{
+	struct YsGlRGBA8Ink ink;
+	if(0==a)
+	{
+		return 0;
+	}
+	ysGlMakeBlendInk(&ink,r,g,b,a);
+	ysGlPrepareInk(&ink);
+	return ysGlInkStringToRGBA8Bitmap(str,&ink,bmpPtr,bmpWid,bmpHei,bottomLeftX,bottomLeftY,
+	    clipX0,clipY0,clipX1,clipY1,fontPtr,fontWid,fontHei);
+}
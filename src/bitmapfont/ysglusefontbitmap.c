@@ -15,7 +15,7 @@
 #include "ysglfontdata.h"
 
 
-static void ysGlMakeFontBitmapDisplayList(int listBase,unsigned char *fontPtr[],int wid,int hei)
+static void ysGlMakeFontBitmapDisplayList(int listBase,unsigned char *const fontPtr[],int wid,int hei)
 {
 	int i;
 	glRasterPos2i(0,0);
@@ -27,7 +27,7 @@ static void ysGlMakeFontBitmapDisplayList(int listBase,unsigned char *fontPtr[],
 	}
 }
 
-static void ysGlDrawFontBitmapDirect(const char str[],unsigned char *fontPtr[],int wid,int hei)
+static void ysGlDrawFontBitmapDirect(const char str[],unsigned char *const fontPtr[],int wid,int hei)
 {
 	int i;
 	for(i=0; 0!=str[i]; i++)
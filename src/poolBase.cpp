@@ -19,6 +19,9 @@
 #include "fssimplewindow.h"
 #include "wcode/fswin32keymap.h"
 #include "bitmapfont\ysglfontdata.h"
+#include "SimSnapshot.h"
+#include "CircleRenderer.h"
+#include "TextRenderer.h"
 
 typedef enum
 {
@@ -53,55 +56,9 @@ BallS *sBalls = NULL;
 bool **collisionFlags = NULL;
 
 //////////////////////////////////////////////////////////////////////////////////////
-void DrawCircle(double cx, double cy, int i) 
-{ 
-	double theta = 2. * PI / double(num_segments); 
-	double c = cos(theta);//precalculate the sine and cosine
-	double s = sin(theta);
-
-	double x = sBalls[i].radius;//we start at angle = 0 
-	double y = 0.; 
- 	double t = x;
-   
-	glColor3ub(sBalls[i].colorx,sBalls[i].colory,sBalls[i].colorz);
-	glBegin(GL_LINE_LOOP); 
-	for(int i = 0; i < num_segments; i++) 
-	{ 
-		glVertex2d(x + cx, y + cy);
-		//apply the rotation matrix
-		t = x;
-		x = c * x - s * y;
-		y = s * t + c * y;
-	} 
-	glEnd(); 
-}
+CircleRenderer circles(num_segments);	// every ball in one draw call
+TextRenderer menuText(YsFont8x12, 8, 12);	// all menu text in one draw call
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DrawSolidCircle(double cx, double cy, int i) 
-{ 
-	double theta = 2. * PI / double(num_segments); 
-	double c = cos(theta);//precalculate the sine and cosine
-	double s = sin(theta);
-
-	glColor3ub(sBalls[i].colorx,sBalls[i].colory,sBalls[i].colorz);
-	double x = sBalls[i].radius;  
-	double y = 0; 
-	double t = x;
-	glBegin(GL_TRIANGLE_FAN); 
-	glVertex2d(cx, cy);
-	for(int i = 0; i < num_segments; i++) 
-	{ 
-		glVertex2d(x + cx, y + cy);//output vertex 
-        
-		//apply the rotation matrix
-		t = x;
-		x = c * x - s * y;
-		y = s * t + c * y;
-	} 
-
-	glVertex2d(sBalls[i].radius + cx, cy);
-	glEnd(); 
-}
 //////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,21 +116,16 @@ int Menu(void)
 		char sRadius[128];
 		sprintf(sRadius, "ball-ball restitution factor is %f. Use Left/Right keys to change it by 0.1!\n", restitution);
 
-		glColor3ub(255,255,255);
-
-		glRasterPos2i(32,32);
-		glCallLists(strlen(sSpeed),GL_UNSIGNED_BYTE,sSpeed);
-		glRasterPos2i(32,64);
-		glCallLists(strlen(sRadius),GL_UNSIGNED_BYTE,sRadius);
-		glRasterPos2i(32,96);
-		glCallLists(strlen(sBallCnt),GL_UNSIGNED_BYTE,sBallCnt);
+		menuText.clear();
+		menuText.add(32, 32, sSpeed, 255, 255, 255);
+		menuText.add(32, 64, sRadius, 255, 255, 255);
+		menuText.add(32, 96, sBallCnt, 255, 255, 255);
 
 		const char *msg1="G.....Start Game\n";
 		const char *msg2="ESC...Exit";
-		glRasterPos2i(32,160);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
-		glRasterPos2i(32,192);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		menuText.add(32, 160, msg1, 255, 255, 255);
+		menuText.add(32, 192, msg2, 255, 255, 255);
+		menuText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -270,18 +222,38 @@ void updatePhysics(double timeInc, int width, int height)
 //////////////////////////////////////////////////////
 void renderScene()
 {
-	////// render balls ///////////////////
+	////// render balls, colliding ones hollow ///////////////////
+	circles.clear();
 	for (int j = 0; j < BallCount; j++)
 	{
+		BallS &b = sBalls[j];
 		if (!ballCollides(j))
-			DrawSolidCircle(sBalls[j].x, sBalls[j].y, j);
+			circles.addSolid(float(b.x), float(b.y), float(b.radius), b.colorx, b.colory, b.colorz);
 		else
-			DrawCircle(sBalls[j].x, sBalls[j].y, j);
+			circles.addRing(float(b.x), float(b.y), float(b.radius), 1.0f, b.colorx, b.colory, b.colorz);
 	}
+	circles.draw();
 	////  swap //////////
 	FsSwapBuffers();
 }
 
+////////////////////////////
+// checkpoints hold the ball array; a restore needs the same BallCount
+const char *checkpointFile = "poolBase.snp";
+const int checkpointSteps = 30;
+const unsigned int tagBalls = SNAPSHOT_TAG('B', 'A', 'L', 'L');
+
+void captureState(SnapshotState &state)
+{
+	state.addArray(tagBalls, sBalls, BallCount);
+}
+
+bool restoreState(const char *fileName)
+{
+	SnapshotState state;
+	return loadSnapshot(fileName, state) && state.getArray(tagBalls, sBalls, BallCount);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 int Game(void)
 {
@@ -321,6 +293,10 @@ int Game(void)
 	glClearColor(1.0,1.0,1.0,1.0);
 	glClear(GL_COLOR_BUFFER_BIT);
 
+	SnapshotWriter checkpoints;
+	bool checkpointing = false;
+	int steps = 0;
+
 	////////////////////// main simulation loop //////////////////////////
 	while(1)
 	{
@@ -332,10 +308,27 @@ int Game(void)
 		int key=FsInkey();
 		if(key == FSKEY_ESC)
 			break;
+		if(key == FSKEY_C)
+		{
+			checkpointing = !checkpointing;
+			if(checkpointing)
+				checkpoints.begin(checkpointFile);
+		}
+		if(key == FSKEY_L)
+		{
+			checkpoints.flush();
+			restoreState(checkpointFile);
+		}
 		timeInc = (double)(passedTime) * 0.001;
 
 		/////////// update physics /////////////////
 		updatePhysics(timeInc, width, height);
+		if(checkpointing && ++steps % checkpointSteps == 0)
+		{
+			SnapshotState state;
+			captureState(state);
+			checkpoints.submit(state);
+		}
 		
 		renderScene();
 		
@@ -383,14 +376,13 @@ void GameOver(int score)
 
 		const char *msg1="Game Over";
 		char msg2[256];
-		glColor3ub(255,255,255);
-		glRasterPos2i(32,32);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
+		menuText.clear();
+		menuText.add(32, 32, msg1, 255, 255, 255);
 
 		sprintf(msg2,"Your score is %d",score);
 
-		glRasterPos2i(32,48);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		menuText.add(32, 48, msg2, 255, 255, 255);
+		menuText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -402,10 +394,7 @@ int main(void)
 	int menu;
 	FsOpenWindow(32,32,800,600,1); // 800x600 pixels, useDoubleBuffer=1
 
-	int listBase;
-	listBase=glGenLists(256);
-	YsGlUseFontBitmap8x12(listBase);
-	glListBase(listBase);
+	menuText.init();
 
 	glDisable(GL_DEPTH_TEST);
 	glDisable(GL_LIGHTING);
@@ -4,6 +4,9 @@
 #include <stddef.h>
 #include <string.h>
 #include <windows.h>
+#include "Geometry.h"
+#include "ShadowMap.h"
+#include "ProceduralTexture.h"
 
 #ifdef __APPLE__
 #include < GLUT/glut.h>
@@ -52,78 +55,8 @@ DWORD FsPassedTime(bool update=false)
 	return passed;
 }
 
-/* Rendering shadows using projective shadows. */
-
-/* Create a single component texture map */
-GLfloat *make_texture(int maxs, int maxt)
-{
-  int s, t;
-  static GLfloat *texture;
-
-  texture = (GLfloat *) malloc(maxs * maxt * sizeof(GLfloat));
-  for (t = 0; t < maxt; t++) {
-    for (s = 0; s < maxs; s++) {
-      texture[s + maxs * t] = 1.f - (((s >> 4) & 0x1) ^ ((t >> 4) & 0x1)) *0.5f;
-    }
-  }
-  return texture;
-}
-
-
-/* create a matrix that will project the desired shadow */
-void shadowmatrix(GLfloat shadowMat[4][4], GLfloat groundplane[4], GLfloat lightpos[4])
-{
-  GLfloat dot;
-
-  /* find dot product between light position vector and ground plane normal */
-  dot = groundplane[X] * lightpos[X] +
-    groundplane[Y] * lightpos[Y] +
-    groundplane[Z] * lightpos[Z] +
-    groundplane[W] * lightpos[W];
-
-  shadowMat[0][0] = dot - lightpos[X] * groundplane[X];
-  shadowMat[1][0] = 0.f - lightpos[X] * groundplane[Y];
-  shadowMat[2][0] = 0.f - lightpos[X] * groundplane[Z];
-  shadowMat[3][0] = 0.f - lightpos[X] * groundplane[W];
-
-  shadowMat[X][1] = 0.f - lightpos[Y] * groundplane[X];
-  shadowMat[1][1] = dot - lightpos[Y] * groundplane[Y];
-  shadowMat[2][1] = 0.f - lightpos[Y] * groundplane[Z];
-  shadowMat[3][1] = 0.f - lightpos[Y] * groundplane[W];
-
-  shadowMat[X][2] = 0.f - lightpos[Z] * groundplane[X];
-  shadowMat[1][2] = 0.f - lightpos[Z] * groundplane[Y];
-  shadowMat[2][2] = dot - lightpos[Z] * groundplane[Z];
-  shadowMat[3][2] = 0.f - lightpos[Z] * groundplane[W];
-
-  shadowMat[X][3] = 0.f - lightpos[W] * groundplane[X];
-  shadowMat[1][3] = 0.f - lightpos[W] * groundplane[Y];
-  shadowMat[2][3] = 0.f - lightpos[W] * groundplane[Z];
-  shadowMat[3][3] = dot - lightpos[W] * groundplane[W];
-
-}
-
-/* find the plane equation given 3 points */
-void findplane(GLfloat plane[4], GLfloat v0[3], GLfloat v1[3], GLfloat v2[3])
-{
-  GLfloat vec0[3], vec1[3];
-
-  /* need 2 vectors to find cross product */
-  vec0[X] = v1[X] - v0[X];
-  vec0[Y] = v1[Y] - v0[Y];
-  vec0[Z] = v1[Z] - v0[Z];
-
-  vec1[X] = v2[X] - v0[X];
-  vec1[Y] = v2[Y] - v0[Y];
-  vec1[Z] = v2[Z] - v0[Z];
-
-  /* find cross product to get A, B, and C of plane equation */
-  plane[A] = vec0[Y] * vec1[Z] - vec0[Z] * vec1[Y];
-  plane[B] = -(vec0[X] * vec1[Z] - vec0[Z] * vec1[X]);
-  plane[C] = vec0[X] * vec1[Y] - vec0[Y] * vec1[X];
-
-  plane[D] = -(plane[A] * v0[X] + plane[B] * v0[Y] + plane[C] * v0[Z]);
-}
+/* Rendering shadows using projective shadows, or a shadow map where the
+   driver has shaders and framebuffer objects. */
 
 GLfloat PosX = 60.f, PosY = -50.f, PosZ = -360.f;
 void sphere(void)
@@ -146,19 +79,25 @@ void cone(void)
 
 enum 
 {
-  NONE, SHADOW
+  NONE, SHADOW, SHADOWMAP
 };
 
+/* the light's depth map; it looks from the light down into the room */
+ShadowMap shadowMap(512);
+
 int rendermode = SHADOW;
 
 void menu(int mode)
 {
+  if (mode == SHADOWMAP && !shadowMap.isReady())
+    return;
   rendermode = mode;
   glutPostRedisplay();
 }
 
-GLfloat leftwallshadow[4][4];
-GLfloat floorshadow[4][4];
+/* matrices that project onto the floor and the left wall as seen from the light */
+Matrix4 leftwallshadow;
+Matrix4 floorshadow;
 
 GLfloat lightpos[] = {50.f, 50.f, -320.f, 1.f};
 
@@ -187,8 +126,20 @@ void redraw(void)
   static GLfloat sphere_mat[] = {1.f, .5f, 0.f, 1.f};
   static GLfloat cone_mat[] = {0.f, .5f, 1.f, 1.f};
 
+  /* one pass from the light with the casters; every surface below reads it */
+  if (rendermode == SHADOWMAP)
+  {
+    shadowMap.beginDepthPass();
+    sphere();
+    shadowMap.endDepthPass();
+  }
+
   glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
+  /* the camera is at the origin, so the camera view is the identity */
+  if (rendermode == SHADOWMAP)
+    shadowMap.beginLighting(Matrix4());
+
   /* Note: wall verticies are ordered so they are all front facing this lets
      me do back face culling to speed things up.  */
 
@@ -201,6 +152,8 @@ void redraw(void)
      a separate glBegin()/glEnd() sequence. You can't turn texturing on and
      off between begin and end calls */
   glEnable(GL_TEXTURE_2D);
+  if (rendermode == SHADOWMAP)
+    shadowMap.setTextured(true);
   glBegin(GL_QUADS);
 	  glColor3f(1.f, 0.f, 0.f);
 	  glNormal3f(0.f, 1.f, 0.f);
@@ -213,6 +166,8 @@ void redraw(void)
 	  glTexCoord2i(0, 1);
 	  glVertex3f(-100.f, -100.f, -520.f);
   glEnd();
+  if (rendermode == SHADOWMAP)
+    shadowMap.setTextured(false);
   glDisable(GL_TEXTURE_2D);
 
   if (rendermode == SHADOW)
@@ -222,12 +177,12 @@ void redraw(void)
     glColor3f(0.f, 0.f, 0.f);  /* shadow color */
 
  /*   glPushMatrix();
-    glMultMatrixf((GLfloat *) floorshadow);
+    glMultMatrixf(floorshadow.get());
     cone();
     glPopMatrix();
 */
     glPushMatrix();
-    glMultMatrixf((GLfloat *) floorshadow);
+    glMultMatrixf(floorshadow.get());
     sphere();
     glPopMatrix();
     glEnable(GL_DEPTH_TEST);
@@ -260,7 +215,7 @@ void redraw(void)
     glColor3f(0.f, 0.f, 0.f);  /* shadow color */
     glDisable(GL_DEPTH_TEST);
     glPushMatrix();
-    glMultMatrixf((GLfloat *) leftwallshadow);
+    glMultMatrixf(leftwallshadow.get());
     cone();
     glPopMatrix();
     glEnable(GL_DEPTH_TEST);
@@ -291,6 +246,15 @@ void redraw(void)
   glVertex3f(-100.f, 100.f, -520.f);
   glEnd();
 
+  //glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, cone_mat);
+  //cone();
+
+  glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, sphere_mat);
+  sphere();
+
+  if (rendermode == SHADOWMAP)
+    shadowMap.endLighting();
+
   glPushMatrix();
   glTranslatef(lightpos[X], lightpos[Y], lightpos[Z]);
   glDisable(GL_LIGHTING);
@@ -299,12 +263,6 @@ void redraw(void)
   glEnable(GL_LIGHTING);
   glPopMatrix();
 
-  //glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, cone_mat);
-  //cone();
-
-  glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, sphere_mat);
-  sphere();
-
   glutSwapBuffers();    /* high end machines may need this */
 
 
@@ -335,10 +293,7 @@ const int TEXDIM = 256;
 
 int main(int argc, char *argv[])
 {
-  GLfloat *tex;
   GLUquadricObj *sphereObj, *coneObj, *base;
-  GLfloat plane[4];
-  GLfloat v0[3], v1[3], v2[3];
 
   FsPassedTime(true);
   passedTime = 0;
@@ -352,7 +307,8 @@ int main(int argc, char *argv[])
   glutIdleFunc(update);
   glutCreateMenu(menu);
   glutAddMenuEntry("No Shadows", NONE);
-  glutAddMenuEntry("Shadows", SHADOW);
+  glutAddMenuEntry("Projected Shadows", SHADOW);
+  glutAddMenuEntry("Shadow Map", SHADOWMAP);
   glutAttachMenu(GLUT_RIGHT_BUTTON);
 
   /* draw a perspective scene */
@@ -368,36 +324,24 @@ int main(int argc, char *argv[])
   /* make shadow matricies */
 
   /* 3 points on floor */
-  v0[X] = -100.f;
-  v0[Y] = -100.f;
-  v0[Z] = -320.f;
-  v1[X] = 100.f;
-  v1[Y] = -100.f;
-  v1[Z] = -320.f;
-  v2[X] = 100.f;
-  v2[Y] = -100.f;
-  v2[Z] = -520.f;
-
-  findplane(plane, v0, v1, v2);
-  shadowmatrix(floorshadow, plane, lightpos);
+  Plane floor = Plane::fromPoints(Vector3(-100.f, -100.f, -320.f), Vector3(100.f, -100.f, -320.f),
+    Vector3(100.f, -100.f, -520.f));
+  floorshadow = shadowMatrix(floor, Vector4(lightpos[X], lightpos[Y], lightpos[Z], lightpos[W]));
 
   /* 3 points on left wall */
-  v0[X] = -100.f;
-  v0[Y] = -100.f;
-  v0[Z] = -320.f;
-  v1[X] = -100.f;
-  v1[Y] = -100.f;
-  v1[Z] = -520.f;
-  v2[X] = -100.f;
-  v2[Y] = 100.f;
-  v2[Z] = -520.f;
-
-  findplane(plane, v0, v1, v2);
-  shadowmatrix(leftwallshadow, plane, lightpos);
+  Plane leftwall = Plane::fromPoints(Vector3(-100.f, -100.f, -320.f), Vector3(-100.f, -100.f, -520.f),
+    Vector3(-100.f, 100.f, -520.f));
+  leftwallshadow = shadowMatrix(leftwall, Vector4(lightpos[X], lightpos[Y], lightpos[Z], lightpos[W]));
 
   /* place light 0 in the right place */
   glLightfv(GL_LIGHT0, GL_POSITION, lightpos);
 
+  /* a 140 degree spot light covers the floor, the back wall and most of the
+     left one; without shaders the projected shadows stay on */
+  shadowMap.setLight(Vector3(lightpos[X], lightpos[Y], lightpos[Z]), Vector3(-30.f, -80.f, -460.f), 140.f, 10.f, 400.f);
+  if (shadowMap.init())
+    rendermode = SHADOWMAP;
+
   /* remove back faces to speed things up */
   glCullFace(GL_BACK);
 
@@ -434,9 +378,7 @@ int main(int argc, char *argv[])
   glEndList();
 */
   /* load pattern for current 2d texture */
-  tex = make_texture(TEXDIM, TEXDIM);
-  glTexImage2D(GL_TEXTURE_2D, 0, 1, TEXDIM, TEXDIM, 0, GL_RED, GL_FLOAT, tex);
-  free(tex);
+  uploadProceduralTexture(getCheckerTexture(TEXDIM, TEXDIM, 16, 255, 128));
 
   glutMainLoop();
   return 0;             /* ANSI C requires main to return int. */
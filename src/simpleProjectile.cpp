@@ -16,6 +16,10 @@
 
 #include "fssimplewindow.h"
 #include "bitmapfont/ysglfontdata.h"
+#include "ProjectileStep.h"
+#include "ProjectileSweep.h"
+#include "TrajectoryBench.h"
+#include "TextRenderer.h"
 
 typedef enum 
 {
@@ -43,6 +47,7 @@ float WorldHeight = WorldWidth * ratio; //
 int width = 0, height = 0;
 
 static double clocktime = 0.f;
+TextRenderer gText(YsFont8x12, 8, 12);	// menu and HUD text in one draw call
 
 struct Circle2D
 {
@@ -177,23 +182,19 @@ int Menu(void)
 
 		glClearColor(0.0,0.0,0.0,0.0);
 		glClear(GL_COLOR_BUFFER_BIT);
-		glColor3ub(127,127,127);
 
 		char sSpeed[128];
 		sprintf(sSpeed, "Initial ball speed is %f m/s. Use Up/Down keys to change it!\n", iSpeed);
 		char sAngle[128];
 		sprintf(sAngle, "Initial horizon Angle is %f degrees. Use Left/Right keys to change it!\n", iAngle*180./PI);
-		glColor3ub(255,255,255);
-		glRasterPos2i(32,32);
-		glCallLists(strlen(sSpeed),GL_UNSIGNED_BYTE,sSpeed);
-		glRasterPos2i(32,64);
-		glCallLists(strlen(sAngle),GL_UNSIGNED_BYTE,sAngle);
+		gText.clear();
+		gText.add(32, 32, sSpeed, 255, 255, 255);
+		gText.add(32, 64, sAngle, 255, 255, 255);
 		const char *msg1="S.....Start Game";
 		const char *msg2="ESC...Exit";
-		glRasterPos2i(32,96);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
-		glRasterPos2i(32,128);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		gText.add(32, 96, msg1, 255, 255, 255);
+		gText.add(32, 128, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -239,14 +240,13 @@ void renderScene()
 	realBall.DrawCircle(0, circleSections);
 
 	///////////// draw the overlay HUD /////////////////////
-	glColor3ub(127, 127, 127);
+	gText.clear();
 	char str[256];
 	sprintf(str, "simBall1: pos(%f, %f), velocity(%f, %f)", simBall1.cx, simBall1.cy, simBall1.vx, simBall1.vy);
-	glRasterPos2i(32, height-32);
-	glCallLists(strlen(str), GL_UNSIGNED_BYTE, str);
+	gText.add(32, height-32, str, 127, 127, 127);
 	sprintf(str, "real: pos(%f, %f), velocity(%f, %f)", realBall.cx, realBall.cy, realBall.vx, realBall.vy);
-	glRasterPos2i(32, height - 64);
-	glCallLists(strlen(str), GL_UNSIGNED_BYTE, str);
+	gText.add(32, height - 64, str, 127, 127, 127);
+	gText.draw();
 
 	FsSwapBuffers();
 }
@@ -256,11 +256,9 @@ void updateNumPhysics(Circle2D &ball, double timeInc)
 	//////////// your physics goes here //////////////////////////
 	// we use a coordinate system in which x goes from left to right of the screen and y goes from top to bottom of the screen
 	// we have 1 forces here: 1) gravity which is in positive y direction. 
-	//////////////Explicit Euler Integration:///////////////////////
-	ball.cx += ball.vx * timeInc; // x position update, x speed is constant.
-
-	ball.vy += gravity * timeInc; // y speed update
-	ball.cy += ball.vy * timeInc; // y position update
+	//////////////Semi-implicit Euler Integration (ProjectileStep.h, timed by -bench):///////////////////////
+	const ProjectileModel model = { gravity, 0.0 };
+	semiImplicitStep(model, timeInc, ball.cx, ball.cy, ball.vx, ball.vy);
 
 	/////////////////////check edge collision ////////////////////////////////////////
 	if (ball.cx<0 && ball.vx <0)
@@ -287,11 +285,13 @@ void updateNumPhysics(Circle2D &ball, double timeInc)
 /////////////////////////////////////////////////////////////////////////
 void updatePrecisePhysics(Circle2D &ball, double timeInc)
 {
-	double ax = 0;
-	ball.cx = ball.cix + ball.vix * timeInc; // +0.5 * ax * time * time; // x position update, x speed is constant.
-
-	ball.vy = ball.viy + gravity * timeInc; // y speed update
-	ball.cy = ball.ciy + ball.viy * timeInc + 0.5 * gravity * timeInc * timeInc; // y position update
+	// exact step from the state at the start of the frame (ProjectileStep.h, timed by -bench)
+	const ProjectileModel model = { gravity, 0.0 };
+	ball.cx = ball.cix;
+	ball.cy = ball.ciy;
+	ball.vx = ball.vix;
+	ball.vy = ball.viy;
+	ClosedFormStep(model, timeInc)(ball.cx, ball.cy, ball.vx, ball.vy);
 	
 	/////////////////////check edge collision ////////////////////////////////////////
 	if (ball.cx<0.f && ball.vx <0.f)
@@ -410,14 +410,13 @@ void GameOver(int score)
 
 		const char *msg1="Game Over";
 		char msg2[256];
-		glColor3ub(255,255,255);
-		glRasterPos2i(32,32);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE,msg1);
+		gText.clear();
+		gText.add(32, 32, msg1, 255, 255, 255);
 
 		sprintf(msg2,"Your score is %d",score);
 
-		glRasterPos2i(32,48);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE,msg2);
+		gText.add(32, 48, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -425,15 +424,33 @@ void GameOver(int score)
 }
 
 //////////////////////////////////////////////////////////////////////////////////////
-int main(void)
+int main(int argc, char *argv[])
 {
+	if (argc > 1 && strcmp(argv[1], "-sweep") == 0)
+	{
+		// batch mode: a grid around the menu settings, written as CSV
+		SweepParams params;
+		params.speed = SweepAxis(iSpeed * 0.5, iSpeed * 2.0, 64);
+		params.angle = SweepAxis(PI / 180., PI * 89. / 180., 89);
+		params.airResistance = SweepAxis(0.0, 0.0, 1);
+		params.friction = SweepAxis(0.0, 0.0, 1);
+		params.gravity = -gravity;
+		return runSweepCommand(argc - 2, argv + 2, params);
+	}
+	if (argc > 1 && strcmp(argv[1], "-bench") == 0)
+	{
+		// integrator accuracy/cost report for the menu launch settings
+		BenchConfig config;
+		config.speed = iSpeed;
+		config.angle = iAngle;
+		config.gravity = -gravity;
+		return runBenchCommand(argc - 2, argv + 2, config);
+	}
+
 	int menu;
 	FsOpenWindow(32, 32, winWidth, winHeight, 1); // 800x600 pixels, useDoubleBuffer=1
 
-	int listBase;
-	listBase=glGenLists(256);
-	YsGlUseFontBitmap8x12(listBase);
-	glListBase(listBase);
+	gText.init();
 
 	glDisable(GL_DEPTH_TEST);
 	glDisable(GL_LIGHTING);
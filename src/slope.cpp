@@ -21,6 +21,10 @@
 #include <random>
 //#include "vector2d.h"
 #include "vector3d.h"
+#include "SimSnapshot.h"
+#include "ProjectileSweep.h"
+#include "TextRenderer.h"
+#include "ProceduralTexture.h"
 
 using namespace std;
 
@@ -59,9 +63,9 @@ double radius = 1.;
 
 static double clocktime = 0.f;
 int framerate = 30;
+TextRenderer gText(YsFont8x12, 8, 12);	// all menu text in one draw call
 
 const int TEXDIM = 1024;
-GLfloat *tex;
 
 bool checkWindowResize();
 
@@ -208,22 +212,6 @@ struct Circle3D
 Circle3D simBall;
 
 
-/* Create a single component texture map */
-GLfloat *make_texture(int maxs, int maxt)
-{
-	int s, t;
-	static GLfloat *texture;
-
-	texture = (GLfloat *)malloc(maxs * maxt * sizeof(GLfloat));
-	for (t = 0; t < maxt; t++) {
-		for (s = 0; s < maxs; s++) {
-			texture[s + maxs * t] = (((s >> 4) & 0x1) ^ ((t >> 4) & 0x1));
-		}
-	}
-	return texture;
-}
-
-
 ///////////////////////////////////////////////////////////////
 void initPhysics(double rad, double speed, double angle)
 {
@@ -301,30 +289,25 @@ int Menu(void)
 		glClear(GL_COLOR_BUFFER_BIT);
 
 		// printing UI message info
-		glColor3f(1., 1., 1.);
+		gText.clear();
 		char msg[128];
 		sprintf_s(msg, "Friction is %f. Use Up/Down keys to change it by 1/10!\n", friction);
-		glRasterPos2i(32, 32);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 32, msg, 255, 255, 255);
 
 		sprintf_s(msg, "Slope Angle is %f degrees. Use Left/Right keys to change it!\n", iAngle*180. / PI);
-		glRasterPos2i(32,64);
-		glCallLists(strlen(msg),GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 64, msg, 255, 255, 255);
 
 		sprintf_s(msg, "Projectile speed is %f m/s. Use PageUp/PageDown keys to change it!\n", iSpeed);
-		glRasterPos2i(32, 96);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 96, msg, 255, 255, 255);
 
 		sprintf_s(msg, "Camera height is %f. Use I/K keys to change it!\n", eyeY);
-		glRasterPos2i(32, 128);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 128, msg, 255, 255, 255);
 
 		const char *msg1 = "S.....Start Game";
 		const char *msg2="ESC...Exit";
-		glRasterPos2i(32, 160);
-		glCallLists(strlen(msg1),GL_UNSIGNED_BYTE, msg1);
-		glRasterPos2i(32,192);
-		glCallLists(strlen(msg2),GL_UNSIGNED_BYTE, msg2);
+		gText.add(32, 160, msg1, 255, 255, 255);
+		gText.add(32, 192, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -438,6 +421,35 @@ void resetPhysics()
 	initPhysics(radius, iSpeed, iAngle);
 }
 
+// checkpoints hold the ball, the clock and whether the run is waiting for a restart
+const char *checkpointFile = "slope.snp";
+const int checkpointSteps = 30;
+const unsigned int tagBall = SNAPSHOT_TAG('B', 'A', 'L', 'L');
+const unsigned int tagClock = SNAPSHOT_TAG('C', 'L', 'O', 'K');
+const unsigned int tagReset = SNAPSHOT_TAG('R', 'S', 'E', 'T');
+
+void captureState(SnapshotState &state, bool resetFlag)
+{
+	state.addValue(tagBall, simBall);
+	state.addValue(tagClock, clocktime);
+	state.addValue(tagReset, (int)resetFlag);
+}
+
+bool restoreState(const char *fileName, bool &resetFlag)
+{
+	SnapshotState state;
+	Circle3D ball;
+	double clock;
+	int reset;
+	if (!loadSnapshot(fileName, state) || !state.getValue(tagBall, ball) ||
+		!state.getValue(tagClock, clock) || !state.getValue(tagReset, reset))
+		return false;
+	simBall = ball;
+	clocktime = clock;
+	resetFlag = reset != 0;
+	return true;
+}
+
 bool checkWindowResize()
 {
 	int wid, hei;
@@ -459,9 +471,7 @@ int Game(void)
 
 
 	/* load pattern for current 2d texture */
-	tex = make_texture(TEXDIM, TEXDIM);
-	glTexImage2D(GL_TEXTURE_2D, 0, 1, TEXDIM, TEXDIM, 0, GL_RED, GL_FLOAT, tex);
-	free(tex);
+	uploadProceduralTexture(getCheckerTexture(TEXDIM, TEXDIM, 16, 0, 255));
 
 //	int lb, mb, rb, mx, my;
 	DWORD passedTime = 0;
@@ -489,6 +499,9 @@ int Game(void)
 
 	glMatrixMode(GL_MODELVIEW);
 	bool resetFlag = false;
+	SnapshotWriter checkpoints;
+	bool checkpointing = false;
+	int steps = 0;
 	while(1)
 	{
 		if (checkWindowResize())
@@ -503,6 +516,17 @@ int Game(void)
 			break;
 		if (key == eStart)
 			resetFlag = false;
+		if (key == FSKEY_C)
+		{
+			checkpointing = !checkpointing;
+			if (checkpointing)
+				checkpoints.begin(checkpointFile);
+		}
+		if (key == FSKEY_L)
+		{
+			checkpoints.flush();
+			restoreState(checkpointFile, resetFlag);
+		}
 
 		timeInc = (double)(passedTime) * 0.001;
 		clocktime += timeInc;
@@ -515,6 +539,12 @@ int Game(void)
 		
 		if (!resetFlag)
 			updatePhysics(simBall, timeInc);
+		if (checkpointing && ++steps % checkpointSteps == 0)
+		{
+			SnapshotState state;
+			captureState(state, resetFlag);
+			checkpoints.submit(state);
+		}
 		/////////////////////////////////////////
 		renderScene();
 
@@ -535,14 +565,24 @@ int Game(void)
 }
 
 //////////////////////////////////////////////////////////////////////////////////////
-int main(void)
+int main(int argc, char *argv[])
 {
+	if (argc > 1 && strcmp(argv[1], "-sweep") == 0)
+	{
+		// batch mode: a grid around the menu settings, written as CSV
+		SweepParams params;
+		params.speed = SweepAxis(iSpeed * 0.5, iSpeed * 2.0, 64);
+		params.angle = SweepAxis(PI / 180., PI * 89. / 180., 89);
+		params.airResistance = SweepAxis(airResistance, airResistance, 1);
+		params.friction = SweepAxis(friction, friction, 1);
+		params.gravity = gravity;
+		return runSweepCommand(argc - 2, argv + 2, params);
+	}
+
 	int menu;
 	FsOpenWindow(32, 32, winWidth, winHeight, 1); // 800x600 pixels, useDoubleBuffer=1
 
-	int listBase = glGenLists(256);
-	YsGlUseFontBitmap8x12(listBase);
-	glListBase(listBase);
+	gText.init();
 
 	glDisable(GL_DEPTH_TEST);
 	glDisable(GL_LIGHTING);
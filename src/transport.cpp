@@ -2,7 +2,6 @@
 #include <string.h>
 #include <math.h>
 #include <vector>
-#include <assert.h>
 
 #ifdef WIN32
 #include <windows.h>
@@ -22,15 +21,21 @@
 #include <ctime>
 #include <random>
 #include "vector3d.h"
-#include  "matrices.h"
-
+#include  "Matrices.h"
+#include "Quaternion.h"
+#include "Camera.h"
+#include "TraceHistory.h"
+#include "TextRenderer.h"
+#include "ProceduralTexture.h"
+
+#include "SimSnapshot.h"
 #include "MilkshapeModel.h"				// Header File For Milkshape File
 
 #if  (_MSC_VER > 1800)
 #pragma comment( lib, "legacy_stdio_definitions.lib" )		// needed for VS 2015 While Linking ( NEW )
 #endif
 
-typedef Vector3d<float> MathVec;
+typedef Vector3d<float> MathVec;		// the same type as Vector3, so it goes straight into Matrix4
 typedef Vector3d<USHORT> MathVecS;
 
 typedef enum
@@ -74,11 +79,9 @@ static float clocktime = 0.f;
 int framerate = 30;
 
 bool checkWindowResize();
-struct TracePoint
-{
-	MathVec position;
-	MathVecS color;
-};
+Camera gCamera;
+TextRenderer gText(YsFont8x12, 8, 12);	// all menu text in one draw call
+ModelViewBatch gFrameTransforms;	// model matrices of the objects drawn this frame
 struct Object3D
 {
 	MathVec pos, acc;
@@ -86,17 +89,18 @@ struct Object3D
 	int red, green, blue;
 	float tParam;
 	float mass;
-	static const size_t maxPointCount = 10000;
-	TracePoint posTrace[maxPointCount];
-	int traceCount;
-
-	TracePoint &SetNextTracePoint(float timeInc)
+	TraceHistory trace;		// every point so far, the older ones simplified
+	TraceStream traceStream;	// its full-resolution end on the GPU; it gets only the points added since the last draw
+	std::vector<TraceVertex> coarseTrace;	// its simplified part, rebuilt when that changes
+	unsigned int coarseRevision;
+	Quaternion spin;		// orientation of the frame and the model
+	int frameSlot, modelSlot;	// their matrices in the frame's ModelViewBatch
+
+	void SetNextTracePoint(float timeInc)
 	{
-		assert(traceCount < maxPointCount);
-		posTrace[traceCount].position = pos;
 		MathVec velF;
-		if(traceCount > 0)
-			velF = MathVec(pos - posTrace[traceCount - 1].position);
+		if (!trace.empty())
+			velF = pos - MathVec(trace.back().x, trace.back().y, trace.back().z);
 		
 		vel.x = min(max((int)velF.x, FLT_MIN), 255); 
 		vel.y = min(max((int)velF.y, FLT_MIN), 255); 
@@ -104,10 +108,44 @@ struct Object3D
 		//if(timeInc > FLT_MIN)
 		//vel /= timeInc;
 	//	std::cout << velF.x<<","<<velF.y<<","<<velF.z<< "=" << vel.x<<","<<vel.y<<","<<vel.z<< std::endl;
-		posTrace[traceCount].color = vel;
-		return posTrace[traceCount++];
+		TraceVertex tp = { pos.x, pos.y, pos.z, (unsigned char)min((int)vel.x, 255),
+			(unsigned char)min((int)vel.y, 255), (unsigned char)min((int)vel.z, 255), 255 };
+		trace.append(tp);
+		traceStream.append(tp);
+	}
+	Object3D() : traceStream(trace.getFullSpan()) { coarseRevision = trace.getRevision(); frameSlot = modelSlot = 0; }
+
+	// the body and its trace; between simplifications the trace only grows at
+	// its end, so most delta checkpoints carry just its new points
+	void capture(SnapshotState &state) const
+	{
+		state.addValue(SNAPSHOT_TAG('P', 'O', 'S', ' '), pos);
+		state.addValue(SNAPSHOT_TAG('A', 'C', 'C', ' '), acc);
+		state.addValue(SNAPSHOT_TAG('V', 'E', 'L', ' '), vel);
+		int scalars[3] = { red, green, blue };
+		state.addArray(SNAPSHOT_TAG('C', 'O', 'L', 'R'), scalars, 3);
+		float params[2] = { tParam, mass };
+		state.addArray(SNAPSHOT_TAG('P', 'A', 'R', 'M'), params, 2);
+		trace.capture(state);
+	}
+	bool restore(const SnapshotState &state)
+	{
+		int scalars[3];
+		float params[2];
+		if (!trace.restore(state) ||
+			!state.getValue(SNAPSHOT_TAG('P', 'O', 'S', ' '), pos) || !state.getValue(SNAPSHOT_TAG('A', 'C', 'C', ' '), acc) ||
+			!state.getValue(SNAPSHOT_TAG('V', 'E', 'L', ' '), vel) || !state.getArray(SNAPSHOT_TAG('C', 'O', 'L', 'R'), scalars, 3) ||
+			!state.getArray(SNAPSHOT_TAG('P', 'A', 'R', 'M'), params, 2))
+			return false;
+		red = scalars[0]; green = scalars[1]; blue = scalars[2];
+		tParam = params[0]; mass = params[1];
+		std::vector<TraceVertex> fine;
+		trace.getFine(fine);
+		traceStream.clear();
+		if (!fine.empty())
+			traceStream.append(&fine[0], fine.size());
+		return true;
 	}
-	Object3D() { traceCount = 0; }
 	void set(float x, float y, float z, float m, MathVec v, int r, int g, int b)
 	{
 		pos.x = x;
@@ -118,80 +156,69 @@ struct Object3D
 		green = r;
 		red = g;
 		blue = b;
-		traceCount = 0;
+		trace.clear();
+		traceStream.clear();
 	}
 
+	// the frame and the model spin around the z axis by 0.1 radian per
+	// frame; stepping the orientation quaternion needs no sin/cos
+	void QueueTransforms(ModelViewBatch &batch, bool running = false)
+	{
+		static const Quaternion spinStep(MathVec(0.f, 0.f, 1.f), 0.1f * 180.f / 3.14159265f);
+		if (running)
+			spin = (spinStep * spin).normalize();
+		else
+			spin.identity();
+		Matrix4 mSpin = spin.getMatrix4();
+
+		// set translation to move the frame to where the object is; the model is also scaled down.
+		Matrix4 mFrame, mModel;
+		mFrame.translate(pos);
+		mModel.scale(0.04f);
+		mModel.translate(pos);
+		frameSlot = batch.add(mFrame * mSpin);
+		modelSlot = batch.add(mModel * mSpin);
+	}
+
+	// the simplified part of the trace as a line strip, the full-resolution end
+	// as points streamed in since the last frame
 	void DrawTrace()
 	{
-		glPushMatrix();
-		glLineWidth(2.f);
-		glDisable(GL_LIGHTING);
-		glBegin(GL_POINTS);
-		for (int i = 0; i < traceCount; i++)
+		if (coarseRevision != trace.getRevision())
 		{
-			auto &tp = posTrace[i];
-			glColor3i(tp.color.x, tp.color.y, tp.color.z);
-			glVertex3fv((float*)&tp.position);
+			trace.getCoarse(coarseTrace);
+			coarseRevision = trace.getRevision();
 		}
-		glEnd();
-
-		glEnable(GL_LIGHTING);
-		glPopMatrix();
+		if (coarseTrace.size() > 1)
+		{
+			glPushAttrib(GL_ENABLE_BIT | GL_LINE_BIT);
+			glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+			glDisable(GL_LIGHTING);
+			glDisable(GL_TEXTURE_2D);
+			glLineWidth(2.f);
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glEnableClientState(GL_COLOR_ARRAY);
+			glVertexPointer(3, GL_FLOAT, sizeof(TraceVertex), &coarseTrace[0].x);
+			glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TraceVertex), &coarseTrace[0].red);
+			glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)coarseTrace.size());
+			glPopClientAttrib();
+			glPopAttrib();
+		}
+		traceStream.draw(3.f);
 	}
 
-	void DrawObject(float extend, bool running = false)
+	// the model-view matrices come from QueueTransforms, resolved for this frame
+	void DrawObject(const ModelViewBatch &batch)
 	{
-		glPushMatrix();
 		glPointSize(3.f);
-		glMatrixMode(GL_MODELVIEW);
-		Matrix4 mModel, mView, mModelView;
-		static float angle = 0.f;
-		if (running)
-			angle += 0.1f;
-		else
-			angle = 0.f;
-		// set rotation matrix for the frame to be rotaton around z axis by angle degrees
-		Vector3 T(cosf(angle), sinf(angle), 0);
-		Vector3 N(-sinf(angle), cosf(angle), 0);
-		Vector3 B(0.f, 0.f, 1.f);
-		mView.setColumn(0, T);
-		mView.setColumn(1, N);
-		mView.setColumn(2, B);
-
-		// set translation to move the frame to where the object is.
-		mModel.scale(0.04f);
-		mModel.translate(pos.x, pos.y, pos.z);
-		mModelView = mModel * mView;
-		glMultMatrixf(mModelView.get());
+		glLoadMatrixf(batch.getModelView(modelSlot).get());
 		pModel->draw();
-		glPopMatrix();
-
 	}
 	////////////////////////////////////////////////////////////////
-	void DrawFrame(float extend, bool running = false)
+	void DrawFrame(float extend, const ModelViewBatch &batch)
 	{
-		glPushMatrix();
 		glPointSize(3.f);
-		glMatrixMode(GL_MODELVIEW);
-		Matrix4 mModel, mView, mModelView;
-		static float angle = 0.f;
-		if (running)
-			angle += 0.1f;
-		else
-			angle = 0.f;
-		// set rotation matrix for the frame to be rotaton around z axis by angle degrees
-		Vector3 T(cosf(angle), sinf(angle), 0);
-		Vector3 N(-sinf(angle), cosf(angle), 0);
-		Vector3 B(0.f, 0.f, 1.f);
-		mView.setColumn(0, T);
-		mView.setColumn(1, N);
-		mView.setColumn(2, B);
-
-		// set translation to move the frame to where the object is.
-		mModel.translate(pos.x, pos.y, pos.z);
-		mModelView = mModel * mView;
-		// set the final matrix to be used as modelview matrix for opengl pipeline.
-		glMultMatrixf(mModelView.get());
+		glLoadMatrixf(batch.getModelView(frameSlot).get());
 		glDisable(GL_LIGHTING);
 		glBegin(GL_LINES);
 		glColor3f(1.f, 0.f, 0.f);
@@ -205,8 +232,6 @@ struct Object3D
 		glVertex3d(0.f, 0.f, extend);
 		glEnd();
 		glEnable(GL_LIGHTING);
-
-		glPopMatrix();
 	}
 };
 Object3D simBall;
@@ -215,21 +240,6 @@ Object3D simBall;
 static GLfloat wall_mat[] = { 1.f, 1.f, 1.f, 1.f };
 GLuint floorTexture = 0;		// Texture ID for the floor.
 
-/* Create a single component texture map */
-GLfloat *make_texture(int maxs, int maxt)
-{
-	int s, t;
-	static GLfloat *texture;
-
-	texture = (GLfloat *)malloc(maxs * maxt * sizeof(GLfloat));
-	for (t = 0; t < maxt; t++) {
-		for (s = 0; s < maxs; s++) {
-			texture[s + maxs * t] = 1.f - (((s >> 4) & 0x1) ^ ((t >> 4) & 0x1))*0.3f;
-		}
-	}
-	return texture;
-}
-
 ///////////////////////////////////////////////////////////////
 void initPhysics(float rad, float speed, float angle)
 {
@@ -269,7 +279,7 @@ void updatePhysics(Object3D &ball, float timeInc)
 	ball.pos.x = 2.f * t_rt13;
 	ball.pos.y = 9.f * sin(t_rt13) + 10.f;
 	ball.pos.z = 9.f * cos(t_rt13) +Initz;
-	TracePoint &tp = ball.SetNextTracePoint(timeInc);
+	ball.SetNextTracePoint(timeInc);
 }
 
 void resetPhysics()
@@ -277,6 +287,32 @@ void resetPhysics()
 	initPhysics(1.f, iSpeed, iAngle);
 }
 
+// checkpoints hold the ball with its trace, the clock and the restart flag
+const char *checkpointFile = "transport.snp";
+const int checkpointSteps = 30;
+const unsigned int tagClock = SNAPSHOT_TAG('C', 'L', 'O', 'K');
+const unsigned int tagReset = SNAPSHOT_TAG('R', 'S', 'E', 'T');
+
+void captureState(SnapshotState &state, bool resetFlag)
+{
+	simBall.capture(state);
+	state.addValue(tagClock, clocktime);
+	state.addValue(tagReset, (int)resetFlag);
+}
+
+bool restoreState(const char *fileName, bool &resetFlag)
+{
+	SnapshotState state;
+	float clock;
+	int reset;
+	if (!loadSnapshot(fileName, state) || !state.getValue(tagClock, clock) ||
+		!state.getValue(tagReset, reset) || !simBall.restore(state))
+		return false;
+	clocktime = clock;
+	resetFlag = reset != 0;
+	return true;
+}
+
 void zoom(bool zoomIn)
 {
 	if (zoomIn)
@@ -350,8 +386,9 @@ int Menu(void)
 
 	glViewport(0, 0, width, height);
 	glMatrixMode(GL_PROJECTION);
+	glLoadMatrixf(orthoMatrix(-0.5f, width - 0.5f, height - 0.5f, -0.5f, -1.f, 1.f).get());
+	glMatrixMode(GL_MODELVIEW);
 	glLoadIdentity();
-	glOrtho(-0.5, (GLdouble)width - 0.5, (GLdouble)height - 0.5, -0.5, -1, 1);
 	glClearColor(0.0, 0.0, 0.0, 0.0);
 		
 	while (key != eStart && key != eStop)
@@ -363,7 +400,7 @@ int Menu(void)
 		glClear(GL_COLOR_BUFFER_BIT);
 
 		// printing UI message info
-		glColor3f(1.f, 1.f, 1.f);
+		gText.clear();
 		char msg[128];
 		//sprintf_s(msg, "Friction is %f. Use Up/Down keys to change it by 1/10!\n", friction);
 		//glRasterPos2i(32, 32);
@@ -371,28 +408,23 @@ int Menu(void)
 
 		//sprintf_s(msg, "Slope Angle is %f degrees. Use Left/Right keys to change it!\n", iAngle*180. / PI);
 		sprintf_s(msg, "Use Left/Right  or Up/Down Keys to move camera left/right or Up/Down!\n");
-		glRasterPos2i(32, 64);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 64, msg, 255, 255, 255);
 
 //		sprintf_s(msg, "Projectile speed is %f m/s. Use PageUp/PageDown keys to change it!\n", iSpeed);
 		sprintf_s(msg, "Use PageUp or PageDown to zoom in or zoom out!\n");
-		glRasterPos2i(32, 96);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 96, msg, 255, 255, 255);
 
 		sprintf_s(msg, "Use F , G , P to choose between Frenet, Geodesic, or Parallel Frames!\n");
-		glRasterPos2i(32, 128);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 128, msg, 255, 255, 255);
 
 		sprintf_s(msg, "Camera height is %f. Use I/K keys to change it!\n", eye.y);
-		glRasterPos2i(32, 168);
-		glCallLists(strlen(msg), GL_UNSIGNED_BYTE, msg);
+		gText.add(32, 168, msg, 255, 255, 255);
 
 		const char *msg1 = "S.....Start Game";
 		const char *msg2 = "ESC...Exit";
-		glRasterPos2i(32, 192);
-		glCallLists(strlen(msg1), GL_UNSIGNED_BYTE, msg1);
-		glRasterPos2i(32, 224);
-		glCallLists(strlen(msg2), GL_UNSIGNED_BYTE, msg2);
+		gText.add(32, 192, msg1, 255, 255, 255);
+		gText.add(32, 224, msg2, 255, 255, 255);
+		gText.draw();
 
 		FsSwapBuffers();
 		FsSleep(10);
@@ -428,24 +460,33 @@ float timeInc =timeSpan * 0.001f; // time increment in seconds
 void renderScene(bool reset)
 {
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glLoadIdentity();
 	glEnable(GL_DEPTH_TEST);
 	glDepthFunc(GL_LEQUAL);
 
 	checkWindowResize();
 
-	// set the camera
-	gluLookAt(eye.x, eye.y, eye.z, simBall.pos.x, simBall.pos.y, simBall.pos.z, 0.0f, 1.0f, 0.0f);
+	// set the camera and work out every object matrix of the frame in one batch
+	gCamera.lookAt(eye, simBall.pos);
+	gFrameTransforms.clear();
+	simBall.QueueTransforms(gFrameTransforms, reset);
+	gFrameTransforms.resolve(gCamera);
+
+	// the projection and the view go to GL once per frame
+	glMatrixMode(GL_PROJECTION);
+	glLoadMatrixf(gCamera.getProjection().get());
+	glMatrixMode(GL_MODELVIEW);
+	glLoadMatrixf(gCamera.getView().get());
 
 	//////////////////// draw the ground ///////////////
 	DrawFloor();
 
 	// draw the frame and its trace:
 	simBall.DrawTrace();
-	simBall.DrawFrame(2.f, reset);
-	simBall.DrawObject(2.f, reset);
+	simBall.DrawFrame(2.f, gFrameTransforms);
+	simBall.DrawObject(gFrameTransforms);
 
 	// draw walls:
+	glLoadMatrixf(gCamera.getView().get());
 	glEnable(GL_LIGHTING);
 	glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, wall_mat);
 	glBegin(GL_QUADS);
@@ -495,11 +536,9 @@ void generateFloorTexture()
 
 	/* load pattern for current 2d texture */
 	const int TEXDIM = 256;
-	GLfloat *tex = make_texture(TEXDIM, TEXDIM);
 	glGenTextures(1, &floorTexture);					// Create Texture id
 	glBindTexture(GL_TEXTURE_2D, floorTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, 1, TEXDIM, TEXDIM, 0, GL_RED, GL_FLOAT, tex);
-	free(tex);
+	uploadProceduralTexture(getCheckerTexture(TEXDIM, TEXDIM, 16, 255, 179));
 
 }
 ///////////////////////////////////////////////////////////////////
@@ -522,24 +561,23 @@ int Game(void)
 	FsPassedTime(true);
 
 	//////////// initial setting up the scene ////////////////////////////////////////
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity();
-
 	checkWindowResize();
 
-	// set the camera
+	// set the camera lens; renderScene() hands it to GL
 	float ratio = (float)width / (float)height;
-	gluPerspective(45.f, ratio, 0.1f, 150.f);
+	gCamera.setPerspective(45.f, ratio, 0.1f, 150.f);
 	int key = eIdle;
 
-	glMatrixMode(GL_MODELVIEW);
 	bool resetFlag = false;
+	SnapshotWriter checkpoints;
+	bool checkpointing = false;
+	int steps = 0;
 	while (1)
 	{
 		if (checkWindowResize())
 		{
 			ratio = (float)width / (float)height;
-			gluPerspective(50.f, ratio, 0.1f, 100.f);
+			gCamera.setPerspective(45.f, ratio, 0.1f, 150.f);
 
 		}
 		key = PollKeys();
@@ -547,6 +585,17 @@ int Game(void)
 			break;
 		if (key == eStart)
 			resetFlag = false;
+		if (key == FSKEY_C)
+		{
+			checkpointing = !checkpointing;
+			if (checkpointing)
+				checkpoints.begin(checkpointFile);
+		}
+		if (key == FSKEY_L)
+		{
+			checkpoints.flush();
+			restoreState(checkpointFile, resetFlag);
+		}
 
 		timeInc = passedTime * 0.001f;
 		clocktime += timeInc;
@@ -559,6 +608,12 @@ int Game(void)
 
 		if (!resetFlag)
 			updatePhysics(simBall, timeInc);
+		if (checkpointing && ++steps % checkpointSteps == 0)
+		{
+			SnapshotState state;
+			captureState(state, resetFlag);
+			checkpoints.submit(state);
+		}
 		/////////////////////////////////////////
 		renderScene(!resetFlag);
 
@@ -579,7 +634,7 @@ int Game(void)
 }
 
 //////////////////////////////////////////////////////////////////////////////////////
-int main(void)
+int main(int argc, char *argv[])
 {
 	int menu;
 	FsOpenWindow(32, 32, winWidth, winHeight, 1); // 800x600 pixels, useDoubleBuffer=1
@@ -591,9 +646,7 @@ int main(void)
 		return 0;								// If Model Didn't Load Quit
 	}
 
-	int listBase = glGenLists(256);
-	YsGlUseFontBitmap8x12(listBase);
-	glListBase(listBase);
+	gText.init();
 
 	//pModel->reloadTextures();										// Loads Model Textures
 
@@ -3,73 +3,24 @@
 #include <cmath>
 #include <cfloat>
 #include <climits>
-#include <tuple>
+#include "Vec.h"
 
-/*The Vector2d class is an object consisting of simply an x and
-y value. Certain operators are overloaded to make it easier
-for vector math to be performed.*/
-template<typename T>
-class Vector2d {
-public:
-	/*The x and y values are public to give easier access for
-	outside funtions. Accessors and mutators are not really
-	necessary*/
-	T x;
-	T y;
-
-	//Constructor assigns the inputs to x and y.
-	Vector2d() : x(T(0)), y(T(0)) {}
-	Vector2d(T a, T b) : x(a), y(b) {}
-
-	/*The following operators simply return Vector2ds that
-	have operations performed on the relative (x, y) values*/
-	Vector2d& operator+=(const Vector2d& v) { x += v.x; y += v.y; return *this; }
-	Vector2d& operator-=(const Vector2d& v) { x -= v.x; y -= v.y; return *this; }
-	Vector2d& operator*=(const Vector2d& v) { x *= v.x; y *= v.y; return *this; }
-	Vector2d& operator/=(const Vector2d& v) { x /= v.x; y /= v.y; return *this; }
-
-	//Check if the Vectors have the same values (uses pairwise comparison of 
-	// 'std::tuple' on the x, y values of L and R.)
-	friend bool operator==(const Vector2d& L, const Vector2d& R) {
-		return std::tie(L.x, L.y) == std::tie(R.x, R.y);
-	}
-	friend bool operator!=(const Vector2d& L, const Vector2d& R) { return !(L == R); }
-
-	void set(T a, T b) { x = a; y = b; }
-	/*Check which Vectors are closer or further from the origin.*/
-	friend bool operator>(const Vector2d& L, const Vector2d& R) { return LengthSq(L) < LengthSq(R); }
-	friend bool operator>=(const Vector2d& L, const Vector2d& R) { return !(L > R); }
-	friend bool operator<(const Vector2d& L, const Vector2d& R) { return R < L; }
-	friend bool operator<=(const Vector2d& L, const Vector2d& R) { return !(R < L); }
-
-	//Negate both the x and y values.
-	Vector2d operator-() const { return Vector2d(-x, -y); }
-
-	//Apply scalar operations.
-	Vector2d& operator*(T s) { x *= s; y *= s; return *this; }
-	Vector2d& operator/(T s) { x /= s; y /= s; return *this; }
-
-	//Returns the length of the vector from the origin.
-	double Length() const { return sqrt(x*x + y*y); }
-	double LengthSq()const { return x*x + y*y; }
-
-};
-
-template<class T> Vector2d<T> operator*(const T& s, const Vector2d<T>& v) { return Vector2d<T>(v) *= s; }
-template<class T> Vector2d<T> operator*(const Vector2d<T>& v, const T& s) { return Vector2d<T>(v) *= s; }
-
-template<class T> Vector2d<T>  operator-(const Vector2d<T>& v1, const Vector2d<T>& v2) { return Vector2d<T>(v1.x-v2.x, v1.y-v2.y); }
-template<class T> Vector2d<T>  operator+(const Vector2d<T>& v1, const Vector2d<T>& v2) { return Vector2d<T>(v1.x+v2.x, v1.y+v2.y); }
+/*The Vector2d is an object consisting of simply an x and y value.
+It is Vec<2,T> from Vec.h, so it mixes freely with the float Vector2 of
+Vectors.h and Matrices.h. The operators (+, -, scalar * and /, compound
+assignment, ==) and Length()/LengthSq() live there; the functions below
+are the ones only 2D vectors have.*/
+template<typename T> using Vector2d = Vec<2, T>;
 
 //Product functions
-template<class T> T DotProduct(const Vector2d<T>& a, const Vector2d<T>& b) { return  ((a.x * b.x) + (a.y * b.y)); }
-template<class T> T CrossProduct(const Vector2d<T>& a, const Vector2d<T>& b) { return ((a.x * b.y) - (a.y * b.x)); }
+template<class T> constexpr T DotProduct(const Vector2d<T>& a, const Vector2d<T>& b) { return  ((a.x * b.x) + (a.y * b.y)); }
+template<class T> constexpr T CrossProduct(const Vector2d<T>& a, const Vector2d<T>& b) { return ((a.x * b.y) - (a.y * b.x)); }
 
 //Return the unit vector of the input
 template<class T> Vector2d<T> Normal(const Vector2d<T>& a) { double mag = a.Length(); return Vector2d<T>(a.x / mag, a.y / mag); }
 
 //Return a vector perpendicular to the left.
-template<class T> Vector2d<T> Perpendicular(const Vector2d<T>& a) { return Vector2d<T>(a.y, -a.x); }
+template<class T> constexpr Vector2d<T> Perpendicular(const Vector2d<T>& a) { return Vector2d<T>(a.y, -a.x); }
 //Return true if two line segments intersect.
 template<class T> 
 bool Intersect(const Vector2d<T>&aa, const Vector2d<T>& ab, const Vector2d<T>& ba, const Vector2d<T>& bb)
@@ -97,7 +48,7 @@ Vector2d<T> GetIntersect(const Vector2d<T>&aa, const Vector2d<T>& ab, const Vect
 	double denominator = (aa.x - ab.x)*(ba.y - bb.y) -
 		(aa.y - ab.y)*(ba.x - bb.x);
 
-	return Vector2d(pX / denominator, pY / denominator);
+	return Vector2d<T>(pX / denominator, pY / denominator);
 }
 
 #endif
\ No newline at end of file